@@ -0,0 +1,189 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        AllocationCounter.cpp
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 18
+
+    Description: Implementation of the class cedar::aux::AllocationCounter.
+
+    Credits:
+
+======================================================================================================================*/
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CEDAR INCLUDES
+#include "cedar/auxiliaries/AllocationCounter.h"
+
+// SYSTEM INCLUDES
+#ifdef CEDAR_COUNT_ALLOCATIONS
+  #include <cstdlib>
+  #include <new>
+#endif // CEDAR_COUNT_ALLOCATIONS
+
+//----------------------------------------------------------------------------------------------------------------------
+// allocation hooks
+//----------------------------------------------------------------------------------------------------------------------
+
+#ifdef CEDAR_COUNT_ALLOCATIONS
+
+namespace
+{
+  /* The counter is accessed from within malloc, so its thread-local storage must not be allocated lazily (which the
+   * default model for shared libraries may do by calling malloc).
+   */
+#if defined(__GNUC__)
+  thread_local unsigned long thread_allocations __attribute__((tls_model("initial-exec"))) = 0;
+#else
+  thread_local unsigned long thread_allocations = 0;
+#endif
+}
+
+#if defined(CEDAR_OS_LINUX) && defined(__GLIBC__)
+
+// glibc allows replacing malloc; hooking it also covers operator new and the allocators of libraries such as OpenCV.
+extern "C"
+{
+  void* __libc_malloc(size_t size);
+  void* __libc_calloc(size_t number, size_t size);
+  void* __libc_realloc(void* pointer, size_t size);
+
+  void* malloc(size_t size)
+  {
+    ++thread_allocations;
+    return __libc_malloc(size);
+  }
+
+  void* calloc(size_t number, size_t size)
+  {
+    ++thread_allocations;
+    return __libc_calloc(number, size);
+  }
+
+  void* realloc(void* pointer, size_t size)
+  {
+    ++thread_allocations;
+    return __libc_realloc(pointer, size);
+  }
+}
+
+#else // CEDAR_OS_LINUX && __GLIBC__
+
+// elsewhere, only allocations through the global operator new are counted
+void* operator new(std::size_t size)
+{
+  ++thread_allocations;
+  void* pointer = std::malloc(size > 0 ? size : 1);
+  if (pointer == nullptr)
+  {
+    throw std::bad_alloc();
+  }
+  return pointer;
+}
+
+void* operator new[](std::size_t size)
+{
+  return ::operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+  ++thread_allocations;
+  return std::malloc(size > 0 ? size : 1);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t& nothrow) noexcept
+{
+  return ::operator new(size, nothrow);
+}
+
+void operator delete(void* pointer) noexcept
+{
+  std::free(pointer);
+}
+
+void operator delete[](void* pointer) noexcept
+{
+  std::free(pointer);
+}
+
+void operator delete(void* pointer, const std::nothrow_t&) noexcept
+{
+  std::free(pointer);
+}
+
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept
+{
+  std::free(pointer);
+}
+
+#endif // CEDAR_OS_LINUX && __GLIBC__
+
+#endif // CEDAR_COUNT_ALLOCATIONS
+
+//----------------------------------------------------------------------------------------------------------------------
+// constructors and destructor
+//----------------------------------------------------------------------------------------------------------------------
+
+cedar::aux::AllocationCounter::AllocationCounter()
+:
+mStart(cedar::aux::AllocationCounter::getThreadAllocations())
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// methods
+//----------------------------------------------------------------------------------------------------------------------
+
+bool cedar::aux::AllocationCounter::isEnabled()
+{
+#ifdef CEDAR_COUNT_ALLOCATIONS
+  return true;
+#else
+  return false;
+#endif // CEDAR_COUNT_ALLOCATIONS
+}
+
+unsigned long cedar::aux::AllocationCounter::getThreadAllocations()
+{
+#ifdef CEDAR_COUNT_ALLOCATIONS
+  return thread_allocations;
+#else
+  return 0;
+#endif // CEDAR_COUNT_ALLOCATIONS
+}
+
+unsigned long cedar::aux::AllocationCounter::getCount() const
+{
+  return cedar::aux::AllocationCounter::getThreadAllocations() - this->mStart;
+}
+
+void cedar::aux::AllocationCounter::restart()
+{
+  this->mStart = cedar::aux::AllocationCounter::getThreadAllocations();
+}
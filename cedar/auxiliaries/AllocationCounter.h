@@ -0,0 +1,102 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        AllocationCounter.h
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 18
+
+    Description: Header file for the class cedar::aux::AllocationCounter.
+
+    Credits:
+
+======================================================================================================================*/
+
+#ifndef CEDAR_AUX_ALLOCATION_COUNTER_H
+#define CEDAR_AUX_ALLOCATION_COUNTER_H
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CEDAR INCLUDES
+
+// FORWARD DECLARATIONS
+#include "cedar/auxiliaries/AllocationCounter.fwd.h"
+
+// SYSTEM INCLUDES
+
+
+/*!@brief Counts the heap allocations made by the current thread.
+ *
+ *        Counting only happens if cedar is built with CEDAR_COUNT_ALLOCATIONS. In that case, cedar replaces the
+ *        allocation functions (malloc and friends on Linux, the global operator new elsewhere) with versions that
+ *        increment a thread-local counter. This is meant for diagnosing allocations in code that is supposed to run
+ *        without them, e.g., in the compute calls of steps; it should not be enabled in regular builds.
+ *
+ *        An instance counts the allocations the constructing thread makes from construction on:
+ *        @code
+ *        cedar::aux::AllocationCounter counter;
+ *        doSomething();
+ *        unsigned long allocations = counter.getCount();
+ *        @endcode
+ *
+ * @remarks Instances must only be used by the thread that created them.
+ */
+class cedar::aux::AllocationCounter
+{
+  //--------------------------------------------------------------------------------------------------------------------
+  // constructors and destructor
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //!@brief The standard constructor; starts counting.
+  AllocationCounter();
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // public methods
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //! Returns the number of allocations the current thread made since construction or the last call of restart.
+  unsigned long getCount() const;
+
+  //! Starts counting anew.
+  void restart();
+
+  //! Returns true if cedar was built with CEDAR_COUNT_ALLOCATIONS, i.e., if allocations are actually counted.
+  static bool isEnabled();
+
+  //! Returns the number of allocations the current thread made so far; always zero if counting is not enabled.
+  static unsigned long getThreadAllocations();
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // members
+  //--------------------------------------------------------------------------------------------------------------------
+private:
+  //! Count of the thread when counting started.
+  unsigned long mStart;
+
+}; // class cedar::aux::AllocationCounter
+
+#endif // CEDAR_AUX_ALLOCATION_COUNTER_H
+
@@ -0,0 +1,315 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        BinaryRecording.cpp
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 18
+
+    Description: Source file for the class cedar::aux::BinaryRecording.
+
+    Credits:
+
+======================================================================================================================*/
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CLASS HEADER
+#include "cedar/auxiliaries/BinaryRecording.h"
+
+// CEDAR INCLUDES
+#include "cedar/auxiliaries/exceptions.h"
+#include "cedar/auxiliaries/assert.h"
+#include "cedar/auxiliaries/stringFunctions.h"
+
+// SYSTEM INCLUDES
+#include <cstring>
+#include <limits>
+#include <stdint.h>
+
+//----------------------------------------------------------------------------------------------------------------------
+// static members
+//----------------------------------------------------------------------------------------------------------------------
+
+#ifndef CEDAR_COMPILER_MSVC
+const unsigned int cedar::aux::BinaryRecording::VERSION;
+const unsigned int cedar::aux::BinaryRecording::ALIGNMENT;
+#endif // CEDAR_COMPILER_MSVC
+
+namespace
+{
+  const char FILE_MAGIC[8] = {'C', 'E', 'D', 'A', 'R', 'R', 'E', 'C'};
+  const char CHUNK_MAGIC[4] = {'C', 'H', 'N', 'K'};
+
+  template <typename T>
+  void writeValue(std::ostream& stream, T value)
+  {
+    stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+  }
+
+  void writePadding(std::ostream& stream, size_t written, size_t alignment)
+  {
+    static const char zeros[cedar::aux::BinaryRecording::ALIGNMENT] = {0};
+    size_t remainder = written % alignment;
+    if (remainder != 0)
+    {
+      stream.write(zeros, alignment - remainder);
+    }
+  }
+
+  size_t padded(size_t size, size_t alignment)
+  {
+    return ((size + alignment - 1) / alignment) * alignment;
+  }
+
+  //! Reads a value at the given position; memcpy is used because the position may not be aligned for T.
+  template <typename T>
+  T readValue(const uchar* position)
+  {
+    T value;
+    std::memcpy(&value, position, sizeof(T));
+    return value;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// constructors and destructor
+//----------------------------------------------------------------------------------------------------------------------
+
+cedar::aux::BinaryRecording::BinaryRecording(const std::string& path)
+:
+mFile(QString::fromStdString(path)),
+mpMapped(nullptr),
+mType(-1)
+{
+  if (!this->mFile.open(QIODevice::ReadOnly))
+  {
+    CEDAR_THROW(cedar::aux::FileNotFoundException, "Could not open binary recording \"" + path + "\".");
+  }
+
+  qint64 size = this->mFile.size();
+  this->mpMapped = this->mFile.map(0, size);
+  if (this->mpMapped == nullptr)
+  {
+    CEDAR_THROW(cedar::aux::FileNotFoundException, "Could not map binary recording \"" + path + "\" into memory.");
+  }
+
+  this->readContents(static_cast<size_t>(size));
+}
+
+cedar::aux::BinaryRecording::~BinaryRecording()
+{
+  if (this->mpMapped != nullptr)
+  {
+    this->mFile.unmap(const_cast<uchar*>(this->mpMapped));
+  }
+  this->mFile.close();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// methods
+//----------------------------------------------------------------------------------------------------------------------
+
+void cedar::aux::BinaryRecording::writeHeader(std::ostream& stream, const cv::Mat& matrix)
+{
+  const int32_t dims = static_cast<int32_t>(matrix.dims);
+  const uint32_t header_size = static_cast<uint32_t>
+                               (
+                                 padded
+                                 (
+                                   sizeof(FILE_MAGIC) + 2 * sizeof(uint32_t) + (2 + dims) * sizeof(int32_t)
+                                     + sizeof(uint64_t),
+                                   ALIGNMENT
+                                 )
+                               );
+
+  stream.write(FILE_MAGIC, sizeof(FILE_MAGIC));
+  writeValue<uint32_t>(stream, VERSION);
+  writeValue<uint32_t>(stream, header_size);
+  writeValue<int32_t>(stream, matrix.type());
+  writeValue<int32_t>(stream, dims);
+  for (int d = 0; d < dims; ++d)
+  {
+    writeValue<int32_t>(stream, matrix.size[d]);
+  }
+  writeValue<uint64_t>(stream, static_cast<uint64_t>(matrix.total() * matrix.elemSize()));
+  writePadding
+  (
+    stream,
+    sizeof(FILE_MAGIC) + 2 * sizeof(uint32_t) + (2 + dims) * sizeof(int32_t) + sizeof(uint64_t),
+    ALIGNMENT
+  );
+}
+
+void cedar::aux::BinaryRecording::writeChunk
+     (
+       std::ostream& stream,
+       const std::vector<cedar::unit::Time>& timeStamps,
+       const std::vector<cv::Mat>& frames
+     )
+{
+  CEDAR_ASSERT(timeStamps.size() == frames.size());
+  if (frames.empty())
+  {
+    return;
+  }
+
+  stream.write(CHUNK_MAGIC, sizeof(CHUNK_MAGIC));
+  writeValue<uint32_t>(stream, static_cast<uint32_t>(frames.size()));
+
+  for (const auto& time_stamp : timeStamps)
+  {
+    writeValue<double>(stream, time_stamp / cedar::unit::Time(1.0 * cedar::unit::second));
+  }
+
+  size_t written = 0;
+  for (const auto& frame : frames)
+  {
+    CEDAR_DEBUG_ASSERT(frame.type() == frames.front().type() && frame.total() == frames.front().total());
+    if (frame.isContinuous())
+    {
+      stream.write(reinterpret_cast<const char*>(frame.data), frame.total() * frame.elemSize());
+    }
+    else
+    {
+      cv::Mat continuous = frame.clone();
+      stream.write(reinterpret_cast<const char*>(continuous.data), continuous.total() * continuous.elemSize());
+    }
+    written += frame.total() * frame.elemSize();
+  }
+  writePadding(stream, written, sizeof(double));
+}
+
+void cedar::aux::BinaryRecording::readContents(size_t fileSize)
+{
+  const size_t fixed_size = sizeof(FILE_MAGIC) + 2 * sizeof(uint32_t) + 2 * sizeof(int32_t);
+  if (fileSize < fixed_size || std::memcmp(this->mpMapped, FILE_MAGIC, sizeof(FILE_MAGIC)) != 0)
+  {
+    CEDAR_THROW(cedar::aux::ParseException, "File is not a binary recording.");
+  }
+
+  const uchar* position = this->mpMapped + sizeof(FILE_MAGIC);
+  uint32_t version = readValue<uint32_t>(position);
+  position += sizeof(uint32_t);
+  if (version != VERSION)
+  {
+    CEDAR_THROW
+    (
+      cedar::aux::ParseException,
+      "Binary recordings of version " + cedar::aux::toString(version) + " are not supported."
+    );
+  }
+  uint32_t header_size = readValue<uint32_t>(position);
+  position += sizeof(uint32_t);
+  this->mType = readValue<int32_t>(position);
+  position += sizeof(int32_t);
+  int32_t dims = readValue<int32_t>(position);
+  position += sizeof(int32_t);
+  if (dims < 0 || fixed_size + (dims * sizeof(int32_t)) + sizeof(uint64_t) > fileSize || header_size > fileSize)
+  {
+    CEDAR_THROW(cedar::aux::ParseException, "The header of the binary recording is damaged.");
+  }
+
+  this->mSizes.resize(static_cast<size_t>(dims));
+  for (int32_t d = 0; d < dims; ++d)
+  {
+    this->mSizes.at(d) = readValue<int32_t>(position);
+    position += sizeof(int32_t);
+  }
+  uint64_t frame_size = readValue<uint64_t>(position);
+
+  // walk through the chunks; a chunk that was not written completely (e.g., after a crash) ends the recording
+  const uchar* end = this->mpMapped + fileSize;
+  position = this->mpMapped + header_size;
+  while (static_cast<size_t>(end - position) >= sizeof(CHUNK_MAGIC) + sizeof(uint32_t))
+  {
+    if (std::memcmp(position, CHUNK_MAGIC, sizeof(CHUNK_MAGIC)) != 0)
+    {
+      break;
+    }
+    uint32_t count = readValue<uint32_t>(position + sizeof(CHUNK_MAGIC));
+    const uchar* time_stamps = position + sizeof(CHUNK_MAGIC) + sizeof(uint32_t);
+    // compare by division so that count * frame_size cannot overflow; no file holds that many frames
+    if (frame_size != 0 && count > std::numeric_limits<size_t>::max() / frame_size)
+    {
+      CEDAR_THROW(cedar::aux::ParseException, "A chunk of the binary recording is damaged.");
+    }
+    // the file ends inside the time stamps of this chunk
+    if (count > static_cast<size_t>(end - time_stamps) / sizeof(double))
+    {
+      break;
+    }
+    const uchar* frames = time_stamps + count * sizeof(double);
+    size_t data_size = padded(count * frame_size, sizeof(double));
+    if (static_cast<size_t>(end - frames) < count * frame_size)
+    {
+      break;
+    }
+
+    for (uint32_t i = 0; i < count; ++i)
+    {
+      this->mTimeStamps.push_back(readValue<double>(time_stamps + i * sizeof(double)));
+      this->mFrames.push_back(frames + i * frame_size);
+    }
+
+    if (static_cast<size_t>(end - frames) < data_size)
+    {
+      break;
+    }
+    position = frames + data_size;
+  }
+}
+
+int cedar::aux::BinaryRecording::getMatrixType() const
+{
+  return this->mType;
+}
+
+const std::vector<int>& cedar::aux::BinaryRecording::getSizes() const
+{
+  return this->mSizes;
+}
+
+size_t cedar::aux::BinaryRecording::getNumberOfFrames() const
+{
+  return this->mFrames.size();
+}
+
+cedar::unit::Time cedar::aux::BinaryRecording::getTimeStamp(size_t frame) const
+{
+  return cedar::unit::Time(this->mTimeStamps.at(frame) * cedar::unit::seconds);
+}
+
+cv::Mat cedar::aux::BinaryRecording::getFrame(size_t frame) const
+{
+  return cv::Mat
+         (
+           static_cast<int>(this->mSizes.size()),
+           &this->mSizes.front(),
+           this->mType,
+           const_cast<uchar*>(this->mFrames.at(frame))
+         );
+}
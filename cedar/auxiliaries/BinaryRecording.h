@@ -0,0 +1,179 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        BinaryRecording.h
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 18
+
+    Description: Header file for the class cedar::aux::BinaryRecording.
+
+    Credits:
+
+======================================================================================================================*/
+
+#ifndef CEDAR_AUX_BINARY_RECORDING_H
+#define CEDAR_AUX_BINARY_RECORDING_H
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CEDAR INCLUDES
+#include "cedar/units/Time.h"
+
+// FORWARD DECLARATIONS
+#include "cedar/auxiliaries/BinaryRecording.fwd.h"
+
+// SYSTEM INCLUDES
+#include <QFile>
+#include <opencv2/opencv.hpp>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/*!@brief Reads and writes the binary recording format used by cedar::aux::Recorder.
+ *
+ *        A binary recording holds the frames of a single matrix whose type and shape do not change. The file starts
+ *        with a header, which is padded to a multiple of cedar::aux::BinaryRecording::ALIGNMENT bytes:
+ *
+ *        <table>
+ *          <tr><td>char[8]</td><td>magic string "CEDARREC"</td></tr>
+ *          <tr><td>uint32</td><td>version of the format</td></tr>
+ *          <tr><td>uint32</td><td>size of the header in bytes, i.e., offset of the first chunk</td></tr>
+ *          <tr><td>int32</td><td>OpenCV type of the matrix</td></tr>
+ *          <tr><td>int32</td><td>number of dimensions n</td></tr>
+ *          <tr><td>int32[n]</td><td>size of each dimension</td></tr>
+ *          <tr><td>uint64</td><td>size of one frame in bytes</td></tr>
+ *        </table>
+ *
+ *        The header is followed by any number of chunks. Each chunk stores its frames column-wise, i.e., first all time
+ *        stamps, then all frames:
+ *
+ *        <table>
+ *          <tr><td>char[4]</td><td>chunk marker "CHNK"</td></tr>
+ *          <tr><td>uint32</td><td>number of frames m in the chunk</td></tr>
+ *          <tr><td>float64[m]</td><td>time stamps in seconds</td></tr>
+ *          <tr><td>m * frame size</td><td>raw matrix data, row-major as in cv::Mat</td></tr>
+ *        </table>
+ *
+ *        Chunks are padded to a multiple of eight bytes. All values are stored in the byte order of the recording
+ *        machine. Because frames are stored without any conversion, a reader can map the file into memory and use the
+ *        frames in place. An incomplete last chunk, as left behind by a crash while recording, is ignored when reading.
+ */
+class cedar::aux::BinaryRecording
+{
+  //--------------------------------------------------------------------------------------------------------------------
+  // constructors and destructor
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //! Opens the given file for reading. The file is mapped into memory; throws if it cannot be read.
+  BinaryRecording(const std::string& path);
+
+  //!Destructor
+  ~BinaryRecording();
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // public methods
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //! Writes the header for recording matrices of the same type and size as the given one.
+  static void writeHeader(std::ostream& stream, const cv::Mat& matrix);
+
+  /*! Writes one chunk with the given frames. All frames must have the type and size given in the header, timeStamps and
+   *  frames must have the same number of entries.
+   */
+  static void writeChunk
+  (
+    std::ostream& stream,
+    const std::vector<cedar::unit::Time>& timeStamps,
+    const std::vector<cv::Mat>& frames
+  );
+
+  //! Returns the OpenCV type of the recorded matrix.
+  int getMatrixType() const;
+
+  //! Returns the sizes of the recorded matrix.
+  const std::vector<int>& getSizes() const;
+
+  //! Returns the number of recorded frames.
+  size_t getNumberOfFrames() const;
+
+  //! Returns the time at which the given frame was recorded.
+  cedar::unit::Time getTimeStamp(size_t frame) const;
+
+  /*! Returns the given frame. The returned matrix points directly into the mapped file and must not be written to; it
+   *  is only valid as long as this object exists. Clone it if it is needed for longer.
+   */
+  cv::Mat getFrame(size_t frame) const;
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // protected methods
+  //--------------------------------------------------------------------------------------------------------------------
+protected:
+  // none yet
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // private methods
+  //--------------------------------------------------------------------------------------------------------------------
+private:
+  //! Reads the header and the positions of all frames from the mapped file.
+  void readContents(size_t fileSize);
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // members
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //! Current version of the format.
+  static const unsigned int VERSION = 1;
+
+  //! The header is padded to a multiple of this many bytes so that the first chunk is aligned.
+  static const unsigned int ALIGNMENT = 64;
+
+protected:
+  // none yet
+
+private:
+  //! The file being read.
+  QFile mFile;
+
+  //! Start of the mapped file.
+  const uchar* mpMapped;
+
+  //! OpenCV type of the recorded matrix.
+  int mType;
+
+  //! Sizes of the recorded matrix.
+  std::vector<int> mSizes;
+
+  //! Time stamps (in seconds) of all frames.
+  std::vector<double> mTimeStamps;
+
+  //! Start of each frame in the mapped file.
+  std::vector<const uchar*> mFrames;
+
+}; // class cedar::aux::BinaryRecording
+
+#endif // CEDAR_AUX_BINARY_RECORDING_H
+
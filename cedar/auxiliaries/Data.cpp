@@ -52,7 +52,9 @@
 cedar::aux::Data::Data()
 :
 mpLock(new QReadWriteLock()),
-mpeOwner(NULL)
+mpeOwner(NULL),
+mRevision(0),
+mUnchanged(false)
 {
 }
 
@@ -85,6 +87,16 @@ void cedar::aux::Data::serializeHeader(std::ostream& /*stream*/, cedar::aux::Ser
   CEDAR_THROW(cedar::aux::NotImplementedException, "serializeHeader function not implemented for this type of data");
 }
 
+bool cedar::aux::Data::commitChanges()
+{
+  if (this->mUnchanged.exchange(false))
+  {
+    return false;
+  }
+  this->markChanged();
+  return true;
+}
+
 QReadWriteLock& cedar::aux::Data::getLock()
 {
   return *this->mpLock;
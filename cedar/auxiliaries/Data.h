@@ -53,6 +53,7 @@
 
 // SYSTEM INCLUDES
 #include <QReadWriteLock>
+#include <atomic>
 #include <iostream>
 #include <fstream>
 
@@ -157,6 +158,39 @@ public:
   //! Clones this data object.
   virtual cedar::aux::DataPtr clone() const;
 
+  /*!@brief Returns a counter that increases whenever the data changes.
+   *
+   *        The revision increases with setData, with markChanged, and after each compute call of the owning step
+   *        unless the step marked the data unchanged. Consumers compare revisions to skip work on unchanged inputs.
+   *        Snapshots of matrix data carry the revision they were published with (see cedar::aux::MatData::publish).
+   */
+  inline unsigned long getRevision() const
+  {
+    return this->mRevision.load(std::memory_order_acquire);
+  }
+
+  //! Increases the revision; call this after modifying the data outside of its owner's compute call.
+  inline void markChanged()
+  {
+    this->mRevision.fetch_add(1, std::memory_order_acq_rel);
+  }
+
+  /*!@brief Declares that the data did not change in the current compute call of its owner.
+   *
+   *        The revision then stays the same, and publishing matrix data keeps its current snapshot.
+   */
+  inline void markUnchanged()
+  {
+    this->mUnchanged = true;
+  }
+
+  /*!@brief Increases the revision unless markUnchanged was called since the last commit.
+   *
+   * @returns Whether the data counts as changed.
+   * @remarks Called by cedar::proc::Step after each compute and reset call.
+   */
+  bool commitChanges();
+
   //--------------------------------------------------------------------------------------------------------------------
   // protected methods
   //--------------------------------------------------------------------------------------------------------------------
@@ -180,6 +214,12 @@ private:
   //!@todo This should be a DataOwner* (if that would exist as interface)
   cedar::aux::Configurable* mpeOwner;
 
+  //! Counts the changes of the data.
+  std::atomic<unsigned long> mRevision;
+
+  //! Whether the data was marked unchanged since the last commit.
+  std::atomic<bool> mUnchanged;
+
 }; // class cedar::aux::Data
 
 #endif // CEDAR_AUX_DATA_H
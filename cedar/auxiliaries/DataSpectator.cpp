@@ -38,11 +38,16 @@
 // CEDAR INCLUDES
 #include "cedar/auxiliaries/DataSpectator.h"
 #include "cedar/auxiliaries/Recorder.h"
+#include "cedar/auxiliaries/BinaryRecording.h"
+#include "cedar/auxiliaries/MatData.h"
+#include "cedar/auxiliaries/Log.h"
+#include "cedar/auxiliaries/stringFunctions.h"
 #include "cedar/auxiliaries/GlobalClock.h"
 #include "cedar/auxiliaries/Settings.h"
 #include "cedar/units/Time.h"
 
 // SYSTEM INCLUDES
+#include <QThread>
 
 #ifndef Q_MOC_RUN
   #include <boost/algorithm/string/replace.hpp>
@@ -64,9 +69,18 @@ cedar::aux::DataSpectator::DataSpectator
 :
 mData(toSpectate),
 mpOfstreamLock(new QReadWriteLock()),
-mpQueueLock(new QReadWriteLock()),
-mName(name)
+mCapacity(0),
+mHead(0),
+mTail(0),
+mName(name),
+mMode(cedar::aux::SerializationFormat::CSV),
+mBinaryType(-1),
+mSkippedFrames(0),
+mNextSimulatedRecordTime(0.0 * cedar::unit::seconds)
 {
+  mOverflowPolicy = cedar::aux::RecorderOverflowPolicy::Block;
+  mDroppedFrames = 0;
+
   this->setStepSize(recordIntervall);
 
   this->connectToStartSignal(boost::bind(&cedar::aux::DataSpectator::prepareStart, this));
@@ -81,7 +95,6 @@ cedar::aux::DataSpectator::~DataSpectator()
     mOutputStream.close();
   }
   delete mpOfstreamLock;
-  delete mpQueueLock;
 }
 
 void cedar::aux::DataSpectator::step(cedar::unit::Time)
@@ -92,7 +105,37 @@ void cedar::aux::DataSpectator::step(cedar::unit::Time)
 void cedar::aux::DataSpectator::prepareStart()
 {
   auto mode = cedar::aux::RecorderSingleton::getInstance()->getSerializationMode();
+
+  // binary recordings are only available for matrices
+  if (mode == cedar::aux::SerializationFormat::Binary && !boost::dynamic_pointer_cast<const cedar::aux::MatData>(mData))
+  {
+    cedar::aux::LogSingleton::getInstance()->warning
+    (
+      "Cannot record \"" + mName + "\" in the binary format because it is not a matrix; using CSV instead.",
+      CEDAR_CURRENT_FUNCTION_NAME
+    );
+    mode = cedar::aux::SerializationFormat::CSV;
+  }
+  mMode = mode;
+  mSkippedFrames = 0;
+  mDroppedFrames = 0;
+
+  // allocate the ring buffer once; record() only copies into these slots
+  auto recorder = cedar::aux::RecorderSingleton::getInstance();
+  mOverflowPolicy = recorder->getOverflowPolicy();
+  mCapacity = recorder->getBufferCapacity();
+  mMatData = boost::dynamic_pointer_cast<const cedar::aux::MatData>(mData);
+  mSlots.reset(new Slot[mCapacity]);
+  for (size_t i = 0; i < mCapacity; ++i)
+  {
+    mSlots[i].mRecord.mData = mData->clone();
+  }
+  mHead = 0;
+  mTail = 0;
+  mNextSimulatedRecordTime = 0.0 * cedar::unit::seconds;
+
   std::string extension;
+  std::ios::openmode open_mode = std::ios::out | std::ios::app;
   switch (mode)
   {
     case cedar::aux::SerializationFormat::Compact:
@@ -102,96 +145,294 @@ void cedar::aux::DataSpectator::prepareStart()
     case cedar::aux::SerializationFormat::CSV:
       extension = "csv";
       break;
+
+    case cedar::aux::SerializationFormat::Binary:
+      extension = "bin";
+      open_mode = std::ios::out | std::ios::trunc | std::ios::binary;
+      break;
   }
   mOutputPath = cedar::aux::RecorderSingleton::getInstance()->getOutputDirectory() + "/" +
       boost::algorithm::replace_all_copy(mName," ","_") + "." + extension;
-  mOutputStream.open(mOutputPath, std::ios::out | std::ios::app);
-  writeHeader(mode);
+  mOutputStream.open(mOutputPath, open_mode);
+  writeHeader();
 }
 
 void cedar::aux::DataSpectator::processQuit()
 {
-  writeAllRecordData(cedar::aux::RecorderSingleton::getInstance()->getSerializationMode());
+  writeAllRecordData();
   
   {
     QWriteLocker locker(mpOfstreamLock);
     mOutputStream.close();
   }
+
+  if (mDroppedFrames > 0)
+  {
+    cedar::aux::LogSingleton::getInstance()->warning
+    (
+      "Dropped " + cedar::aux::toString(mDroppedFrames.load()) + " frame(s) of \"" + mName
+        + "\" because the recording buffer was full.",
+      CEDAR_CURRENT_FUNCTION_NAME
+    );
+  }
+
+  if (mSkippedFrames > 0)
+  {
+    cedar::aux::LogSingleton::getInstance()->warning
+    (
+      "Skipped " + cedar::aux::toString(mSkippedFrames) + " frame(s) of \"" + mName
+        + "\" because the type or size of the matrix changed during recording.",
+      CEDAR_CURRENT_FUNCTION_NAME
+    );
+  }
 }
 
-void cedar::aux::DataSpectator::writeHeader(cedar::aux::SerializationFormat::Id mode)
+void cedar::aux::DataSpectator::writeHeader()
 {
   QWriteLocker locker(mpOfstreamLock);
-  mData->serializeHeader(mOutputStream, mode);
-  mOutputStream << std::endl;
+  if (mMode == cedar::aux::SerializationFormat::Binary)
+  {
+    auto mat_data = boost::static_pointer_cast<const cedar::aux::MatData>(mData);
+    QReadLocker data_locker(&mat_data->getLock());
+    const cv::Mat& matrix = mat_data->getData();
+    mBinaryType = matrix.type();
+    mBinarySizes.assign(matrix.size.p, matrix.size.p + matrix.dims);
+    cedar::aux::BinaryRecording::writeHeader(mOutputStream, matrix);
+  }
+  else
+  {
+    mData->serializeHeader(mOutputStream, mMode);
+    mOutputStream << std::endl;
+  }
 }
 
 void cedar::aux::DataSpectator::record()
 {
-  // Copy the Data
-  cedar::aux::DataPtr data = mData->clone();
+  // thread context: this is the only producer of the ring buffer.
+  size_t head = mHead.load(std::memory_order_relaxed);
+  Slot& slot = mSlots[head % mCapacity];
+
+  while (true)
+  {
+    int state = SLOT_EMPTY;
+    if (slot.mState.compare_exchange_strong(state, SLOT_WRITING, std::memory_order_acquire))
+    {
+      break;
+    }
+
+    // the ring is full; a slot in SLOT_READING is being written to disk and must not be touched
+    if (state == SLOT_FULL && mOverflowPolicy == cedar::aux::RecorderOverflowPolicy::DropOldest)
+    {
+      if (slot.mState.compare_exchange_strong(state, SLOT_WRITING, std::memory_order_acquire))
+      {
+        // the slot held the oldest unread element; skip it
+        mTail.store(head - mCapacity + 1, std::memory_order_release);
+        ++mDroppedFrames;
+        break;
+      }
+      // the recorder took the slot in the meantime
+      continue;
+    }
+
+    if (mOverflowPolicy == cedar::aux::RecorderOverflowPolicy::Block && !this->stopRequested())
+    {
+      QThread::yieldCurrentThread();
+      continue;
+    }
+
+    ++mDroppedFrames;
+    return;
+  }
+
+  this->copySnapshot(slot.mRecord);
+  slot.mState.store(SLOT_FULL, std::memory_order_release);
+  mHead.store(head + 1, std::memory_order_release);
+}
+
+void cedar::aux::DataSpectator::recordSimulated(cedar::unit::Time time)
+{
+  if (time < mNextSimulatedRecordTime)
+  {
+    return;
+  }
 
-  //Create new recordData
-  RecordData rec;
-  rec.mData = data;
-  rec.mRecordTime = cedar::aux::GlobalClockSingleton::getInstance()->getTime();
-  //Lock the Queue and push record Data
-  QWriteLocker locker(mpQueueLock);
-  mDataQueue.push_back(rec);
+  // make room first, as record() would otherwise wait for a consumer that does not exist
+  if (mHead.load(std::memory_order_relaxed) - mTail.load(std::memory_order_acquire) >= mCapacity)
+  {
+    writeFirstRecordData();
+  }
+  record();
+  mNextSimulatedRecordTime = time + this->getStepSize();
 }
 
-void cedar::aux::DataSpectator::writeFirstRecordData(cedar::aux::SerializationFormat::Id mode)
+void cedar::aux::DataSpectator::copySnapshot(RecordData& record)
 {
-  // thread context: called from Recorder's thread.
-  /* This function uses a lot of locks. It is important to don't lock the queue during the serialization (takes 25-30ms)
-   * to not block the record function for pushing new RecordData into the queue.
-   */
-  unsigned int size;
+  record.mRecordTime = cedar::aux::GlobalClockSingleton::getInstance()->getTime();
+
+  QReadLocker locker(&mData->getLock());
+  if (mMatData)
+  {
+    // copyTo only reallocates if the size or type of the matrix changed
+    auto target = boost::static_pointer_cast<cedar::aux::MatData>(record.mData);
+    mMatData->getData().copyTo(target->getData());
+  }
+  else
+  {
+    record.mData->copyValueFrom(mData);
+  }
+}
+
+bool cedar::aux::DataSpectator::acquireOldestSlot(size_t& slotIndex)
+{
+  while (true)
+  {
+    size_t tail = mTail.load(std::memory_order_acquire);
+    if (tail == mHead.load(std::memory_order_acquire))
+    {
+      return false;
+    }
 
+    Slot& slot = mSlots[tail % mCapacity];
+    int state = SLOT_FULL;
+    if (slot.mState.compare_exchange_strong(state, SLOT_READING, std::memory_order_acquire))
+    {
+      if (mTail.load(std::memory_order_acquire) == tail)
+      {
+        // the slot is reserved, so the producer cannot drop it any more; advance the tail right away
+        mTail.store(tail + 1, std::memory_order_release);
+        slotIndex = tail % mCapacity;
+        return true;
+      }
+
+      // the producer dropped the element and the slot already holds a newer one; give it back
+      slot.mState.store(SLOT_FULL, std::memory_order_release);
+    }
+  }
+}
+
+void cedar::aux::DataSpectator::releaseSlot(size_t slotIndex)
+{
+  mSlots[slotIndex].mState.store(SLOT_EMPTY, std::memory_order_release);
+}
+
+unsigned int cedar::aux::DataSpectator::getNumberOfDroppedFrames() const
+{
+  return mDroppedFrames.load();
+}
+
+bool cedar::aux::DataSpectator::matchesBinaryLayout(const cv::Mat& matrix) const
+{
+  if (matrix.type() != mBinaryType || matrix.dims != static_cast<int>(mBinarySizes.size()))
   {
-    QReadLocker locker(mpQueueLock);
-    size = mDataQueue.size();
+    return false;
   }
 
-  if (size > 0)
+  for (int d = 0; d < matrix.dims; ++d)
   {
-    // Save data to disk.
-    RecordData data;
+    if (matrix.size[d] != mBinarySizes.at(d))
     {
-      QWriteLocker locker(mpQueueLock);
-      data = mDataQueue.front();
-      mDataQueue.pop_front();
+      return false;
     }
+  }
+  return true;
+}
+
+void cedar::aux::DataSpectator::writeQueueAsChunk()
+{
+  // thread context: called from Recorder's thread.
+  QMutexLocker consumer_locker(&mConsumerLock);
+
+  // reserve everything that is currently in the ring; the producer keeps filling the remaining slots meanwhile
+  std::vector<size_t> slots;
+  size_t slot_index;
+  while (slots.size() < mCapacity && this->acquireOldestSlot(slot_index))
+  {
+    slots.push_back(slot_index);
+  }
+
+  if (slots.empty())
+  {
+    return;
+  }
 
+  std::vector<cedar::unit::Time> time_stamps;
+  std::vector<cv::Mat> frames;
+  time_stamps.reserve(slots.size());
+  frames.reserve(slots.size());
+  for (auto index : slots)
+  {
+    // reserved slots are not touched by the producer, so no locking is needed
+    const RecordData& data = mSlots[index].mRecord;
+    const cv::Mat& frame = boost::static_pointer_cast<cedar::aux::MatData>(data.mData)->getData();
+    if (!this->matchesBinaryLayout(frame))
     {
-      QWriteLocker locker(mpOfstreamLock);
-      mOutputStream << data.mRecordTime << ",";
-      data.mData->serializeData(mOutputStream, mode);
-      mOutputStream << std::endl;
+      ++mSkippedFrames;
+      continue;
     }
+    time_stamps.push_back(data.mRecordTime);
+    frames.push_back(frame);
+  }
+
+  {
+    QWriteLocker locker(mpOfstreamLock);
+    cedar::aux::BinaryRecording::writeChunk(mOutputStream, time_stamps, frames);
+  }
+
+  for (auto index : slots)
+  {
+    this->releaseSlot(index);
   }
 }
 
-void cedar::aux::DataSpectator::writeAllRecordData(cedar::aux::SerializationFormat::Id mode)
+void cedar::aux::DataSpectator::writeRecord(const RecordData& data)
+{
+  QWriteLocker locker(mpOfstreamLock);
+  mOutputStream << data.mRecordTime << ",";
+  data.mData->serializeData(mOutputStream, mMode);
+  mOutputStream << std::endl;
+}
+
+void cedar::aux::DataSpectator::writeFirstRecordData()
 {
   // thread context: called from Recorder's thread.
-  // here a single lock is enough. No new recordData will be created so the list can be blocked.
 
-  QWriteLocker locker(mpQueueLock);
+  // binary recordings write everything that is queued as one chunk; this is much cheaper than one chunk per frame
+  if (mMode == cedar::aux::SerializationFormat::Binary)
+  {
+    this->writeQueueAsChunk();
+    return;
+  }
 
-  while (mDataQueue.size() > 0)
+  // The slot stays reserved during the serialization (takes 25-30ms); record() meanwhile uses the other slots.
+  QMutexLocker consumer_locker(&mConsumerLock);
+  size_t slot_index;
+  if (this->acquireOldestSlot(slot_index))
   {
-    RecordData data;
-    data = mDataQueue.front();
+    this->writeRecord(mSlots[slot_index].mRecord);
+    this->releaseSlot(slot_index);
+  }
+}
 
+void cedar::aux::DataSpectator::writeAllRecordData()
+{
+  // thread context: called from Recorder's thread.
+
+  if (mMode == cedar::aux::SerializationFormat::Binary)
+  {
+    // chunks are limited to the capacity of the ring, so repeat until it is empty
+    while (mHead.load() != mTail.load())
     {
-      QWriteLocker locker(mpOfstreamLock);
-      mOutputStream << data.mRecordTime << ",";
-      data.mData->serializeData(mOutputStream, mode);
-      mOutputStream << std::endl;
+      this->writeQueueAsChunk();
     }
-    mDataQueue.pop_front();
+    return;
+  }
 
+  QMutexLocker consumer_locker(&mConsumerLock);
+  size_t slot_index;
+  while (this->acquireOldestSlot(slot_index))
+  {
+    this->writeRecord(mSlots[slot_index].mRecord);
+    this->releaseSlot(slot_index);
   }
 }
 
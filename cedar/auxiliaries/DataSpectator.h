@@ -41,21 +41,32 @@
 // CEDAR INCLUDES
 #include "cedar/auxiliaries/Data.h"
 #include "cedar/auxiliaries/LoopedThread.h"
+#include "cedar/auxiliaries/SerializationFormat.h"
+#include "cedar/auxiliaries/RecorderOverflowPolicy.h"
 #include "cedar/units/Time.h"
 
 // FORWARD DECLARATIONS
 #include "cedar/auxiliaries/DataSpectator.fwd.h"
 #include "cedar/auxiliaries/Recorder.fwd.h"
+#include "cedar/auxiliaries/MatData.fwd.h"
 
 // SYSTEM INCLUDES
 #include <QTime>
+#include <QMutex>
 #include <string>
 #include <fstream>
-#include <list>
+#include <vector>
+#include <atomic>
+#include <memory>
 
 /*!@brief The Recorder uses this class to observe the registered DataPtr.
- *        This class copies the observed DataPtr in each time step and stores the copy in a queue together with time
- *        stamp. The recorder can access this queue and write the elements to disk.
+ *        This class copies the observed DataPtr in each time step into a preallocated ring buffer together with a time
+ *        stamp. The recorder reads the ring buffer and writes the elements to disk.
+ *
+ *        The ring buffer has exactly one producer (this thread) and is consumed by the recorder. Its slots are
+ *        allocated once when the recording starts and are reused afterwards, so recording does not allocate memory
+ *        and the producer never waits for a lock. What happens when the ring is full is determined by the
+ *        recorder's overflow policy.
  */
 class cedar::aux::DataSpectator : public cedar::aux::LoopedThread
 {
@@ -79,6 +90,28 @@ private:
     cedar::aux::DataPtr mData;
   };
 
+  //!@brief States of a slot in the ring buffer.
+  enum SlotState
+  {
+    //! The slot holds no data and can be written by the producer.
+    SLOT_EMPTY,
+    //! The producer is currently copying data into the slot.
+    SLOT_WRITING,
+    //! The slot holds data that has not been written to disk yet.
+    SLOT_FULL,
+    //! The recorder is currently writing the slot to disk.
+    SLOT_READING
+  };
+
+  //!@brief One preallocated element of the ring buffer.
+  struct Slot
+  {
+    Slot() : mState(SLOT_EMPTY) {}
+
+    std::atomic<int> mState;
+    RecordData mRecord;
+  };
+
   //--------------------------------------------------------------------------------------------------------------------
   // constructors and destructor
   //--------------------------------------------------------------------------------------------------------------------
@@ -107,6 +140,9 @@ public:
   //!@brief Returns the record interval for this DataPtr.
   cedar::unit::Time getRecordIntervalTime() const;
 
+  //!@brief Returns the number of snapshots that were lost in the current recording because the ring buffer was full.
+  unsigned int getNumberOfDroppedFrames() const;
+
   //!@brief Makes a snapshot of the data.
   void makeSnapshot();
 
@@ -124,17 +160,46 @@ private:
   void step(cedar::unit::Time time);
 
   //!@brief Writes the header for the DataPtr to the output file.
-  void writeHeader(cedar::aux::SerializationFormat::Id mode);
+  void writeHeader();
 
   //!@brief Writes the first element of the RecordData queue to the output file.
-  void writeFirstRecordData(cedar::aux::SerializationFormat::Id mode);
+  void writeFirstRecordData();
 
   //!@brief Writes the whole RecordData queue to the output file.
-  void writeAllRecordData(cedar::aux::SerializationFormat::Id mode);
+  void writeAllRecordData();
+
+  //!@brief Writes all elements of the RecordData queue as one chunk of a binary recording.
+  void writeQueueAsChunk();
+
+  //!@brief Writes a single record to the output stream in the current text format.
+  void writeRecord(const RecordData& data);
+
+  //!@brief Checks whether a matrix has the type and size given in the header of a binary recording.
+  bool matchesBinaryLayout(const cv::Mat& matrix) const;
 
   //!@brief Copies the DataPtr and stores it as new RecordData in the queue.
   void record();
 
+  /*!@brief Records the data if its record interval has passed since the last simulated record.
+   *
+   *        Used instead of this thread when the recorder is driven by a simulation. Because no other thread empties
+   *        the ring buffer then, it is written to disk whenever it is full.
+   */
+  void recordSimulated(cedar::unit::Time time);
+
+  //!@brief Copies the current state of the spectated data into the (preallocated) data of the given record.
+  void copySnapshot(RecordData& record);
+
+  /*!@brief Reserves the oldest unread slot of the ring buffer for reading.
+   *
+   * @returns False, if the ring buffer is empty. Otherwise, slotIndex is set to the reserved slot, which must be given
+   *          back with releaseSlot.
+   */
+  bool acquireOldestSlot(size_t& slotIndex);
+
+  //!@brief Marks a slot reserved with acquireOldestSlot as empty so that it can be reused by the producer.
+  void releaseSlot(size_t slotIndex);
+
   //!@brief Starts the DataSpectator: Before starting the output file will be opened and the header be written.
   void prepareStart();
 
@@ -161,14 +226,47 @@ private:
   //!@brief The Lock for mOutputStream.
   QReadWriteLock* mpOfstreamLock;
 
-  //!@brief This queue will be write to disk every time step is called.
-  std::list<RecordData> mDataQueue;
+  //!@brief The ring buffer. Slots are allocated in prepareStart and reused until the recording stops.
+  std::unique_ptr<Slot[]> mSlots;
+
+  //!@brief Number of slots in mSlots.
+  size_t mCapacity;
+
+  //!@brief Index of the next element written by the producer. Only the producer changes this.
+  std::atomic<size_t> mHead;
+
+  //!@brief Index of the oldest unread element. Changed by the consumer and by the producer when dropping the oldest.
+  std::atomic<size_t> mTail;
+
+  //!@brief Serializes the consumers of the ring buffer, i.e., the recorder's step and this thread's processQuit.
+  QMutex mConsumerLock;
 
-  //!@brief Locks mDataQueue.
-  QReadWriteLock* mpQueueLock;
+  //!@brief What to do when the ring buffer is full.
+  cedar::aux::RecorderOverflowPolicy::Id mOverflowPolicy;
+
+  //!@brief The spectated data as a matrix, if it is one; used to copy without reallocating.
+  cedar::aux::ConstMatDataPtr mMatData;
+
+  //!@brief Number of snapshots lost because the ring buffer was full.
+  std::atomic<unsigned int> mDroppedFrames;
 
   //!@brief Unique name of the DataPtr.
   std::string mName;
+
+  //!@brief The format used for the current recording.
+  cedar::aux::SerializationFormat::Id mMode;
+
+  //!@brief Type of the recorded matrix when writing binary recordings.
+  int mBinaryType;
+
+  //!@brief Sizes of the recorded matrix when writing binary recordings.
+  std::vector<int> mBinarySizes;
+
+  //!@brief Number of frames that could not be written because their type or size changed during recording.
+  unsigned int mSkippedFrames;
+
+  //!@brief Simulated time at which recordSimulated records the next snapshot.
+  cedar::unit::Time mNextSimulatedRecordTime;
 };
 
 #endif // CEDAR_AUX_DATASPECTATOR_H_
@@ -116,9 +116,10 @@ public:
   }
 
   //!@brief sets the internal data to the given data/value
-  void setData(const T& data)
+  virtual void setData(const T& data)
   {
     this->mData = data;
+    this->markChanged();
   }
 
   //! Copies the value in this data object from the given data.
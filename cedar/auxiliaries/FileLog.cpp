@@ -100,5 +100,12 @@ void cedar::aux::FileLog::message(cedar::aux::LOG_LEVEL level, const std::string
     stream << "(" << title << ") ";
   }
 
-  stream << message << std::endl;
+  // the log flushes the file when appropriate, i.e., after each message or after a batch of messages
+  stream << message << '\n';
+}
+
+void cedar::aux::FileLog::flush()
+{
+  QMutexLocker locker(mLogFile.getLockPtr());
+  this->mLogFile.member().flush();
 }
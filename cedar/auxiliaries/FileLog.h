@@ -75,6 +75,9 @@ public:
   //!@brief Appends the given log message to the log file.
   void message(cedar::aux::LOG_LEVEL level, const std::string& message, const std::string& title);
 
+  //!@brief Writes buffered messages to the log file.
+  void flush();
+
   //--------------------------------------------------------------------------------------------------------------------
   // protected methods
   //--------------------------------------------------------------------------------------------------------------------
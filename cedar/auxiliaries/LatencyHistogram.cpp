@@ -0,0 +1,224 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        LatencyHistogram.cpp
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 18
+
+    Description: 
+
+    Credits:
+
+======================================================================================================================*/
+
+// CEDAR INCLUDES
+#include "cedar/auxiliaries/LatencyHistogram.h"
+#include "cedar/units/prefixes.h"
+
+// SYSTEM INCLUDES
+#include <algorithm>
+
+//----------------------------------------------------------------------------------------------------------------------
+// constants
+//----------------------------------------------------------------------------------------------------------------------
+
+namespace
+{
+  //! Bins below this latency (in microseconds) are one microsecond wide.
+  const long long FINE_RANGE = 1000;
+
+  //! Bins below this latency (in microseconds) and above FINE_RANGE are COARSE_WIDTH wide.
+  const long long COARSE_RANGE = 100000;
+
+  //! Width of the coarse bins in microseconds.
+  const long long COARSE_WIDTH = 100;
+
+  //! Fine bins, coarse bins and one bin for everything above COARSE_RANGE.
+  const unsigned int NUMBER_OF_BINS
+    = static_cast<unsigned int>(FINE_RANGE + (COARSE_RANGE - FINE_RANGE) / COARSE_WIDTH + 1);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// constructors and destructor
+//----------------------------------------------------------------------------------------------------------------------
+
+cedar::aux::LatencyHistogram::LatencyHistogram()
+:
+mBins(NUMBER_OF_BINS),
+mCount(0),
+mMaximum(0)
+{
+  this->reset();
+}
+
+cedar::aux::LatencyHistogram::LatencyHistogram(const cedar::aux::LatencyHistogram& other)
+:
+mBins(NUMBER_OF_BINS),
+mCount(0),
+mMaximum(0)
+{
+  *this = other;
+}
+
+cedar::aux::LatencyHistogram& cedar::aux::LatencyHistogram::operator=(const cedar::aux::LatencyHistogram& other)
+{
+  for (unsigned int bin = 0; bin < this->mBins.size(); ++bin)
+  {
+    this->mBins[bin].store(other.mBins[bin].load(std::memory_order_relaxed), std::memory_order_relaxed);
+  }
+  this->mCount.store(other.mCount.load(std::memory_order_relaxed), std::memory_order_relaxed);
+  this->mMaximum.store(other.mMaximum.load(std::memory_order_relaxed), std::memory_order_relaxed);
+  return *this;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// methods
+//----------------------------------------------------------------------------------------------------------------------
+
+void cedar::aux::LatencyHistogram::record(const cedar::unit::Time& latency)
+{
+  this->record(static_cast<long long>(latency / cedar::unit::Time(1.0 * cedar::unit::micro * cedar::unit::second)));
+}
+
+void cedar::aux::LatencyHistogram::record(long long microseconds)
+{
+  microseconds = std::max(0LL, microseconds);
+
+  unsigned int bin;
+  if (microseconds < FINE_RANGE)
+  {
+    bin = static_cast<unsigned int>(microseconds);
+  }
+  else if (microseconds < COARSE_RANGE)
+  {
+    bin = static_cast<unsigned int>(FINE_RANGE + (microseconds - FINE_RANGE) / COARSE_WIDTH);
+  }
+  else
+  {
+    bin = NUMBER_OF_BINS - 1;
+  }
+
+  this->mBins[bin].fetch_add(1, std::memory_order_relaxed);
+  this->mCount.fetch_add(1, std::memory_order_relaxed);
+  this->raiseMaximum(microseconds);
+}
+
+void cedar::aux::LatencyHistogram::raiseMaximum(long long microseconds)
+{
+  long long maximum = this->mMaximum.load(std::memory_order_relaxed);
+  while (microseconds > maximum && !this->mMaximum.compare_exchange_weak(maximum, microseconds))
+  {
+  }
+}
+
+void cedar::aux::LatencyHistogram::merge(const cedar::aux::LatencyHistogram& other)
+{
+  for (unsigned int bin = 0; bin < this->mBins.size(); ++bin)
+  {
+    this->mBins[bin].fetch_add(other.mBins[bin].load(std::memory_order_relaxed), std::memory_order_relaxed);
+  }
+  this->mCount.fetch_add(other.mCount.load(std::memory_order_relaxed), std::memory_order_relaxed);
+  this->raiseMaximum(other.mMaximum.load(std::memory_order_relaxed));
+}
+
+void cedar::aux::LatencyHistogram::reset()
+{
+  for (auto& count : this->mBins)
+  {
+    count.store(0, std::memory_order_relaxed);
+  }
+  this->mCount.store(0, std::memory_order_relaxed);
+  this->mMaximum.store(0, std::memory_order_relaxed);
+}
+
+unsigned long cedar::aux::LatencyHistogram::getCount() const
+{
+  return this->mCount.load(std::memory_order_relaxed);
+}
+
+cedar::unit::Time cedar::aux::LatencyHistogram::getMaximum() const
+{
+  double maximum = static_cast<double>(this->mMaximum.load(std::memory_order_relaxed));
+  return cedar::unit::Time(maximum * cedar::unit::micro * cedar::unit::seconds);
+}
+
+cedar::unit::Time cedar::aux::LatencyHistogram::getPercentile(double fraction) const
+{
+  unsigned long count = this->getCount();
+  if (count == 0)
+  {
+    return cedar::unit::Time(0.0 * cedar::unit::seconds);
+  }
+
+  fraction = std::min(1.0, std::max(0.0, fraction));
+  unsigned long rank = std::max
+                       (
+                         1UL,
+                         static_cast<unsigned long>(fraction * static_cast<double>(count) + 0.5)
+                       );
+
+  unsigned long seen = 0;
+  for (unsigned int bin = 0; bin < this->mBins.size(); ++bin)
+  {
+    seen += this->mBins[bin].load(std::memory_order_relaxed);
+    if (seen >= rank)
+    {
+      long long maximum = this->mMaximum.load(std::memory_order_relaxed);
+      long long bound = std::min(this->getBinUpperBoundInMicroseconds(bin), maximum);
+      return cedar::unit::Time(static_cast<double>(bound) * cedar::unit::micro * cedar::unit::seconds);
+    }
+  }
+  return this->getMaximum();
+}
+
+unsigned int cedar::aux::LatencyHistogram::getNumberOfBins() const
+{
+  return NUMBER_OF_BINS;
+}
+
+unsigned long cedar::aux::LatencyHistogram::getBinCount(unsigned int bin) const
+{
+  return this->mBins.at(bin).load(std::memory_order_relaxed);
+}
+
+cedar::unit::Time cedar::aux::LatencyHistogram::getBinUpperBound(unsigned int bin) const
+{
+  double bound = static_cast<double>(this->getBinUpperBoundInMicroseconds(bin));
+  return cedar::unit::Time(bound * cedar::unit::micro * cedar::unit::seconds);
+}
+
+long long cedar::aux::LatencyHistogram::getBinUpperBoundInMicroseconds(unsigned int bin) const
+{
+  if (bin < FINE_RANGE)
+  {
+    return static_cast<long long>(bin) + 1;
+  }
+  else if (bin < NUMBER_OF_BINS - 1)
+  {
+    return FINE_RANGE + (static_cast<long long>(bin) - FINE_RANGE + 1) * COARSE_WIDTH;
+  }
+  return this->mMaximum.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,141 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        LatencyHistogram.h
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 18
+
+    Description: 
+
+    Credits:
+
+======================================================================================================================*/
+
+#ifndef CEDAR_AUX_LATENCY_HISTOGRAM_H
+#define CEDAR_AUX_LATENCY_HISTOGRAM_H
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CEDAR INCLUDES
+#include "cedar/units/Time.h"
+
+// FORWARD DECLARATIONS
+#include "cedar/auxiliaries/LatencyHistogram.fwd.h"
+
+// SYSTEM INCLUDES
+#include <vector>
+#include <atomic>
+
+
+/*!@brief A histogram of latencies, e.g., of how late a thread woke up compared to when it was scheduled to.
+ *
+ *        Latencies up to one millisecond are binned with a resolution of one microsecond, latencies up to one hundred
+ *        milliseconds with a resolution of one hundred microseconds; everything above goes into a last bin. The
+ *        maximum is kept exactly. Recording neither allocates nor locks.
+ *
+ * @remarks The counts are atomic, so a thread may record into its own histogram while other threads copy or read it,
+ *          e.g., to show the wakeup latencies of a looped thread. A reader may then see a latency in the count that is
+ *          not yet in its bin.
+ */
+class cedar::aux::LatencyHistogram
+{
+  //--------------------------------------------------------------------------------------------------------------------
+  // constructors and destructor
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //!@brief The standard constructor.
+  LatencyHistogram();
+
+  //!@brief Copies the counts of the other histogram.
+  LatencyHistogram(const cedar::aux::LatencyHistogram& other);
+
+  //!@brief Replaces the counts by those of the other histogram.
+  cedar::aux::LatencyHistogram& operator=(const cedar::aux::LatencyHistogram& other);
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // public methods
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //! Adds a latency in microseconds; negative values are counted as zero.
+  void record(long long microseconds);
+
+  //! Adds a latency.
+  void record(const cedar::unit::Time& latency);
+
+  //! Adds all latencies recorded in another histogram.
+  void merge(const cedar::aux::LatencyHistogram& other);
+
+  //! Removes all recorded latencies.
+  void reset();
+
+  //! Returns the number of recorded latencies.
+  unsigned long getCount() const;
+
+  //! Returns the largest recorded latency.
+  cedar::unit::Time getMaximum() const;
+
+  /*!@brief Returns the latency below which the given fraction (between 0 and 1) of the recorded latencies lies.
+   *
+   *        The result is the upper end of the bin the percentile falls into, but never more than the maximum.
+   */
+  cedar::unit::Time getPercentile(double fraction) const;
+
+  //! Returns the number of bins.
+  unsigned int getNumberOfBins() const;
+
+  //! Returns how many latencies fell into the given bin.
+  unsigned long getBinCount(unsigned int bin) const;
+
+  //! Returns the upper end of the given bin; the last bin has no upper end and returns the maximum instead.
+  cedar::unit::Time getBinUpperBound(unsigned int bin) const;
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // private methods
+  //--------------------------------------------------------------------------------------------------------------------
+private:
+  long long getBinUpperBoundInMicroseconds(unsigned int bin) const;
+
+  //! Sets the maximum to the given latency if it is larger.
+  void raiseMaximum(long long microseconds);
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // members
+  //--------------------------------------------------------------------------------------------------------------------
+private:
+  //! Counts per bin.
+  std::vector<std::atomic<unsigned long> > mBins;
+
+  //! Number of recorded latencies.
+  std::atomic<unsigned long> mCount;
+
+  //! Largest recorded latency in microseconds.
+  std::atomic<long long> mMaximum;
+
+}; // class cedar::aux::LatencyHistogram
+
+#endif // CEDAR_AUX_LATENCY_HISTOGRAM_H
+
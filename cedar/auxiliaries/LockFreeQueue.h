@@ -0,0 +1,211 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        LockFreeQueue.h
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 18
+
+    Description: Header file for the class cedar::aux::LockFreeQueue.
+
+    Credits:
+
+======================================================================================================================*/
+
+#ifndef CEDAR_AUX_LOCK_FREE_QUEUE_H
+#define CEDAR_AUX_LOCK_FREE_QUEUE_H
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CEDAR INCLUDES
+#include "cedar/auxiliaries/assert.h"
+
+// FORWARD DECLARATIONS
+#include "cedar/auxiliaries/LockFreeQueue.fwd.h"
+
+// SYSTEM INCLUDES
+#include <atomic>
+#include <memory>
+#include <utility>
+#include <cstddef>
+
+
+/*!@brief A bounded queue that any number of threads can push to and pop from without locking.
+ *
+ *        Each cell of the ring carries a sequence number that tells producers and consumers whether it is free or
+ *        filled for their current position, so threads only contend on a compare-and-swap of the head or tail index.
+ *        When the queue is full, tryPush fails instead of waiting; when it is empty, tryPop fails.
+ *
+ * @remarks The capacity is rounded up to the next power of two. Values are moved into and out of preallocated cells,
+ *          so T has to be default constructible and move assignable.
+ */
+template <typename T>
+class cedar::aux::LockFreeQueue
+{
+  //--------------------------------------------------------------------------------------------------------------------
+  // nested types
+  //--------------------------------------------------------------------------------------------------------------------
+private:
+  //! A slot of the ring buffer.
+  struct Cell
+  {
+    //! Position for which the cell is free (== position) or filled (== position + 1).
+    std::atomic<size_t> mSequence;
+
+    //! The stored value.
+    T mValue;
+  };
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // constructors and destructor
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //!@brief Constructs a queue that holds at least the given number of elements.
+  LockFreeQueue(size_t capacity)
+  :
+  mCapacity(roundUpToPowerOfTwo(capacity)),
+  mCells(new Cell[mCapacity]),
+  mEnqueuePosition(0),
+  mDequeuePosition(0)
+  {
+    for (size_t i = 0; i < this->mCapacity; ++i)
+    {
+      this->mCells[i].mSequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // public methods
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //! Appends a value to the queue. Returns false, without waiting, if the queue is full.
+  bool tryPush(T value)
+  {
+    size_t position = this->mEnqueuePosition.load(std::memory_order_relaxed);
+    for (;;)
+    {
+      Cell& cell = this->mCells[position & (this->mCapacity - 1)];
+      size_t sequence = cell.mSequence.load(std::memory_order_acquire);
+      std::ptrdiff_t difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position);
+      if (difference == 0)
+      {
+        if (this->mEnqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+        {
+          cell.mValue = std::move(value);
+          cell.mSequence.store(position + 1, std::memory_order_release);
+          return true;
+        }
+      }
+      else if (difference < 0)
+      {
+        // the cell still holds a value from the previous round, i.e., the queue is full
+        return false;
+      }
+      else
+      {
+        position = this->mEnqueuePosition.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  //! Removes the oldest value from the queue. Returns false if the queue is empty.
+  bool tryPop(T& value)
+  {
+    size_t position = this->mDequeuePosition.load(std::memory_order_relaxed);
+    for (;;)
+    {
+      Cell& cell = this->mCells[position & (this->mCapacity - 1)];
+      size_t sequence = cell.mSequence.load(std::memory_order_acquire);
+      std::ptrdiff_t difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position + 1);
+      if (difference == 0)
+      {
+        if (this->mDequeuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+        {
+          value = std::move(cell.mValue);
+          cell.mSequence.store(position + this->mCapacity, std::memory_order_release);
+          return true;
+        }
+      }
+      else if (difference < 0)
+      {
+        // nothing has been written to this cell yet
+        return false;
+      }
+      else
+      {
+        position = this->mDequeuePosition.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  //! Returns whether the queue is empty. This is only a snapshot if other threads are pushing concurrently.
+  bool isEmpty() const
+  {
+    return this->mEnqueuePosition.load(std::memory_order_acquire)
+           == this->mDequeuePosition.load(std::memory_order_acquire);
+  }
+
+  //! Returns the number of elements the queue can hold.
+  size_t getCapacity() const
+  {
+    return this->mCapacity;
+  }
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // private methods
+  //--------------------------------------------------------------------------------------------------------------------
+private:
+  static size_t roundUpToPowerOfTwo(size_t value)
+  {
+    CEDAR_ASSERT(value > 0);
+    size_t power = 1;
+    while (power < value)
+    {
+      power <<= 1;
+    }
+    return power;
+  }
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // members
+  //--------------------------------------------------------------------------------------------------------------------
+private:
+  //! Number of cells; always a power of two.
+  const size_t mCapacity;
+
+  //! The ring buffer.
+  std::unique_ptr<Cell[]> mCells;
+
+  //! Position at which the next value is written.
+  std::atomic<size_t> mEnqueuePosition;
+
+  //! Position from which the next value is read.
+  std::atomic<size_t> mDequeuePosition;
+
+}; // class cedar::aux::LockFreeQueue
+
+#endif // CEDAR_AUX_LOCK_FREE_QUEUE_H
+
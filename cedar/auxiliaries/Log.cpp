@@ -39,9 +39,31 @@
 #include "cedar/auxiliaries/LogFilter.h"
 #include "cedar/auxiliaries/LogInterface.h"
 #include "cedar/auxiliaries/ConsoleLog.h"
+#include "cedar/auxiliaries/LockFreeQueue.h"
+#include "cedar/auxiliaries/CallFunctionInThread.h"
 #include "cedar/auxiliaries/Settings.h"
 
 // SYSTEM INCLUDES
+#include <QReadLocker>
+#include <QWriteLocker>
+#include <QMutexLocker>
+#include <boost/bind.hpp>
+
+//----------------------------------------------------------------------------------------------------------------------
+// static members
+//----------------------------------------------------------------------------------------------------------------------
+
+namespace
+{
+  //! Number of messages that fit into the queue of the asynchronous mode.
+  const size_t QUEUE_CAPACITY = 4096;
+
+  //! Length of the window over which messages are rate limited and repetitions are summarized.
+  const std::chrono::seconds SUMMARY_WINDOW(1);
+
+  //! How long the logging thread sleeps when it is not woken up, in milliseconds.
+  const unsigned long IDLE_WAIT = 50;
+}
 
 //----------------------------------------------------------------------------------------------------------------------
 // constructors and destructor
@@ -49,13 +71,22 @@
 
 cedar::aux::Log::Log()
 :
+mHandlersLock(QReadWriteLock::Recursive),
 mDefaultLogger(new cedar::aux::ConsoleLog()),
-mThrowOnDebugMessage(false)
+mThrowOnDebugMessage(false),
+mAsynchronous(false),
+mStopRequested(false),
+mFlushesRequested(0),
+mFlushesCompleted(0),
+mRateLimit(0),
+mDroppedMessages(0),
+mReportedDroppedMessages(0)
 {
 }
 
 cedar::aux::Log::~Log()
 {
+  this->setAsynchronous(false);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -64,6 +95,7 @@ cedar::aux::Log::~Log()
 
 void cedar::aux::Log::clearLoggers()
 {
+  QWriteLocker locker(&this->mHandlersLock);
   this->mHandlers.clear();
 }
 
@@ -72,6 +104,7 @@ void cedar::aux::Log::addLogger(cedar::aux::LogInterfacePtr logger, cedar::aux::
   LogHandler handler;
   handler.mpFilter = filter;
   handler.mpLogger = logger;
+  QWriteLocker locker(&this->mHandlersLock);
   this->mHandlers.push_back(handler);
 }
 
@@ -80,11 +113,13 @@ void cedar::aux::Log::addLoggerAtFront(cedar::aux::LogInterfacePtr logger, cedar
   LogHandler handler;
   handler.mpFilter = filter;
   handler.mpLogger = logger;
+  QWriteLocker locker(&this->mHandlersLock);
   this->mHandlers.insert(this->mHandlers.begin(), handler);
 }
 
 void cedar::aux::Log::removeLogger(cedar::aux::LogInterfacePtr logger)
 {
+  QWriteLocker locker(&this->mHandlersLock);
   for (std::vector<LogHandler>::iterator i = this->mHandlers.begin(); i != this->mHandlers.end();)
   {
     const LogHandler& handler = *i;
@@ -102,6 +137,38 @@ void cedar::aux::Log::removeLogger(cedar::aux::LogInterfacePtr logger)
 
 void cedar::aux::Log::log(cedar::aux::LOG_LEVEL level, const std::string& message, const std::string& source, const std::string& title)
 {
+  if (!this->mAsynchronous.load(std::memory_order_acquire))
+  {
+    this->dispatch(level, message, source, title, true);
+    return;
+  }
+
+  QueuedMessage queued;
+  queued.mLevel = level;
+  queued.mMessage = message;
+  queued.mSource = source;
+  queued.mTitle = title;
+  if (this->mpQueue->tryPush(std::move(queued)))
+  {
+    this->mWakeUp.wakeOne();
+  }
+  else
+  {
+    ++this->mDroppedMessages;
+  }
+}
+
+void cedar::aux::Log::dispatch
+(
+  cedar::aux::LOG_LEVEL level,
+  const std::string& message,
+  const std::string& source,
+  const std::string& title,
+  bool flushAfterwards
+)
+{
+  QReadLocker locker(&this->mHandlersLock);
+
   bool was_accepted = false;
   // see if any of the filters match
   for (size_t i = 0; i < this->mHandlers.size(); ++i)
@@ -111,6 +178,10 @@ void cedar::aux::Log::log(cedar::aux::LOG_LEVEL level, const std::string& messag
     {
       // if the filter matches, send the message to the corresponding logger.
       handler.mpLogger->message(level, message, title);
+      if (flushAfterwards)
+      {
+        handler.mpLogger->flush();
+      }
       was_accepted = true;
       
       if (handler.mpFilter->removesMessages())
@@ -124,6 +195,307 @@ void cedar::aux::Log::log(cedar::aux::LOG_LEVEL level, const std::string& messag
   if (!was_accepted)
   {
     this->mDefaultLogger->message(level, message, title);
+    if (flushAfterwards)
+    {
+      this->mDefaultLogger->flush();
+    }
+  }
+}
+
+void cedar::aux::Log::flushLoggers()
+{
+  QReadLocker locker(&this->mHandlersLock);
+  for (size_t i = 0; i < this->mHandlers.size(); ++i)
+  {
+    this->mHandlers.at(i).mpLogger->flush();
+  }
+  this->mDefaultLogger->flush();
+}
+
+void cedar::aux::Log::setAsynchronous(bool asynchronous)
+{
+  if (asynchronous == this->mAsynchronous.load())
+  {
+    return;
+  }
+
+  if (asynchronous)
+  {
+    if (!this->mpQueue)
+    {
+      this->mpQueue.reset(new MessageQueue(QUEUE_CAPACITY));
+    }
+    if (!this->mLoggingThread)
+    {
+      this->mLoggingThread = cedar::aux::CallFunctionInThreadPtr
+                             (
+                               new cedar::aux::CallFunctionInThread(boost::bind(&cedar::aux::Log::processQueue, this))
+                             );
+      this->mLoggingThread->setThreadName("log");
+    }
+    {
+      QMutexLocker lock(&this->mWakeUpMutex);
+      this->mStopRequested = false;
+    }
+    this->mLoggingThread->start();
+    this->mAsynchronous.store(true, std::memory_order_release);
+  }
+  else
+  {
+    this->mAsynchronous.store(false, std::memory_order_release);
+    {
+      QMutexLocker lock(&this->mWakeUpMutex);
+      this->mStopRequested = true;
+    }
+    this->mWakeUp.wakeOne();
+    this->mLoggingThread->stop();
+
+    // threads that were already enqueueing when the mode was switched may have added messages after the logging thread
+    // finished; pass them on here so they are not held back until the next switch
+    QueuedMessage queued;
+    while (this->mpQueue->tryPop(queued))
+    {
+      this->dispatch(queued.mLevel, queued.mMessage, queued.mSource, queued.mTitle, true);
+    }
+  }
+}
+
+bool cedar::aux::Log::isAsynchronous() const
+{
+  return this->mAsynchronous.load();
+}
+
+void cedar::aux::Log::setRateLimit(unsigned int messagesPerSecond)
+{
+  this->mRateLimit = messagesPerSecond;
+}
+
+unsigned int cedar::aux::Log::getRateLimit() const
+{
+  return this->mRateLimit;
+}
+
+unsigned long cedar::aux::Log::getNumberOfDroppedMessages() const
+{
+  return this->mDroppedMessages;
+}
+
+void cedar::aux::Log::flush()
+{
+  QMutexLocker lock(&this->mWakeUpMutex);
+  // once the logging thread is asked to stop, it no longer takes new requests
+  if (!this->mAsynchronous.load(std::memory_order_acquire) || this->mStopRequested)
+  {
+    lock.unlock();
+    this->flushLoggers();
+    return;
+  }
+
+  unsigned long ticket = ++this->mFlushesRequested;
+  this->mWakeUp.wakeOne();
+  while (this->mFlushesCompleted < ticket)
+  {
+    this->mFlushed.wait(&this->mWakeUpMutex);
+  }
+}
+
+void cedar::aux::Log::processQueue()
+{
+  bool stop = false;
+  while (!stop)
+  {
+    unsigned long flushes_requested;
+    {
+      QMutexLocker lock(&this->mWakeUpMutex);
+      stop = this->mStopRequested;
+      flushes_requested = this->mFlushesRequested;
+    }
+
+    // messages enqueued before the stop or flush request was made are processed in this iteration
+    bool processed = false;
+    QueuedMessage queued;
+    while (this->mpQueue->tryPop(queued))
+    {
+      this->processQueuedMessage(queued);
+      processed = true;
+    }
+
+    bool force = stop || flushes_requested != this->mFlushesCompleted;
+    this->emitSummaries(force);
+    this->reportDroppedMessages();
+
+    // loggers are flushed once per batch rather than once per message
+    if (processed || force)
+    {
+      this->flushLoggers();
+    }
+
+    QMutexLocker lock(&this->mWakeUpMutex);
+    if (stop)
+    {
+      this->mFlushesCompleted = this->mFlushesRequested;
+    }
+    else if (flushes_requested != this->mFlushesCompleted)
+    {
+      this->mFlushesCompleted = flushes_requested;
+    }
+    this->mFlushed.wakeAll();
+
+    if
+    (
+      !stop
+      && !this->mStopRequested
+      && this->mFlushesRequested == this->mFlushesCompleted
+      && this->mpQueue->isEmpty()
+    )
+    {
+      // producers wake the thread without taking the mutex, so a wake-up may be missed; the timeout bounds the delay
+      this->mWakeUp.wait(&this->mWakeUpMutex, IDLE_WAIT);
+    }
+  }
+}
+
+void cedar::aux::Log::processQueuedMessage(const QueuedMessage& queued)
+{
+  auto now = std::chrono::steady_clock::now();
+  auto iter = this->mSources.find(queued.mSource);
+  if (iter == this->mSources.end())
+  {
+    SourceState state;
+    state.mRepetitions = 0;
+    state.mWindowStart = now;
+    state.mWindowCount = 0;
+    state.mSuppressed = 0;
+    iter = this->mSources.insert(std::make_pair(queued.mSource, state)).first;
+  }
+  else
+  {
+    SourceState& state = iter->second;
+    if
+    (
+      state.mLastLevel == queued.mLevel
+      && state.mLastMessage == queued.mMessage
+      && state.mLastTitle == queued.mTitle
+    )
+    {
+      ++state.mRepetitions;
+      return;
+    }
+
+    // a different message ends the current run of repetitions
+    if (state.mRepetitions > 0)
+    {
+      this->dispatch
+      (
+        state.mLastLevel,
+        "Last message repeated " + cedar::aux::toString(state.mRepetitions) + " times.",
+        queued.mSource,
+        state.mLastTitle,
+        false
+      );
+      state.mRepetitions = 0;
+    }
+  }
+
+  SourceState& state = iter->second;
+  state.mLastLevel = queued.mLevel;
+  state.mLastMessage = queued.mMessage;
+  state.mLastTitle = queued.mTitle;
+
+  unsigned int limit = this->mRateLimit;
+  if (now - state.mWindowStart >= SUMMARY_WINDOW)
+  {
+    this->emitSummary(queued.mSource, state);
+    state.mWindowStart = now;
+    state.mWindowCount = 0;
+  }
+
+  if (limit > 0 && state.mWindowCount >= limit)
+  {
+    ++state.mSuppressed;
+    return;
+  }
+
+  ++state.mWindowCount;
+  this->dispatch(queued.mLevel, queued.mMessage, queued.mSource, queued.mTitle, false);
+}
+
+void cedar::aux::Log::emitSummaries(bool force)
+{
+  auto now = std::chrono::steady_clock::now();
+  for (auto iter = this->mSources.begin(); iter != this->mSources.end();)
+  {
+    SourceState& state = iter->second;
+    if (!force && now - state.mWindowStart < SUMMARY_WINDOW)
+    {
+      ++iter;
+      continue;
+    }
+
+    bool idle = (state.mRepetitions == 0 && state.mSuppressed == 0);
+    this->emitSummary(iter->first, state);
+
+    // sources without pending summaries are forgotten so the map does not keep growing with one-off sources
+    if (idle || force)
+    {
+      iter = this->mSources.erase(iter);
+    }
+    else
+    {
+      state.mWindowStart = now;
+      state.mWindowCount = 0;
+      ++iter;
+    }
+  }
+}
+
+void cedar::aux::Log::emitSummary(const std::string& source, SourceState& state)
+{
+  if (state.mRepetitions > 0)
+  {
+    this->dispatch
+    (
+      state.mLastLevel,
+      "Last message repeated " + cedar::aux::toString(state.mRepetitions) + " times.",
+      source,
+      state.mLastTitle,
+      false
+    );
+    state.mRepetitions = 0;
+    // the next occurrence of the message is passed on again
+    state.mLastMessage.clear();
+    state.mLastTitle.clear();
+  }
+
+  if (state.mSuppressed > 0)
+  {
+    this->dispatch
+    (
+      cedar::aux::LOG_LEVEL_WARNING,
+      cedar::aux::toString(state.mSuppressed) + " messages from this source were suppressed by the rate limit.",
+      source,
+      "",
+      false
+    );
+    state.mSuppressed = 0;
+  }
+}
+
+void cedar::aux::Log::reportDroppedMessages()
+{
+  unsigned long dropped = this->mDroppedMessages;
+  if (dropped != this->mReportedDroppedMessages)
+  {
+    this->dispatch
+    (
+      cedar::aux::LOG_LEVEL_WARNING,
+      cedar::aux::toString(dropped - this->mReportedDroppedMessages)
+        + " log messages were dropped because the log queue was full.",
+      "cedar::aux::Log",
+      "",
+      false
+    );
+    this->mReportedDroppedMessages = dropped;
   }
 }
 
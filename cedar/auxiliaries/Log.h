@@ -40,6 +40,8 @@
 // FORWARD DECLARATIONS
 #include "cedar/auxiliaries/Log.fwd.h"
 #include "cedar/auxiliaries/LogInterface.fwd.h"
+#include "cedar/auxiliaries/LockFreeQueue.fwd.h"
+#include "cedar/auxiliaries/CallFunctionInThread.fwd.h"
 
 // CEDAR INCLUDES
 #include "cedar/auxiliaries/assert.h"
@@ -54,10 +56,24 @@
 // SYSTEM INCLUDES
 #include <vector>
 #include <string>
+#include <map>
+#include <memory>
+#include <atomic>
+#include <chrono>
 #include <stdexcept>
 #include <QApplication>
-
-//!@brief A class for logging messages in a file.
+#include <QReadWriteLock>
+#include <QMutex>
+#include <QWaitCondition>
+
+/*!@brief A class for logging messages in a file.
+ *
+ *        By default, messages are passed through the filters and loggers on the thread that logs them. In asynchronous
+ *        mode (see setAsynchronous), log calls only enqueue the message into a bounded lock-free queue and return; a
+ *        background thread then runs the filters and loggers. Messages that do not fit into the queue are dropped and
+ *        counted. In this mode, consecutive repetitions of the same message from one source are collapsed into a
+ *        single summary, and the number of messages per source and second can be limited (see setRateLimit).
+ */
 class cedar::aux::Log
 {
   //--------------------------------------------------------------------------------------------------------------------
@@ -78,6 +94,38 @@ private:
     cedar::aux::LogInterfacePtr mpLogger;
   };
 
+  //! A message waiting in the queue of the asynchronous mode.
+  struct QueuedMessage
+  {
+    cedar::aux::LOG_LEVEL mLevel;
+    std::string mMessage;
+    std::string mSource;
+    std::string mTitle;
+  };
+
+  //! Deduplication and rate limiting state of a single message source; only used by the logging thread.
+  struct SourceState
+  {
+    //! The last message that was passed on from this source.
+    cedar::aux::LOG_LEVEL mLastLevel;
+    std::string mLastMessage;
+    std::string mLastTitle;
+
+    //! How often the last message was repeated since it was passed on.
+    unsigned int mRepetitions;
+
+    //! Start of the current rate limiting window.
+    std::chrono::steady_clock::time_point mWindowStart;
+
+    //! Number of messages passed on in the current window.
+    unsigned int mWindowCount;
+
+    //! Number of messages suppressed in the current window.
+    unsigned int mSuppressed;
+  };
+
+  typedef cedar::aux::LockFreeQueue<QueuedMessage> MessageQueue;
+
   //--------------------------------------------------------------------------------------------------------------------
   // constructors and destructor
   //--------------------------------------------------------------------------------------------------------------------
@@ -187,6 +235,35 @@ public:
    */
   void removeLogger(cedar::aux::LogInterfacePtr logger);
 
+  /*!@brief Switches between synchronous and asynchronous message processing.
+   *
+   *        When switching back to synchronous mode, the logging thread finishes processing all queued messages before
+   *        this method returns.
+   */
+  void setAsynchronous(bool asynchronous);
+
+  //!@brief Returns whether messages are processed by a background thread.
+  bool isAsynchronous() const;
+
+  /*!@brief Limits the number of messages each source may log per second in asynchronous mode.
+   *
+   *        Messages beyond the limit are suppressed and summarized once the second is over. A limit of zero disables
+   *        rate limiting.
+   */
+  void setRateLimit(unsigned int messagesPerSecond);
+
+  //!@brief Returns the number of messages each source may log per second in asynchronous mode; zero means no limit.
+  unsigned int getRateLimit() const;
+
+  //!@brief Returns how many messages were dropped so far because the queue of the asynchronous mode was full.
+  unsigned long getNumberOfDroppedMessages() const;
+
+  /*!@brief Blocks until all messages logged by this thread so far have been passed on, then flushes all loggers.
+   *
+   *        Pending summaries of repeated or suppressed messages are passed on as well.
+   */
+  void flush();
+
 
   /*!@brief Sends a standard message about an object's allocation.
    */
@@ -247,6 +324,34 @@ private:
 	// Has to be wrapped to avoid circular dependencies between Log and Settings.
   bool getMemoryDebugFlag();
 
+  //! Runs the filters and loggers for the given message, optionally flushing every logger that received it.
+  void dispatch
+  (
+    cedar::aux::LOG_LEVEL level,
+    const std::string& message,
+    const std::string& source,
+    const std::string& title,
+    bool flushAfterwards
+  );
+
+  //! Flushes all loggers, including the default logger.
+  void flushLoggers();
+
+  //! Main loop of the logging thread.
+  void processQueue();
+
+  //! Applies deduplication and rate limiting to a message taken from the queue, then dispatches it.
+  void processQueuedMessage(const QueuedMessage& queued);
+
+  //! Passes on all summaries whose rate limiting window has ended, or all of them if force is true.
+  void emitSummaries(bool force);
+
+  //! Passes on the summaries of repeated and suppressed messages of the given source.
+  void emitSummary(const std::string& source, SourceState& state);
+
+  //! Logs a warning if messages were dropped since the last report.
+  void reportDroppedMessages();
+
   //--------------------------------------------------------------------------------------------------------------------
   // members
   //--------------------------------------------------------------------------------------------------------------------
@@ -254,11 +359,51 @@ protected:
   // none yet
 private:
   std::vector<LogHandler> mHandlers;
+
+  //! Protects the handlers, which are used by the logging thread in asynchronous mode.
+  mutable QReadWriteLock mHandlersLock;
   
   cedar::aux::LogInterfacePtr mDefaultLogger;
 
   //! Whether to throw on debug messages
   bool mThrowOnDebugMessage;
+
+  //! Whether messages are enqueued rather than processed by the calling thread.
+  std::atomic<bool> mAsynchronous;
+
+  //! Queue of the asynchronous mode; created when the mode is first enabled.
+  std::unique_ptr<MessageQueue> mpQueue;
+
+  //! Thread that processes the queue in asynchronous mode.
+  cedar::aux::CallFunctionInThreadPtr mLoggingThread;
+
+  //! Protects the fields used to wake up the logging thread and the threads waiting in flush.
+  QMutex mWakeUpMutex;
+
+  //! Signals the logging thread that messages are available, a flush is requested or it should stop.
+  QWaitCondition mWakeUp;
+
+  //! Signals threads waiting in flush that their request was completed.
+  QWaitCondition mFlushed;
+
+  //! Whether the logging thread should stop.
+  bool mStopRequested;
+
+  //! Number of flush requests made and completed, respectively.
+  unsigned long mFlushesRequested;
+  unsigned long mFlushesCompleted;
+
+  //! Messages per source and second in asynchronous mode; zero means no limit.
+  std::atomic<unsigned int> mRateLimit;
+
+  //! Number of messages dropped because the queue was full.
+  std::atomic<unsigned long> mDroppedMessages;
+
+  //! Number of dropped messages that have already been reported; only used by the logging thread.
+  unsigned long mReportedDroppedMessages;
+
+  //! Deduplication and rate limiting state per source; only used by the logging thread.
+  std::map<std::string, SourceState> mSources;
 };
 
 //!@cond SKIPPED_DOCUMENTATION
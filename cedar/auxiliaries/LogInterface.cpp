@@ -54,3 +54,7 @@ cedar::aux::LogInterface::~LogInterface()
 //----------------------------------------------------------------------------------------------------------------------
 // methods
 //----------------------------------------------------------------------------------------------------------------------
+
+void cedar::aux::LogInterface::flush()
+{
+}
@@ -76,6 +76,9 @@ public:
     const std::string& title
   ) = 0;
 
+  //!@brief Writes out any messages the logger has buffered. The default implementation does nothing.
+  virtual void flush();
+
   //--------------------------------------------------------------------------------------------------------------------
   // protected methods
   //--------------------------------------------------------------------------------------------------------------------
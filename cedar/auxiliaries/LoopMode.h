@@ -125,6 +125,12 @@ public:
    */
   static const Id FakeDT = 6;
 
+  /*! Sleep until absolute deadlines spaced by the step time, so that time spent in step() does not make the loop
+   *  drift. Pass the real elapsed time down to step(). Optionally busy-waits right before each deadline and runs
+   *  with real-time priority on a fixed CPU.
+   */
+  static const Id Deadline = 7;
+
 protected:
   // none yet
 
@@ -117,6 +117,24 @@ _mLoopMode
     cedar::aux::LoopMode::typePtr(),
     mode
   )
+),
+_mBusyWaitTime
+(
+  new cedar::aux::TimeParameter
+      (
+        this,
+        "busy wait time",
+        cedar::unit::Time(0.0 * cedar::unit::seconds),
+        cedar::aux::TimeParameter::LimitType::positiveZero()
+      )
+),
+_mRealTimePriority
+(
+  new cedar::aux::UIntParameter(this, "real-time priority", 0, cedar::aux::UIntParameter::LimitType(0, 99))
+),
+_mCpuAffinity
+(
+  new cedar::aux::IntParameter(this, "cpu affinity", -1, cedar::aux::IntParameter::LimitType(-1, 1023))
 )
 {
   init();
@@ -190,6 +208,24 @@ _mLoopMode
     cedar::aux::LoopMode::typePtr(),
     mode
   )
+),
+_mBusyWaitTime
+(
+  new cedar::aux::TimeParameter
+      (
+        this,
+        "busy wait time",
+        cedar::unit::Time(0.0 * cedar::unit::seconds),
+        cedar::aux::TimeParameter::LimitType::positiveZero()
+      )
+),
+_mRealTimePriority
+(
+  new cedar::aux::UIntParameter(this, "real-time priority", 0, cedar::aux::UIntParameter::LimitType(0, 99))
+),
+_mCpuAffinity
+(
+  new cedar::aux::IntParameter(this, "cpu affinity", -1, cedar::aux::IntParameter::LimitType(-1, 1023))
 )
 {
   init();
@@ -255,6 +291,9 @@ void cedar::aux::LoopedThread::makeParametersConst(bool makeConst)
     this->_mIdleTime->setConstant(makeConst);
     this->_mStepSize->setConstant(makeConst);
     this->_mSimulatedTime->setConstant(makeConst);
+    this->_mBusyWaitTime->setConstant(makeConst);
+    this->_mRealTimePriority->setConstant(makeConst);
+    this->_mCpuAffinity->setConstant(makeConst);
   }
 }
 
@@ -361,6 +400,57 @@ void cedar::aux::LoopedThread::setSimulatedTime(cedar::unit::Time simulatedTime)
 
   _mSimulatedTime->setValue(simulatedTime);
 }
+
+void cedar::aux::LoopedThread::setBusyWaitTime(cedar::unit::Time busyWait)
+{
+  QWriteLocker locker(this->_mBusyWaitTime->getLock());
+
+  this->_mBusyWaitTime->setValue(busyWait);
+}
+
+void cedar::aux::LoopedThread::setRealTimePriority(unsigned int priority)
+{
+  QWriteLocker locker(this->_mRealTimePriority->getLock());
+
+  this->_mRealTimePriority->setValue(priority);
+}
+
+void cedar::aux::LoopedThread::setCpuAffinity(int cpu)
+{
+  QWriteLocker locker(this->_mCpuAffinity->getLock());
+
+  this->_mCpuAffinity->setValue(cpu);
+}
+
+cedar::unit::Time cedar::aux::LoopedThread::getBusyWaitTime() const
+{
+  QReadLocker locker(this->_mBusyWaitTime->getLock());
+  cedar::unit::Time busy_wait = this->_mBusyWaitTime->getValue();
+  return busy_wait;
+}
+
+unsigned int cedar::aux::LoopedThread::getRealTimePriority() const
+{
+  QReadLocker locker(this->_mRealTimePriority->getLock());
+  unsigned int priority = this->_mRealTimePriority->getValue();
+  return priority;
+}
+
+int cedar::aux::LoopedThread::getCpuAffinity() const
+{
+  QReadLocker locker(this->_mCpuAffinity->getLock());
+  int cpu = this->_mCpuAffinity->getValue();
+  return cpu;
+}
+
+cedar::aux::LatencyHistogram cedar::aux::LoopedThread::getWakeupLatencyHistogram() const
+{
+  if (this->mpWorker)
+  {
+    return this->mpWorker->getWakeupLatencyHistogram();
+  }
+  return cedar::aux::LatencyHistogram();
+}
  
 cedar::aux::detail::ThreadWorker* cedar::aux::LoopedThread::resetWorker()
 {
@@ -371,6 +461,12 @@ cedar::aux::detail::ThreadWorker* cedar::aux::LoopedThread::resetWorker()
 
 void cedar::aux::LoopedThread::modeChanged()
 {
+  // scheduling options are only applied by the deadline mode
+  bool deadline_mode = (_mLoopMode->getValue() == cedar::aux::LoopMode::Deadline);
+  this->_mBusyWaitTime->setConstant(!deadline_mode);
+  this->_mRealTimePriority->setConstant(!deadline_mode);
+  this->_mCpuAffinity->setConstant(!deadline_mode);
+
   switch (_mLoopMode->getValue())
   {
 
@@ -427,6 +523,17 @@ void cedar::aux::LoopedThread::modeChanged()
       this->_mSimulatedTime->setConstant(true);
       break;
     }
+    case cedar::aux::LoopMode::Deadline:
+    {
+      this->_mStepSize->setConstant(false);
+      this->_mFakeStepSize->setConstant(true);
+      this->_mMinimumStepSize->setConstant(true);
+
+      //legacy:
+      this->_mIdleTime->setConstant(true);
+      this->_mSimulatedTime->setConstant(true);
+      break;
+    }
 
     default:
     {
@@ -46,6 +46,9 @@
 #include "cedar/auxiliaries/DoubleParameter.h"
 #include "cedar/auxiliaries/BoolParameter.h"
 #include "cedar/auxiliaries/EnumParameter.h"
+#include "cedar/auxiliaries/IntParameter.h"
+#include "cedar/auxiliaries/UIntParameter.h"
+#include "cedar/auxiliaries/LatencyHistogram.h"
 #include "cedar/auxiliaries/LoopMode.h"
 #include "cedar/auxiliaries/ThreadWrapper.h"
 #include "cedar/auxiliaries/TimeParameter.h"
@@ -213,6 +216,39 @@ public:
   void setSimulatedTime(cedar::unit::Time simulatedTime
                           = cedar::unit::Time(0.0 * cedar::unit::milli * cedar::unit::seconds));
 
+  /*!@brief Sets how long the thread spins right before each deadline instead of sleeping.
+   *
+   * Only used in cedar::aux::LoopMode::Deadline. Spinning makes the wakeup more precise at the cost of CPU time.
+   */
+  void setBusyWaitTime(cedar::unit::Time busyWait);
+
+  /*!@brief Sets the SCHED_FIFO priority (1 to 99) the thread runs with; zero keeps the default scheduling.
+   *
+   * Only used in cedar::aux::LoopMode::Deadline. Usually requires the permission to use real-time priorities.
+   */
+  void setRealTimePriority(unsigned int priority);
+
+  /*!@brief Sets the CPU the thread is pinned to; a negative value lets it run on any CPU.
+   *
+   * Only used in cedar::aux::LoopMode::Deadline.
+   */
+  void setCpuAffinity(int cpu);
+
+  //! get the time spent spinning before each deadline
+  cedar::unit::Time getBusyWaitTime() const;
+
+  //! get the real-time priority of the thread
+  unsigned int getRealTimePriority() const;
+
+  //! get the CPU the thread is pinned to
+  int getCpuAffinity() const;
+
+  /*!@brief Returns how late the thread woke up compared to its schedule, since it was last started.
+   *
+   * This is recorded in all loop modes that sleep until a scheduled time.
+   */
+  cedar::aux::LatencyHistogram getWakeupLatencyHistogram() const;
+
 
 
   //! get the duration of the fixed trigger step
@@ -415,6 +451,15 @@ private:
   //! The loop mode of the trigger
   cedar::aux::EnumParameterPtr _mLoopMode;
 
+  //!@brief time spent spinning before each deadline (since v6.2)
+  cedar::aux::TimeParameterPtr _mBusyWaitTime;
+
+  //!@brief SCHED_FIFO priority of the thread, zero for the default scheduling (since v6.2)
+  cedar::aux::UIntParameterPtr _mRealTimePriority;
+
+  //!@brief CPU the thread is pinned to, negative for none (since v6.2)
+  cedar::aux::IntParameterPtr _mCpuAffinity;
+
 }; // class cedar::aux::LoopedThread
 
 #endif // CEDAR_AUX_LOOPED_THREAD_H
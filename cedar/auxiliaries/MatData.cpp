@@ -48,6 +48,14 @@
 #include <fstream>
 #include <QReadLocker>
 #include <QReadWriteLock>
+#include <QMutexLocker>
+
+namespace
+{
+  //! Number of buffers a publishing MatData keeps for reuse; two or three suffice unless readers hold on to snapshots.
+  const size_t MAX_POOLED_BUFFERS = 4;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 // constructors and destructor
 //----------------------------------------------------------------------------------------------------------------------
@@ -57,6 +65,134 @@
 // methods
 //----------------------------------------------------------------------------------------------------------------------
 
+void cedar::aux::MatData::setData(const cv::Mat& data)
+{
+  this->Super::setData(data);
+  this->publish();
+}
+
+void cedar::aux::MatData::setPublishing(bool publishing)
+{
+  QMutexLocker locker(&this->mPublishLock);
+  this->mPublishing = publishing;
+  if (!publishing)
+  {
+    // readers may still hold the published buffer, which the matrix can share memory with
+    if (this->mLiveBuffer && this->mLivePublished)
+    {
+      this->mData = this->mData.clone();
+    }
+    boost::atomic_store(&this->mPublished, ConstSnapshotPtr());
+    this->mLiveBuffer.reset();
+    this->mLivePublished = false;
+    this->mBuffers.clear();
+    return;
+  }
+  locker.unlock();
+
+  // make sure readers never see an unpublished state
+  this->publish();
+}
+
+boost::shared_ptr<cedar::aux::MatData::Snapshot> cedar::aux::MatData::takeFreeBuffer()
+{
+  // a buffer is free if only the pool refers to it; the live and the published buffer are also referenced elsewhere
+  for (const auto& candidate : this->mBuffers)
+  {
+    if (candidate.use_count() == 1)
+    {
+      return candidate;
+    }
+  }
+
+  // buffers beyond the pool's capacity are released by the last reader holding them
+  boost::shared_ptr<Snapshot> buffer(new Snapshot());
+  if (this->mBuffers.size() < MAX_POOLED_BUFFERS)
+  {
+    this->mBuffers.push_back(buffer);
+  }
+  return buffer;
+}
+
+cv::Mat cedar::aux::MatData::prepareWrite(bool keepContents)
+{
+  cv::Mat previous = this->mData;
+  if (!this->mPublishing)
+  {
+    return previous;
+  }
+
+  QMutexLocker locker(&this->mPublishLock);
+  if (this->mLiveBuffer && !this->mLivePublished)
+  {
+    // no reader has seen the current buffer yet
+    return previous;
+  }
+
+  boost::shared_ptr<Snapshot> buffer = this->takeFreeBuffer();
+  // copyTo and create reuse the buffer's memory if type and size match
+  if (keepContents)
+  {
+    this->mData.copyTo(buffer->mData);
+  }
+  else
+  {
+    buffer->mData.create(this->mData.dims, this->mData.size.p, this->mData.type());
+  }
+  this->mData = buffer->mData;
+  this->mLiveBuffer = buffer;
+  this->mLivePublished = false;
+  return previous;
+}
+
+void cedar::aux::MatData::publish()
+{
+  if (!this->mPublishing)
+  {
+    return;
+  }
+
+  QMutexLocker locker(&this->mPublishLock);
+
+  // the matrix was replaced, resized or written without prepareWrite; publish a copy so that readers never share
+  // memory that the owner may still write to
+  if (!this->mLiveBuffer || this->mLivePublished || this->mLiveBuffer->mData.data != this->mData.data)
+  {
+    boost::shared_ptr<Snapshot> buffer = this->takeFreeBuffer();
+    this->mData.copyTo(buffer->mData);
+    this->mData = buffer->mData;
+    this->mLiveBuffer = buffer;
+  }
+
+  // every publication is a change; the revision usually increased already (e.g., in setData or after compute)
+  ConstSnapshotPtr previous = boost::atomic_load(&this->mPublished);
+  if (!previous || previous->mRevision >= this->getRevision())
+  {
+    this->markChanged();
+  }
+  this->mLiveBuffer->mRevision = this->getRevision();
+  boost::atomic_store(&this->mPublished, ConstSnapshotPtr(this->mLiveBuffer));
+  this->mLivePublished = true;
+}
+
+cedar::aux::MatData::ConstSnapshotPtr cedar::aux::MatData::getSnapshot() const
+{
+  if (this->mPublishing)
+  {
+    ConstSnapshotPtr published = boost::atomic_load(&this->mPublished);
+    if (published)
+    {
+      return published;
+    }
+  }
+
+  boost::shared_ptr<Snapshot> snapshot(new Snapshot());
+  QReadLocker locker(this->mpLock);
+  snapshot->mData = this->mData.clone();
+  snapshot->mRevision = this->getRevision();
+  return snapshot;
+}
+
 std::string cedar::aux::MatData::getDescription() const
 {
   std::string description;
@@ -172,7 +308,10 @@ void cedar::aux::MatData::deserialize(std::istream& stream, cedar::aux::Serializ
   if (header_entries.back() == "compact")
   {
     offset = 1;
-    CEDAR_NON_CRITICAL_ASSERT(mode == cedar::aux::SerializationFormat::Compact);
+    CEDAR_NON_CRITICAL_ASSERT
+    (
+      mode == cedar::aux::SerializationFormat::Compact || mode == cedar::aux::SerializationFormat::Binary
+    );
   }
   for (size_t i = 2; i < header_entries.size() - offset; ++i)
   {
@@ -221,6 +360,7 @@ void cedar::aux::MatData::deserialize(std::istream& stream, cedar::aux::Serializ
     } // case SERIALIZE_CSV
 
     case cedar::aux::SerializationFormat::Compact:
+    case cedar::aux::SerializationFormat::Binary:
     {
       // matrix should be a linear array in memory, without gaps
       CEDAR_DEBUG_ASSERT(mat.isContinuous());
@@ -337,6 +477,7 @@ void cedar::aux::MatData::serializeData(std::ostream& stream, cedar::aux::Serial
     } // case SerializationMode::SERIALIZE_CSV
 
     case cedar::aux::SerializationFormat::Compact:
+    case cedar::aux::SerializationFormat::Binary:
     {
       // we can only handle matrices that are continuous, i.e., those, that are written linearly in memory
       CEDAR_ASSERT(this->mData.isContinuous());
@@ -368,7 +509,7 @@ void cedar::aux::MatData::serializeHeader(std::ostream& stream, cedar::aux::Seri
     stream << mData.size[i];
   }
 
-  if (mode == cedar::aux::SerializationFormat::Compact)
+  if (mode == cedar::aux::SerializationFormat::Compact || mode == cedar::aux::SerializationFormat::Binary)
   {
     stream << ",compact";
   }
@@ -46,9 +46,20 @@
 
 // SYSTEM INCLUDES
 #include <QReadWriteLock>
+#include <QMutex>
+#ifndef Q_MOC_RUN
+  #include <boost/smart_ptr.hpp>
+#endif // Q_MOC_RUN
+#include <atomic>
+#include <vector>
 #include <string>
 
 /*!@brief Data containing matrices.
+ *
+ *        Optionally, the data can be put into publishing mode (see setPublishing). In this mode, the owner of the data
+ *        publishes the matrix after each change by swapping a pointer, and writes the next version into another buffer
+ *        from a small pool (see prepareWrite). Readers that only need a consistent view of the last published value can
+ *        then call getSnapshot without taking the data's lock.
  */
 class cedar::aux::MatData : public cedar::aux::DataTemplate<cv::Mat>
 {
@@ -62,19 +73,42 @@ class cedar::aux::MatData : public cedar::aux::DataTemplate<cv::Mat>
 private:
   typedef cedar::aux::DataTemplate<cv::Mat> Super;
 
+public:
+  /*!@brief A published, immutable version of the matrix.
+   *
+   * @remarks The matrix shares its memory with a buffer that is reused once all snapshots referring to it are gone.
+   *          Keep the snapshot pointer alive for as long as the matrix (or any header copied from it) is in use.
+   */
+  struct Snapshot
+  {
+    //! The published matrix.
+    cv::Mat mData;
+
+    //! Revision of the data at the time of publishing (see cedar::aux::Data::getRevision).
+    unsigned long mRevision;
+  };
+
+  //! Pointer to a published snapshot.
+  typedef boost::shared_ptr<const Snapshot> ConstSnapshotPtr;
+
   //--------------------------------------------------------------------------------------------------------------------
   // constructors and destructor
   //--------------------------------------------------------------------------------------------------------------------
 public:
   //!@brief The standard constructor.
   MatData()
+  :
+  mPublishing(false),
+  mLivePublished(false)
   {
   }
 
   //!@brief This constructor initializes the internal data to a value.
   MatData(const cv::Mat& value)
   :
-  cedar::aux::DataTemplate<cv::Mat>(value)
+  cedar::aux::DataTemplate<cv::Mat>(value),
+  mPublishing(false),
+  mLivePublished(false)
   {
   }
 
@@ -121,6 +155,61 @@ public:
     }
   }
 
+  //!@brief Sets the internal matrix; in publishing mode, the new matrix is published right away.
+  void setData(const cv::Mat& data) override;
+
+  /*!@brief Enables or disables publishing mode.
+   *
+   *        Publishing lets consumers that read snapshots (see cedar::proc::ExternalData::setReadsSnapshots) skip the
+   *        data's lock, so they never wait for the owner. In return, the owner has to call prepareWrite before each
+   *        change. This pays off most for data that rarely changes, such as the outputs of input sources: owners that
+   *        mark it unchanged (see cedar::aux::Data::markUnchanged) keep its snapshot and revision, so consumers can
+   *        also skip the work on it.
+   *
+   * @remarks Whether data is publishing determines how consumers lock it (see cedar::proc::ExternalData). Thus, this
+   *          should be set before the data is connected anywhere, usually in the constructor of the owning step.
+   */
+  void setPublishing(bool publishing);
+
+  //! Returns whether this data is in publishing mode.
+  inline bool isPublishing() const
+  {
+    return this->mPublishing;
+  }
+
+  /*!@brief Makes the current matrix the one returned by getSnapshot; the matrix is handed over, not copied.
+   *
+   *        If the matrix was not written through prepareWrite since the last publication (e.g., because it was replaced
+   *        or resized), it is copied into a buffer of the pool instead. The snapshot is stamped with the data's
+   *        revision, which is increased first unless it already changed since the last publication.
+   *
+   * @remarks The caller has to make sure that the matrix is not written concurrently, i.e., hold at least a read lock
+   *          on the data or be the step owning the data while it computes. Does nothing unless the data is publishing.
+   */
+  void publish();
+
+  /*!@brief Moves the matrix to a buffer that no reader holds, so that it can be written without changing snapshots.
+   *
+   *        Has to be called by the owner of publishing data before each change of the matrix. The new buffer has the
+   *        size and type of the old one. If keepContents is false, its contents are undefined; owners that overwrite
+   *        the matrix completely, or that compute it from the returned matrix, thus avoid a copy. Buffers still
+   *        referenced by readers are never reused, so this never waits for readers; at most a few buffers are kept for
+   *        reuse.
+   *
+   * @returns The matrix as it was before the call. It must not be written and may share memory with the new matrix
+   *          (e.g., if the data is not publishing).
+   *
+   * @remarks The caller has to hold the write lock of the data or otherwise make sure that no one else writes it.
+   */
+  cv::Mat prepareWrite(bool keepContents = true);
+
+  /*!@brief Returns a consistent copy of the matrix.
+   *
+   *        In publishing mode, this returns the last published buffer without locking. Otherwise, the matrix is cloned
+   *        under a read lock, so the caller must not hold the data's lock in that case.
+   */
+  ConstSnapshotPtr getSnapshot() const;
+
   //! Checks if the matrix is empty.
   bool isEmpty() const
   {
@@ -144,7 +233,8 @@ protected:
   // private methods
   //--------------------------------------------------------------------------------------------------------------------
 private:
-  // none yet
+  //! Returns a buffer no reader holds. Must be called with mPublishLock held.
+  boost::shared_ptr<Snapshot> takeFreeBuffer();
 
   //--------------------------------------------------------------------------------------------------------------------
   // members
@@ -153,7 +243,23 @@ protected:
   // none yet
 
 private:
-  // none yet
+  //! Whether changes to the data are published to snapshots.
+  std::atomic<bool> mPublishing;
+
+  //! The snapshot handed out to readers; only accessed through boost::atomic_load/atomic_store.
+  ConstSnapshotPtr mPublished;
+
+  //! Buffers the matrix is written to and published from; reused when no reader holds them anymore.
+  std::vector<boost::shared_ptr<Snapshot> > mBuffers;
+
+  //! The buffer whose memory the matrix currently uses.
+  boost::shared_ptr<Snapshot> mLiveBuffer;
+
+  //! Whether mLiveBuffer has been published, i.e., whether readers may see it.
+  bool mLivePublished;
+
+  //! Serializes publishers; readers never take this lock.
+  QMutex mPublishLock;
 
 }; // class cedar::aux::MatData
 
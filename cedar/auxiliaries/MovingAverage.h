@@ -47,7 +47,9 @@
 #include "cedar/auxiliaries/MovingAverage.fwd.h"
 
 // SYSTEM INCLUDES
-#include <deque>
+#ifndef Q_MOC_RUN
+  #include <boost/circular_buffer.hpp>
+#endif // Q_MOC_RUN
 #include <iostream>
 
 
@@ -127,6 +129,7 @@ public:
   //!@brief The standard constructor.
   MovingAverage(size_t maxNumSamples)
   :
+  mBuffer(maxNumSamples),
   mMaxNumElements(maxNumSamples),
   mElementSum(0)
   {
@@ -151,6 +154,7 @@ public:
     this->mMaxNumElements = maxNumSamples;
 
     this->removeExcess();
+    this->mBuffer.set_capacity(maxNumSamples);
   }
 
   /*!@brief Appends a new value to the average.
@@ -238,8 +242,8 @@ private:
 protected:
   // none yet
 private:
-  //! The buffer containing the elements.
-  std::deque<ElementType> mBuffer;
+  //! The buffer containing the elements; its capacity is allocated once, so appending never allocates.
+  boost::circular_buffer<ElementType> mBuffer;
 
   //! The maximum number of elements to be stored.
   size_t mMaxNumElements;
@@ -38,6 +38,7 @@
 
 #include "cedar/auxiliaries/Recorder.h"
 #include "cedar/auxiliaries/assert.h"
+#include "cedar/auxiliaries/exceptions.h"
 #include "cedar/auxiliaries/ThreadWrapper.h"
 #include "cedar/auxiliaries/Settings.h"
 #include "cedar/units/Time.h"
@@ -62,7 +63,10 @@
 cedar::aux::Recorder::Recorder()
 :
 mpListLock(new QReadWriteLock()),
-mSubFolder("recording_#T#")
+mSubFolder("recording_#T#"),
+mBufferCapacity(256),
+mOverflowPolicy(cedar::aux::RecorderOverflowPolicy::Block),
+mRunningSimulated(false)
 {
   mProjectName = "Unnamed";
 
@@ -93,14 +97,58 @@ void cedar::aux::Recorder::setSerializationMode(cedar::aux::SerializationFormat:
   cedar::aux::SettingsSingleton::getInstance()->setSerializationFormat(mode);
 }
 
-void cedar::aux::Recorder::step(cedar::unit::Time)
+size_t cedar::aux::Recorder::getBufferCapacity() const
+{
+  return this->mBufferCapacity;
+}
+
+void cedar::aux::Recorder::setBufferCapacity(size_t capacity)
+{
+  if (capacity == 0)
+  {
+    CEDAR_THROW(cedar::aux::RangeException, "The buffer capacity of the recorder must be at least one.");
+  }
+  this->mBufferCapacity = capacity;
+}
+
+cedar::aux::RecorderOverflowPolicy::Id cedar::aux::Recorder::getOverflowPolicy() const
+{
+  return this->mOverflowPolicy;
+}
+
+void cedar::aux::Recorder::setOverflowPolicy(cedar::aux::RecorderOverflowPolicy::Id policy)
+{
+  this->mOverflowPolicy = policy;
+}
+
+unsigned int cedar::aux::Recorder::getNumberOfDroppedFrames(const std::string& name) const
+{
+  QReadLocker locker(mpListLock);
+  auto it = mDataSpectators.find(name);
+  if (it == mDataSpectators.end())
+  {
+    CEDAR_THROW(cedar::aux::NotFoundException, "No data of name \"" + name + "\" registered.");
+  }
+  return it->second->getNumberOfDroppedFrames();
+}
+
+unsigned int cedar::aux::Recorder::getNumberOfDroppedFrames() const
 {
-  auto mode = this->getSerializationMode();
+  QReadLocker locker(mpListLock);
+  unsigned int dropped = 0;
+  for (const auto& data_spectator : mDataSpectators)
+  {
+    dropped += data_spectator.second->getNumberOfDroppedFrames();
+  }
+  return dropped;
+}
 
-  // Writing the first value of every DataSpectator queue.
+void cedar::aux::Recorder::step(cedar::unit::Time)
+{
+  // Writing the first value of every DataSpectator queue (binary recordings write the whole queue).
   for (auto data_spectator : mDataSpectators)
   {
-    boost::static_pointer_cast<cedar::aux::DataSpectator>(data_spectator.second)->writeFirstRecordData(mode);
+    boost::static_pointer_cast<cedar::aux::DataSpectator>(data_spectator.second)->writeFirstRecordData();
   }
 }
 
@@ -220,6 +268,62 @@ void cedar::aux::Recorder::processQuit()
   this->stopAllRecordings();
 }
 
+void cedar::aux::Recorder::startSimulated()
+{
+  if (this->isRunningNolocking() || this->mRunningSimulated)
+  {
+    CEDAR_THROW(cedar::aux::RecorderException, "Cannot start a simulated recording while the recorder is running");
+  }
+
+  QReadLocker locker(mpListLock);
+  if (mDataSpectators.size() > 0)
+  {
+    this->createOutputDirectory();
+  }
+
+  // opens the files and allocates the buffers without starting the threads
+  for (auto data_spectator : mDataSpectators)
+  {
+    data_spectator.second->prepareStart();
+  }
+  this->mRunningSimulated = true;
+}
+
+void cedar::aux::Recorder::stepSimulated(cedar::unit::Time time)
+{
+  if (!this->mRunningSimulated)
+  {
+    return;
+  }
+
+  QReadLocker locker(mpListLock);
+  for (auto data_spectator : mDataSpectators)
+  {
+    data_spectator.second->recordSimulated(time);
+  }
+}
+
+void cedar::aux::Recorder::stopSimulated()
+{
+  if (!this->mRunningSimulated)
+  {
+    return;
+  }
+
+  QReadLocker locker(mpListLock);
+  for (auto data_spectator : mDataSpectators)
+  {
+    data_spectator.second->processQuit();
+  }
+  mSubFolder = "recording_#T#";
+  this->mRunningSimulated = false;
+}
+
+bool cedar::aux::Recorder::isRunningSimulated() const
+{
+  return this->mRunningSimulated;
+}
+
 void cedar::aux::Recorder::clear()
 {
   // throw exception if running
@@ -42,6 +42,7 @@
 #include "cedar/auxiliaries/Data.h"
 #include "cedar/auxiliaries/LoopedThread.h"
 #include "cedar/auxiliaries/DataSpectator.h"
+#include "cedar/auxiliaries/RecorderOverflowPolicy.h"
 #include "cedar/units/Time.h"
 
 // FORWARD DECLARATION
@@ -158,6 +159,23 @@ public:
   //!@brief Removes all threads.
   void removeAllRecordings();
 
+  /*!@brief Starts a recording that is driven by stepSimulated instead of the recorder's threads.
+   *
+   *        This is used when an architecture is stepped in simulated time, e.g., by
+   *        cedar::proc::experiment::Experiment::runSimulatedTrial. The record intervals then refer to the time of the
+   *        global clock, and all data is recorded and written in the thread calling stepSimulated.
+   */
+  void startSimulated();
+
+  //!@brief Records all data whose record interval has passed at the given simulated time.
+  void stepSimulated(cedar::unit::Time time);
+
+  //!@brief Ends a recording started with startSimulated and writes all remaining data to disk.
+  void stopSimulated();
+
+  //! Returns true if a recording started with startSimulated is running.
+  bool isRunningSimulated() const;
+
   //! Returns true if any data is set to be recorded.
   bool hasDataToRecord() const;
 
@@ -167,6 +185,29 @@ public:
   //! Sets the serialization mode for writing data.
   void setSerializationMode(cedar::aux::SerializationFormat::Id mode);
 
+  //! Returns the number of snapshots each registered data can buffer before they are written to disk.
+  size_t getBufferCapacity() const;
+
+  /*!@brief Sets the number of snapshots each registered data can buffer before they are written to disk.
+   *
+   *        The buffers are allocated when the recording starts, so changes only affect the next recording.
+   */
+  void setBufferCapacity(size_t capacity);
+
+  //! Returns what happens to new snapshots when a buffer is full.
+  cedar::aux::RecorderOverflowPolicy::Id getOverflowPolicy() const;
+
+  //! Sets what happens to new snapshots when a buffer is full. Only affects the next recording.
+  void setOverflowPolicy(cedar::aux::RecorderOverflowPolicy::Id policy);
+
+  /*!@brief Returns the number of snapshots of the data 'name' that were lost in the current recording because its
+   *        buffer was full.
+   */
+  unsigned int getNumberOfDroppedFrames(const std::string& name) const;
+
+  //! Returns the number of snapshots of all registered data that were lost in the current recording.
+  unsigned int getNumberOfDroppedFrames() const;
+
 signals:
   //! Emitted whenver data is added or removed.
   void recordedDataChanged();
@@ -219,6 +260,15 @@ private:
   std::string mProjectName;
 
   std::string mSubFolder;
+
+  //!@brief Number of slots in the ring buffer of each DataSpectator.
+  size_t mBufferCapacity;
+
+  //!@brief What the DataSpectators do when their ring buffer is full.
+  cedar::aux::RecorderOverflowPolicy::Id mOverflowPolicy;
+
+  //!@brief Whether a recording started with startSimulated is running.
+  bool mRunningSimulated;
 };
 
 
@@ -0,0 +1,84 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        RecorderOverflowPolicy.cpp
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 18
+
+    Description: Source file for the class cedar::aux::RecorderOverflowPolicy.
+
+    Credits:
+
+======================================================================================================================*/
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CLASS HEADER
+#include "cedar/auxiliaries/RecorderOverflowPolicy.h"
+
+// CEDAR INCLUDES
+
+// SYSTEM INCLUDES
+
+
+//----------------------------------------------------------------------------------------------------------------------
+// static members
+//----------------------------------------------------------------------------------------------------------------------
+
+cedar::aux::EnumType<cedar::aux::RecorderOverflowPolicy>
+  cedar::aux::RecorderOverflowPolicy::mType("cedar::aux::RecorderOverflowPolicy::");
+
+#ifndef CEDAR_COMPILER_MSVC
+const cedar::aux::RecorderOverflowPolicy::Id cedar::aux::RecorderOverflowPolicy::Block;
+const cedar::aux::RecorderOverflowPolicy::Id cedar::aux::RecorderOverflowPolicy::DropOldest;
+const cedar::aux::RecorderOverflowPolicy::Id cedar::aux::RecorderOverflowPolicy::DropNewest;
+#endif // CEDAR_COMPILER_MSVC
+
+//----------------------------------------------------------------------------------------------------------------------
+// constructors and destructor
+//----------------------------------------------------------------------------------------------------------------------
+
+void cedar::aux::RecorderOverflowPolicy::construct()
+{
+  mType.type()->def(cedar::aux::Enum(cedar::aux::RecorderOverflowPolicy::Block, "Block", "block"));
+  mType.type()->def(cedar::aux::Enum(cedar::aux::RecorderOverflowPolicy::DropOldest, "DropOldest", "drop oldest"));
+  mType.type()->def(cedar::aux::Enum(cedar::aux::RecorderOverflowPolicy::DropNewest, "DropNewest", "drop newest"));
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// methods
+//----------------------------------------------------------------------------------------------------------------------
+
+const cedar::aux::EnumBase& cedar::aux::RecorderOverflowPolicy::type()
+{
+  return *cedar::aux::RecorderOverflowPolicy::mType.type();
+}
+
+const cedar::aux::RecorderOverflowPolicy::TypePtr& cedar::aux::RecorderOverflowPolicy::typePtr()
+{
+  return cedar::aux::RecorderOverflowPolicy::mType.type();
+}
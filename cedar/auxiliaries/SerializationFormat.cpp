@@ -55,6 +55,7 @@ cedar::aux::EnumType<cedar::aux::SerializationFormat>
 #ifndef CEDAR_COMPILER_MSVC
 const cedar::aux::SerializationFormat::Id cedar::aux::SerializationFormat::CSV;
 const cedar::aux::SerializationFormat::Id cedar::aux::SerializationFormat::Compact;
+const cedar::aux::SerializationFormat::Id cedar::aux::SerializationFormat::Binary;
 #endif // CEDAR_COMPILER_MSVC
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -65,6 +66,7 @@ void cedar::aux::SerializationFormat::construct()
 {
   mType.type()->def(cedar::aux::Enum(cedar::aux::SerializationFormat::CSV, "CSV", "CSV"));
   mType.type()->def(cedar::aux::Enum(cedar::aux::SerializationFormat::Compact, "Compact", "Compact"));
+  mType.type()->def(cedar::aux::Enum(cedar::aux::SerializationFormat::Binary, "Binary", "Binary (chunked frames)"));
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -104,6 +104,9 @@ public:
   //! Write data in a compact (binary) format.
   static const Id Compact = 1;
 
+  //! Write data as chunks of raw frames with a binary header, see cedar::aux::BinaryRecording.
+  static const Id Binary = 2;
+
 protected:
   // none yet
 private:
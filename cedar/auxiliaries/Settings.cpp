@@ -59,7 +59,8 @@ cedar::aux::Settings::Settings()
 cedar::aux::Configurable(),
 mGlobalTimeFactor(1.0),
 _mMemoryDebugOutput(new cedar::aux::BoolParameter(this, "memory debug output", false)),
-_mRecorderSerializationFormat(new cedar::aux::EnumParameter(this, "recorder data format", cedar::aux::SerializationFormat::typePtr(), cedar::aux::SerializationFormat::CSV))
+_mRecorderSerializationFormat(new cedar::aux::EnumParameter(this, "recorder data format", cedar::aux::SerializationFormat::typePtr(), cedar::aux::SerializationFormat::CSV)),
+_mPublishFieldSnapshots(new cedar::aux::BoolParameter(this, "publish field snapshots", false))
 {
   _mRecorderWorkspace = new cedar::aux::DirectoryParameter
                         (
@@ -422,6 +423,11 @@ bool cedar::aux::Settings::getMemoryDebugOutput() const
   return this->_mMemoryDebugOutput->getValue();
 }
 
+bool cedar::aux::Settings::getPublishFieldSnapshots() const
+{
+  return this->_mPublishFieldSnapshots->getValue();
+}
+
 const std::set<std::string>& cedar::aux::Settings::pluginsToLoad()
 {
   return this->_mPluginsToLoad->get();
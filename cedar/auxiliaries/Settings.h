@@ -102,6 +102,12 @@ public:
   //! Whether or not memory output is generated.
   bool getMemoryDebugOutput() const;
 
+  /*!@brief Whether neural fields publish their activation and output (see cedar::aux::MatData::setPublishing).
+   *
+   *        Only affects fields that are created afterwards.
+   */
+  bool getPublishFieldSnapshots() const;
+
   //!@brief Returns the directory where the recorder will save the recorded files.
   std::string getRecorderOutputDirectory() const;
 
@@ -285,6 +291,9 @@ protected:
   //! Format of data written out by the recorder
   cedar::aux::EnumParameterPtr _mRecorderSerializationFormat;
 
+  //! Whether neural fields publish their activation and output.
+  cedar::aux::BoolParameterPtr _mPublishFieldSnapshots;
+
 private:
   // none yet
 
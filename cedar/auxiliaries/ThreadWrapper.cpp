@@ -260,6 +260,7 @@ void cedar::aux::ThreadWrapper::start()
     // we need a new worker object:
     mpWorker = resetWorker(); // overridden by children
     mpThread = new QThread();
+    mpThread->setObjectName(QString::fromStdString(this->getThreadName()));
 
     mpWorker->moveToThread(mpThread); // workers event loop belongs to
                                       // the new thread
@@ -533,6 +534,18 @@ bool cedar::aux::ThreadWrapper::getReallocateOnStart()
   QReadLocker locker(&mReallocateOnStartLock);
   return mReallocateOnStart;
 }
+
+void cedar::aux::ThreadWrapper::setThreadName(const std::string& name)
+{
+  QWriteLocker locker(&mThreadNameLock);
+  mThreadName = name;
+}
+
+std::string cedar::aux::ThreadWrapper::getThreadName() const
+{
+  QReadLocker locker(&mThreadNameLock);
+  return mThreadName;
+}
  
 void cedar::aux::ThreadWrapper::forceQuitThread()
 {
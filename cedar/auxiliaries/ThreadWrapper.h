@@ -206,6 +206,15 @@ public:
   //! Reallocate the worker and thread when re-starting?
   bool getReallocateOnStart();
 
+  /*!@brief Sets the name of the thread, e.g., as shown by the cedar::aux::Tracer and debuggers.
+   *
+   * The name is given to the thread when it is allocated, i.e., it takes effect on the next start().
+   */
+  void setThreadName(const std::string& name);
+
+  //! Returns the name given to the thread.
+  std::string getThreadName() const;
+
 public slots:
   //! slot called when thread finishes. context: the new thread
   void quittedThreadSlot(); 
@@ -278,6 +287,10 @@ private:
   mutable QReadWriteLock mThreadAndWorkerLock;
 
   mutable QReadWriteLock mReallocateOnStartLock;
+  //! name given to the thread when it is allocated
+  std::string mThreadName;
+  //! Lock for mThreadName
+  mutable QReadWriteLock mThreadNameLock;
 
 
   //!@brief stop is requested
@@ -0,0 +1,375 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        Tracer.cpp
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 18
+
+    Description: Implementation file for the class cedar::aux::Tracer.
+
+    Credits:
+
+======================================================================================================================*/
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CLASS HEADER
+#include "cedar/auxiliaries/Tracer.h"
+
+// CEDAR INCLUDES
+#include "cedar/auxiliaries/Path.h"
+#include "cedar/auxiliaries/exceptions.h"
+#include "cedar/auxiliaries/stringFunctions.h"
+
+// SYSTEM INCLUDES
+#include <QMutex>
+#include <QMutexLocker>
+#include <QThread>
+#include <QThreadStorage>
+#ifndef Q_MOC_RUN
+  #include <boost/date_time/posix_time/posix_time.hpp>
+  #include <boost/smart_ptr.hpp>
+#endif
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+
+//----------------------------------------------------------------------------------------------------------------------
+// helpers
+//----------------------------------------------------------------------------------------------------------------------
+
+namespace
+{
+  //! Ring buffer of the events recorded by one thread.
+  struct ThreadBuffer
+  {
+    //! Only contended while events are being read or cleared.
+    QMutex mLock;
+
+    /*! Recorded events; grows up to mCapacity events and is then used as a ring. The strings keep their capacity when
+     *  slots are reused.
+     */
+    std::vector<cedar::aux::Tracer::Event> mEvents;
+
+    //! Number of events kept.
+    size_t mCapacity;
+
+    //! Slot that is written next.
+    size_t mNext;
+
+    //! Number of valid events in the buffer.
+    size_t mCount;
+
+    //! Number and name of the thread.
+    unsigned int mThread;
+    std::string mThreadName;
+  };
+  typedef boost::shared_ptr<ThreadBuffer> ThreadBufferPtr;
+
+  //! Everything shared by the threads that record events.
+  struct TracerState
+  {
+    TracerState()
+    :
+    mEnabled(false),
+    mCapacity(10000),
+    mNextThread(0)
+    {
+    }
+
+    std::atomic<bool> mEnabled;
+    std::atomic<unsigned int> mCapacity;
+
+    //! Locks the list of buffers, but not the buffers themselves.
+    QMutex mBuffersLock;
+    std::vector<ThreadBufferPtr> mBuffers;
+    unsigned int mNextThread;
+
+    QThreadStorage<ThreadBufferPtr> mThreadBuffer;
+  };
+
+  TracerState& state()
+  {
+    static TracerState state;
+    return state;
+  }
+
+  //! Returns the buffer of the calling thread, creating it on first use.
+  ThreadBuffer& thread_buffer()
+  {
+    auto& tracer = state();
+    if (!tracer.mThreadBuffer.hasLocalData())
+    {
+      // the events are allocated as they are recorded, so that short traces don't take the full capacity
+      ThreadBufferPtr buffer(new ThreadBuffer());
+      buffer->mCapacity = tracer.mCapacity.load();
+      buffer->mNext = 0;
+      buffer->mCount = 0;
+
+      QMutexLocker locker(&tracer.mBuffersLock);
+      buffer->mThread = tracer.mNextThread++;
+      QString thread_name = QThread::currentThread()->objectName();
+      if (thread_name.isEmpty())
+      {
+        buffer->mThreadName = "thread " + cedar::aux::toString(buffer->mThread);
+      }
+      else
+      {
+        buffer->mThreadName = thread_name.toStdString();
+      }
+      tracer.mBuffers.push_back(buffer);
+      tracer.mThreadBuffer.setLocalData(buffer);
+    }
+    return *tracer.mThreadBuffer.localData();
+  }
+
+  //! Escapes a string so that it can be written as a JSON string.
+  void write_json_string(std::ostream& stream, const std::string& string)
+  {
+    stream << '"';
+    for (char c : string)
+    {
+      switch (c)
+      {
+        case '"':
+          stream << "\\\"";
+          break;
+        case '\\':
+          stream << "\\\\";
+          break;
+        case '\n':
+          stream << "\\n";
+          break;
+        case '\t':
+          stream << "\\t";
+          break;
+        default:
+          if (static_cast<unsigned char>(c) < 0x20)
+          {
+            char escaped[7];
+            std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned int>(c));
+            stream << escaped;
+          }
+          else
+          {
+            stream << c;
+          }
+      }
+    }
+    stream << '"';
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// methods
+//----------------------------------------------------------------------------------------------------------------------
+
+void cedar::aux::Tracer::setEnabled(bool enabled)
+{
+  state().mEnabled = enabled;
+}
+
+bool cedar::aux::Tracer::isEnabled()
+{
+  return state().mEnabled.load(std::memory_order_relaxed);
+}
+
+void cedar::aux::Tracer::setBufferCapacity(unsigned int eventsPerThread)
+{
+  if (eventsPerThread == 0)
+  {
+    CEDAR_THROW(cedar::aux::RangeException, "The tracer must be able to store at least one event per thread.");
+  }
+  state().mCapacity = eventsPerThread;
+}
+
+unsigned int cedar::aux::Tracer::getBufferCapacity()
+{
+  return state().mCapacity.load();
+}
+
+void cedar::aux::Tracer::record
+(
+  const char* category,
+  const std::string& name,
+  const std::string& detail,
+  const boost::posix_time::ptime& begin,
+  const boost::posix_time::ptime& end
+)
+{
+  if (!cedar::aux::Tracer::isEnabled())
+  {
+    return;
+  }
+
+  ThreadBuffer& buffer = thread_buffer();
+  QMutexLocker locker(&buffer.mLock);
+  if (buffer.mNext == buffer.mEvents.size())
+  {
+    buffer.mEvents.push_back(Event());
+  }
+  // assigning reuses the memory the strings of the slot already have
+  Event& event = buffer.mEvents[buffer.mNext];
+  event.mCategory = category;
+  event.mName = name;
+  event.mDetail = detail;
+  event.mBegin = begin;
+  event.mEnd = end;
+  event.mThread = buffer.mThread;
+
+  buffer.mNext = (buffer.mNext + 1) % buffer.mCapacity;
+  buffer.mCount = std::min(buffer.mCount + 1, buffer.mCapacity);
+}
+
+std::vector<cedar::aux::Tracer::Event> cedar::aux::Tracer::getEvents()
+{
+  std::vector<Event> events;
+
+  auto& tracer = state();
+  QMutexLocker buffers_locker(&tracer.mBuffersLock);
+  for (const auto& buffer : tracer.mBuffers)
+  {
+    QMutexLocker locker(&buffer->mLock);
+    if (buffer->mCount == 0)
+    {
+      continue;
+    }
+    size_t size = buffer->mEvents.size();
+    size_t first = (buffer->mNext + size - buffer->mCount) % size;
+    for (size_t i = 0; i < buffer->mCount; ++i)
+    {
+      events.push_back(buffer->mEvents[(first + i) % size]);
+    }
+  }
+
+  std::stable_sort
+  (
+    events.begin(),
+    events.end(),
+    [](const Event& a, const Event& b)
+    {
+      return a.mBegin < b.mBegin;
+    }
+  );
+  return events;
+}
+
+void cedar::aux::Tracer::clear()
+{
+  auto& tracer = state();
+  QMutexLocker buffers_locker(&tracer.mBuffersLock);
+
+  // buffers that are only referenced here belong to threads that no longer exist
+  tracer.mBuffers.erase
+  (
+    std::remove_if
+    (
+      tracer.mBuffers.begin(),
+      tracer.mBuffers.end(),
+      [](const ThreadBufferPtr& buffer)
+      {
+        return buffer.unique();
+      }
+    ),
+    tracer.mBuffers.end()
+  );
+
+  for (const auto& buffer : tracer.mBuffers)
+  {
+    QMutexLocker locker(&buffer->mLock);
+    std::vector<Event>().swap(buffer->mEvents);
+    buffer->mCapacity = tracer.mCapacity.load();
+    buffer->mNext = 0;
+    buffer->mCount = 0;
+  }
+}
+
+void cedar::aux::Tracer::writeChromeTrace(std::ostream& stream)
+{
+  std::vector<Event> events = cedar::aux::Tracer::getEvents();
+
+  std::vector<std::pair<unsigned int, std::string> > threads;
+  {
+    auto& tracer = state();
+    QMutexLocker buffers_locker(&tracer.mBuffersLock);
+    for (const auto& buffer : tracer.mBuffers)
+    {
+      threads.push_back(std::make_pair(buffer->mThread, buffer->mThreadName));
+    }
+  }
+
+  // time stamps are given in microseconds relative to the first event
+  boost::posix_time::ptime origin;
+  if (!events.empty())
+  {
+    origin = events.front().mBegin;
+  }
+
+  stream << "{\"traceEvents\":[";
+  bool first = true;
+  for (const auto& thread : threads)
+  {
+    stream << (first ? "\n" : ",\n");
+    first = false;
+    stream << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << thread.first << ",\"args\":{\"name\":";
+    write_json_string(stream, thread.second);
+    stream << "}}";
+  }
+
+  for (const auto& event : events)
+  {
+    stream << (first ? "\n" : ",\n");
+    first = false;
+    stream << "{\"name\":";
+    write_json_string(stream, event.mName);
+    stream << ",\"cat\":";
+    write_json_string(stream, event.mCategory);
+    stream << ",\"ph\":\"X\""
+           << ",\"ts\":" << (event.mBegin - origin).total_microseconds()
+           << ",\"dur\":" << (event.mEnd - event.mBegin).total_microseconds()
+           << ",\"pid\":1,\"tid\":" << event.mThread;
+    if (!event.mDetail.empty())
+    {
+      stream << ",\"args\":{\"detail\":";
+      write_json_string(stream, event.mDetail);
+      stream << "}";
+    }
+    stream << "}";
+  }
+  stream << "\n],\"displayTimeUnit\":\"ms\"}" << std::endl;
+}
+
+void cedar::aux::Tracer::writeChromeTrace(const cedar::aux::Path& path)
+{
+  std::ofstream stream(path.absolute().toString());
+  if (!stream.is_open())
+  {
+    CEDAR_THROW(cedar::aux::FileNotFoundException, "Could not open \"" + path.toString() + "\" for writing the trace.");
+  }
+  cedar::aux::Tracer::writeChromeTrace(stream);
+}
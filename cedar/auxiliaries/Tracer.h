@@ -0,0 +1,159 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        Tracer.h
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 18
+
+    Description: Header file for the class cedar::aux::Tracer.
+
+    Credits:
+
+======================================================================================================================*/
+
+#ifndef CEDAR_AUX_TRACER_H
+#define CEDAR_AUX_TRACER_H
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CEDAR INCLUDES
+
+// FORWARD DECLARATIONS
+#include "cedar/auxiliaries/Tracer.fwd.h"
+#include "cedar/auxiliaries/Path.fwd.h"
+
+// SYSTEM INCLUDES
+#ifndef Q_MOC_RUN
+  #include <boost/date_time/posix_time/posix_time_types.hpp>
+#endif
+#include <ostream>
+#include <string>
+#include <vector>
+
+
+/*!@brief Records when and on which thread named pieces of work begin and end, and exports them as a timeline.
+ *
+ *        Events are written into ring buffers, one per thread, so that threads never wait for each other when
+ *        recording. A buffer is allocated when its thread records the first event and grows up to the buffer capacity;
+ *        when it is full, its oldest events are overwritten. Tracing is off by default and can be switched on and off
+ *        at any time; while it is off, recording an event only costs reading a flag.
+ *
+ *        While tracing is on, each event copies its name and detail into its slot of the ring buffer. A slot keeps the
+ *        memory of its strings when it is reused, so recording allocates while a buffer fills up for the first time and
+ *        afterwards only for names longer than the ones the slot held before. Names that the caller has to assemble
+ *        cost their own allocations unless the caller reuses a buffer for them.
+ *
+ *        The recorded events can be exported in the trace event format that can be viewed in chrome://tracing or
+ *        Perfetto.
+ */
+class cedar::aux::Tracer
+{
+  //--------------------------------------------------------------------------------------------------------------------
+  // nested types
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //! A single recorded event.
+  struct Event
+  {
+    //! Category of the event, e.g., "step" or "lock"; points to a string literal.
+    const char* mCategory;
+
+    //! Name of the event, e.g., the name of a step.
+    std::string mName;
+
+    //! Additional information, e.g., the trigger that caused the event.
+    std::string mDetail;
+
+    //! Time at which the event began.
+    boost::posix_time::ptime mBegin;
+
+    //! Time at which the event ended.
+    boost::posix_time::ptime mEnd;
+
+    //! Number of the thread that recorded the event; threads are numbered in the order in which they first record.
+    unsigned int mThread;
+  };
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // constructors and destructor
+  //--------------------------------------------------------------------------------------------------------------------
+private:
+  //! This class only has static members.
+  Tracer();
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // public methods
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //! Switches recording of events on or off. Events that were recorded before are kept.
+  static void setEnabled(bool enabled);
+
+  //! Returns whether events are currently recorded.
+  static bool isEnabled();
+
+  /*!@brief Sets the number of events kept per thread.
+   *
+   *        Buffers of threads that already recorded events are resized on the next call to clear().
+   */
+  static void setBufferCapacity(unsigned int eventsPerThread);
+
+  //! Returns the number of events kept per thread.
+  static unsigned int getBufferCapacity();
+
+  /*!@brief Records an event of the calling thread. Does nothing if tracing is disabled.
+   *
+   * @param category Category of the event; used to filter events in the viewer. Must be a string literal, because
+   *                 only the pointer is stored.
+   * @param name     Name of the event.
+   * @param detail   Additional information shown for the event; may be empty.
+   * @param begin    Time at which the event began, as returned by boost::posix_time::microsec_clock::universal_time.
+   * @param end      Time at which the event ended.
+   */
+  static void record
+  (
+    const char* category,
+    const std::string& name,
+    const std::string& detail,
+    const boost::posix_time::ptime& begin,
+    const boost::posix_time::ptime& end
+  );
+
+  //! Returns all events that are currently stored, ordered by their beginning.
+  static std::vector<cedar::aux::Tracer::Event> getEvents();
+
+  //! Removes all stored events.
+  static void clear();
+
+  //! Writes all stored events as a JSON document in the trace event format.
+  static void writeChromeTrace(std::ostream& stream);
+
+  //! Writes all stored events to the given file, see writeChromeTrace(std::ostream&).
+  static void writeChromeTrace(const cedar::aux::Path& path);
+}; // class cedar::aux::Tracer
+
+#endif // CEDAR_AUX_TRACER_H
+
@@ -0,0 +1,154 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        TripleBuffer.h
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 18
+
+    Description: Header file for the class cedar::aux::TripleBuffer.
+
+    Credits:
+
+======================================================================================================================*/
+
+#ifndef CEDAR_AUX_TRIPLE_BUFFER_H
+#define CEDAR_AUX_TRIPLE_BUFFER_H
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CEDAR INCLUDES
+
+// FORWARD DECLARATIONS
+#include "cedar/auxiliaries/TripleBuffer.fwd.h"
+
+// SYSTEM INCLUDES
+#include <atomic>
+
+
+/*!@brief Hands the latest value from one writing thread to one reading thread without locking or copying.
+ *
+ *        Writer and reader each own one of three buffers; the third one is exchanged through an atomic index. The
+ *        writer fills its buffer and publishes it, which swaps it with the exchanged one. The reader calls update,
+ *        which swaps its buffer with the exchanged one if something new was published since. Neither side ever
+ *        waits for the other, and a value that is published before the reader picked up the previous one simply
+ *        replaces it.
+ *
+ * @remarks There must be at most one writing and one reading thread at a time; serialize further threads on each
+ *          side externally. The buffers are reused, so filling them does not allocate once they have their final size.
+ */
+template <typename T>
+class cedar::aux::TripleBuffer
+{
+  //--------------------------------------------------------------------------------------------------------------------
+  // constructors and destructor
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //!@brief The standard constructor.
+  TripleBuffer()
+  :
+  mWriteIndex(0),
+  mExchange(1),
+  mReadIndex(2)
+  {
+  }
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // public methods
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  /*!@brief Calls the given function for each of the three buffers, e.g., to allocate them.
+   *
+   * @remarks Only call this while neither the writer nor the reader accesses the buffer.
+   */
+  template <typename Function>
+  void initialize(Function function)
+  {
+    for (unsigned int i = 0; i < 3; ++i)
+    {
+      function(this->mBuffers[i]);
+    }
+  }
+
+  //! Returns the buffer the writer fills next.
+  T& getWriteBuffer()
+  {
+    return this->mBuffers[this->mWriteIndex];
+  }
+
+  //! Makes the write buffer available to the reader; the writer continues with another buffer.
+  void publish()
+  {
+    unsigned int previous = this->mExchange.exchange(this->mWriteIndex | FRESH, std::memory_order_acq_rel);
+    this->mWriteIndex = previous & INDEX_MASK;
+  }
+
+  /*!@brief Makes the most recently published buffer the read buffer.
+   *
+   * @returns False, without changing the read buffer, if nothing was published since the last update.
+   */
+  bool update()
+  {
+    if ((this->mExchange.load(std::memory_order_acquire) & FRESH) == 0)
+    {
+      return false;
+    }
+    unsigned int previous = this->mExchange.exchange(this->mReadIndex, std::memory_order_acq_rel);
+    this->mReadIndex = previous & INDEX_MASK;
+    return true;
+  }
+
+  //! Returns the buffer the reader got with the last successful update.
+  const T& getReadBuffer() const
+  {
+    return this->mBuffers[this->mReadIndex];
+  }
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // members
+  //--------------------------------------------------------------------------------------------------------------------
+private:
+  //! Marks the exchanged buffer as published but not yet read.
+  static const unsigned int FRESH = 4;
+
+  //! Extracts the buffer index from the exchanged value.
+  static const unsigned int INDEX_MASK = 3;
+
+  //! The three buffers.
+  T mBuffers[3];
+
+  //! Index of the buffer owned by the writer.
+  unsigned int mWriteIndex;
+
+  //! Index of the exchanged buffer, combined with FRESH.
+  std::atomic<unsigned int> mExchange;
+
+  //! Index of the buffer owned by the reader.
+  unsigned int mReadIndex;
+
+}; // class cedar::aux::TripleBuffer
+
+#endif // CEDAR_AUX_TRIPLE_BUFFER_H
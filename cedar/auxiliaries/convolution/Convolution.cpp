@@ -204,6 +204,23 @@ cv::Mat cedar::aux::conv::Convolution::convolve(const cv::Mat& matrix) const
   return this->getEngine()->convolve(matrix, this->getBorderType(), this->getMode(), this->getAlternateEvenKernelCenter());
 }
 
+void cedar::aux::conv::Convolution::convolveInto(const cv::Mat& matrix, cv::Mat& output) const
+{
+  this->getEngine()->convolveInto
+  (
+    matrix,
+    output,
+    this->getBorderType(),
+    this->getMode(),
+    this->getAlternateEvenKernelCenter()
+  );
+}
+
+void cedar::aux::conv::Convolution::prepare(const cv::Mat& matrix) const
+{
+  this->getEngine()->prepare(matrix);
+}
+
 cv::Mat cedar::aux::conv::Convolution::convolve
 (
   const cv::Mat& matrix,
@@ -106,6 +106,16 @@ public:
    */
   cv::Mat convolve(const cv::Mat& matrix) const;
 
+  /*!@brief Same as convolve(const cv::Mat&), but writes the result into output.
+   *
+   *        Depending on the engine, this avoids allocating a new result matrix in every call. matrix and output may
+   *        refer to the same matrix.
+   */
+  void convolveInto(const cv::Mat& matrix, cv::Mat& output) const;
+
+  //! Lets the engine prepare for convolving matrices of the same size and type as the given one.
+  void prepare(const cv::Mat& matrix) const;
+
   //! Checks whether the convolution engine can convolve the given matrices with the parameters set in this convolution.
   bool canConvolve(const cv::Mat& matrix, const cv::Mat& kernel) const;
 
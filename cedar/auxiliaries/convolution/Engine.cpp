@@ -62,6 +62,25 @@ cv::Mat cedar::aux::conv::Engine::convolveSeparable
   return this->convolve(matrix, cedar::aux::kernel::ConstKernelPtr(kernel), borderType, mode, alternateEvenCenter);
 }
 
+void cedar::aux::conv::Engine::convolveInto
+     (
+       const cv::Mat& matrix,
+       cv::Mat& output,
+       cedar::aux::conv::BorderType::Id borderType,
+       cedar::aux::conv::Mode::Id mode,
+       bool alternateEvenCenter
+     )
+     const
+{
+  // default implementation: call the normal convolve method
+  output = this->convolve(matrix, borderType, mode, alternateEvenCenter);
+}
+
+void cedar::aux::conv::Engine::prepare(const cv::Mat& /* matrix */) const
+{
+  // default implementation: nothing to prepare
+}
+
 void cedar::aux::conv::Engine::setKernelList(cedar::aux::conv::KernelListPtr kernelList)
 {
   CEDAR_DEBUG_ASSERT(kernelList.get() != nullptr);
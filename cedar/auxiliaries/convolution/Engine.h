@@ -90,6 +90,30 @@ public:
     bool alternateEvenCenter = false
   ) const = 0;
 
+  /*!@brief   Convolves a given matrix with the kernel list stored in this convolution object and writes the result into
+   *          output.
+   *
+   * @remarks As a default, this method assigns the result of the normal convolve function to output. Override this in
+   *          engines that can write into an existing matrix so that repeated convolutions do not allocate new memory.
+   *          matrix and output may refer to the same matrix.
+   */
+  virtual void convolveInto
+  (
+    const cv::Mat& matrix,
+    cv::Mat& output,
+    cedar::aux::conv::BorderType::Id borderType = cedar::aux::conv::BorderType::Replicate,
+    cedar::aux::conv::Mode::Id mode = cedar::aux::conv::Mode::Same,
+    bool alternateEvenCenter = false
+  ) const;
+
+  /*!@brief   Prepares the engine for convolving matrices of the same size and type as the given one.
+   *
+   * @remarks Engines that have to set up something expensive per matrix size, e.g., transformation plans, override this
+   *          so that the work can be done before a simulation starts rather than in its first step. The default
+   *          implementation does nothing.
+   */
+  virtual void prepare(const cv::Mat& matrix) const;
+
   /*!@brief   Convolves two matrices with each other.
    */
   virtual cv::Mat convolve
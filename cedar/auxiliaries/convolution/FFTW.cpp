@@ -58,12 +58,14 @@
 #ifdef CEDAR_USE_FFTW_THREADED
 #include <omp.h>
 #endif // CEDAR_USE_FFTW_THREADED
+#include <QMutex>
+#include <algorithm>
+#include <memory>
+#include <map>
 
 QReadWriteLock cedar::aux::conv::FFTW::mPlanLock;
 bool cedar::aux::conv::FFTW::mMultiThreadActivated = false;
 std::set<std::string> cedar::aux::conv::FFTW::mLoadedWisdoms;
-std::map<std::string, fftw_plan> cedar::aux::conv::FFTW::mForwardPlans;
-std::map<std::string, fftw_plan> cedar::aux::conv::FFTW::mBackwardPlans;
 
 //----------------------------------------------------------------------------------------------------------------------
 // register type with the factory
@@ -74,16 +76,525 @@ namespace
     = cedar::aux::conv::EngineManagerSingleton::getInstance()->registerType<cedar::aux::conv::FFTWPtr>();
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+// precision-dependent parts of the FFTW interface
+//----------------------------------------------------------------------------------------------------------------------
+namespace
+{
+  //! Maps the FFTW functions of one floating point precision to common names.
+  template <typename T> struct FFTWPrecision;
+
+  template <>
+  struct FFTWPrecision<double>
+  {
+    typedef fftw_plan Plan;
+    typedef fftw_complex Complex;
+
+    static std::string name()
+    {
+      return "fftw";
+    }
+
+    static Complex* allocate(size_t size)
+    {
+      return static_cast<Complex*>(fftw_malloc(sizeof(Complex) * size));
+    }
+
+    static double* allocateReal(size_t size)
+    {
+      return static_cast<double*>(fftw_malloc(sizeof(double) * size));
+    }
+
+    static void deallocate(void* buffer)
+    {
+      fftw_free(buffer);
+    }
+
+    static int alignmentOf(const double* buffer)
+    {
+      return fftw_alignment_of(const_cast<double*>(buffer));
+    }
+
+    static Plan planForward(int rank, const int* sizes, double* in, Complex* out, unsigned int flags)
+    {
+      return fftw_plan_dft_r2c(rank, sizes, in, out, flags);
+    }
+
+    static Plan planBackward(int rank, const int* sizes, Complex* in, double* out, unsigned int flags)
+    {
+      return fftw_plan_dft_c2r(rank, sizes, in, out, flags);
+    }
+
+    static void forward(Plan plan, double* in, Complex* out)
+    {
+      fftw_execute_dft_r2c(plan, in, out);
+    }
+
+    static void backward(Plan plan, Complex* in, double* out)
+    {
+      fftw_execute_dft_c2r(plan, in, out);
+    }
+
+    static void importWisdom(const std::string& path)
+    {
+      fftw_import_wisdom_from_filename(path.c_str());
+    }
+
+    static void exportWisdom(const std::string& path)
+    {
+      fftw_export_wisdom_to_filename(path.c_str());
+    }
+
+#ifdef CEDAR_USE_FFTW_THREADED
+    static void planWithThreads(int threads)
+    {
+      fftw_plan_with_nthreads(threads);
+    }
+#endif // CEDAR_USE_FFTW_THREADED
+  };
+
+#ifdef CEDAR_USE_FFTW_FLOAT
+  template <>
+  struct FFTWPrecision<float>
+  {
+    typedef fftwf_plan Plan;
+    typedef fftwf_complex Complex;
+
+    static std::string name()
+    {
+      return "fftwf";
+    }
+
+    static Complex* allocate(size_t size)
+    {
+      return static_cast<Complex*>(fftwf_malloc(sizeof(Complex) * size));
+    }
+
+    static float* allocateReal(size_t size)
+    {
+      return static_cast<float*>(fftwf_malloc(sizeof(float) * size));
+    }
+
+    static void deallocate(void* buffer)
+    {
+      fftwf_free(buffer);
+    }
+
+    static int alignmentOf(const float* buffer)
+    {
+      return fftwf_alignment_of(const_cast<float*>(buffer));
+    }
+
+    static Plan planForward(int rank, const int* sizes, float* in, Complex* out, unsigned int flags)
+    {
+      return fftwf_plan_dft_r2c(rank, sizes, in, out, flags);
+    }
+
+    static Plan planBackward(int rank, const int* sizes, Complex* in, float* out, unsigned int flags)
+    {
+      return fftwf_plan_dft_c2r(rank, sizes, in, out, flags);
+    }
+
+    static void forward(Plan plan, float* in, Complex* out)
+    {
+      fftwf_execute_dft_r2c(plan, in, out);
+    }
+
+    static void backward(Plan plan, Complex* in, float* out)
+    {
+      fftwf_execute_dft_c2r(plan, in, out);
+    }
+
+    static void importWisdom(const std::string& path)
+    {
+      fftwf_import_wisdom_from_filename(path.c_str());
+    }
+
+    static void exportWisdom(const std::string& path)
+    {
+      fftwf_export_wisdom_to_filename(path.c_str());
+    }
+
+#ifdef CEDAR_USE_FFTW_THREADED
+    static void planWithThreads(int threads)
+    {
+      fftwf_plan_with_nthreads(threads);
+    }
+#endif // CEDAR_USE_FFTW_THREADED
+  };
+#endif // CEDAR_USE_FFTW_FLOAT
+
+  //! Number of complex elements in the spectrum of a real matrix of the given sizes.
+  size_t getNumberOfTransformedElements(const std::vector<int>& sizes)
+  {
+    size_t transformed_elements = 1;
+    for (size_t dim = 0; dim + 1 < sizes.size(); ++dim)
+    {
+      transformed_elements *= static_cast<size_t>(sizes.at(dim));
+    }
+    transformed_elements *= static_cast<size_t>(sizes.back() / 2 + 1);
+    return transformed_elements;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// transformation of one precision
+//----------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+class cedar::aux::conv::FFTW::Transform
+{
+public:
+  typedef FFTWPrecision<T> Precision;
+  typedef typename Precision::Plan Plan;
+  typedef typename Precision::Complex Complex;
+
+  //! The forward and the backward plan for one matrix size.
+  struct Plans
+  {
+    Plan mForward;
+    Plan mBackward;
+  };
+
+  //! Plans indexed by the matrix sizes followed by the number of threads the plans were created for.
+  typedef std::map<std::vector<int>, Plans> PlanMap;
+
+  Transform()
+  :
+  mAllocatedSize(0),
+  mNumberOfElements(0),
+  mMatrixBuffer(nullptr),
+  mKernelBuffer(nullptr),
+  mAlignedBuffer(nullptr),
+  mRetransformKernel(true)
+  {
+  }
+
+  ~Transform()
+  {
+    this->freeBuffers();
+  }
+
+  //! Marks the cached kernel spectrum as outdated.
+  void kernelChanged()
+  {
+    QMutexLocker locker(&this->mLock);
+    this->mRetransformKernel = true;
+  }
+
+  /*! Convolves matrix (which must be of type T and continuous) with kernel and writes the result into output. The
+   *  spectrum of the kernel is only recomputed if the kernel or the size of the matrix has changed.
+   */
+  void convolve(const cv::Mat& matrix, const cv::Mat& kernel, cv::Mat& output)
+  {
+    const int type = cv::DataType<T>::type;
+    CEDAR_DEBUG_ASSERT(matrix.type() == type);
+    CEDAR_DEBUG_ASSERT(matrix.isContinuous());
+
+    std::vector<int> sizes(cedar::aux::math::getDimensionalityOf(matrix));
+    for (unsigned int dim = 0; dim < sizes.size(); ++dim)
+    {
+      sizes.at(dim) = matrix.size[dim];
+    }
+
+    // buffers, plans and the kernel spectrum are shared by all convolutions of this engine
+    QMutexLocker locker(&this->mLock);
+
+    // plans are only looked up when the size changes; until then, this transformation keeps using its own copy
+    if (sizes != this->mSizes)
+    {
+      this->mPlans = getPlans(sizes);
+      this->allocateBuffers(sizes);
+    }
+
+    Plan forward_plan = this->mPlans.mForward;
+    Plan backward_plan = this->mPlans.mBackward;
+
+    this->forward(forward_plan, matrix.ptr<T>(), this->mMatrixBuffer);
+
+    if (this->mRetransformKernel)
+    {
+      this->transformKernel(forward_plan, matrix, kernel);
+      this->mRetransformKernel = false;
+    }
+
+    // complex multiplication with the kernel spectrum, in place; the kernel spectrum already contains the normalization
+    T* p_matrix = reinterpret_cast<T*>(this->mMatrixBuffer);
+    const T* p_kernel = reinterpret_cast<const T*>(this->mKernelBuffer);
+    const size_t end = 2 * this->mAllocatedSize;
+    for (size_t i = 0; i < end; i += 2)
+    {
+      const T real = p_kernel[i] * p_matrix[i] - p_kernel[i + 1] * p_matrix[i + 1];
+      const T imaginary = p_kernel[i + 1] * p_matrix[i] + p_kernel[i] * p_matrix[i + 1];
+      p_matrix[i] = real;
+      p_matrix[i + 1] = imaginary;
+    }
+
+    // transform back directly into the output; the matrix has been read completely, so output may be the same
+    if (!output.isContinuous())
+    {
+      output.release();
+    }
+    output.create(matrix.dims, matrix.size, type);
+    T* p_output = output.ptr<T>();
+    if (isAligned(p_output))
+    {
+      Precision::backward(backward_plan, this->mMatrixBuffer, p_output);
+    }
+    else
+    {
+      T* aligned = this->getAlignedBuffer();
+      Precision::backward(backward_plan, this->mMatrixBuffer, aligned);
+      std::copy(aligned, aligned + this->mNumberOfElements, p_output);
+    }
+  }
+
+private:
+  /*! The plans are created for arrays allocated by FFTW; executing them on arrays with a different alignment is
+   *  undefined, see the FFTW documentation of the new-array execute functions.
+   */
+  static bool isAligned(const T* buffer)
+  {
+    return Precision::alignmentOf(buffer) == 0;
+  }
+
+  //! Forward transformation that copies the input into an aligned buffer first if necessary.
+  void forward(Plan plan, const T* input, Complex* output)
+  {
+    if (isAligned(input))
+    {
+      Precision::forward(plan, const_cast<T*>(input), output);
+    }
+    else
+    {
+      T* aligned = this->getAlignedBuffer();
+      std::copy(input, input + this->mNumberOfElements, aligned);
+      Precision::forward(plan, aligned, output);
+    }
+  }
+
+  //! Scratch buffer for matrices that aren't aligned; only allocated once such a matrix comes along.
+  T* getAlignedBuffer()
+  {
+    if (!this->mAlignedBuffer)
+    {
+      this->mAlignedBuffer = Precision::allocateReal(this->mNumberOfElements);
+    }
+    return this->mAlignedBuffer;
+  }
+
+  void allocateBuffers(const std::vector<int>& sizes)
+  {
+    this->freeBuffers();
+    this->mAllocatedSize = getNumberOfTransformedElements(sizes);
+    this->mNumberOfElements = 1;
+    for (auto size : sizes)
+    {
+      this->mNumberOfElements *= static_cast<size_t>(size);
+    }
+    this->mMatrixBuffer = Precision::allocate(this->mAllocatedSize);
+    this->mKernelBuffer = Precision::allocate(this->mAllocatedSize);
+    this->mSizes = sizes;
+    this->mRetransformKernel = true;
+  }
+
+  void freeBuffers()
+  {
+    if (this->mMatrixBuffer)
+    {
+      Precision::deallocate(this->mMatrixBuffer);
+      this->mMatrixBuffer = nullptr;
+    }
+
+    if (this->mKernelBuffer)
+    {
+      Precision::deallocate(this->mKernelBuffer);
+      this->mKernelBuffer = nullptr;
+    }
+
+    if (this->mAlignedBuffer)
+    {
+      Precision::deallocate(this->mAlignedBuffer);
+      this->mAlignedBuffer = nullptr;
+    }
+    this->mAllocatedSize = 0;
+    this->mNumberOfElements = 0;
+    this->mSizes.clear();
+  }
+
+  //! Pads and transforms the kernel; the normalization of the backward transformation is folded into the spectrum.
+  void transformKernel(Plan forwardPlan, const cv::Mat& matrix, const cv::Mat& kernel)
+  {
+    const int type = cv::DataType<T>::type;
+    cv::Mat kernel_typed;
+    if (kernel.type() != type)
+    {
+      kernel.convertTo(kernel_typed, type);
+    }
+    else
+    {
+      kernel_typed = kernel;
+    }
+
+    cv::Mat padded_kernel = cedar::aux::conv::FFTW::padKernel(matrix, kernel_typed);
+    this->forward(forwardPlan, padded_kernel.ptr<T>(), this->mKernelBuffer);
+
+    const T normalization = T(1) / static_cast<T>(matrix.total());
+    T* p_kernel = reinterpret_cast<T*>(this->mKernelBuffer);
+    const size_t end = 2 * this->mAllocatedSize;
+    for (size_t i = 0; i < end; ++i)
+    {
+      p_kernel[i] *= normalization;
+    }
+  }
+
+public:
+  /*! Returns the plans for matrices of the given sizes, creating them if necessary. Plans that exist already are found
+   *  without locking.
+   */
+  static Plans getPlans(const std::vector<int>& sizes)
+  {
+    std::vector<int> key = sizes;
+    key.push_back(cedar::aux::conv::FFTW::getNumberOfPlanningThreads());
+
+    std::shared_ptr<const PlanMap> plans = std::atomic_load(&mPlanMap);
+    if (plans)
+    {
+      auto entry = plans->find(key);
+      if (entry != plans->end())
+      {
+        return entry->second;
+      }
+    }
+
+    return createPlans(sizes, key);
+  }
+
+private:
+  static Plans createPlans(const std::vector<int>& sizes, const std::vector<int>& key)
+  {
+    QWriteLocker plan_locker(&cedar::aux::conv::FFTW::mPlanLock);
+#ifdef CEDAR_USE_FFTW_THREADED
+    cedar::aux::conv::FFTW::initThreads();
+#endif
+
+    // another thread may have created the plans while this one was waiting for the lock
+    std::shared_ptr<const PlanMap> plans = std::atomic_load(&mPlanMap);
+    if (plans)
+    {
+      auto entry = plans->find(key);
+      if (entry != plans->end())
+      {
+        return entry->second;
+      }
+    }
+
+    // the string identifier is only needed for the wisdom files and messages
+    std::string unique_identifier = cedar::aux::toString(sizes.at(0));
+    for (unsigned int i = 1; i < sizes.size(); ++i)
+    {
+      unique_identifier += "." + cedar::aux::toString(sizes.at(i));
+    }
+    cedar::aux::conv::FFTW::loadWisdom<T>(unique_identifier);
+
+#ifdef CEDAR_USE_FFTW_THREADED
+    Precision::planWithThreads(key.back());
+#endif
+
+    Plans created;
+    created.mForward = createPlan(sizes, true, unique_identifier);
+    created.mBackward = createPlan(sizes, false, unique_identifier);
+
+    // copy on write: readers keep the map they have loaded, the extended one replaces it atomically
+    std::shared_ptr<PlanMap> extended = plans ? std::make_shared<PlanMap>(*plans) : std::make_shared<PlanMap>();
+    (*extended)[key] = created;
+    std::atomic_store(&mPlanMap, std::shared_ptr<const PlanMap>(extended));
+
+    cedar::aux::conv::FFTW::saveWisdom<T>(unique_identifier);
+    return created;
+  }
+
+  //! Creates a (forward or backward) plan; the caller must hold the plan lock.
+  static Plan createPlan(const std::vector<int>& sizes, bool forward, const std::string& uniqueIdentifier)
+  {
+    // planning may overwrite the arrays, so it gets its own; they are allocated by FFTW to get its alignment
+    size_t elements = 1;
+    for (auto size : sizes)
+    {
+      elements *= static_cast<size_t>(size);
+    }
+    T* matrix = Precision::allocateReal(elements);
+    Complex* matrix_fourier = Precision::allocate(getNumberOfTransformedElements(sizes));
+    unsigned int flags = cedar::aux::SettingsSingleton::getInstance()->getFFTWPlanningStrategy();
+    Plan plan;
+    if (forward)
+    {
+      plan = Precision::planForward
+             (
+               static_cast<int>(sizes.size()), &(sizes.front()), matrix, matrix_fourier, flags
+             );
+    }
+    else
+    {
+      plan = Precision::planBackward
+             (
+               static_cast<int>(sizes.size()), &(sizes.front()), matrix_fourier, matrix, flags
+             );
+    }
+    Precision::deallocate(matrix_fourier);
+    Precision::deallocate(matrix);
+
+    if (!plan)
+    {
+      CEDAR_THROW
+      (
+        cedar::aux::NotFoundException,
+        "FFTW could not find a " + std::string(forward ? "forward" : "backward")
+        + " transformation plan for a matrix with sizes " + uniqueIdentifier
+        + ". You can try to alter the planning strategy."
+      );
+    }
+
+    return plan;
+  }
+
+private:
+  //! plans of all transformations of this precision; only ever replaced as a whole, see createPlans
+  static std::shared_ptr<const PlanMap> mPlanMap;
+
+  //! sizes of the matrix the buffers are allocated for
+  std::vector<int> mSizes;
+  //! plans for mSizes
+  Plans mPlans;
+  //! number of complex elements in each buffer
+  size_t mAllocatedSize;
+  //! number of real elements in matrices of mSizes
+  size_t mNumberOfElements;
+  //! spectrum of the matrix; the product with the kernel spectrum is stored here as well
+  Complex* mMatrixBuffer;
+  //! cached, normalized spectrum of the kernel
+  Complex* mKernelBuffer;
+  //! copy of matrices whose alignment differs from the one the plans were created for
+  T* mAlignedBuffer;
+  //! dirty flag if kernel has changed since last time
+  bool mRetransformKernel;
+  //! protects all of the above
+  QMutex mLock;
+};
+
+template <typename T>
+std::shared_ptr<const typename cedar::aux::conv::FFTW::Transform<T>::PlanMap>
+  cedar::aux::conv::FFTW::Transform<T>::mPlanMap;
+
 //----------------------------------------------------------------------------------------------------------------------
 // constructors and destructor
 //----------------------------------------------------------------------------------------------------------------------
 cedar::aux::conv::FFTW::FFTW()
 :
-mAllocatedSize(0),
-mMatrixBuffer(nullptr),
-mKernelBuffer(nullptr),
-mResultBuffer(nullptr),
-mRetransformKernel(true)
+#ifdef CEDAR_USE_FFTW_FLOAT
+mFloatTransform(new cedar::aux::conv::FFTW::Transform<float>()),
+#endif // CEDAR_USE_FFTW_FLOAT
+mDoubleTransform(new cedar::aux::conv::FFTW::Transform<double>())
 {
  this->connect(this, SIGNAL(kernelListChanged()), SLOT(kernelListChanged()));
 }
@@ -95,17 +606,32 @@ cv::Mat cedar::aux::conv::FFTW::convolve
 (
   const cv::Mat& matrix,
   cedar::aux::conv::BorderType::Id borderType,
+  cedar::aux::conv::Mode::Id mode,
+  bool alternateEvenCenter
+) const
+{
+  cv::Mat output;
+  this->convolveInto(matrix, output, borderType, mode, alternateEvenCenter);
+  return output;
+}
+
+void cedar::aux::conv::FFTW::convolveInto
+(
+  const cv::Mat& matrix,
+  cv::Mat& output,
+  cedar::aux::conv::BorderType::Id borderType,
   cedar::aux::conv::Mode::Id /* mode */,
   bool alternateEvenCenter
 ) const
 {
   if (this->getKernelList()->size() > 0)
   {
-    return this->convolveInternal(matrix, this->getKernelList()->getCombinedKernel(), borderType, alternateEvenCenter);
+    this->convolveInternal(matrix, this->getKernelList()->getCombinedKernel(), borderType, alternateEvenCenter, output);
   }
   else
   {
-    return cv::Mat(matrix.dims, matrix.size, matrix.type(), cv::Scalar(0.0));
+    output.create(matrix.dims, matrix.size, matrix.type());
+    output = cv::Scalar(0.0);
   }
 }
 
@@ -120,7 +646,9 @@ cv::Mat cedar::aux::conv::FFTW::convolve
 ) const
 {
   this->kernelChanged();
-  return this->convolveInternal(matrix, kernel, borderType, alternateEvenCenter);
+  cv::Mat output;
+  this->convolveInternal(matrix, kernel, borderType, alternateEvenCenter, output);
+  return output;
 }
 
 cv::Mat cedar::aux::conv::FFTW::convolve
@@ -133,7 +661,9 @@ cv::Mat cedar::aux::conv::FFTW::convolve
 ) const
 {
   this->kernelChanged();
-  return this->convolveInternal(matrix, kernel->getKernel(), borderType, alternateEvenCenter);
+  cv::Mat output;
+  this->convolveInternal(matrix, kernel->getKernel(), borderType, alternateEvenCenter, output);
+  return output;
 }
 
 cv::Mat cedar::aux::conv::FFTW::convolve
@@ -148,7 +678,9 @@ cv::Mat cedar::aux::conv::FFTW::convolve
   if (kernelList->size() > 0)
   {
     this->kernelChanged();
-    return this->convolveInternal(matrix, kernelList->getCombinedKernel(), borderType, alternateEvenCenter);
+    cv::Mat output;
+    this->convolveInternal(matrix, kernelList->getCombinedKernel(), borderType, alternateEvenCenter, output);
+    return output;
   }
   else
   {
@@ -156,13 +688,14 @@ cv::Mat cedar::aux::conv::FFTW::convolve
   }
 }
 
-cv::Mat cedar::aux::conv::FFTW::convolveInternal
-        (
-          const cv::Mat& matrixIn,
-          const cv::Mat& kernelIn,
-          cedar::aux::conv::BorderType::Id /* borderType */,
-          bool alternateEvenCenter
-        ) const
+void cedar::aux::conv::FFTW::convolveInternal
+     (
+       const cv::Mat& matrixIn,
+       const cv::Mat& kernelIn,
+       cedar::aux::conv::BorderType::Id /* borderType */,
+       bool alternateEvenCenter,
+       cv::Mat& output
+     ) const
 {
   cv::Mat matrix, kernel;
   if (alternateEvenCenter)
@@ -179,19 +712,26 @@ cv::Mat cedar::aux::conv::FFTW::convolveInternal
     cedar::aux::math::flip(matrixIn, matrix, flipped);
     cedar::aux::math::flip(kernelIn, kernel, flipped);
   }
-  else
+  else if (matrixIn.isContinuous())
   {
     matrix = matrixIn;
     kernel = kernelIn;
   }
+  else
+  {
+    matrix = matrixIn.clone();
+    kernel = kernelIn;
+  }
 
   if (cedar::aux::math::getDimensionalityOf(kernel) == 0)
   {
-    return matrix * cedar::aux::math::getMatrixEntry<double>(kernel, 0, 0);
+    matrix.convertTo(output, matrix.type(), cedar::aux::math::getMatrixEntry<double>(kernel, 0, 0));
+    return;
   }
   else if (cedar::aux::math::getDimensionalityOf(matrix) == 0)
   {
-    return cv::Mat(1, 1, kernel.type(), cv::sum(kernel * cedar::aux::math::getMatrixEntry<double>(matrix, 0, 0)));
+    output = cv::Mat(1, 1, kernel.type(), cv::sum(kernel * cedar::aux::math::getMatrixEntry<double>(matrix, 0, 0)));
+    return;
   }
   //!@todo Why the - 1?
   for (unsigned int dim = 0 ; dim < cedar::aux::math::getDimensionalityOf(matrix) - 1; ++dim)
@@ -208,134 +748,41 @@ cv::Mat cedar::aux::conv::FFTW::convolveInternal
     }
   }
 
-  cv::Mat matrix_64;
-  cv::Mat kernel_64;
-  if (matrix.type() != CV_64F)
-  {
-    matrix.convertTo(matrix_64, CV_64F);
-  }
-  else
-  {
-    CEDAR_ASSERT(matrix.type() == CV_64F);
-    matrix_64 = matrix;
-  }
-
-  if (kernel.type() != CV_64F)
-  {
-    kernel.convertTo(kernel_64, CV_64F);
-  }
-  else
-  {
-    CEDAR_ASSERT(kernel.type() == CV_64F);
-    kernel_64 = kernel;
-  }
-
-  cv::Mat output = matrix_64.clone();
-  output = 0.0;
-  cv::Mat padded_kernel = this->padKernel(matrix_64, kernel_64);
+  // when flipping, the result has to be flipped back into the output afterwards
+  cv::Mat flipped_result;
+  cv::Mat& result = alternateEvenCenter ? flipped_result : output;
 
-  unsigned int transformed_elements = 1;
-  double number_of_elements = 1.0;
-  for (unsigned int dim = 0 ; dim < cedar::aux::math::getDimensionalityOf(matrix_64) - 1; ++dim)
+  switch (matrix.type())
   {
-    transformed_elements *= matrix_64.size[dim];
-    number_of_elements *= matrix_64.size[dim];
-  }
-  transformed_elements *= matrix_64.size[cedar::aux::math::getDimensionalityOf(matrix_64) -1] / 2 + 1;
-  number_of_elements *= matrix_64.size[cedar::aux::math::getDimensionalityOf(matrix_64) -1];
+#ifdef CEDAR_USE_FFTW_FLOAT
+    case CV_32F:
+      this->mFloatTransform->convolve(matrix, kernel, result);
+      break;
+#endif // CEDAR_USE_FFTW_FLOAT
 
-  if (transformed_elements != mAllocatedSize)
-  {
-    if (mMatrixBuffer)
-    {
-      fftw_free(mMatrixBuffer);
-    }
+    case CV_64F:
+      this->mDoubleTransform->convolve(matrix, kernel, result);
+      break;
 
-    if (mResultBuffer)
-    {
-      fftw_free(mResultBuffer);
-    }
-
-    if (mKernelBuffer)
+    default:
     {
-      fftw_free(mKernelBuffer);
+      cv::Mat matrix_64, result_64;
+      matrix.convertTo(matrix_64, CV_64F);
+      this->mDoubleTransform->convolve(matrix_64, kernel, result_64);
+      result_64.convertTo(result, matrix.type());
     }
-
-    mMatrixBuffer = (fftw_complex*) fftw_malloc(sizeof(fftw_complex) * transformed_elements);
-    mResultBuffer = (fftw_complex*) fftw_malloc(sizeof(fftw_complex) * transformed_elements);
-    mKernelBuffer = (fftw_complex*) fftw_malloc(sizeof(fftw_complex) * transformed_elements);
-    mAllocatedSize = transformed_elements;
-    QWriteLocker write_lock(&this->mKernelTransformLock);
-    this->mRetransformKernel = true;
-  }
-
-//  fftw_execute(matrix_plan_forward);
-  std::vector<unsigned int> mat_sizes(cedar::aux::math::getDimensionalityOf(matrix_64));
-  for (unsigned int dim = 0; dim < mat_sizes.size(); ++dim)
-  {
-   mat_sizes.at(dim) = static_cast<unsigned int>(matrix.size[dim]);
-  }
-
-  fftw_execute_dft_r2c
-  (
-    cedar::aux::conv::FFTW::getForwardPlan(cedar::aux::math::getDimensionalityOf(matrix_64), mat_sizes),
-    const_cast<double*>(matrix_64.ptr<double>()),
-    mMatrixBuffer
-  );
-
-  QWriteLocker write_lock(&this->mKernelTransformLock);
-  if (this->mRetransformKernel)
-  {
-    fftw_execute_dft_r2c
-    (
-      cedar::aux::conv::FFTW::getForwardPlan(cedar::aux::math::getDimensionalityOf(padded_kernel), mat_sizes),
-      const_cast<double*>(padded_kernel.ptr<double>()),
-      mKernelBuffer
-    );
-    this->mRetransformKernel = false;
-  }
-  write_lock.unlock();
-
-  // go trough all data points
-  for (unsigned int xyz = 0; xyz < transformed_elements; ++xyz)
-  {
-    // complex multiplication (lateral)
-    mResultBuffer[xyz][0] = (mKernelBuffer[xyz][0] * mMatrixBuffer[xyz][0] - mKernelBuffer[xyz][1] * mMatrixBuffer[xyz][1]) / number_of_elements;
-    mResultBuffer[xyz][1] = (mKernelBuffer[xyz][1] * mMatrixBuffer[xyz][0] + mKernelBuffer[xyz][0] * mMatrixBuffer[xyz][1]) / number_of_elements;
-  }
-
-  // transform interaction back to time domain (ifft)
-  fftw_execute_dft_c2r
-  (
-    cedar::aux::conv::FFTW::getBackwardPlan(cedar::aux::math::getDimensionalityOf(output), mat_sizes),
-    mResultBuffer,
-    const_cast<double*>(output.ptr<double>())
-  );
-
-  cv::Mat returned;
-  if (matrix.type() != CV_64F)
-  {
-    output.convertTo(returned, matrix.type());
-  }
-  else
-  {
-    returned = output;
   }
 
   if (alternateEvenCenter)
   {
-    // to alternate the kernel center, we flip all inputs and then flip the result back
     std::vector<bool> flipped;
     flipped.assign(cedar::aux::math::getDimensionalityOf(matrixIn), true);
-    cv::Mat tmp_returned = returned.clone() * 0.0;
-    cedar::aux::math::flip(returned, tmp_returned, flipped);
-    returned = tmp_returned;
+    output.create(flipped_result.dims, flipped_result.size, flipped_result.type());
+    cedar::aux::math::flip(flipped_result, output, flipped);
   }
-
-  return returned;
 }
 
-cv::Mat cedar::aux::conv::FFTW::padKernel(const cv::Mat& matrix, const cv::Mat& kernel) const
+cv::Mat cedar::aux::conv::FFTW::padKernel(const cv::Mat& matrix, const cv::Mat& kernel)
 {
   /* prepare the kernel for Fourier transform (pad to matrix size and flip); example for 2D:
    * 010    211
@@ -498,171 +945,76 @@ bool cedar::aux::conv::FFTW::checkModeCapability
   return mode == cedar::aux::conv::Mode::Same;
 }
 
+void cedar::aux::conv::FFTW::prepare(const cv::Mat& matrix) const
+{
+  std::vector<int> sizes(cedar::aux::math::getDimensionalityOf(matrix));
+  for (unsigned int dim = 0; dim < sizes.size(); ++dim)
+  {
+    sizes.at(dim) = matrix.size[dim];
+  }
+  cedar::aux::conv::FFTW::warmUp(sizes, matrix.type());
+}
+
+void cedar::aux::conv::FFTW::warmUp(const std::vector<int>& sizes, int type)
+{
+  if (sizes.empty())
+  {
+    // nothing is transformed for scalars
+    return;
+  }
+
+  // same choice of precision as in convolveInternal
+  if (type == CV_32F)
+  {
+#ifdef CEDAR_USE_FFTW_FLOAT
+    cedar::aux::conv::FFTW::Transform<float>::getPlans(sizes);
+    return;
+#endif // CEDAR_USE_FFTW_FLOAT
+  }
+  cedar::aux::conv::FFTW::Transform<double>::getPlans(sizes);
+}
+
+int cedar::aux::conv::FFTW::getNumberOfPlanningThreads()
+{
+#ifdef CEDAR_USE_FFTW_THREADED
+  return static_cast<int>(cedar::aux::SettingsSingleton::getInstance()->getFFTWNumberOfThreads());
+#else
+  return 1;
+#endif // CEDAR_USE_FFTW_THREADED
+}
+
+template <typename T>
 void cedar::aux::conv::FFTW::loadWisdom(const std::string& uniqueIdentifier)
 {
-  if (cedar::aux::conv::FFTW::mLoadedWisdoms.find(uniqueIdentifier) == cedar::aux::conv::FFTW::mLoadedWisdoms.end())
+  const std::string precision = FFTWPrecision<T>::name();
+  if (cedar::aux::conv::FFTW::mLoadedWisdoms.find(precision + "." + uniqueIdentifier)
+      == cedar::aux::conv::FFTW::mLoadedWisdoms.end())
   {
     std::string path = cedar::aux::getUserApplicationDataDirectory()
-                         + "/.cedar/fftw/fftw."
+                         + "/.cedar/fftw/" + precision + "."
                          + CEDAR_BUILT_ON_MACHINE + "."
                          + cedar::aux::toString(cedar::aux::SettingsSingleton::getInstance()->getFFTWNumberOfThreads()) + "."
                          + cedar::aux::toString(cedar::aux::SettingsSingleton::getInstance()->getFFTWPlanningStrategyString()) + "."
                          + uniqueIdentifier + "."
                          + "wisdom";
-    fftw_import_wisdom_from_filename(path.c_str());
-    cedar::aux::conv::FFTW::mLoadedWisdoms.insert(uniqueIdentifier);
+    FFTWPrecision<T>::importWisdom(path);
+    cedar::aux::conv::FFTW::mLoadedWisdoms.insert(precision + "." + uniqueIdentifier);
   }
 }
 
+template <typename T>
 void cedar::aux::conv::FFTW::saveWisdom(const std::string& uniqueIdentifier)
 {
   cedar::aux::Path path = cedar::aux::getUserApplicationDataDirectory()
-                          + "/.cedar/fftw/fftw."
+                          + "/.cedar/fftw/" + FFTWPrecision<T>::name() + "."
                           + CEDAR_BUILT_ON_MACHINE + "."
                           + cedar::aux::toString(cedar::aux::SettingsSingleton::getInstance()->getFFTWNumberOfThreads()) + "."
                           + cedar::aux::toString(cedar::aux::SettingsSingleton::getInstance()->getFFTWPlanningStrategyString()) + "."
                           + uniqueIdentifier + "."
                           + "wisdom";
   path.createDirectories();
-                       
-  fftw_export_wisdom_to_filename(path.toString().c_str());
-}
-
-fftw_plan cedar::aux::conv::FFTW::getForwardPlan(unsigned int dimensionality, std::vector<unsigned int> sizes)
-{
-  CEDAR_ASSERT(sizes.size() == dimensionality);
-  std::string unique_identifier = cedar::aux::toString(sizes.at(0));
-  for (unsigned int i = 1; i < sizes.size(); ++i)
-  {
-    unique_identifier += "." + cedar::aux::toString(sizes.at(i));
-  }
-  auto entry = cedar::aux::conv::FFTW::mForwardPlans.find(unique_identifier);
-  if (entry != cedar::aux::conv::FFTW::mForwardPlans.end())
-  {
-    return entry->second;
-  }
-  else
-  {
-#ifdef CEDAR_USE_FFTW_THREADED
-    cedar::aux::conv::FFTW::initThreads();
-#endif
-    QWriteLocker plan_locker(&cedar::aux::conv::FFTW::mPlanLock);
-    cedar::aux::conv::FFTW::loadWisdom(unique_identifier);
-    std::vector<int> sizes_signed(sizes.size());
-    for (unsigned int i = 0; i < sizes_signed.size(); ++i)
-    {
-      sizes_signed.at(i) = static_cast<int>(sizes.at(i));
-    }
 
-    cv::Mat matrix(dimensionality, &(sizes_signed.front()), CV_64F);
-
-    unsigned int transformed_elements = 1;
-    double number_of_elements = 1.0;
-    for (unsigned int dim = 0 ; dim < cedar::aux::math::getDimensionalityOf(matrix) - 1; ++dim)
-    {
-      transformed_elements *= matrix.size[dim];
-      number_of_elements *= matrix.size[dim];
-    }
-    transformed_elements *= matrix.size[cedar::aux::math::getDimensionalityOf(matrix) -1] / 2 + 1;
-    number_of_elements *= matrix.size[cedar::aux::math::getDimensionalityOf(matrix) -1];
-
-    fftw_complex* matrix_fourier = (fftw_complex*) fftw_malloc(sizeof(fftw_complex) * transformed_elements);
-    fftw_plan matrix_plan_forward
-      = fftw_plan_dft_r2c
-        (
-          cedar::aux::math::getDimensionalityOf(matrix),
-          matrix.size,
-          const_cast<double*>(matrix.clone().ptr<double>()),
-          matrix_fourier,
-          cedar::aux::SettingsSingleton::getInstance()->getFFTWPlanningStrategy()
-        );
-    fftw_free(matrix_fourier);
-    if (matrix_plan_forward)
-    {
-      cedar::aux::conv::FFTW::mForwardPlans[unique_identifier] = matrix_plan_forward;
-      cedar::aux::conv::FFTW::saveWisdom(unique_identifier);
-      plan_locker.unlock();
-      return matrix_plan_forward;
-    }
-    else
-    {
-      plan_locker.unlock();
-      CEDAR_THROW
-      (
-        cedar::aux::NotFoundException,
-        "FFTW could not find a forward transformation plan for a matrix with sizes " + unique_identifier
-        + ". You can try to alter the planning strategy."
-      );
-    }
-  }
-}
-
-fftw_plan cedar::aux::conv::FFTW::getBackwardPlan(unsigned int dimensionality, std::vector<unsigned int> sizes)
-{
-  CEDAR_ASSERT(sizes.size() == dimensionality);
-  std::string unique_identifier = cedar::aux::toString(sizes.at(0));
-  for (unsigned int i = 1; i < sizes.size(); ++i)
-  {
-    unique_identifier += "." + cedar::aux::toString(sizes.at(i));
-  }
-  auto entry = cedar::aux::conv::FFTW::mBackwardPlans.find(unique_identifier);
-  if (entry != cedar::aux::conv::FFTW::mBackwardPlans.end())
-  {
-    return entry->second;
-  }
-  else
-  {
-#ifdef CEDAR_USE_FFTW_THREADED
-    cedar::aux::conv::FFTW::initThreads();
-#endif
-    QWriteLocker plan_locker(&cedar::aux::conv::FFTW::mPlanLock);
-    cedar::aux::conv::FFTW::loadWisdom(unique_identifier);
-    std::vector<int> sizes_signed(sizes.size());
-    for (unsigned int i = 0; i < sizes_signed.size(); ++i)
-    {
-      sizes_signed.at(i) = static_cast<int>(sizes.at(i));
-    }
-
-    cv::Mat matrix(dimensionality, &(sizes_signed.front()), CV_64F);
-
-    unsigned int transformed_elements = 1;
-    double number_of_elements = 1.0;
-    for (unsigned int dim = 0 ; dim < cedar::aux::math::getDimensionalityOf(matrix) - 1; ++dim)
-    {
-      transformed_elements *= matrix.size[dim];
-      number_of_elements *= matrix.size[dim];
-    }
-    transformed_elements *= matrix.size[cedar::aux::math::getDimensionalityOf(matrix) -1] / 2 + 1;
-    number_of_elements *= matrix.size[cedar::aux::math::getDimensionalityOf(matrix) -1];
-
-    fftw_complex* matrix_fourier = (fftw_complex*) fftw_malloc(sizeof(fftw_complex) * transformed_elements);
-    fftw_plan matrix_plan_backward
-      = fftw_plan_dft_c2r
-        (
-          cedar::aux::math::getDimensionalityOf(matrix),
-          matrix.size,
-          matrix_fourier,
-          const_cast<double*>(matrix.ptr<double>()),
-          cedar::aux::SettingsSingleton::getInstance()->getFFTWPlanningStrategy()
-        );
-    fftw_free(matrix_fourier);
-    if (matrix_plan_backward)
-    {
-      cedar::aux::conv::FFTW::mBackwardPlans[unique_identifier] = matrix_plan_backward;
-      cedar::aux::conv::FFTW::saveWisdom(unique_identifier);
-      plan_locker.unlock();
-      return matrix_plan_backward;
-    }
-    else
-    {
-      CEDAR_THROW
-      (
-        cedar::aux::NotFoundException,
-        "FFTW could not find a backward transformation plan for a matrix with sizes " + unique_identifier
-        + ". You can try to alter the planning strategy."
-      );
-    }
-  }
+  FFTWPrecision<T>::exportWisdom(path.toString());
 }
 
 void cedar::aux::conv::FFTW::initThreads()
@@ -674,8 +1026,11 @@ void cedar::aux::conv::FFTW::initThreads()
     fftw_init_threads();
     omp_set_num_threads(cedar::aux::SettingsSingleton::getInstance()->getFFTWNumberOfThreads());
     fftw_set_timelimit(30.0);
-    // from now on, all plans are generated for n threads
-    fftw_plan_with_nthreads(cedar::aux::SettingsSingleton::getInstance()->getFFTWNumberOfThreads());
+#ifdef CEDAR_USE_FFTW_FLOAT
+    fftwf_init_threads();
+    fftwf_set_timelimit(30.0);
+#endif // CEDAR_USE_FFTW_FLOAT
+    // the number of threads is set before each planning, see Transform::createPlans
     // make sure that we do not initialize this again
     mMultiThreadActivated = true;
   }
@@ -684,8 +1039,10 @@ void cedar::aux::conv::FFTW::initThreads()
 
 void cedar::aux::conv::FFTW::kernelChanged() const
 {
-  QWriteLocker write_lock(&this->mKernelTransformLock);
-  this->mRetransformKernel = true;
+#ifdef CEDAR_USE_FFTW_FLOAT
+  this->mFloatTransform->kernelChanged();
+#endif // CEDAR_USE_FFTW_FLOAT
+  this->mDoubleTransform->kernelChanged();
 }
 
 void cedar::aux::conv::FFTW::kernelListChanged()
@@ -50,8 +50,10 @@
 // SYSTEM INCLUDES
 #include <opencv2/opencv.hpp>
 #include <fftw3.h>
+#ifndef Q_MOC_RUN
+  #include <boost/shared_ptr.hpp>
+#endif
 #include <vector>
-#include <map>
 #include <string>
 #include <set>
 
@@ -80,6 +82,15 @@ public:
     bool alternateEvenCenter = false
   ) const;
 
+  void convolveInto
+  (
+    const cv::Mat& matrix,
+    cv::Mat& output,
+    cedar::aux::conv::BorderType::Id borderType = cedar::aux::conv::BorderType::Replicate,
+    cedar::aux::conv::Mode::Id mode = cedar::aux::conv::Mode::Same,
+    bool alternateEvenCenter = false
+  ) const;
+
   cv::Mat convolve
   (
     const cv::Mat& matrix,
@@ -134,32 +145,56 @@ public:
     cedar::aux::conv::Mode::Id mode
   ) const;
 
+  //! Creates the transformation plans for matrices of the same size and type as the given one.
+  void prepare(const cv::Mat& matrix) const;
+
+  /*!@brief Creates the transformation plans for matrices of the given sizes and type in advance.
+   *
+   *        Planning can take seconds with the more thorough planning strategies; calling this when an architecture is
+   *        loaded keeps it out of the first simulation step. Wisdom stored by earlier runs is used when available. Plans
+   *        are shared by all FFTW engines, so this only has to be done once per size.
+   */
+  static void warmUp(const std::vector<int>& sizes, int type = CV_32F);
+
   //--------------------------------------------------------------------------------------------------------------------
   // protected methods
   //--------------------------------------------------------------------------------------------------------------------
 protected:
-  //!@brief the internal version of the convolve method, currently called by all interface methods
-  cv::Mat convolveInternal
+  /*!@brief the internal version of the convolve method, currently called by all interface methods
+   *
+   *        CV_32F matrices are transformed in single precision, all others in double precision. The result has the type
+   *        of matrix and is written into output, which is only reallocated if its size or type does not fit.
+   */
+  void convolveInternal
   (
     const cv::Mat& matrix,
     const cv::Mat& kernel,
     cedar::aux::conv::BorderType::Id borderType,
-    bool alternateEvenCenter
+    bool alternateEvenCenter,
+    cv::Mat& output
   ) const;
 
   //!@brief adjusts the size of the kernel (to matrix size) and flips sectors
-  cv::Mat padKernel(const cv::Mat& matrix, const cv::Mat& kernel) const;
+  static cv::Mat padKernel(const cv::Mat& matrix, const cv::Mat& kernel);
 
   //--------------------------------------------------------------------------------------------------------------------
   // private methods
   //--------------------------------------------------------------------------------------------------------------------
 private:
-  static fftw_plan getForwardPlan(unsigned int dimensionality, std::vector<unsigned int> sizes);
-  static fftw_plan getBackwardPlan(unsigned int dimensionality, std::vector<unsigned int> sizes);
-  static void loadWisdom(const std::string& uniqueIdentifier);
-  static void saveWisdom(const std::string& uniqueIdentifier);
+  /*!@brief Transformation buffers, cached kernel spectrum and plans for one floating point precision (float or double).
+   *
+   *        Defined in the source file.
+   */
+  template <typename T> class Transform;
+
+  template <typename T> static void loadWisdom(const std::string& uniqueIdentifier);
+  template <typename T> static void saveWisdom(const std::string& uniqueIdentifier);
+  //! Initializes the threaded FFTW libraries once; the caller must hold the plan lock.
   static void initThreads();
 
+  //! The number of threads plans are currently created for; part of the key under which plans are cached.
+  static int getNumberOfPlanningThreads();
+
 private slots:
   void kernelChanged() const;
   void kernelListChanged();
@@ -170,19 +205,17 @@ private slots:
 protected:
   // none yet
 private:
-  //!@brief plan creation and destruction is not thread-safe, must be locked
+  //!@brief plan creation and destruction is not thread-safe, must be locked; looking up existing plans is lock-free
   static QReadWriteLock mPlanLock;
+  //! whether initThreads ran; guarded by mPlanLock
   static bool mMultiThreadActivated;
   static std::set<std::string> mLoadedWisdoms;
-  static std::map<std::string, fftw_plan> mForwardPlans;
-  static std::map<std::string, fftw_plan> mBackwardPlans;
-  mutable unsigned int mAllocatedSize;
-  mutable fftw_complex* mMatrixBuffer;
-  mutable fftw_complex* mKernelBuffer;
-  mutable fftw_complex* mResultBuffer;
-  // dirty flag if kernel has changed since last time
-  mutable bool mRetransformKernel;
-  mutable QReadWriteLock mKernelTransformLock;
+#ifdef CEDAR_USE_FFTW_FLOAT
+  //! single precision transformation, used for CV_32F matrices
+  boost::shared_ptr<Transform<float> > mFloatTransform;
+#endif // CEDAR_USE_FFTW_FLOAT
+  //! double precision transformation, used for all other matrices (and CV_32F ones if fftw3f isn't available)
+  boost::shared_ptr<Transform<double> > mDoubleTransform;
 }; // cedar::aux::conv::FFTW
 
 #endif // CEDAR_FFTW
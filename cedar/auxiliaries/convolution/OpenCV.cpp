@@ -38,13 +38,18 @@
 #include "cedar/auxiliaries/convolution/OpenCV.h"
 #include "cedar/auxiliaries/convolution/BorderType.h"
 #include "cedar/auxiliaries/convolution/Mode.h"
+#include "cedar/auxiliaries/convolution/Strategy.h"
 #include "cedar/auxiliaries/convolution/EngineManager.h"
 #include "cedar/auxiliaries/kernel/Separable.h"
 #include "cedar/auxiliaries/math/tools.h"
 #include "cedar/auxiliaries/casts.h"
+#include "cedar/auxiliaries/parallelFunctions.h"
 
 
 // SYSTEM INCLUDES
+#include <algorithm>
+#include <limits>
+#include <cmath>
 
 //----------------------------------------------------------------------------------------------------------------------
 // register type with the factory
@@ -55,10 +60,68 @@ namespace
     = cedar::aux::conv::EngineManagerSingleton::getInstance()->registerType<cedar::aux::conv::OpenCVPtr>();
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+// cost model
+//----------------------------------------------------------------------------------------------------------------------
+namespace
+{
+  // all costs are in (roughly) multiply-adds per element; the constants were chosen such that the crossover points
+  // measured by the convolution strategy benchmark (tests/performance/auxiliaries/convolution/Strategies) fit
+
+  //! Additional cost per element of every pass over the matrix, i.e., for writing out the intermediate result.
+  const double pass_overhead = 2.0;
+
+  //! Multiply-adds per element and per log2(size) of one real-valued discrete fourier transform.
+  const double dft_factor = 1.25;
+
+  //! Cost per element of multiplying the spectra and of padding and cropping the matrices.
+  const double dft_element_overhead = 4.0;
+
+  //! Returns the sizes of the matrix along its actual dimensions, i.e., one size for vectors and none for scalars.
+  std::vector<int> shape_of(const cv::Mat& matrix)
+  {
+    std::vector<int> sizes;
+    switch (cedar::aux::math::getDimensionalityOf(matrix))
+    {
+      case 0:
+        break;
+
+      case 1:
+        sizes.push_back(static_cast<int>(matrix.total()));
+        break;
+
+      default:
+        for (int d = 0; d < matrix.dims; ++d)
+        {
+          sizes.push_back(matrix.size[d]);
+        }
+    }
+    return sizes;
+  }
+
+  //! Returns a 2d header for the plane at the given index along the first dimension of a continuous 3d matrix.
+  cv::Mat plane_of(const cv::Mat& matrix, int index)
+  {
+    CEDAR_DEBUG_ASSERT(matrix.dims == 3 && matrix.isContinuous());
+    return cv::Mat(matrix.size[1], matrix.size[2], matrix.type(), const_cast<uchar*>(matrix.ptr(index)));
+  }
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 // constructors and destructor
 //----------------------------------------------------------------------------------------------------------------------
 
+cedar::aux::conv::OpenCV::IntoKernel::IntoKernel()
+:
+mMatrixRows(-1),
+mMatrixCols(-1),
+mKernelRows(-1),
+mKernelCols(-1),
+mSeparable(false),
+mStrategy(cedar::aux::conv::Strategy::Direct)
+{
+}
+
 cedar::aux::conv::OpenCV::OpenCV()
 {
 }
@@ -83,7 +146,13 @@ bool cedar::aux::conv::OpenCV::checkCapability
      )
      const
 {
-  if (matrixDim > 2 || kernelDim > 2)
+  if (matrixDim > 3 || kernelDim > 3)
+  {
+    return false;
+  }
+
+  // three-dimensional convolutions are only implemented plane by plane, i.e., for matching kernels and mode same
+  if ((matrixDim == 3 || kernelDim == 3) && (matrixDim != kernelDim || mode != cedar::aux::conv::Mode::Same))
   {
     return false;
   }
@@ -143,31 +212,34 @@ bool cedar::aux::conv::OpenCV::checkModeCapability
 void cedar::aux::conv::OpenCV::translateAnchor
      (
        cv::Point& anchor,
-       std::vector<int> anchor_vector,
+       const std::vector<int>& anchor_vector,
        const std::vector<int>& sizes,
        bool alternateEvenCenter
      ) const
 {
-  anchor = cv::Point(-1, -1);
-
-  if (alternateEvenCenter && anchor_vector.size() < 1)
-  {
-    anchor_vector.push_back(0);
-  }
-  if (alternateEvenCenter && anchor_vector.size() < 2)
-  {
-    anchor_vector.push_back(0);
-  }
+  const int* size_array = sizes.empty() ? nullptr : &sizes.front();
+  this->translateAnchor(anchor, anchor_vector, size_array, sizes.size(), alternateEvenCenter);
+}
 
-  std::vector<int> point;
-  point.assign(2, -1);
+void cedar::aux::conv::OpenCV::translateAnchor
+     (
+       cv::Point& anchor,
+       const std::vector<int>& anchor_vector,
+       const int* sizes,
+       size_t dimensionality,
+       bool alternateEvenCenter
+     ) const
+{
+  int point[2] = {-1, -1};
 
   for (size_t i = 0; i < 2; ++i)
   {
-    if (anchor_vector.size() > i && sizes.size() > i)
+    // when alternating the center, missing anchor entries count as zero
+    if ((anchor_vector.size() > i || alternateEvenCenter) && dimensionality > i)
     {
       int size = sizes[i];
-      point[i] = cedar::aux::math::saturate(size/2 + anchor_vector.at(i), 0, size - 1);
+      int offset = anchor_vector.size() > i ? anchor_vector.at(i) : 0;
+      point[i] = cedar::aux::math::saturate(size/2 + offset, 0, size - 1);
       if (alternateEvenCenter && size % 2 == 0 && point[i] > 0)
       {
         point[i] -= 1;
@@ -192,10 +264,8 @@ void cedar::aux::conv::OpenCV::translateAnchor
        bool alternateEvenCenter
      ) const
 {
-  std::vector<int> sizes(2);
-  sizes[0] = msize[0];
-  sizes[1] = msize[1];
-  this->translateAnchor(anchor, anchor_vector, sizes, alternateEvenCenter);
+  int sizes[2] = {msize[0], msize[1]};
+  this->translateAnchor(anchor, anchor_vector, sizes, 2, alternateEvenCenter);
 }
 
 void cedar::aux::conv::OpenCV::translateAnchor
@@ -206,19 +276,19 @@ void cedar::aux::conv::OpenCV::translateAnchor
        bool alternateEvenCenter
      ) const
 {
+  // only the first two dimensions are used, so this doesn't need to copy anything
   QReadLocker locker(kernel->getReadWriteLock());
-  std::vector<int> sizes;
-  const std::vector<int> anchor_vector = kernel->getAnchor();
-  auto dim = kernel->getDimensionality();
-  cv::Mat kernel_mat = kernel->getKernel().clone();
-  for (size_t d = 0; d < dim; ++d)
+  size_t dim = kernel->getDimensionality();
+  int sizes[2] = {0, 0};
+  for (size_t d = 0; d < std::min(dim, static_cast<size_t>(2)); ++d)
   {
-    sizes.push_back(static_cast<int>(kernel->getSize(d)));
+    sizes[d] = static_cast<int>(kernel->getSize(d));
   }
+  bool row_vector = kernel->getKernel().rows == 1;
+  this->translateAnchor(anchor, kernel->getAnchor(), sizes, std::min(dim, static_cast<size_t>(2)), alternateEvenCenter);
   locker.unlock();
-  this->translateAnchor(anchor, anchor_vector, sizes, alternateEvenCenter);
 
-  if (dim == 1 && kernel_mat.rows == 1)
+  if (dim == 1 && row_vector)
   {
     std::swap(anchor.x, anchor.y);
   }
@@ -690,6 +760,220 @@ cv::Mat cedar::aux::conv::OpenCV::convolve
   }
 }
 
+void cedar::aux::conv::OpenCV::convolveInto
+     (
+       const cv::Mat& matrix,
+       cv::Mat& output,
+       cedar::aux::conv::BorderType::Id borderType,
+       cedar::aux::conv::Mode::Id mode,
+       bool alternateEvenCenter
+     ) const
+{
+  // without kernels, the result is zero everywhere; this is common for fields without lateral interactions
+  if (this->getKernelList()->size() == 0 && mode == cedar::aux::conv::Mode::Same)
+  {
+    output.create(matrix.dims, matrix.size, matrix.type());
+    output.setTo(0.0);
+  }
+  else if (mode == cedar::aux::conv::Mode::Same && matrix.dims <= 2)
+  {
+    CEDAR_DEBUG_ASSERT(this->getKernelList()->size() == this->mKernelTypes.size());
+    QMutexLocker locker(&this->mIntoLock);
+
+    // the first kernel is written to the output directly, so the input must not be the output
+    const cv::Mat* source = &matrix;
+    if (output.data == matrix.data)
+    {
+      matrix.copyTo(this->mIntoSource);
+      source = &this->mIntoSource;
+    }
+
+    int cv_border_type = cedar::aux::conv::BorderType::toCvConstant(borderType);
+    this->mIntoKernels.resize(this->getKernelList()->size());
+    output.create(matrix.rows, matrix.cols, matrix.type());
+    for (size_t i = 0; i < this->getKernelList()->size(); ++i)
+    {
+      if (i == 0)
+      {
+        this->convolveKernelInto(*source, i, cv_border_type, alternateEvenCenter, output);
+      }
+      else
+      {
+        this->convolveKernelInto(*source, i, cv_border_type, alternateEvenCenter, this->mIntoSummand);
+        output += this->mIntoSummand;
+      }
+    }
+  }
+  else
+  {
+    this->convolve(matrix, borderType, mode, alternateEvenCenter).copyTo(output);
+  }
+}
+
+void cedar::aux::conv::OpenCV::convolveKernelInto
+     (
+       const cv::Mat& matrix,
+       size_t index,
+       int cvBorderType,
+       bool alternateEvenCenter,
+       cv::Mat& output
+     ) const
+{
+  // the caller holds mIntoLock
+  cedar::aux::kernel::ConstKernelPtr kernel = this->getKernelList()->getKernel(index);
+  auto separable = boost::dynamic_pointer_cast<const cedar::aux::kernel::Separable>(kernel);
+  IntoKernel& into = this->mIntoKernels.at(index);
+
+  QReadLocker locker(kernel->getReadWriteLock());
+  const unsigned int kernel_dim = kernel->getDimensionality();
+  const int kernel_rows = kernel->getKernel().rows;
+  const int kernel_cols = kernel->getKernel().cols;
+  locker.unlock();
+
+  // strategies only depend on the shapes, so they are only looked up again when one of them changes
+  if
+  (
+    into.mMatrixRows != matrix.rows || into.mMatrixCols != matrix.cols
+    || into.mKernelRows != kernel_rows || into.mKernelCols != kernel_cols
+    || into.mSeparable != static_cast<bool>(separable)
+  )
+  {
+    into.mStrategy = this->getStrategy(matrix, kernel);
+    into.mMatrixRows = matrix.rows;
+    into.mMatrixCols = matrix.cols;
+    into.mKernelRows = kernel_rows;
+    into.mKernelCols = kernel_cols;
+    into.mSeparable = static_cast<bool>(separable);
+  }
+
+  cv::Point anchor = cv::Point(-1, -1);
+  this->translateAnchor(anchor, kernel, matrix, alternateEvenCenter);
+
+  // one-dimensional kernels are oriented like the matrix below
+  bool transposed = kernel_dim == 1
+                    && ((matrix.rows == 1 && kernel_rows != 1) || (matrix.cols == 1 && kernel_cols != 1));
+  int oriented_rows = transposed ? kernel_cols : kernel_rows;
+  int oriented_cols = transposed ? kernel_rows : kernel_cols;
+
+  // kernels larger than the matrix are cut down or folded by cvConvolve; the fourier transform needs its own buffers
+  if
+  (
+    kernel_dim > 2 || oriented_rows > matrix.rows || oriented_cols > matrix.cols
+    || into.mStrategy == cedar::aux::conv::Strategy::FFT
+  )
+  {
+    this->cvConvolve(matrix, kernel, into.mStrategy, cvBorderType, anchor).copyTo(output);
+    return;
+  }
+
+  locker.relock();
+  if (into.mStrategy == cedar::aux::conv::Strategy::Separable)
+  {
+    CEDAR_DEBUG_ASSERT(separable);
+    switch (kernel_dim)
+    {
+      case 0:
+        // in the 0d-case, the kernel is a 1x1 matrix, thus convolution is the same as multiplication
+        matrix.convertTo(output, -1, cedar::aux::math::getMatrixEntry<double>(separable->getKernelPart(0), 0, 0));
+        break;
+
+      case 1:
+      {
+        cv::flip(separable->getKernelPart(0), into.mFlipped, -1);
+        // reshaping a vector doesn't copy it
+        cv::Mat flipped = into.mFlipped;
+        if ((matrix.rows == 1 && flipped.rows != 1) || (matrix.cols == 1 && flipped.cols != 1))
+        {
+          flipped = flipped.reshape(0, flipped.cols);
+          std::swap(anchor.x, anchor.y);
+        }
+        this->cvFilterInto(matrix, flipped, cvBorderType, anchor, output);
+        break;
+      }
+
+      default:
+        cv::flip(separable->getKernelPart(1), into.mFlippedX, -1);
+        cv::flip(separable->getKernelPart(0), into.mFlippedY, -1);
+        this->cvSepFilterInto(matrix, into.mFlippedX, into.mFlippedY, cvBorderType, anchor, output);
+    }
+  }
+  else
+  {
+    cv::flip(kernel->getKernel(), into.mFlipped, -1);
+    cv::Mat flipped = into.mFlipped;
+    if (transposed)
+    {
+      flipped = flipped.reshape(0, flipped.cols);
+      std::swap(anchor.x, anchor.y);
+    }
+    this->cvFilterInto(matrix, flipped, cvBorderType, anchor, output);
+  }
+}
+
+void cedar::aux::conv::OpenCV::cvFilterInto
+     (
+       const cv::Mat& matrix,
+       const cv::Mat& flippedKernel,
+       int cvBorderType,
+       const cv::Point& anchor,
+       cv::Mat& output
+     ) const
+{
+  if (cvBorderType != cv::BORDER_WRAP)
+  {
+    cv::filter2D(matrix, output, -1, flippedKernel, anchor, 0.0, cvBorderType);
+  }
+  else
+  {
+    // same padding as in cvConvolve
+    int dh = flippedKernel.rows / 2;
+    int dw = flippedKernel.cols / 2;
+    cv::copyMakeBorder
+    (
+      matrix, this->mIntoPadded, dh, flippedKernel.rows - dh, dw, flippedKernel.cols - dw, cv::BORDER_WRAP
+    );
+    cv::filter2D(this->mIntoPadded, this->mIntoPaddedResult, -1, flippedKernel, anchor, 0.0, cv::BORDER_DEFAULT);
+    this->mIntoPaddedResult(cv::Range(dh, dh + matrix.rows), cv::Range(dw, dw + matrix.cols)).copyTo(output);
+  }
+}
+
+void cedar::aux::conv::OpenCV::cvSepFilterInto
+     (
+       const cv::Mat& matrix,
+       const cv::Mat& flippedKernelX,
+       const cv::Mat& flippedKernelY,
+       int cvBorderType,
+       const cv::Point& anchor,
+       cv::Mat& output
+     ) const
+{
+  if (cvBorderType != cv::BORDER_WRAP)
+  {
+    cv::sepFilter2D(matrix, output, -1, flippedKernelX, flippedKernelY, anchor, 0, cvBorderType);
+  }
+  else
+  {
+    // same padding as in cvConvolveSeparable2D
+    int height = static_cast<int>(cedar::aux::math::get1DMatrixSize(flippedKernelX));
+    int width = static_cast<int>(cedar::aux::math::get1DMatrixSize(flippedKernelY));
+    int dh = height / 2;
+    int dw = width / 2;
+    cv::copyMakeBorder(matrix, this->mIntoPadded, dh, height - dh, dw, width - dw, cv::BORDER_WRAP);
+    cv::sepFilter2D
+    (
+      this->mIntoPadded,
+      this->mIntoPaddedResult,
+      -1,
+      flippedKernelX,
+      flippedKernelY,
+      anchor,
+      0,
+      cv::BORDER_DEFAULT
+    );
+    this->mIntoPaddedResult(cv::Range(dh, dh + matrix.rows), cv::Range(dw, dw + matrix.cols)).copyTo(output);
+  }
+}
+
 cv::Mat cedar::aux::conv::OpenCV::convolveSeparable
         (
           const cv::Mat& matrix,
@@ -760,25 +1044,217 @@ cv::Mat cedar::aux::conv::OpenCV::cvConvolve
   const cv::Point& anchor
 ) const
 {
+  return this->cvConvolve(matrix, kernel, this->getStrategy(matrix, kernel), cvBorderType, anchor);
+}
+
+cv::Mat cedar::aux::conv::OpenCV::cvConvolve
+(
+  const cv::Mat& matrix,
+  const cedar::aux::kernel::ConstKernelPtr kernel,
+  cedar::aux::conv::Strategy::Id strategy,
+  int cvBorderType,
+  cv::Point anchor
+) const
+{
+  if (strategy == cedar::aux::conv::Strategy::Separable)
+  {
+    return this->cvConvolve
+           (
+             matrix,
+             cedar::aux::asserted_pointer_cast<const cedar::aux::kernel::Separable>(kernel),
+             cvBorderType,
+             anchor
+           );
+  }
+
+  QReadLocker locker(kernel->getReadWriteLock());
+  cv::Mat kernel_mat = kernel->getKernel();
+
+  // one-dimensional kernels have to be oriented the same way as the matrix
   if
   (
-    cedar::aux::kernel::ConstSeparablePtr separable_kernel
-      = boost::dynamic_pointer_cast<const cedar::aux::kernel::Separable>(kernel)
+    kernel->getDimensionality() == 1
+    && ((matrix.rows == 1 && kernel_mat.rows != 1) || (matrix.cols == 1 && kernel_mat.cols != 1))
   )
   {
-    return this->cvConvolve(matrix, separable_kernel, cvBorderType, anchor);
+    kernel_mat = kernel_mat.t();
+    std::swap(anchor.x, anchor.y);
   }
-  else
+
+  cv::Mat result;
+  switch (strategy)
   {
-    QReadLocker locker(kernel->getReadWriteLock());
-    cv::Mat result;
-    const cv::Mat& kernel_mat = kernel->getKernel();
-    result = this->cvConvolve(matrix, kernel_mat, cvBorderType, anchor);
-    kernel->unlock();
-    return result;
+    case cedar::aux::conv::Strategy::Direct:
+      result = this->cvConvolve(matrix, kernel_mat, cvBorderType, anchor);
+      break;
+
+    case cedar::aux::conv::Strategy::FFT:
+      result = this->cvConvolveDFT(matrix, kernel_mat, cvBorderType, anchor);
+      break;
+
+    default:
+      CEDAR_THROW(cedar::aux::UnhandledValueException, "Unhandled convolution strategy.");
+  }
+  return result;
+}
+
+cv::Mat cedar::aux::conv::OpenCV::convolveUsing
+        (
+          const cv::Mat& matrix,
+          cedar::aux::kernel::ConstKernelPtr kernel,
+          cedar::aux::conv::BorderType::Id borderType,
+          cedar::aux::conv::Strategy::Id strategy
+        ) const
+{
+  std::vector<int> kernel_sizes;
+  QReadLocker locker(kernel->getReadWriteLock());
+  for (size_t d = 0; d < kernel->getDimensionality(); ++d)
+  {
+    kernel_sizes.push_back(static_cast<int>(kernel->getSize(d)));
+  }
+  locker.unlock();
+
+  bool separable = static_cast<bool>(boost::dynamic_pointer_cast<const cedar::aux::kernel::Separable>(kernel));
+  if (estimateCost(strategy, shape_of(matrix), kernel_sizes, separable) == std::numeric_limits<double>::infinity())
+  {
+    CEDAR_THROW
+    (
+      cedar::aux::UnhandledValueException,
+      "Convolution strategy \"" + cedar::aux::conv::Strategy::type().get(strategy).name()
+      + "\" cannot be applied to the given matrix and kernel."
+    );
+  }
+
+  cv::Point anchor = cv::Point(-1, -1);
+  this->translateAnchor(anchor, kernel, matrix);
+  return this->cvConvolve(matrix, kernel, strategy, cedar::aux::conv::BorderType::toCvConstant(borderType), anchor);
+}
+
+cedar::aux::conv::Strategy::Id cedar::aux::conv::OpenCV::getStrategy
+                               (
+                                 const cv::Mat& matrix,
+                                 cedar::aux::kernel::ConstKernelPtr kernel
+                               ) const
+{
+  std::vector<int> kernel_sizes;
+  QReadLocker locker(kernel->getReadWriteLock());
+  for (size_t d = 0; d < kernel->getDimensionality(); ++d)
+  {
+    kernel_sizes.push_back(static_cast<int>(kernel->getSize(d)));
+  }
+  locker.unlock();
+
+  bool separable = static_cast<bool>(boost::dynamic_pointer_cast<const cedar::aux::kernel::Separable>(kernel));
+  return this->getStrategy(shape_of(matrix), kernel_sizes, separable);
+}
+
+cedar::aux::conv::Strategy::Id cedar::aux::conv::OpenCV::getStrategy
+                               (
+                                 const std::vector<int>& matrixSizes,
+                                 const std::vector<int>& kernelSizes,
+                                 bool separable
+                               ) const
+{
+  // -1 separates the matrix from the kernel sizes so that shapes of different dimensionality cannot collide
+  std::vector<int> key = matrixSizes;
+  key.push_back(-1);
+  key.insert(key.end(), kernelSizes.begin(), kernelSizes.end());
+  key.push_back(separable ? 1 : 0);
+
+  QMutexLocker locker(&this->mPlansLock);
+  auto iter = this->mPlans.find(key);
+  if (iter == this->mPlans.end())
+  {
+    iter = this->mPlans.insert(std::make_pair(key, planStrategy(matrixSizes, kernelSizes, separable))).first;
+  }
+  return iter->second;
+}
+
+void cedar::aux::conv::OpenCV::clearPlans()
+{
+  QMutexLocker locker(&this->mPlansLock);
+  this->mPlans.clear();
+}
+
+double cedar::aux::conv::OpenCV::estimateCost
+       (
+         cedar::aux::conv::Strategy::Id strategy,
+         const std::vector<int>& matrixSizes,
+         const std::vector<int>& kernelSizes,
+         bool separable
+       )
+{
+  size_t dim = std::max(matrixSizes.size(), kernelSizes.size());
+  double elements = 1.0;
+  double kernel_elements = 1.0;
+  double kernel_sum = 0.0;
+  double dft_elements = 1.0;
+  bool kernel_fits = true;
+
+  for (size_t d = 0; d < dim; ++d)
+  {
+    int matrix_size = d < matrixSizes.size() ? matrixSizes.at(d) : 1;
+    int kernel_size = d < kernelSizes.size() ? kernelSizes.at(d) : 1;
+
+    // no more than 2n + 1 kernel entries can ever overlap the matrix, larger kernels are cut down to that
+    double effective_kernel_size = static_cast<double>(std::min(kernel_size, 2 * matrix_size + 1));
+
+    elements *= static_cast<double>(matrix_size);
+    kernel_elements *= effective_kernel_size;
+    kernel_sum += effective_kernel_size;
+    dft_elements *= static_cast<double>(cv::getOptimalDFTSize(matrix_size + kernel_size - 1));
+    kernel_fits = kernel_fits && kernel_size <= matrix_size;
+  }
+
+  switch (strategy)
+  {
+    case cedar::aux::conv::Strategy::Direct:
+      return elements * kernel_elements;
+
+    case cedar::aux::conv::Strategy::Separable:
+      if (!separable)
+      {
+        return std::numeric_limits<double>::infinity();
+      }
+      return elements * (kernel_sum + pass_overhead * static_cast<double>(dim));
+
+    case cedar::aux::conv::Strategy::FFT:
+      // cv::dft only handles up to two dimensions; kernels larger than the matrix are left to the direct method
+      if (dim == 0 || dim > 2 || !kernel_fits)
+      {
+        return std::numeric_limits<double>::infinity();
+      }
+      // two forward transforms, one inverse transform and the product of the spectra
+      return dft_elements * (3.0 * dft_factor * std::log2(dft_elements) + dft_element_overhead);
+
+    default:
+      return std::numeric_limits<double>::infinity();
   }
 }
 
+cedar::aux::conv::Strategy::Id cedar::aux::conv::OpenCV::planStrategy
+                               (
+                                 const std::vector<int>& matrixSizes,
+                                 const std::vector<int>& kernelSizes,
+                                 bool separable
+                               )
+{
+  cedar::aux::conv::Strategy::Id best = cedar::aux::conv::Strategy::Direct;
+  double best_cost = estimateCost(best, matrixSizes, kernelSizes, separable);
+
+  for (auto strategy : {cedar::aux::conv::Strategy::Separable, cedar::aux::conv::Strategy::FFT})
+  {
+    double cost = estimateCost(strategy, matrixSizes, kernelSizes, separable);
+    if (cost < best_cost)
+    {
+      best = strategy;
+      best_cost = cost;
+    }
+  }
+
+  return best;
+}
+
 cv::Mat cedar::aux::conv::OpenCV::cvConvolve
         (
           const cv::Mat& matrix,
@@ -818,63 +1294,251 @@ cv::Mat cedar::aux::conv::OpenCV::cvConvolve
     case 2:
     {
       CEDAR_DEBUG_ASSERT(kernel->kernelPartCount() == 2);
-      const cv::Mat& kernel_mat_x = kernel->getKernelPart(1);
-      const cv::Mat& kernel_mat_y = kernel->getKernelPart(0);
+      convolved = this->cvConvolveSeparable2D
+                  (
+                    matrix,
+                    kernel->getKernelPart(1),
+                    kernel->getKernelPart(0),
+                    cvBorderType,
+                    anchor
+                  );
+      break;
+    }
 
-      cv::Mat flipped_kernel_mat_x, flipped_kernel_mat_y;
-      cv::flip(kernel_mat_x, flipped_kernel_mat_x, -1);
-      cv::flip(kernel_mat_y, flipped_kernel_mat_y, -1);
+    case 3:
+    {
+      CEDAR_DEBUG_ASSERT(kernel->kernelPartCount() == 3);
+      convolved = this->cvConvolveSeparable3D(matrix, kernel, cvBorderType);
+      break;
+    }
 
+    default:
+      CEDAR_THROW(cedar::aux::UnhandledValueException, "Cannot convolve matrices of the given dimensionality.");
+  }
 
-      if (cvBorderType != cv::BORDER_WRAP)
-      {
-        cv::sepFilter2D
+  locker.unlock();
+
+  return convolved;
+}
+
+cv::Mat cedar::aux::conv::OpenCV::cvConvolveSeparable2D
         (
-          matrix,
-          convolved,
-          -1,
-          flipped_kernel_mat_x,
-          flipped_kernel_mat_y,
-          anchor,
-          0,
-          cvBorderType
-        );
-      }
-      else
+          const cv::Mat& matrix,
+          const cv::Mat& kernelX,
+          const cv::Mat& kernelY,
+          int cvBorderType,
+          cv::Point anchor
+        ) const
+{
+  cv::Mat convolved;
+  cv::Mat flipped_kernel_mat_x, flipped_kernel_mat_y;
+  cv::flip(kernelX, flipped_kernel_mat_x, -1);
+  cv::flip(kernelY, flipped_kernel_mat_y, -1);
+
+  if (cvBorderType != cv::BORDER_WRAP)
+  {
+    cv::sepFilter2D
+    (
+      matrix,
+      convolved,
+      -1,
+      flipped_kernel_mat_x,
+      flipped_kernel_mat_y,
+      anchor,
+      0,
+      cvBorderType
+    );
+  }
+  else
+  {
+    cv::Mat modified;
+    int height = static_cast<int>(cedar::aux::math::get1DMatrixSize(flipped_kernel_mat_x));
+    int width = static_cast<int>(cedar::aux::math::get1DMatrixSize(flipped_kernel_mat_y));
+    int dh = height / 2;
+    int dw = width / 2;
+
+    // height - dh makes sure that in uneven cases, padding is not too small or too large
+    cv::copyMakeBorder(matrix, modified, dh, height - dh, dw, width - dw, cv::BORDER_WRAP);
+    cv::sepFilter2D
+    (
+      modified,
+      convolved,
+      -1,
+      flipped_kernel_mat_x,
+      flipped_kernel_mat_y,
+      anchor,
+      0,
+      cv::BORDER_DEFAULT
+    );
+    convolved = convolved(cv::Range(dh, dh + matrix.rows), cv::Range(dw, dw + matrix.cols));
+  }
+
+  return convolved;
+}
+
+cv::Mat cedar::aux::conv::OpenCV::cvConvolveSeparable3D
+        (
+          const cv::Mat& matrix,
+          cedar::aux::kernel::ConstSeparablePtr kernel,
+          int cvBorderType
+        ) const
+{
+  // the caller holds the kernel's lock
+  cv::Mat source = matrix.isContinuous() ? matrix : matrix.clone();
+  int planes = source.size[0];
+
+  // first pass: apply the parts for dimensions 1 and 2 within each plane
+  cv::Mat in_plane(source.dims, source.size, source.type());
+  cedar::aux::parallelForSlices
+  (
+    source,
+    [&](int begin, int end)
+    {
+      for (int i = begin; i < end; ++i)
       {
-        cv::Mat modified;
-        int height = static_cast<int>(cedar::aux::math::get1DMatrixSize(flipped_kernel_mat_x));
-        int width = static_cast<int>(cedar::aux::math::get1DMatrixSize(flipped_kernel_mat_y));
-        int dh = height / 2;
-        int dw = width / 2;
-
-        // height - dh makes sure that in uneven cases, padding is not too small or too large
-        cv::copyMakeBorder(matrix, modified, dh, height - dh, dw, width - dw, cv::BORDER_WRAP);
-        cv::sepFilter2D
+        cv::Mat plane = plane_of(in_plane, i);
+        this->cvConvolveSeparable2D
         (
-          modified,
-          convolved,
-          -1,
-          flipped_kernel_mat_x,
-          flipped_kernel_mat_y,
-          anchor,
-          0,
-          cv::BORDER_DEFAULT
-        );
-        convolved = convolved(cv::Range(dh, dh + matrix.rows), cv::Range(dw, dw + matrix.cols));
+          plane_of(source, i),
+          kernel->getKernelPart(2),
+          kernel->getKernelPart(1),
+          cvBorderType,
+          cv::Point(-1, -1)
+        ).copyTo(plane);
       }
+    }
+  );
 
+  // second pass: sum up weighted planes along dimension 0
+  cv::Mat weights;
+  kernel->getKernelPart(0).convertTo(weights, CV_64F);
+  int depth = static_cast<int>(weights.total());
+  int center = depth / 2;
 
-      break;
+  // every result plane only depends on the first pass, so the planes are summed up in parallel
+  cv::Mat result = cv::Mat::zeros(source.dims, source.size, source.type());
+  cedar::aux::parallelForSlices
+  (
+    result,
+    [&](int begin, int end)
+    {
+      for (int i = begin; i < end; ++i)
+      {
+        cv::Mat result_plane = plane_of(result, i);
+        for (int j = 0; j < depth; ++j)
+        {
+          // j indexes the flipped kernel
+          int source_index = cv::borderInterpolate(i + j - center, planes, cvBorderType);
+          if (source_index < 0)
+          {
+            // outside of the matrix with zero borders
+            continue;
+          }
+          double weight = weights.at<double>(depth - 1 - j);
+          cv::scaleAdd(plane_of(in_plane, source_index), weight, result_plane, result_plane);
+        }
+      }
     }
+  );
 
-    default:
-      CEDAR_THROW(cedar::aux::UnhandledValueException, "Cannot convolve matrices of the given dimensionality.");
+  return result;
+}
+
+cv::Mat cedar::aux::conv::OpenCV::cvConvolve3D(const cv::Mat& matrix, const cv::Mat& kernel, int cvBorderType) const
+{
+  if (kernel.dims != 3)
+  {
+    CEDAR_THROW(cedar::aux::UnhandledValueException, "Three-dimensional matrices need three-dimensional kernels.");
   }
 
-  locker.unlock();
+  cv::Mat source = matrix.isContinuous() ? matrix : matrix.clone();
+  cv::Mat kernel_source = kernel.isContinuous() ? kernel : kernel.clone();
+  int planes = source.size[0];
+  int depth = kernel_source.size[0];
+  int center = depth / 2;
 
-  return convolved;
+  // every result plane is a sum of 2d convolutions of its own, so the planes are computed in parallel
+  cv::Mat result = cv::Mat::zeros(source.dims, source.size, source.type());
+  cedar::aux::parallelForSlices
+  (
+    result,
+    [&](int begin, int end)
+    {
+      for (int i = begin; i < end; ++i)
+      {
+        cv::Mat result_plane = plane_of(result, i);
+        for (int j = 0; j < depth; ++j)
+        {
+          int source_index = cv::borderInterpolate(i + j - center, planes, cvBorderType);
+          if (source_index < 0)
+          {
+            // outside of the matrix with zero borders
+            continue;
+          }
+          // j indexes the flipped kernel; flipping within the planes is done by the 2d convolution
+          cv::Mat kernel_plane = plane_of(kernel_source, depth - 1 - j);
+          result_plane
+            += this->cvConvolve(plane_of(source, source_index), kernel_plane, cvBorderType, cv::Point(-1, -1));
+        }
+      }
+    }
+  );
+
+  return result;
+}
+
+cv::Mat cedar::aux::conv::OpenCV::cvConvolveDFT
+        (
+          const cv::Mat& matrix,
+          const cv::Mat& kernel,
+          int cvBorderType,
+          cv::Point anchor
+        ) const
+{
+  CEDAR_DEBUG_ASSERT(matrix.dims <= 2 && kernel.dims <= 2);
+
+  // same anchor semantics as cv::filter2D applied to the flipped kernel (see cvConvolve)
+  int anchor_row = anchor.y < 0 ? kernel.rows / 2 : anchor.y;
+  int anchor_col = anchor.x < 0 ? kernel.cols / 2 : anchor.x;
+
+  // the border is added explicitly, so the linear convolution of the padded matrix contains the result
+  cv::Mat padded;
+  cv::copyMakeBorder
+  (
+    matrix,
+    padded,
+    anchor_row,
+    kernel.rows - 1 - anchor_row,
+    anchor_col,
+    kernel.cols - 1 - anchor_col,
+    cvBorderType,
+    cv::Scalar(0)
+  );
+
+  // transforms at least as large as the padded matrix don't let the cyclic wrap-around reach the part we cut out
+  int work_type = matrix.depth() == CV_64F ? CV_64F : CV_32F;
+  cv::Size dft_size(cv::getOptimalDFTSize(padded.cols), cv::getOptimalDFTSize(padded.rows));
+
+  cv::Mat matrix_spectrum = cv::Mat::zeros(dft_size, work_type);
+  cv::Mat matrix_roi = matrix_spectrum(cv::Rect(0, 0, padded.cols, padded.rows));
+  padded.convertTo(matrix_roi, work_type);
+
+  cv::Mat kernel_spectrum = cv::Mat::zeros(dft_size, work_type);
+  cv::Mat kernel_roi = kernel_spectrum(cv::Rect(0, 0, kernel.cols, kernel.rows));
+  kernel.convertTo(kernel_roi, work_type);
+
+  cv::dft(matrix_spectrum, matrix_spectrum, 0, padded.rows);
+  cv::dft(kernel_spectrum, kernel_spectrum, 0, kernel.rows);
+  cv::mulSpectrums(matrix_spectrum, kernel_spectrum, matrix_spectrum, 0);
+  cv::dft(matrix_spectrum, matrix_spectrum, cv::DFT_INVERSE | cv::DFT_SCALE | cv::DFT_REAL_OUTPUT);
+
+  cv::Mat result;
+  matrix_spectrum
+  (
+    cv::Range(kernel.rows - 1, kernel.rows - 1 + matrix.rows),
+    cv::Range(kernel.cols - 1, kernel.cols - 1 + matrix.cols)
+  ).convertTo(result, matrix.type());
+  return result;
 }
 
 cv::Mat cedar::aux::conv::OpenCV::convolve
@@ -909,22 +1573,6 @@ cv::Mat cedar::aux::conv::OpenCV::convolve
           {
             //--------------------------------------------------------------------------------------
             case KERNEL_TYPE_SEPARABLE:
-            //--------------------------------------------------------------------------------------
-            {
-              cedar::aux::kernel::ConstSeparablePtr kernel
-                = cedar::aux::asserted_pointer_cast<const cedar::aux::kernel::Separable>
-                  (
-                    this->getKernelList()->getKernel(i)
-                  );
-
-              cv::Point anchor = cv::Point(-1, -1);
-              this->translateAnchor(anchor, kernel, matrix, alternateEvenCenter);
-
-              convolved = this->cvConvolve(matrix, kernel, cv_border_type, anchor);
-              break;
-            }
-
-            //--------------------------------------------------------------------------------------
             case KERNEL_TYPE_FULL:
             //--------------------------------------------------------------------------------------
             {
@@ -933,10 +1581,8 @@ cv::Mat cedar::aux::conv::OpenCV::convolve
               cv::Point anchor = cv::Point(-1, -1);
               this->translateAnchor(anchor, kernel, matrix, alternateEvenCenter);
 
-              QReadLocker locker(kernel->getReadWriteLock());
-              cv::Mat kernel_mat = kernel->getKernel();
-              convolved = this->cvConvolve(matrix, kernel_mat, cv_border_type, anchor);
-              locker.unlock();
+              // the planned strategy decides whether the kernel is applied directly, in passes or via dft
+              convolved = this->cvConvolve(matrix, kernel, cv_border_type, anchor);
               break;
             }
 
@@ -1117,7 +1763,11 @@ cv::Mat cedar::aux::conv::OpenCV::cvConvolve
   cv::Point anchor
 ) const
 {
-  if (cedar::aux::math::getDimensionalityOf(matrix) > 2)
+  if (cedar::aux::math::getDimensionalityOf(matrix) == 3)
+  {
+    return this->cvConvolve3D(matrix, kernel, cvBorderType);
+  }
+  else if (cedar::aux::math::getDimensionalityOf(matrix) > 3)
   {
     CEDAR_THROW(cedar::aux::UnhandledValueException, "Cannot convolve matrices of the given dimensionality.");
   }
@@ -1243,6 +1893,7 @@ void cedar::aux::conv::OpenCV::kernelRemoved(size_t index)
 {
   CEDAR_DEBUG_ASSERT(index < this->mKernelTypes.size());
   this->mKernelTypes.erase(this->mKernelTypes.begin() + index);
+  this->clearPlans();
 }
 
 void cedar::aux::conv::OpenCV::updateKernelType(size_t index)
@@ -1260,6 +1911,9 @@ void cedar::aux::conv::OpenCV::updateKernelType(size_t index)
   {
     this->mKernelTypes.at(index) = KERNEL_TYPE_FULL;
   }
+
+  // kernel shapes may have changed; planning again is cheap, so this just keeps the cache from growing
+  this->clearPlans();
 }
 
 void cedar::aux::conv::OpenCV::setKernelList(cedar::aux::conv::KernelListPtr kernelList)
@@ -1269,6 +1923,7 @@ void cedar::aux::conv::OpenCV::setKernelList(cedar::aux::conv::KernelListPtr ker
   mKernelRemovedConnection.disconnect();
   this->Engine::setKernelList(kernelList);
   this->mKernelTypes.clear();
+  this->clearPlans();
   for (size_t i = 0; i < this->getKernelList()->size(); ++i)
   {
     this->updateKernelType(i);
@@ -39,16 +39,26 @@
 
 // CEDAR INCLUDES
 #include "cedar/auxiliaries/convolution/Engine.h"
+#include "cedar/auxiliaries/convolution/Strategy.h"
 #include "cedar/auxiliaries/opencv_helper.h"
 
 // FORWARD DECLARATIONS
 #include "cedar/auxiliaries/convolution/OpenCV.fwd.h"
 
 // SYSTEM INCLUDES
+#include <QMutex>
 #include <vector>
+#include <map>
 
 
 /*!@brief A convolution engine based on OpenCV's filter engine.
+ *
+ *        For every combination of matrix and kernel shape, the engine estimates the cost of a direct convolution, of
+ *        one-dimensional passes (for separable kernels) and of a convolution via cv::dft, and uses the cheapest one.
+ *        The decisions are cached per engine, i.e., per cedar::aux::conv::Convolution.
+ *
+ *        Three-dimensional matrices are convolved plane by plane in mode Same only; in this case, kernels are always
+ *        centered and the fourier transform strategy is not available.
  */
 class cedar::aux::conv::OpenCV : public cedar::aux::conv::Engine
 {
@@ -63,6 +73,25 @@ private:
     KERNEL_TYPE_SEPARABLE
   };
 
+  //! Per-kernel state convolveInto keeps between calls so that convolving the same shapes again doesn't allocate.
+  struct IntoKernel
+  {
+    IntoKernel();
+
+    //! matrix and kernel shapes (and whether the kernel is separable) the strategy was looked up for
+    int mMatrixRows;
+    int mMatrixCols;
+    int mKernelRows;
+    int mKernelCols;
+    bool mSeparable;
+    cedar::aux::conv::Strategy::Id mStrategy;
+    //! flipped kernel for the direct strategy
+    cv::Mat mFlipped;
+    //! flipped parts along the columns and rows for the separable strategy
+    cv::Mat mFlippedX;
+    cv::Mat mFlippedY;
+  };
+
   //--------------------------------------------------------------------------------------------------------------------
   // constructors and destructor
   //--------------------------------------------------------------------------------------------------------------------
@@ -82,6 +111,22 @@ public:
     bool alternateEvenCenter = false
   ) const;
 
+  /*!@brief Writes the convolution with the kernel list into output.
+   *
+   *        Without kernels, output is zeroed in place. One- and two-dimensional matrices in mode Same are filtered
+   *        directly into output; flipped kernels and the buffers for cyclic borders and for summing up several kernels
+   *        are kept between calls. What remains are the bookkeeping allocations OpenCV's filters make internally. All
+   *        other cases, and the fourier transform strategy, are computed by convolve and copied into output.
+   */
+  void convolveInto
+  (
+    const cv::Mat& matrix,
+    cv::Mat& output,
+    cedar::aux::conv::BorderType::Id borderType,
+    cedar::aux::conv::Mode::Id mode,
+    bool alternateEvenCenter = false
+  ) const;
+
   cv::Mat convolve
   (
     const cv::Mat& matrix,
@@ -148,6 +193,42 @@ public:
   //!@brief method for setting the kernel list
   void setKernelList(cedar::aux::conv::KernelListPtr kernelList);
 
+  /*!@brief Convolves the matrix with the kernel in mode Same, using the given strategy instead of the planned one.
+   *
+   *        This is mainly meant for comparing the strategies against each other, e.g., in benchmarks.
+   */
+  cv::Mat convolveUsing
+  (
+    const cv::Mat& matrix,
+    cedar::aux::kernel::ConstKernelPtr kernel,
+    cedar::aux::conv::BorderType::Id borderType,
+    cedar::aux::conv::Strategy::Id strategy
+  ) const;
+
+  //! Returns the strategy this engine uses for the given matrix and kernel; plans and caches it if necessary.
+  cedar::aux::conv::Strategy::Id getStrategy(const cv::Mat& matrix, cedar::aux::kernel::ConstKernelPtr kernel) const;
+
+  /*!@brief Estimates the cost of a convolution of the given shapes with the given strategy.
+   *
+   *        The unit is roughly one multiply-add, so values are only meaningful when compared to each other. Strategies
+   *        that cannot be applied to the given shapes have infinite cost.
+   */
+  static double estimateCost
+  (
+    cedar::aux::conv::Strategy::Id strategy,
+    const std::vector<int>& matrixSizes,
+    const std::vector<int>& kernelSizes,
+    bool separable
+  );
+
+  //! Returns the strategy with the lowest estimated cost for the given shapes.
+  static cedar::aux::conv::Strategy::Id planStrategy
+  (
+    const std::vector<int>& matrixSizes,
+    const std::vector<int>& kernelSizes,
+    bool separable
+  );
+
   //--------------------------------------------------------------------------------------------------------------------
   // protected methods
   //--------------------------------------------------------------------------------------------------------------------
@@ -162,6 +243,17 @@ private:
 
   void updateKernelType(size_t index);
 
+  //! Returns the strategy for the given shapes from the cache, planning it first if it isn't there yet.
+  cedar::aux::conv::Strategy::Id getStrategy
+  (
+    const std::vector<int>& matrixSizes,
+    const std::vector<int>& kernelSizes,
+    bool separable
+  ) const;
+
+  //! Forgets all planned strategies.
+  void clearPlans();
+
   void translateAnchor
   (
     cv::Point& anchor,
@@ -186,11 +278,52 @@ private:
   void translateAnchor
   (
     cv::Point& anchor,
-    std::vector<int> anchor_vector,
+    const std::vector<int>& anchor_vector,
     const std::vector<int>& sizes,
     bool alternateEvenCenter = false
   ) const;
 
+  //! Translates the anchor for a kernel with the given sizes along its first (up to two) dimensions.
+  void translateAnchor
+  (
+    cv::Point& anchor,
+    const std::vector<int>& anchor_vector,
+    const int* sizes,
+    size_t dimensionality,
+    bool alternateEvenCenter
+  ) const;
+
+  //! Convolves matrix with the kernel at the given index of the kernel list in mode Same and writes into output.
+  void convolveKernelInto
+  (
+    const cv::Mat& matrix,
+    size_t index,
+    int cvBorderType,
+    bool alternateEvenCenter,
+    cv::Mat& output
+  ) const;
+
+  //! Applies an already flipped kernel in mode Same, writing into output; cyclic borders are padded in mIntoPadded.
+  void cvFilterInto
+  (
+    const cv::Mat& matrix,
+    const cv::Mat& flippedKernel,
+    int cvBorderType,
+    const cv::Point& anchor,
+    cv::Mat& output
+  ) const;
+
+  //! Applies already flipped kernel parts in mode Same, writing into output; cyclic borders are padded in mIntoPadded.
+  void cvSepFilterInto
+  (
+    const cv::Mat& matrix,
+    const cv::Mat& flippedKernelX,
+    const cv::Mat& flippedKernelY,
+    int cvBorderType,
+    const cv::Point& anchor,
+    cv::Mat& output
+  ) const;
+
   cv::Mat createFullMatrix(
                           const cv::Mat& matrix,
                           int kernelRows,
@@ -272,6 +405,39 @@ private:
     const cv::Point& anchor
   ) const;
 
+  cv::Mat cvConvolve
+  (
+    const cv::Mat& matrix,
+    const cedar::aux::kernel::ConstKernelPtr kernel,
+    cedar::aux::conv::Strategy::Id strategy,
+    int cvBorderType,
+    cv::Point anchor
+  ) const;
+
+  //! Applies a separable kernel given by its (one-dimensional) parts along the rows and columns of a 2d matrix.
+  cv::Mat cvConvolveSeparable2D
+  (
+    const cv::Mat& matrix,
+    const cv::Mat& kernelX,
+    const cv::Mat& kernelY,
+    int cvBorderType,
+    cv::Point anchor
+  ) const;
+
+  //! Convolves a 3d matrix with a 3d kernel by summing up 2d convolutions of the matrix and kernel planes.
+  cv::Mat cvConvolve3D(const cv::Mat& matrix, const cv::Mat& kernel, int cvBorderType) const;
+
+  //! Convolves a 3d matrix with a separable kernel by doing one one-dimensional pass per dimension.
+  cv::Mat cvConvolveSeparable3D
+  (
+    const cv::Mat& matrix,
+    cedar::aux::kernel::ConstSeparablePtr kernel,
+    int cvBorderType
+  ) const;
+
+  //! Convolves a matrix of up to two dimensions with the kernel by multiplying their spectra.
+  cv::Mat cvConvolveDFT(const cv::Mat& matrix, const cv::Mat& kernel, int cvBorderType, cv::Point anchor) const;
+
   //--------------------------------------------------------------------------------------------------------------------
   // members
   //--------------------------------------------------------------------------------------------------------------------
@@ -280,6 +446,28 @@ protected:
 private:
   std::vector<KernelType> mKernelTypes;
 
+  //! Strategies planned so far, indexed by the matrix and kernel shapes (see getStrategy).
+  mutable std::map<std::vector<int>, cedar::aux::conv::Strategy::Id> mPlans;
+
+  //! Lock for mPlans.
+  mutable QMutex mPlansLock;
+
+  //! State of convolveInto for each kernel of the kernel list.
+  mutable std::vector<IntoKernel> mIntoKernels;
+
+  //! Copy of the matrix when convolveInto is called in place.
+  mutable cv::Mat mIntoSource;
+
+  //! Result of the second and further kernels before it is added to the output of convolveInto.
+  mutable cv::Mat mIntoSummand;
+
+  //! Matrix with cyclic border and the filtered result for convolveInto.
+  mutable cv::Mat mIntoPadded;
+  mutable cv::Mat mIntoPaddedResult;
+
+  //! Lock for the buffers of convolveInto.
+  mutable QMutex mIntoLock;
+
   //! Connection to the kernel added signal of the kernel list.
   boost::signals2::connection mKernelAddedConnection;
 
@@ -0,0 +1,81 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        Strategy.cpp
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 18
+
+    Description: Enum describing the different ways in which a convolution can be computed.
+
+    Credits:
+
+======================================================================================================================*/
+
+// CEDAR INCLUDES
+#include "cedar/auxiliaries/convolution/Strategy.h"
+#include "cedar/auxiliaries/EnumBase.h"
+#include "cedar/auxiliaries/EnumType.h"
+
+// SYSTEM INCLUDES
+
+
+//----------------------------------------------------------------------------------------------------------------------
+// Static members
+//----------------------------------------------------------------------------------------------------------------------
+
+cedar::aux::EnumType<cedar::aux::conv::Strategy> cedar::aux::conv::Strategy::mType("cedar::aux::conv::Strategy::");
+
+#ifndef CEDAR_COMPILER_MSVC
+const cedar::aux::conv::Strategy::Id cedar::aux::conv::Strategy::Direct;
+const cedar::aux::conv::Strategy::Id cedar::aux::conv::Strategy::Separable;
+const cedar::aux::conv::Strategy::Id cedar::aux::conv::Strategy::FFT;
+#endif
+
+
+//----------------------------------------------------------------------------------------------------------------------
+// constructors and destructor
+//----------------------------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------------------------
+// methods
+//----------------------------------------------------------------------------------------------------------------------
+
+void cedar::aux::conv::Strategy::construct()
+{
+  mType.type()->def(cedar::aux::Enum(cedar::aux::conv::Strategy::Direct, "Direct", "direct"));
+  mType.type()->def(cedar::aux::Enum(cedar::aux::conv::Strategy::Separable, "Separable", "separable"));
+  mType.type()->def(cedar::aux::Enum(cedar::aux::conv::Strategy::FFT, "FFT", "FFT"));
+}
+
+const cedar::aux::EnumBase& cedar::aux::conv::Strategy::type()
+{
+  return *cedar::aux::conv::Strategy::typePtr();
+}
+
+const cedar::aux::conv::Strategy::TypePtr& cedar::aux::conv::Strategy::typePtr()
+{
+  return cedar::aux::conv::Strategy::mType.type();
+}
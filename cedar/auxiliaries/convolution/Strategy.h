@@ -0,0 +1,124 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        Strategy.h
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 18
+
+    Description: Enum describing the different ways in which a convolution can be computed.
+
+    Credits:
+
+======================================================================================================================*/
+
+#ifndef CEDAR_AUX_CONV_STRATEGY_H
+#define CEDAR_AUX_CONV_STRATEGY_H
+
+// CEDAR INCLUDES
+#include "cedar/auxiliaries/EnumBase.h"
+
+// FORWARD DECLARATIONS
+#include "cedar/auxiliaries/convolution/Strategy.fwd.h"
+
+// SYSTEM INCLUDES
+
+
+/*!@brief Enum describing how a single convolution is computed.
+ *
+ *        Engines that can compute a convolution in more than one way use these values to report (and cache) the
+ *        approach they chose:
+ *        <ul>
+ *          <li>@em Direct: The full kernel is applied at every position of the matrix.</li>
+ *          <li>@em Separable: One one-dimensional pass is done along each dimension; only for separable kernels.</li>
+ *          <li>@em FFT: The convolution is computed as a product in frequency space.</li>
+ *        </ul>
+ */
+class cedar::aux::conv::Strategy
+{
+  //--------------------------------------------------------------------------------------------------------------------
+  // nested types
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //! The enum id
+  typedef cedar::aux::EnumId Id;
+
+  //! Pointer type to the enum base object of this class.
+  typedef boost::shared_ptr<cedar::aux::EnumBase> TypePtr;
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // constructors and destructor
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  // none
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // public methods
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //! Initialization of the enum values.
+  static void construct();
+
+  //! Returns a reference to the base enum object.
+  static const cedar::aux::EnumBase& type();
+
+  //! Returns a pointer to the base enum object.
+  static const cedar::aux::conv::Strategy::TypePtr& typePtr();
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // protected methods
+  //--------------------------------------------------------------------------------------------------------------------
+protected:
+  // none yet
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // private methods
+  //--------------------------------------------------------------------------------------------------------------------
+private:
+  // none yet
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // members
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //! The kernel is applied as a whole at every position.
+  static const Id Direct = 0;
+
+  //! The kernel is applied as a sequence of one-dimensional passes.
+  static const Id Separable = 1;
+
+  //! The convolution is computed via discrete fourier transforms.
+  static const Id FFT = 2;
+
+protected:
+  // none yet
+private:
+  //! The type object for this enum class.
+  static cedar::aux::EnumType<cedar::aux::conv::Strategy> mType;
+
+}; // class cedar::aux::conv::Strategy
+
+#endif // CEDAR_AUX_CONV_STRATEGY_H
+
@@ -41,11 +41,13 @@
 #include "cedar/auxiliaries/Settings.h"
 #include "cedar/auxiliaries/stringFunctions.h"
 #include "cedar/auxiliaries/sleepFunctions.h"
+#include "cedar/auxiliaries/threadingUtilities.h"
 #include "cedar/units/Time.h"
 #include "cedar/units/prefixes.h"
 
 // SYSTEM INCLUDES
 #include <algorithm>
+#include <chrono>
 #include <boost/date_time/posix_time/posix_time.hpp>
 #include <boost/date_time/posix_time/posix_time_io.hpp>
 
@@ -173,6 +175,11 @@ void cedar::aux::detail::LoopedThreadWorker::work()
         if (safeStopRequested())
           break;
 
+        recordWakeupLatency
+        (
+          (boost::posix_time::microsec_clock::universal_time() - scheduled_wakeup).total_microseconds()
+        );
+
         // determine time since last run
         setLastTimeStepStart( getLastTimeStepEnd() );
         setLastTimeStepEnd( scheduled_wakeup );
@@ -232,6 +239,11 @@ void cedar::aux::detail::LoopedThreadWorker::work()
         if (safeStopRequested()) // a lot can happen in a few us 
           break;
 
+        recordWakeupLatency
+        (
+          (boost::posix_time::microsec_clock::universal_time() - scheduled_wakeup).total_microseconds()
+        );
+
         // determine time since last run
         setLastTimeStepStart( getLastTimeStepEnd() );
         setLastTimeStepEnd( scheduled_wakeup );
@@ -370,6 +382,12 @@ void cedar::aux::detail::LoopedThreadWorker::work()
 
         auto current_time_after_sleep= boost::posix_time::microsec_clock::universal_time();
 
+        recordWakeupLatency
+        (
+          (current_time_after_sleep - current_time_before_sleep).total_microseconds()
+            - effective_sleep_duration_safe_mus
+        );
+
         mLastTimeStepStart= mLastTimeStepEnd;
         mLastTimeStepEnd= current_time_after_sleep;
 
@@ -465,6 +483,12 @@ void cedar::aux::detail::LoopedThreadWorker::work()
       } // end while
       break;
     } // end new nodes
+
+    case cedar::aux::LoopMode::Deadline:
+    {
+      this->workWithDeadlines(orig_step_size);
+      break;
+    }
     default:
     {
       // this should never happen - unrecognized enum case
@@ -476,6 +500,88 @@ void cedar::aux::detail::LoopedThreadWorker::work()
   return;
 }
 
+void cedar::aux::detail::LoopedThreadWorker::workWithDeadlines(const boost::posix_time::time_duration& stepSize)
+{
+  this->initRngs();
+
+  // scheduling options; failing to apply them is not fatal, the loop just runs less precisely
+  unsigned int priority = mpWrapper->getRealTimePriority();
+  if (priority > 0 && !cedar::aux::setCurrentThreadRealTimePriority(priority))
+  {
+    cedar::aux::LogSingleton::getInstance()->warning
+    (
+      "Could not set the real-time priority " + cedar::aux::toString(priority) + "; the thread runs with default "
+      "scheduling. This usually requires the permission to use real-time priorities.",
+      CEDAR_CURRENT_FUNCTION_NAME
+    );
+  }
+  int cpu = mpWrapper->getCpuAffinity();
+  if (cpu >= 0 && !cedar::aux::setCurrentThreadAffinity(cpu))
+  {
+    cedar::aux::LogSingleton::getInstance()->warning
+    (
+      "Could not pin the thread to CPU " + cedar::aux::toString(cpu) + ".",
+      CEDAR_CURRENT_FUNCTION_NAME
+    );
+  }
+  cedar::unit::Time busy_wait = mpWrapper->getBusyWaitTime();
+
+  const std::chrono::microseconds step_size(stepSize.total_microseconds());
+  std::chrono::steady_clock::time_point last_wakeup = std::chrono::steady_clock::now();
+  std::chrono::steady_clock::time_point deadline = last_wakeup + step_size;
+
+  setLastTimeStepStart(boost::posix_time::microsec_clock::universal_time());
+  setLastTimeStepEnd(getLastTimeStepStart());
+
+  while (!safeStopRequested())
+  {
+    cedar::aux::sleepUntil(deadline, busy_wait);
+
+    if (safeStopRequested())
+    {
+      break;
+    }
+
+    std::chrono::steady_clock::time_point wakeup = std::chrono::steady_clock::now();
+    recordWakeupLatency(std::chrono::duration_cast<std::chrono::microseconds>(wakeup - deadline).count());
+
+    setLastTimeStepStart(getLastTimeStepEnd());
+    setLastTimeStepEnd(boost::posix_time::microsec_clock::universal_time());
+
+    QReadLocker locker(this->mTimeFactor.getLockPtr());
+    double time_factor = this->mTimeFactor.member();
+    locker.unlock();
+
+    double elapsed_us
+      = static_cast<double>(std::chrono::duration_cast<std::chrono::microseconds>(wakeup - last_wakeup).count());
+    last_wakeup = wakeup;
+    cedar::unit::Time elapsed(elapsed_us * cedar::unit::micro * cedar::unit::seconds);
+    mpWrapper->step(elapsed * time_factor);
+
+    // the next deadline only depends on the previous one, so time spent in step() does not accumulate as drift;
+    // deadlines that already passed are skipped rather than caught up with
+    deadline += step_size;
+    long steps_missed = 0;
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    if (deadline < now)
+    {
+      steps_missed = static_cast<long>((now - deadline) / step_size) + 1;
+      deadline += steps_missed * step_size;
+    }
+
+    updateStatistics(steps_missed + 1);
+  }
+
+  if (priority > 0)
+  {
+    cedar::aux::setCurrentThreadRealTimePriority(0);
+  }
+  if (cpu >= 0)
+  {
+    cedar::aux::setCurrentThreadAffinity(-1);
+  }
+}
+
 void cedar::aux::detail::LoopedThreadWorker::initRngs()
 {
   auto seed = boost::posix_time::microsec_clock::universal_time().time_of_day().total_milliseconds();
@@ -492,6 +598,19 @@ void cedar::aux::detail::LoopedThreadWorker::initStatistics()
   mNumberOfSteps = 0;
   mSumOfStepsTaken = 0.0;
   mMaxStepsTaken = 0.0;
+
+  mWakeupLatencies.reset();
+}
+
+void cedar::aux::detail::LoopedThreadWorker::recordWakeupLatency(long long microseconds)
+{
+  // the histogram is atomic, so the looped thread never waits for someone reading the statistics
+  mWakeupLatencies.record(microseconds);
+}
+
+cedar::aux::LatencyHistogram cedar::aux::detail::LoopedThreadWorker::getWakeupLatencyHistogram() const
+{
+  return mWakeupLatencies;
 }
 
 void cedar::aux::detail::LoopedThreadWorker::updateStatistics(double stepsTaken)
@@ -46,6 +46,7 @@
 #include "cedar/auxiliaries/DoubleParameter.h"
 #include "cedar/auxiliaries/BoolParameter.h"
 #include "cedar/auxiliaries/EnumParameter.h"
+#include "cedar/auxiliaries/LatencyHistogram.h"
 #include "cedar/auxiliaries/LoopMode.h"
 #include "cedar/auxiliaries/LockableMember.h"
 #include "cedar/auxiliaries/detail/ThreadWorker.h"
@@ -81,6 +82,8 @@ class cedar::aux::detail::LoopedThreadWorker : public cedar::aux::detail::Thread
     void initStatistics();
     //! update statistics 
     inline void updateStatistics(double stepsTaken);
+    //! adds how late the thread woke up compared to its schedule to the statistics
+    void recordWakeupLatency(long long microseconds);
     //! request stop in the wrapper
     void safeRequestStop();
     //! check whether a stop has been requested
@@ -127,9 +130,15 @@ class cedar::aux::detail::LoopedThreadWorker : public cedar::aux::detail::Thread
     //! Return the number of steps missed
     double getSumOfStepsMissed();
 
+    //! Returns a copy of the histogram of wakeup latencies since the last start.
+    cedar::aux::LatencyHistogram getWakeupLatencyHistogram() const;
+
   private:
     void globalTimeFactorChanged(double newFactor);
 
+    //! the loop of cedar::aux::LoopMode::Deadline
+    void workWithDeadlines(const boost::posix_time::time_duration& stepSize);
+
   private:
     //! we keep a pointer to the wrapper
     cedar::aux::LoopedThread* mpWrapper;
@@ -160,6 +169,9 @@ class cedar::aux::detail::LoopedThreadWorker : public cedar::aux::detail::Thread
     //! lock for mLastTimeStepEnd
     mutable QReadWriteLock mLastTimeStepEndLock;
 
+    //! how late the thread woke up compared to its schedule; recorded only by the looped thread, read without locking
+    cedar::aux::LatencyHistogram mWakeupLatencies;
+
     boost::signals2::scoped_connection mGlobalTimeFactorConnection;
 
     bool mDebugMe;
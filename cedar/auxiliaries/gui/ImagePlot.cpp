@@ -113,6 +113,7 @@ cedar::aux::gui::ImagePlot::~ImagePlot()
 void cedar::aux::gui::ImagePlot::construct()
 {
   this->mDataType = DATA_TYPE_UNKNOWN;
+  this->mConvertedRevision = 0;
 
   this->setValueScalingEnabled(false);
 }
@@ -122,9 +123,8 @@ void cedar::aux::gui::ImagePlot::plotClicked(QMouseEvent* pEvent, double relativ
   if (!this->mData || pEvent->button() != Qt::LeftButton)
     return;
 
-  QReadLocker locker(&this->mData->getLock());
-
-  const cv::Mat& matrix = this->mData->getData();
+  cedar::aux::MatData::ConstSnapshotPtr snapshot = this->mData->getSnapshot();
+  const cv::Mat& matrix = snapshot->mData;
 
   if (matrix.empty())
   {
@@ -199,29 +199,27 @@ void cedar::aux::gui::ImagePlot::plotClicked(QMouseEvent* pEvent, double relativ
     info_text += QString(" (%1)").arg(QString::fromStdString(this->mDataColorSpace->getChannelCode()));
   }
 
-  locker.unlock();
-
   QToolTip::showText(pEvent->globalPos(), info_text);
 }
 
 //!@cond SKIPPED_DOCUMENTATION
 bool cedar::aux::gui::ImagePlot::doConversion()
 {
-  QReadLocker read_lock(&this->mData->getLock());
-
   if (this->mDataType == DATA_TYPE_UNKNOWN)
   {
     return false;
   }
 
-  if (this->mData->getDimensionality() > 2)
+  // convert a snapshot so that the lock of the data is never held during the conversion
+  cedar::aux::MatData::ConstSnapshotPtr snapshot = this->mData->getSnapshot();
+  const cv::Mat& mat = snapshot->mData;
+
+  if (cedar::aux::math::getDimensionalityOf(mat) > 2)
   {
     this->setInfo("cannot display matrices of dimensionality > 2");
     return false;
   }
 
-  const cv::Mat& mat = this->mData->getData();
-
   if (mat.empty())
   {
     this->setInfo("Matrix is empty.");
@@ -234,9 +232,7 @@ bool cedar::aux::gui::ImagePlot::doConversion()
     case CV_16UC1:
     case CV_8UC1:
     {
-      cv::Mat copy = this->mData->getData().clone();
-      read_lock.unlock();
-      cv::Mat converted = this->threeChannelGrayscale(copy);
+      cv::Mat converted = this->threeChannelGrayscale(mat);
       CEDAR_DEBUG_ASSERT(converted.type() == CV_8UC3);
       this->displayMatrix(converted);
       break;
@@ -258,7 +254,7 @@ bool cedar::aux::gui::ImagePlot::doConversion()
         cv::Mat converted;
         cv::cvtColor
         (
-          this->mData->getData(),
+          mat,
           converted,
 #if CEDAR_OPENCV_MAJOR_VERSION >= 3
           cv::COLOR_HSV2BGR
@@ -266,13 +262,11 @@ bool cedar::aux::gui::ImagePlot::doConversion()
           CV_HSV2BGR
 #endif
         );
-				read_lock.unlock();
         this->displayMatrix(converted);
       }
       else
       {
-        this->displayMatrix(this->mData->getData());
-				read_lock.unlock();
+        this->displayMatrix(mat);
       }
       break;
     }
@@ -281,9 +275,7 @@ bool cedar::aux::gui::ImagePlot::doConversion()
     case CV_64FC1:
     {
       // convert grayscale to three-channel matrix
-      cv::Mat copy = mat.clone();
-      read_lock.unlock();
-      cv::Mat converted = this->threeChannelGrayscale(copy);
+      cv::Mat converted = this->threeChannelGrayscale(mat);
       CEDAR_DEBUG_ASSERT(converted.type() == CV_8UC3);
       this->displayMatrix(converted);
       break;
@@ -292,11 +284,9 @@ bool cedar::aux::gui::ImagePlot::doConversion()
     case CV_32FC3:
     {
       // convert grayscale to three-channel matrix
-      cv::Mat copy = mat.clone();
-      read_lock.unlock();
       cv::Mat channels[3];
       double min_all = std::numeric_limits<double>::max(), max_all = -std::numeric_limits<double>::max();
-      cv::split(copy, channels);
+      cv::split(mat, channels);
       for (size_t c = 0; c < 3; ++c)
       {
         double min, max;
@@ -311,8 +301,8 @@ bool cedar::aux::gui::ImagePlot::doConversion()
         }
       }
       cv::Mat converted;
-      copy = (copy - min_all) / (max_all - min_all);
-      copy.convertTo(converted, CV_8UC3, 255.0);
+      cv::Mat scaled = (mat - min_all) / (max_all - min_all);
+      scaled.convertTo(converted, CV_8UC3, 255.0);
       CEDAR_DEBUG_ASSERT(converted.type() == CV_8UC3);
       this->displayMatrix(converted);
       break;
@@ -320,15 +310,21 @@ bool cedar::aux::gui::ImagePlot::doConversion()
 
     default:
     {
-      read_lock.unlock();
       std::string matrix_type_name = cedar::aux::math::matrixTypeToString(mat);
       this->setInfo("Cannot display matrix of type " + matrix_type_name + ".");
       return false;
     }
   }
 
+  this->mConvertedRevision = snapshot->mRevision;
   return true;
 }
+
+bool cedar::aux::gui::ImagePlot::isUpToDate() const
+{
+  // non-publishing data may be written without a new revision
+  return this->mData && this->mData->isPublishing() && this->mData->getRevision() == this->mConvertedRevision;
+}
 //!@endcond
 
 cv::Mat cedar::aux::gui::ImagePlot::threeChannelGrayscale(const cv::Mat& in)
@@ -49,6 +49,7 @@
 
 // SYSTEM INCLUDES
 #include <QReadWriteLock>
+#include <atomic>
 #include <vector>
 
 
@@ -117,6 +118,9 @@ private:
 
   bool doConversion();
 
+  //! Returns true if the data is publishing and its current revision has already been converted.
+  bool isUpToDate() const;
+
   //--------------------------------------------------------------------------------------------------------------------
   // members
   //--------------------------------------------------------------------------------------------------------------------
@@ -132,6 +136,9 @@ private:
   //! Type of the data.
   DataType mDataType;
 
+  //! Revision of the snapshot that was converted last.
+  std::atomic<unsigned long> mConvertedRevision;
+
 }; // class cedar::aux::gui::ImagePlot
 
 #endif // CEDAR_AUX_GUI_IMAGE_PLOT_H
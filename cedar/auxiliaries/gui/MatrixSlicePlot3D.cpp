@@ -66,7 +66,8 @@
 cedar::aux::gui::MatrixSlicePlot3D::MatrixSlicePlot3D(QWidget* pParent)
 :
 cedar::aux::gui::QImagePlot(pParent),
-mDataIsSet(false)
+mDataIsSet(false),
+mConvertedRevision(0)
 {
   this->init();
 }
@@ -79,7 +80,8 @@ cedar::aux::gui::MatrixSlicePlot3D::MatrixSlicePlot3D
 )
 :
 cedar::aux::gui::QImagePlot(pParent),
-mDataIsSet(false)
+mDataIsSet(false),
+mConvertedRevision(0)
 {
   this->init();
   this->plot(matData, title);
@@ -306,21 +308,20 @@ bool cedar::aux::gui::MatrixSlicePlot3D::doConversion()
     return false;
   }
 
-  QReadLocker locker(&this->mData->getLock());
-  if (this->mData->getDimensionality() != 3) // plot is no longer capable of displaying the data
+  // convert a snapshot so that the lock of the data is never held during the conversion
+  cedar::aux::MatData::ConstSnapshotPtr snapshot = this->mData->getSnapshot();
+  if (cedar::aux::math::getDimensionalityOf(snapshot->mData) != 3) // plot is no longer capable of displaying the data
   {
     emit dataChanged();
     return false;
   }
 
-  const cv::Mat& mat = this->mData->getData();
-  if (mat.empty())
+  const cv::Mat& cloned_mat = snapshot->mData;
+  if (cloned_mat.empty())
   {
     this->setInfo("Matrix is empty.");
     return false;
   }
-  cv::Mat cloned_mat = mat.clone();
-  locker.unlock();
 #ifdef CEDAR_SLICE_PLOT_OPENCV_BACKWARDS_COMPATIBILITY_MODE
   switch(cloned_mat.type())
   {
@@ -341,9 +342,16 @@ bool cedar::aux::gui::MatrixSlicePlot3D::doConversion()
   this->slicesFromMat(cloned_mat);
 #endif // CEDAR_SLICE_PLOT_OPENCV_BACKWARDS_COMPATIBILITY_MODE
 
+  this->mConvertedRevision = snapshot->mRevision;
   return true;
 }
 
+bool cedar::aux::gui::MatrixSlicePlot3D::isUpToDate() const
+{
+  // non-publishing data may be written without a new revision
+  return this->mDataIsSet && this->mData->isPublishing() && this->mData->getRevision() == this->mConvertedRevision;
+}
+
 void cedar::aux::gui::MatrixSlicePlot3D::fillContextMenu(QMenu& menu)
 {
   QMenu* p_slice_menu = menu.addMenu("sliced dimension");
@@ -372,6 +380,9 @@ void cedar::aux::gui::MatrixSlicePlot3D::slicedDimensionSelected()
 
   QWriteLocker sliced_dim_locker(this->_mSlicedDimension->getLock());
   this->_mSlicedDimension->setValue(dimension);
+  sliced_dim_locker.unlock();
+
+  this->invalidate();
 }
 
 void cedar::aux::gui::MatrixSlicePlot3D::plotClicked(QMouseEvent* pEvent, double relativeImageX, double relativeImageY)
@@ -382,14 +393,14 @@ void cedar::aux::gui::MatrixSlicePlot3D::plotClicked(QMouseEvent* pEvent, double
 
   cedar::aux::gui::MatrixSlicePlot3D::getSetup(dim_0, dim_1, dim_sliced);
 
-  QReadLocker locker(&this->mData->getLock());
+  cedar::aux::MatData::ConstSnapshotPtr snapshot = this->mData->getSnapshot();
 
   int padding = 1;
 
   int idx_row = static_cast<int>(relativeImageY * static_cast<double>(mSliceMatrix.rows));
   int idx_col = static_cast<int>(relativeImageX * static_cast<double>(mSliceMatrix.cols));
 
-  cv::Mat mat = this->mData->getData();
+  const cv::Mat& mat = snapshot->mData;
   auto size = mat.size;
 
   int idx_2_per_row = mSliceMatrix.cols / (size[dim_1] + padding) + 1; // +1 because there is no padding on the right side
@@ -427,7 +438,6 @@ void cedar::aux::gui::MatrixSlicePlot3D::plotClicked(QMouseEvent* pEvent, double
   }
 
   QToolTip::showText(pEvent->globalPos(), info_text);
-  locker.unlock();
 }
 
 
@@ -441,6 +451,7 @@ void cedar::aux::gui::MatrixSlicePlot3D::keyPressEvent(QKeyEvent* pEvent)
       if (_mDesiredColumns->getValue() < static_cast<unsigned int>(mat.size[2]))
       {
         this->_mDesiredColumns->setValue(this->_mDesiredColumns->getValue() + 1);
+        this->invalidate();
       }
       break;
     }
@@ -449,6 +460,7 @@ void cedar::aux::gui::MatrixSlicePlot3D::keyPressEvent(QKeyEvent* pEvent)
       if (this->_mDesiredColumns->getValue() > 1)
       {
         this->_mDesiredColumns->setValue(this->_mDesiredColumns->getValue() - 1);
+        this->invalidate();
       }
       break;
     }
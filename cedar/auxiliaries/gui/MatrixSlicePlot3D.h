@@ -53,6 +53,7 @@
 #include <QLabel>
 #include <QReadWriteLock>
 #include <opencv2/opencv.hpp>
+#include <atomic>
 
 
 /*!@brief A slice-plot for 3D matrices.
@@ -112,6 +113,9 @@ private:
 
   bool doConversion();
 
+  //! Returns true if the data is publishing and its current revision has already been converted.
+  bool isUpToDate() const;
+
   //! initialize the widget
   void init();
 
@@ -141,6 +145,9 @@ private:
   cv::Mat mSliceSize;
   bool mDataIsSet;
 
+  //! Revision of the snapshot that was converted last.
+  std::atomic<unsigned long> mConvertedRevision;
+
 
   //--------------------------------------------------------------------------------------------------------------------
   // parameters
@@ -55,6 +55,7 @@
 #include <QDoubleSpinBox>
 #include <QPushButton>
 #include <QFileDialog>
+#include <algorithm>
 
 
 //!@cond SKIPPED_DOCUMENTATION
@@ -184,6 +185,8 @@ cedar::aux::gui::detail::QImagePlotLegend::QImagePlotLegend()
 
 void cedar::aux::gui::QImagePlot::plot(cedar::aux::ConstDataPtr data, const std::string& /*title*/)
 {
+  this->invalidate();
+
   if (data->hasAnnotation<cedar::aux::annotation::ValueRangeHint>())
   {
     this->mValueHint = data->getAnnotation<cedar::aux::annotation::ValueRangeHint>();
@@ -208,6 +211,7 @@ void cedar::aux::gui::QImagePlot::colorJetChanged()
   auto enum_id = this->_mColorJet->getValue();
   auto gradient = cedar::aux::ColorGradient::getStandardGradient(enum_id);
   this->setColorJet(gradient);
+  this->invalidate();
 }
 
 void cedar::aux::gui::QImagePlot::setColorJet(cedar::aux::ColorGradientPtr gradient)
@@ -280,6 +284,7 @@ cv::Mat cedar::aux::gui::QImagePlot::colorizeMatrix(const cv::Mat& toColorize, b
 void cedar::aux::gui::QImagePlot::setAutomaticScaling()
 {
   this->_mAutoScaling->setValue(true);
+  this->invalidate();
 }
 
 void cedar::aux::gui::QImagePlot::setLimits(double min, double max)
@@ -342,6 +347,8 @@ void cedar::aux::gui::QImagePlot::updateMinMax(double min, double max)
 
 void cedar::aux::gui::QImagePlot::valueLimitsChanged()
 {
+  this->invalidate();
+
   if (!this->isAutoScaling() && this->mpLegend)
   {
     this->mpLegend->updateMinMax(this->getValueLimits().getLower(), this->getValueLimits().getUpper());
@@ -456,9 +463,48 @@ void cedar::aux::gui::QImagePlot::colorJetActionTriggered()
 
 void cedar::aux::gui::QImagePlot::resizeEvent(QResizeEvent * /*pEvent*/)
 {
+  QWriteLocker size_locker(this->mDisplaySize.getLockPtr());
+  this->mDisplaySize.member() = this->mpImageDisplay->size();
+  size_locker.unlock();
+  // the image may have been decimated for a smaller display
+  this->invalidate();
+
   this->resizePixmap();
 }
 
+cv::Mat cedar::aux::gui::QImagePlot::decimate(const cv::Mat& image) const
+{
+  // width and height have to be read together, they may be changed by a resize event in the GUI thread meanwhile
+  QReadLocker size_locker(this->mDisplaySize.getLockPtr());
+  int width = this->mDisplaySize.member().width();
+  int height = this->mDisplaySize.member().height();
+  size_locker.unlock();
+  if (width <= 0 || height <= 0 || image.dims > 2 || (image.cols <= width && image.rows <= height))
+  {
+    return image;
+  }
+
+  double factor = std::max
+                  (
+                    static_cast<double>(width) / static_cast<double>(image.cols),
+                    static_cast<double>(height) / static_cast<double>(image.rows)
+                  );
+  if (factor >= 1.0)
+  {
+    return image;
+  }
+
+  cv::Size size
+  (
+    std::max(1, cvRound(factor * static_cast<double>(image.cols))),
+    std::max(1, cvRound(factor * static_cast<double>(image.rows)))
+  );
+  cv::Mat decimated;
+  // area interpolation averages the pixels that are merged, which avoids aliasing
+  cv::resize(image, decimated, size, 0.0, 0.0, cv::INTER_AREA);
+  return decimated;
+}
+
 void cedar::aux::gui::QImagePlot::resizePixmap()
 {
   Qt::AspectRatioMode aspect_ratio_mode = Qt::KeepAspectRatio;
@@ -508,15 +554,19 @@ void cedar::aux::gui::QImagePlot::updatePlot()
 
 void cedar::aux::gui::QImagePlot::displayMatrix(const cv::Mat& matrix)
 {
+  cv::Mat image = this->decimate(matrix);
+
+  QImage converted = QImage
+                     (
+                       image.data,
+                       image.cols,
+                       image.rows,
+                       image.step,
+                       QImage::Format_RGB888
+                     ).rgbSwapped();
+
   QWriteLocker lock(&this->mImageLock);
-  this->mImage = QImage
-                 (
-                   matrix.data,
-                   matrix.cols,
-                   matrix.rows,
-                   matrix.step,
-                   QImage::Format_RGB888
-                 ).rgbSwapped();
+  this->mImage = converted;
 }
 
 //!@cond SKIPPED_DOCUMENTATION
@@ -57,6 +57,7 @@
 #include <QDir>
 #include <QLinearGradient>
 #include <QReadWriteLock>
+#include <QSize>
 #include <opencv2/opencv.hpp>
 
 
@@ -193,7 +194,8 @@ protected:
   void updatePlot();
 
   /*! Set the matrix to be displayed.
-   *  @remarks This only has effect after updateImage() is called from the GUI threat.
+   *  @remarks This only has effect after updateImage() is called from the GUI threat. Matrices larger than the
+   *           display are downsampled here, i.e., in the conversion thread (see decimate).
    */
   void displayMatrix(const cv::Mat& matrix);
 
@@ -230,6 +232,13 @@ private:
   */
   void resizePixmap();
 
+  /*!@brief Downsamples an image that is larger than the display area.
+   *
+   *        The image is shrunk uniformly until one of its sides matches the display, so no detail is lost that the
+   *        display could show, regardless of the aspect ratio setting.
+   */
+  cv::Mat decimate(const cv::Mat& image) const;
+
   virtual void fillContextMenu(QMenu& menu);
 
   virtual void plotClicked(QMouseEvent* pEvent, double relativeImageX, double relativeImageY);
@@ -264,6 +273,9 @@ private:
   //! Lock for mImage.
   QReadWriteLock mImageLock;
 
+  //! Size of the image display, used by the conversion thread for decimation (invalid if unknown).
+  cedar::aux::LockableMember<QSize> mDisplaySize;
+
   //! Whether or not a legend is available
   bool mLegendAvailable;
 
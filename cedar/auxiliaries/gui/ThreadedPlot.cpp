@@ -56,7 +56,8 @@ cedar::aux::gui::ThreadedPlot::ThreadedPlot(QWidget* pParent)
 :
 cedar::aux::gui::PlotInterface(pParent),
 mTimerId(0),
-mCaller(boost::bind(&cedar::aux::gui::ThreadedPlot::convert, this))
+mCaller(boost::bind(&cedar::aux::gui::ThreadedPlot::convert, this)),
+mInvalidated(true)
 {
   QObject::connect(this, SIGNAL(conversionDoneSignal()), this, SLOT(conversionDone()), Qt::QueuedConnection);
   QObject::connect(this, SIGNAL(conversionFailedSignal()), this, SLOT(conversionFailed()), Qt::QueuedConnection);
@@ -119,9 +120,25 @@ void cedar::aux::gui::ThreadedPlot::timerEvent(QTimerEvent* /*pEvent*/)
 
   if (!this->mCaller.isExecuting())
   {
+    // skip frames in which nothing has changed
+    if (!this->mInvalidated.exchange(false) && this->isUpToDate())
+    {
+      return;
+    }
+
     this->mCaller.execute();
   }
 }
+
+bool cedar::aux::gui::ThreadedPlot::isUpToDate() const
+{
+  return false;
+}
+
+void cedar::aux::gui::ThreadedPlot::invalidate()
+{
+  this->mInvalidated = true;
+}
 
 void cedar::aux::gui::ThreadedPlot::start()
 {
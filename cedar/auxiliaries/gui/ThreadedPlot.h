@@ -50,10 +50,14 @@
 // SYSTEM INCLUDES
 #include <QObject>
 #include <QThread>
+#include <atomic>
 
 
 /*!@brief A base class for plots that convert data in a separate thread.
  *
+ *        Conversions are started by a timer. Child classes that can tell when their data has not changed since the
+ *        last conversion can override isUpToDate to skip these frames; settings that change the plot's appearance
+ *        should then call invalidate.
  */
 class cedar::aux::gui::ThreadedPlot : public cedar::aux::gui::PlotInterface
 {
@@ -106,6 +110,9 @@ protected:
   //! Waits for plotting to finish.
   void wait();
 
+  //! Makes the next timer event convert the data even if isUpToDate returns true.
+  void invalidate();
+
   //--------------------------------------------------------------------------------------------------------------------
   // private methods
   //--------------------------------------------------------------------------------------------------------------------
@@ -121,6 +128,11 @@ private:
    */
   virtual void updatePlot() = 0;
 
+  /*! Returns whether the last conversion still reflects the plotted data. Called in the GUI thread, so this should
+   *  be cheap. The default implementation returns false, i.e., the data is converted on every timer event.
+   */
+  virtual bool isUpToDate() const;
+
   void convert();
 
 private slots:
@@ -140,6 +152,9 @@ private:
   //! Used for calling the plot function.
   cedar::aux::CallFunctionInThreadALot mCaller;
 
+  //! Whether the next timer event has to convert regardless of isUpToDate.
+  std::atomic<bool> mInvalidated;
+
   //--------------------------------------------------------------------------------------------------------------------
   // parameters
   //--------------------------------------------------------------------------------------------------------------------
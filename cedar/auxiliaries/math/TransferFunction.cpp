@@ -59,7 +59,14 @@ float cedar::aux::math::TransferFunction::compute(float value) const
 
 cv::Mat cedar::aux::math::TransferFunction::compute(const cv::Mat& values) const
 {
-  cv::Mat result = values.clone();
+  cv::Mat result;
+  this->compute(values, result);
+  return result;
+}
+
+void cedar::aux::math::TransferFunction::compute(const cv::Mat& values, cv::Mat& result) const
+{
+  result.create(values.dims, values.size, values.type());
   if (values.type() == CV_32F)
   {
     cv::MatConstIterator_<float> iter_src = values.begin<float>();
@@ -88,6 +95,4 @@ cv::Mat cedar::aux::math::TransferFunction::compute(const cv::Mat& values) const
       "This transfer function is not implemented for non-floating data types."
     );
   }
-  return result;
 }
-
@@ -39,11 +39,14 @@
 
 // CEDAR INCLUDES
 #include "cedar/auxiliaries/Configurable.h"
+#include "cedar/auxiliaries/exceptions.h"
 
 // FORWARD DECLARATIONS
 #include "cedar/auxiliaries/math/TransferFunction.fwd.h"
 
 // SYSTEM INCLUDES
+#include <opencv2/opencv.hpp>
+#include <algorithm>
 
 /*!@brief Basic interface for all TransferFunction functions.
  */
@@ -99,26 +102,83 @@ public:
 
   /*!@brief Computes the transfer function for each element in the matrix.
    *
-   * @remarks The default implementation iterates over the matrix and calls the other compute function. Override this in
-   *          the child classes to increase performance.
+   * @remarks The default implementation allocates a result matrix and calls compute(const cv::Mat&, cv::Mat&).
    */
   virtual cv::Mat compute(const cv::Mat& values) const;
 
+  /*!@brief Computes the transfer function for each element in the matrix and writes it into the given result.
+   *
+   *        If result already has the size and type of values, no memory is allocated. values and result may refer to
+   *        the same matrix.
+   *
+   * @remarks The default implementation iterates over the matrix and calls compute(double) for each element. Override
+   *          this in the child classes to increase performance.
+   */
+  virtual void compute(const cv::Mat& values, cv::Mat& result) const;
+
   //--------------------------------------------------------------------------------------------------------------------
   // protected methods
   //--------------------------------------------------------------------------------------------------------------------
 protected:
-  // none yet
+  /*!@brief Applies an element-wise batch kernel to values and writes the output into result.
+   *
+   *        The kernel is called as kernel(const T* in, T* out, int length) for consecutive blocks of at most
+   *        BATCH_BLOCK_SIZE elements, where T is float for CV_32F and double for CV_64F matrices. in and out may point
+   *        to the same memory. result is only reallocated if it does not match values in size and type.
+   */
+  template <typename Kernel>
+  static void applyBatchKernel(const cv::Mat& values, cv::Mat& result, const Kernel& kernel)
+  {
+    switch (values.type())
+    {
+      case CV_32F:
+        applyBatchKernelTyped<float>(values, result, kernel);
+        break;
+
+      case CV_64F:
+        applyBatchKernelTyped<double>(values, result, kernel);
+        break;
+
+      default:
+        CEDAR_THROW
+        (
+          cedar::aux::NotImplementedException,
+          "This transfer function is not implemented for non-floating data types."
+        );
+    }
+  }
 
   //--------------------------------------------------------------------------------------------------------------------
   // private methods
   //--------------------------------------------------------------------------------------------------------------------
 private:
-  // none yet
+  //! Applies the batch kernel for the given element type, see applyBatchKernel.
+  template <typename T, typename Kernel>
+  static void applyBatchKernelTyped(const cv::Mat& values, cv::Mat& result, const Kernel& kernel)
+  {
+    result.create(values.dims, values.size, values.type());
+
+    const cv::Mat* arrays[] = {&values, &result, 0};
+    cv::Mat planes[2];
+    cv::NAryMatIterator iter(arrays, planes);
+    for (size_t plane = 0; plane < iter.nplanes; ++plane, ++iter)
+    {
+      const T* p_in = planes[0].ptr<T>();
+      T* p_out = planes[1].ptr<T>();
+      for (size_t begin = 0; begin < iter.size; begin += BATCH_BLOCK_SIZE)
+      {
+        int length = static_cast<int>(std::min(static_cast<size_t>(BATCH_BLOCK_SIZE), iter.size - begin));
+        kernel(p_in + begin, p_out + begin, length);
+      }
+    }
+  }
 
   //--------------------------------------------------------------------------------------------------------------------
   // members
   //--------------------------------------------------------------------------------------------------------------------
+public:
+  //! Maximum number of elements handed to a batch kernel at once; small enough for a block to stay in the cache.
+  static const int BATCH_BLOCK_SIZE = 1024;
 protected:
   // none yet
 private:
@@ -43,6 +43,7 @@
 
 // SYSTEM INCLUDES
 #include <iostream>
+#include <algorithm>
 #include <math.h>
 
 cv::Mat cedar::aux::math::boxMatrix
@@ -127,16 +128,33 @@ cv::Mat cedar::aux::math::gaussMatrix
         )
 {
   cv::Mat output;
-  std::vector<cv::Mat> kernel_parts;
-  kernel_parts.resize(dimensionality);
+  std::vector<cv::Mat> profiles;
+  cedar::aux::math::gaussMatrix(dimensionality, matrixSizes, amplitude, sigmas, centers, cyclic, output, profiles);
+  return output;
+}
+
+void cedar::aux::math::gaussMatrix
+     (
+       unsigned int dimensionality,
+       const std::vector<unsigned int>& matrixSizes,
+       double amplitude,
+       const std::vector<double>& sigmas,
+       const std::vector<double>& centers,
+       bool cyclic,
+       cv::Mat& output,
+       std::vector<cv::Mat>& profiles
+     )
+{
+  CEDAR_ASSERT(dimensionality <= CV_MAX_DIM);
+  profiles.resize(dimensionality);
   for (size_t dim = 0; dim < dimensionality; ++dim)
   {
-    kernel_parts.at(dim) = cv::Mat(static_cast<int>(matrixSizes.at(dim)), 1, CV_32F);
+    profiles.at(dim).create(static_cast<int>(matrixSizes.at(dim)), 1, CV_32F);
     CEDAR_DEBUG_ASSERT(sigmas.at(dim) > 0.0);
 
     if (cyclic) // is this a cyclic kernel? (only check once)
     {
-      for (int row = 0; row < kernel_parts.at(dim).rows; ++row)
+      for (int row = 0; row < profiles.at(dim).rows; ++row)
       {
         double position = row - static_cast<double>(centers.at(dim));
         double current_size = static_cast<double>(matrixSizes.at(dim));
@@ -152,76 +170,67 @@ cv::Mat cedar::aux::math::gaussMatrix
         {
           position -= current_size;
         }
-        kernel_parts.at(dim).at<float>(row, 0)
+        profiles.at(dim).at<float>(row, 0)
               = cedar::aux::math::gauss(position, sigmas.at(dim));
       }
     }
     else // nothing special to do here
     {
-      for (int row = 0; row < kernel_parts.at(dim).rows; ++row)
+      for (int row = 0; row < profiles.at(dim).rows; ++row)
       {
-        kernel_parts.at(dim).at<float>(row, 0)
+        profiles.at(dim).at<float>(row, 0)
               = cedar::aux::math::gauss(static_cast<double>(row) - centers.at(dim), sigmas.at(dim));
       }
     }
   }
-  kernel_parts.at(0) *= amplitude;
+  profiles.at(0) *= amplitude;
   // assemble the input
-  std::vector<int> sizes(static_cast<size_t>(dimensionality));
+  int sizes[CV_MAX_DIM];
   for (unsigned int i = 0; i < dimensionality; i++)
   {
     sizes[i] = matrixSizes.at(i);
   }
+  // create only reallocates if the output does not have the requested size already
   if (dimensionality == 1)
   {
-    output = cv::Mat(static_cast<int>(sizes.at(0)), 1, CV_32F);
+    output.create(sizes[0], 1, CV_32F);
   }
   else
   {
-    output = cv::Mat(static_cast<int>(dimensionality), &sizes.at(0), CV_32F);
+    output.create(static_cast<int>(dimensionality), sizes, CV_32F);
   }
-  // now fill up the big kernel matrix
-  std::vector<int> position(static_cast<size_t>(dimensionality));
-  unsigned int max_index = 1;
+  // check the size before filling the matrix
   double max_index_d = 1.0;
   for (unsigned int dim = 0; dim < dimensionality; dim++)
   {
-    position[dim] = 0;
     max_index_d *= sizes[dim];
     if (max_index_d > std::numeric_limits<unsigned int>::max()/100.0)
     {
       CEDAR_THROW(cedar::aux::RangeException, "cannot handle inputs of this size");
     }
   }
-  max_index = static_cast<unsigned int>(max_index_d);
-  for (unsigned int i = 0; i < max_index; i++)
+
+  // the Gauss is separable: the matrix is the outer product of the 1D profiles. Its memory is continuous with the last
+  // dimension varying fastest, so the product is expanded in place one dimension at a time; iterating backwards makes
+  // sure that no entry is overwritten before it has been expanded.
+  CEDAR_DEBUG_ASSERT(output.isContinuous());
+  float* data = output.ptr<float>();
+  const float* first_part = profiles.at(0).ptr<float>();
+  std::copy(first_part, first_part + sizes[0], data);
+  size_t filled = static_cast<size_t>(sizes[0]);
+  for (unsigned int dim = 1; dim < dimensionality; dim++)
   {
-    float value = 1.0;
-    for (unsigned int dim = 0; dim < dimensionality; dim++)
-    {
-      value *= kernel_parts.at(dim).at<float>(position.at(dim), 0);
-    }
-    if (dimensionality == 1)
+    const float* part = profiles.at(dim).ptr<float>();
+    size_t part_size = static_cast<size_t>(sizes[dim]);
+    for (size_t i = filled; i-- > 0;)
     {
-      output.at<float>(position[0], 0) = value;
-    }
-    else
-    {
-      output.at<float>(&position.at(0)) = value;
-    }
-    // increment index
-    position[0]++;
-    for (unsigned int dim = 0; dim < dimensionality; dim++)
-    {
-      if (position[dim] >= static_cast<int>(sizes[dim]))
+      float value = data[i];
+      float* target = data + i * part_size;
+      for (size_t j = part_size; j-- > 0;)
       {
-        position[dim] = 0;
-        if (dim+1 < dimensionality)
-        {
-          position[dim+1]++;
-        }
+        target[j] = value * part[j];
       }
     }
+    filled *= part_size;
   }
-  return output;
 }
@@ -79,6 +79,23 @@ namespace cedar
                              const std::vector<double>& centers,
                              bool cyclic
                            );
+
+      /*!@brief Fills the given matrix with a Gaussian.
+       *
+       *        The one-dimensional profiles of the Gaussian are stored in profiles. If output and profiles already have
+       *        the right sizes, e.g., because they were passed to the previous call, no memory is allocated.
+       */
+      CEDAR_AUX_LIB_EXPORT void gaussMatrix
+                           (
+                             unsigned int dimensionality,
+                             const std::vector<unsigned int>& matrixSizes,
+                             double amplitude,
+                             const std::vector<double>& sigmas,
+                             const std::vector<double>& centers,
+                             bool cyclic,
+                             cv::Mat& output,
+                             std::vector<cv::Mat>& profiles
+                           );
     }
   }
 }
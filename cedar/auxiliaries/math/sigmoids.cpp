@@ -39,6 +39,35 @@
 #include "cedar/auxiliaries/math/constants.h"
 
 // SYSTEM INCLUDES
+#include <cmath>
+
+//----------------------------------------------------------------------------------------------------------------------
+// local functions
+//----------------------------------------------------------------------------------------------------------------------
+
+namespace
+{
+  // Plain loop over contiguous planes; written so that the compiler can vectorize the inner loop.
+  template<typename T>
+  void sigmoidAbsInPlace(const cv::Mat& mat, cv::Mat& result, const T beta, const T threshold)
+  {
+    result.create(mat.dims, mat.size, mat.type());
+
+    const cv::Mat* arrays[] = {&mat, &result, 0};
+    cv::Mat planes[2];
+    cv::NAryMatIterator iter(arrays, planes);
+    for (size_t plane = 0; plane < iter.nplanes; ++plane, ++iter)
+    {
+      const T* p_in = planes[0].ptr<T>();
+      T* p_out = planes[1].ptr<T>();
+      for (size_t i = 0; i < iter.size; ++i)
+      {
+        const T x = p_in[i] - threshold;
+        p_out[i] = T(0.5) * (T(1) + beta * x / (T(1) + beta * std::abs(x)));
+      }
+    }
+  }
+}
 
 double cedar::aux::math::sigmoidExp(const double x, const double beta, const double threshold)
 {
@@ -117,14 +146,26 @@ template CEDAR_AUX_LIB_EXPORT cv::Mat cedar::aux::math::sigmoidAbs<float>(const
 //same as cv::mat sigmoidAbs but does not create new memory for result
 void cedar::aux::math::sigmoidAbs(const cv::Mat& mat, cv::Mat& result, const double beta, const double threshold)
 {
-  result = sigmoidAbs(mat, beta, threshold);
+  switch (mat.type())
+  {
+    case CV_32F:
+      sigmoidAbsInPlace<float>(mat, result, static_cast<float>(beta), static_cast<float>(threshold));
+      break;
+
+    case CV_64F:
+      sigmoidAbsInPlace<double>(mat, result, beta, threshold);
+      break;
+
+    default:
+      result = sigmoidAbs(mat, beta, threshold);
+  }
 }
 
 //same as cv::mat sigmoidAbs but does not create new memory for result
 template<typename T>
 void cedar::aux::math::sigmoidAbs(const cv::Mat& mat, cv::Mat& result, const double beta, const double threshold)
 {
-  result = sigmoidAbs(mat, beta, threshold);
+  sigmoidAbs(mat, result, beta, threshold);
 }
 
 template CEDAR_AUX_LIB_EXPORT void cedar::aux::math::sigmoidAbs<double>(const cv::Mat&, cv::Mat&, const double, const double);
@@ -40,6 +40,7 @@
 #include "cedar/auxiliaries/stringFunctions.h"
 #include "cedar/auxiliaries/assert.h"
 #include "cedar/auxiliaries/exceptions.h"
+#include "cedar/auxiliaries/parallelFunctions.h"
 #include <cedar/auxiliaries/utilities.h>
 
 // SYSTEM INCLUDES
@@ -385,86 +386,92 @@ void cedar::aux::math::reduceCvMat3D
 
   int dropped_size = source.size[dimensionToReduce];
 
-  T sum;
-  T min;
-  T max;
+  // the rows of the destination are independent of each other, so they are reduced in parallel
+  auto reduce_rows = [&](int begin, int end)
+  {
+    T sum;
+    T min;
+    T max;
 
-  int src_index[3] = {0, 0, 0};
-  int& dim_dropped = src_index[static_cast<size_t>(dimensionToReduce)];
-  int& dim_1 = src_index[mapped_dimensions[0]];
-  int& dim_2 = src_index[mapped_dimensions[1]];
+    int src_index[3] = {0, 0, 0};
+    int& dim_dropped = src_index[static_cast<size_t>(dimensionToReduce)];
+    int& dim_1 = src_index[mapped_dimensions[0]];
+    int& dim_2 = src_index[mapped_dimensions[1]];
 
-  switch (reductionOperator)
-  {
-    case CEDAR_OPENCV_CONSTANT(REDUCE_SUM):
+    switch (reductionOperator)
     {
-      for (dim_1 = 0; dim_1 < source_size[0]; ++dim_1)
+      case CEDAR_OPENCV_CONSTANT(REDUCE_SUM):
       {
-        for (dim_2 = 0; dim_2 < source_size[1]; ++dim_2)
+        for (dim_1 = begin; dim_1 < end; ++dim_1)
         {
-          sum = 0;
-          for (dim_dropped = 0; dim_dropped < dropped_size; ++dim_dropped)
+          for (dim_2 = 0; dim_2 < source_size[1]; ++dim_2)
           {
-            sum += source.at<T>(src_index);
+            sum = 0;
+            for (dim_dropped = 0; dim_dropped < dropped_size; ++dim_dropped)
+            {
+              sum += source.at<T>(src_index);
+            }
+            destination.at<T>(dim_1, dim_2) = sum;
           }
-          destination.at<T>(dim_1, dim_2) = sum;
         }
+        break;
       }
-      break;
-    }
-    case CEDAR_OPENCV_CONSTANT(REDUCE_AVG):
-    {
-      for (dim_1 = 0; dim_1 < source_size[0]; ++dim_1)
+      case CEDAR_OPENCV_CONSTANT(REDUCE_AVG):
       {
-        for (dim_2 = 0; dim_2 < source_size[1]; ++dim_2)
+        for (dim_1 = begin; dim_1 < end; ++dim_1)
         {
-          sum = 0;
-          for (dim_dropped = 0; dim_dropped < dropped_size; ++dim_dropped)
+          for (dim_2 = 0; dim_2 < source_size[1]; ++dim_2)
           {
-            sum += source.at<T>(src_index);
+            sum = 0;
+            for (dim_dropped = 0; dim_dropped < dropped_size; ++dim_dropped)
+            {
+              sum += source.at<T>(src_index);
+            }
+            destination.at<T>(dim_1, dim_2) = sum/dropped_size;
           }
-          destination.at<T>(dim_1, dim_2) = sum/dropped_size;
         }
+        break;
       }
-      break;
-    }
-    case CEDAR_OPENCV_CONSTANT(REDUCE_MAX):
-    {
-      for (dim_1 = 0; dim_1 < source_size[0]; ++dim_1)
+      case CEDAR_OPENCV_CONSTANT(REDUCE_MAX):
       {
-        for (dim_2 = 0; dim_2 < source_size[1]; ++dim_2)
+        for (dim_1 = begin; dim_1 < end; ++dim_1)
         {
-          max = static_cast<T>(std::numeric_limits<int>::min());
-          for (dim_dropped = 0; dim_dropped < dropped_size; ++dim_dropped)
+          for (dim_2 = 0; dim_2 < source_size[1]; ++dim_2)
           {
-            max = std::max(max, source.at<T>(src_index));
+            max = static_cast<T>(std::numeric_limits<int>::min());
+            for (dim_dropped = 0; dim_dropped < dropped_size; ++dim_dropped)
+            {
+              max = std::max(max, source.at<T>(src_index));
+            }
+            destination.at<T>(dim_1, dim_2) = max;
           }
-          destination.at<T>(dim_1, dim_2) = max;
         }
+        break;
       }
-      break;
-    }
-    case CEDAR_OPENCV_CONSTANT(REDUCE_MIN):
-    {
-      for (dim_1 = 0; dim_1 < source_size[0]; ++dim_1)
+      case CEDAR_OPENCV_CONSTANT(REDUCE_MIN):
       {
-        for (dim_2 = 0; dim_2 < source_size[1]; ++dim_2)
+        for (dim_1 = begin; dim_1 < end; ++dim_1)
         {
-          min = static_cast<T>(std::numeric_limits<int>::max());
-          for (dim_dropped = 0; dim_dropped < dropped_size; ++dim_dropped)
+          for (dim_2 = 0; dim_2 < source_size[1]; ++dim_2)
           {
-            min = std::min(min, source.at<T>(src_index));
+            min = static_cast<T>(std::numeric_limits<int>::max());
+            for (dim_dropped = 0; dim_dropped < dropped_size; ++dim_dropped)
+            {
+              min = std::min(min, source.at<T>(src_index));
+            }
+            destination.at<T>(dim_1, dim_2) = min;
           }
-          destination.at<T>(dim_1, dim_2) = min;
         }
+        break;
       }
-      break;
-    }
-    default:
-    {
-      break;
-    }
-  } // END switch reductionOperator
+      default:
+      {
+        break;
+      }
+    } // END switch reductionOperator
+  };
+
+  cedar::aux::parallelForSlices(source_size[0], source.total(), reduce_rows);
 }
 
 template CEDAR_AUX_LIB_EXPORT void cedar::aux::math::reduceCvMat3D<float>(const cv::Mat& source, cv::Mat& dst, int dimensionToReduce, int reductionOperator, bool swapDimensions);
@@ -75,5 +75,12 @@ double cedar::aux::math::AbsSigmoid::compute(double value) const
 
 cv::Mat cedar::aux::math::AbsSigmoid::compute(const cv::Mat& values) const
 {
-  return sigmoidAbs(values, this->_mBeta->getValue(), this->mThreshold->getValue());
+  cv::Mat result;
+  this->compute(values, result);
+  return result;
+}
+
+void cedar::aux::math::AbsSigmoid::compute(const cv::Mat& values, cv::Mat& result) const
+{
+  sigmoidAbs(values, result, this->_mBeta->getValue(), this->mThreshold->getValue());
 }
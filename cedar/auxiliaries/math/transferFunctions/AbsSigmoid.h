@@ -83,6 +83,9 @@ public:
   //! Overriden for efficiency.
   virtual cv::Mat compute(const cv::Mat& values) const;
 
+  //! Overriden for efficiency; does not allocate memory if result already has the right size and type.
+  virtual void compute(const cv::Mat& values, cv::Mat& result) const;
+
   //! Returns the beta (slope) of the sigmoid.
   inline double getBeta() const
   {
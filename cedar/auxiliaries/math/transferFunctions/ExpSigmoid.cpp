@@ -51,6 +51,46 @@ namespace
     = cedar::aux::math::TransferFunctionManagerSingleton::getInstance()->registerType<cedar::aux::math::ExpSigmoidPtr>();
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+// batch kernel
+//----------------------------------------------------------------------------------------------------------------------
+
+namespace
+{
+  //! Element-wise exponential sigmoid; the exponential itself is computed by OpenCV's vectorized cv::exp.
+  struct ExpSigmoidKernel
+  {
+    ExpSigmoidKernel(double beta, double threshold)
+    :
+    mBeta(beta),
+    mThreshold(threshold)
+    {
+    }
+
+    template <typename T>
+    void operator()(const T* in, T* out, int length) const
+    {
+      const T beta = static_cast<T>(this->mBeta);
+      const T threshold = static_cast<T>(this->mThreshold);
+      for (int i = 0; i < length; ++i)
+      {
+        out[i] = -beta * (in[i] - threshold);
+      }
+
+      cv::Mat block(1, length, cv::DataType<T>::type, out);
+      cv::exp(block, block);
+
+      for (int i = 0; i < length; ++i)
+      {
+        out[i] = T(1) / (T(1) + out[i]);
+      }
+    }
+
+    double mBeta;
+    double mThreshold;
+  };
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 // constructors and destructor
 //----------------------------------------------------------------------------------------------------------------------
@@ -70,3 +110,8 @@ double cedar::aux::math::ExpSigmoid::compute(double value) const
 {
   return cedar::aux::math::sigmoidExp(value, _mBeta->getValue(), this->getThreshold());
 }
+
+void cedar::aux::math::ExpSigmoid::compute(const cv::Mat& values, cv::Mat& result) const
+{
+  applyBatchKernel(values, result, ExpSigmoidKernel(this->_mBeta->getValue(), this->getThreshold()));
+}
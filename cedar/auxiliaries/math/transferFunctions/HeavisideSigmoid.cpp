@@ -51,6 +51,35 @@ namespace
     = cedar::aux::math::TransferFunctionManagerSingleton::getInstance()->registerType<cedar::aux::math::HeavisideSigmoidPtr>();
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+// batch kernel
+//----------------------------------------------------------------------------------------------------------------------
+
+namespace
+{
+  //! Element-wise step function.
+  struct HeavisideKernel
+  {
+    HeavisideKernel(double threshold)
+    :
+    mThreshold(threshold)
+    {
+    }
+
+    template <typename T>
+    void operator()(const T* in, T* out, int length) const
+    {
+      const T threshold = static_cast<T>(this->mThreshold);
+      for (int i = 0; i < length; ++i)
+      {
+        out[i] = (in[i] < threshold) ? T(0) : T(1);
+      }
+    }
+
+    double mThreshold;
+  };
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 // constructors and destructor
 //----------------------------------------------------------------------------------------------------------------------
@@ -63,3 +92,8 @@ double cedar::aux::math::HeavisideSigmoid::compute(double value) const
 {
   return cedar::aux::math::sigmoidHeaviside(value, this->getThreshold());
 }
+
+void cedar::aux::math::HeavisideSigmoid::compute(const cv::Mat& values, cv::Mat& result) const
+{
+  applyBatchKernel(values, result, HeavisideKernel(this->getThreshold()));
+}
@@ -89,6 +89,9 @@ public:
    */
   virtual double compute(double value) const;
 
+  //! Batch version of compute(double) for CV_32F and CV_64F matrices; does not allocate if result fits already.
+  virtual void compute(const cv::Mat& values, cv::Mat& result) const;
+
   //--------------------------------------------------------------------------------------------------------------------
   // protected methods
   //--------------------------------------------------------------------------------------------------------------------
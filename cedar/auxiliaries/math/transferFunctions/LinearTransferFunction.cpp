@@ -61,6 +61,38 @@ namespace
   bool registered = register_function();
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+// batch kernel
+//----------------------------------------------------------------------------------------------------------------------
+
+namespace
+{
+  //! Element-wise affine function.
+  struct LinearKernel
+  {
+    LinearKernel(double factor, double offset)
+    :
+    mFactor(factor),
+    mOffset(offset)
+    {
+    }
+
+    template <typename T>
+    void operator()(const T* in, T* out, int length) const
+    {
+      const T factor = static_cast<T>(this->mFactor);
+      const T offset = static_cast<T>(this->mOffset);
+      for (int i = 0; i < length; ++i)
+      {
+        out[i] = factor * in[i] + offset;
+      }
+    }
+
+    double mFactor;
+    double mOffset;
+  };
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 // constructors and destructor
 //----------------------------------------------------------------------------------------------------------------------
@@ -81,3 +113,8 @@ double cedar::aux::math::LinearTransferFunction::compute(double value) const
 {
   return this->getFactor() * value + this->getOffset();
 }
+
+void cedar::aux::math::LinearTransferFunction::compute(const cv::Mat& values, cv::Mat& result) const
+{
+  applyBatchKernel(values, result, LinearKernel(this->getFactor(), this->getOffset()));
+}
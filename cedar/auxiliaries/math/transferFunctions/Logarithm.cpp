@@ -43,6 +43,7 @@
 #include "cedar/auxiliaries/Singleton.h"
 
 // SYSTEM INCLUDES
+#include <limits>
 
 //----------------------------------------------------------------------------------------------------------------------
 // register class with the sigmoid factory manager
@@ -59,6 +60,37 @@ namespace
   bool registered = register_function();
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+// batch kernel
+//----------------------------------------------------------------------------------------------------------------------
+
+namespace
+{
+  /*! Element-wise natural logarithm. OpenCV's vectorized cv::log leaves the result for non-positive values undefined,
+   *  so these are set to what std::log returns for them.
+   */
+  struct LogarithmKernel
+  {
+    template <typename T>
+    void operator()(const T* in, T* out, int length) const
+    {
+      // in and out may be the same, so the logarithm goes into a separate buffer first
+      T buffer[cedar::aux::math::Logarithm::BATCH_BLOCK_SIZE];
+      cv::Mat block_in(1, length, cv::DataType<T>::type, const_cast<T*>(in));
+      cv::Mat block_log(1, length, cv::DataType<T>::type, buffer);
+      cv::log(block_in, block_log);
+
+      const T minus_infinity = -std::numeric_limits<T>::infinity();
+      const T not_a_number = std::numeric_limits<T>::quiet_NaN();
+      for (int i = 0; i < length; ++i)
+      {
+        const T value = in[i];
+        out[i] = (value > T(0)) ? buffer[i] : ((value == T(0)) ? minus_infinity : not_a_number);
+      }
+    }
+  };
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 // constructors and destructor
 //----------------------------------------------------------------------------------------------------------------------
@@ -75,3 +107,8 @@ double cedar::aux::math::Logarithm::compute(double value) const
 {
   return std::log(value);
 }
+
+void cedar::aux::math::Logarithm::compute(const cv::Mat& values, cv::Mat& result) const
+{
+  applyBatchKernel(values, result, LogarithmKernel());
+}
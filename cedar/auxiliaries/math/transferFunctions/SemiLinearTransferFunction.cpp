@@ -59,6 +59,38 @@ namespace
   bool registered = register_function();
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+// batch kernel
+//----------------------------------------------------------------------------------------------------------------------
+
+namespace
+{
+  //! Element-wise semi-linear function, see cedar::aux::math::sigmoidSemiLinear.
+  struct SemiLinearKernel
+  {
+    SemiLinearKernel(double threshold, double gain)
+    :
+    mThreshold(threshold),
+    mGain(gain)
+    {
+    }
+
+    template <typename T>
+    void operator()(const T* in, T* out, int length) const
+    {
+      const T threshold = static_cast<T>(this->mThreshold);
+      const T gain = static_cast<T>(this->mGain);
+      for (int i = 0; i < length; ++i)
+      {
+        out[i] = (in[i] > threshold) ? threshold + gain * (in[i] - threshold) : threshold;
+      }
+    }
+
+    double mThreshold;
+    double mGain;
+  };
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 // constructors and destructor
 //----------------------------------------------------------------------------------------------------------------------
@@ -79,11 +111,7 @@ double cedar::aux::math::SemiLinearTransferFunction::compute(double value) const
   return cedar::aux::math::sigmoidSemiLinear(value, this->getThreshold(), this->getBeta());
 }
 
-cv::Mat cedar::aux::math::SemiLinearTransferFunction::compute(const cv::Mat& values) const
+void cedar::aux::math::SemiLinearTransferFunction::compute(const cv::Mat& values, cv::Mat& result) const
 {
-  double beta = this->getBeta();
-  double threshold = this->getThreshold();
-  cv::Mat result = threshold + beta * values;
-  result.setTo(threshold, values < threshold);
-  return result;
+  applyBatchKernel(values, result, SemiLinearKernel(this->getThreshold(), this->getBeta()));
 }
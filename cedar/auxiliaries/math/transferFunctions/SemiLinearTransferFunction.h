@@ -81,7 +81,8 @@ public:
    */
   virtual double compute(double value) const;
 
-  cv::Mat compute(const cv::Mat& values) const;
+  //! Batch version of compute(double) for CV_32F and CV_64F matrices; does not allocate if result fits already.
+  virtual void compute(const cv::Mat& values, cv::Mat& result) const;
 
   /*!@brief Returns the current beta value.
    */
@@ -0,0 +1,130 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        parallelFunctions.cpp
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 18
+
+    Description: Functions for running slices of N-D work in parallel.
+
+    Credits:
+
+======================================================================================================================*/
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CEDAR INCLUDES
+#include "cedar/auxiliaries/parallelFunctions.h"
+#include "cedar/auxiliaries/math/tools.h"
+
+// SYSTEM INCLUDES
+#include <algorithm>
+#include <atomic>
+
+namespace
+{
+  //! The minimum work used when callers of parallelForSlices don't pass one.
+  std::atomic<size_t> default_minimum_work(cedar::aux::PARALLEL_FOR_SLICES_MINIMUM_WORK);
+
+  //! Adapts a function to the loop body interface of cv::parallel_for_.
+  class SliceLoopBody : public cv::ParallelLoopBody
+  {
+    public:
+      SliceLoopBody(const boost::function<void (int, int)>& body)
+      :
+      mBody(body)
+      {
+      }
+
+      void operator()(const cv::Range& range) const
+      {
+        mBody(range.start, range.end);
+      }
+
+    private:
+      const boost::function<void (int, int)>& mBody;
+  };
+}
+
+size_t cedar::aux::getParallelForSlicesMinimumWork()
+{
+  return default_minimum_work.load();
+}
+
+void cedar::aux::setParallelForSlicesMinimumWork(size_t minimumWork)
+{
+  default_minimum_work = minimumWork;
+}
+
+void cedar::aux::parallelForSlices
+(
+  int slices,
+  size_t work,
+  const boost::function<void (int, int)>& body,
+  size_t minimumWork
+)
+{
+  if (slices <= 0)
+  {
+    return;
+  }
+
+  if (slices == 1 || work < minimumWork)
+  {
+    body(0, slices);
+    return;
+  }
+
+  // one stripe per thread keeps the overhead per range low; OpenCV balances the stripes across its pool
+  double stripes = std::min(slices, std::max(1, cv::getNumThreads()));
+  cv::parallel_for_(cv::Range(0, slices), SliceLoopBody(body), stripes);
+}
+
+void cedar::aux::parallelForSlices
+(
+  const cv::Mat& matrix,
+  const boost::function<void (int, int)>& body,
+  size_t minimumWork
+)
+{
+  if (matrix.empty())
+  {
+    return;
+  }
+
+  int slices;
+  if (cedar::aux::math::getDimensionalityOf(matrix) <= 1)
+  {
+    // 0d and 1d matrices have no outer dimension that could be split
+    slices = 1;
+  }
+  else
+  {
+    slices = matrix.size[0];
+  }
+  cedar::aux::parallelForSlices(slices, matrix.total(), body, minimumWork);
+}
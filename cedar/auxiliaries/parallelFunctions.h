@@ -0,0 +1,103 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        parallelFunctions.h
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 18
+
+    Description: Functions for running slices of N-D work in parallel.
+
+    Credits:
+
+======================================================================================================================*/
+
+#ifndef CEDAR_AUX_PARALLEL_FUNCTIONS_H
+#define CEDAR_AUX_PARALLEL_FUNCTIONS_H
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CEDAR INCLUDES
+#include "cedar/auxiliaries/lib.h"
+
+// SYSTEM INCLUDES
+#include <opencv2/opencv.hpp>
+#ifndef Q_MOC_RUN
+  #include <boost/function.hpp>
+#endif // Q_MOC_RUN
+#include <cstddef>
+
+
+namespace cedar
+{
+  namespace aux
+  {
+    /*!@brief Number of elements below which parallelForSlices calls the body in the calling thread.
+     *
+     *        Handing work to other threads costs a few microseconds; below this size, that is more than is saved.
+     */
+    const size_t PARALLEL_FOR_SLICES_MINIMUM_WORK = 32 * 1024;
+
+    //! Returns the minimum work that parallelForSlices uses unless the caller passes one.
+    CEDAR_AUX_LIB_EXPORT size_t getParallelForSlicesMinimumWork();
+
+    /*!@brief Sets the minimum work that parallelForSlices uses unless the caller passes one.
+     *
+     *        Setting it to SIZE_MAX runs all slice loops serially, e.g., to compare their results with parallel runs.
+     *        The default is PARALLEL_FOR_SLICES_MINIMUM_WORK.
+     */
+    CEDAR_AUX_LIB_EXPORT void setParallelForSlicesMinimumWork(size_t minimumWork);
+
+    /*!@brief Calls @em body for consecutive, disjoint ranges of the slices [0, @em slices), in parallel.
+     *
+     *        The body is called as body(begin, end) and must process the slices begin, ..., end - 1. It may only
+     *        write data that belongs to these slices. The ranges are run on OpenCV's thread pool, so OpenCV functions
+     *        called from the body run serially instead of spawning further threads.
+     *        If @em work, the total number of elements processed, is less than @em minimumWork, or if there is only
+     *        one slice, the body is called once for all slices in the calling thread.
+     */
+    CEDAR_AUX_LIB_EXPORT void parallelForSlices
+    (
+      int slices,
+      size_t work,
+      const boost::function<void (int, int)>& body,
+      size_t minimumWork = cedar::aux::getParallelForSlicesMinimumWork()
+    );
+
+    /*!@brief Calls @em body in parallel for ranges along the first (outermost) dimension of @em matrix.
+     *
+     *        The work is the number of elements of the matrix. See the other overload for details.
+     */
+    CEDAR_AUX_LIB_EXPORT void parallelForSlices
+    (
+      const cv::Mat& matrix,
+      const boost::function<void (int, int)>& body,
+      size_t minimumWork = cedar::aux::getParallelForSlicesMinimumWork()
+    );
+  }
+}
+
+#endif // CEDAR_AUX_PARALLEL_FUNCTIONS_H
@@ -46,7 +46,13 @@
 #else
   #include <unistd.h>
 #endif // CEDAR_OS_WINDOWS
+#ifdef CEDAR_OS_LINUX
+  #include <time.h>
+  #include <errno.h>
+#endif // CEDAR_OS_LINUX
+#include <algorithm>
 #include <iostream>
+#include <thread>
 
 void cedar::aux::sleep(cedar::unit::Time time)
 {
@@ -77,3 +83,33 @@ void cedar::aux::usleep(unsigned int microseconds)
 
 #endif // CEDAR_OS_WINDOWS
 }
+
+void cedar::aux::sleepUntil(const std::chrono::steady_clock::time_point& deadline, cedar::unit::Time busyWait)
+{
+  cedar::unit::Time nanosecond(1.0 * cedar::unit::nano * cedar::unit::second);
+  double busy_wait_in_nanoseconds = busyWait / nanosecond;
+  std::chrono::nanoseconds spin(static_cast<long long>(std::max(0.0, busy_wait_in_nanoseconds)));
+  std::chrono::steady_clock::time_point wakeup = deadline - spin;
+
+#ifdef CEDAR_OS_LINUX
+  // steady_clock is CLOCK_MONOTONIC on linux, so the deadline can be handed to the kernel as an absolute time
+  long long wakeup_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(wakeup.time_since_epoch()).count();
+  if (wakeup_ns > 0)
+  {
+    struct timespec until;
+    until.tv_sec = static_cast<time_t>(wakeup_ns / 1000000000LL);
+    until.tv_nsec = static_cast<long>(wakeup_ns % 1000000000LL);
+    // an absolute sleep can simply be restarted when it is interrupted by a signal
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &until, nullptr) == EINTR)
+    {
+    }
+  }
+#else
+  std::this_thread::sleep_until(wakeup);
+#endif // CEDAR_OS_LINUX
+
+  while (std::chrono::steady_clock::now() < deadline)
+  {
+    // busy wait for the remainder
+  }
+}
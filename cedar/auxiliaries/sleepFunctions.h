@@ -42,6 +42,7 @@
 #include "cedar/units/Time.h"
 
 // SYSTEM INCLUDES
+#include <chrono>
 
 
 namespace cedar
@@ -52,6 +53,17 @@ namespace cedar
     CEDAR_AUX_LIB_EXPORT void sleep(cedar::unit::Time time);
     //!@brief Windows does not ship its own usleep function - for compatibility reasons, here's the cedar version
     CEDAR_AUX_LIB_EXPORT void usleep(unsigned int microseconds);
+    /*!@brief Sleeps until the given point in time.
+     *
+     *        Unlike sleeping for a duration, this does not drift by the time that passes between computing the
+     *        deadline and going to sleep. The last busyWait before the deadline are spent spinning, which trades CPU
+     *        time for a more precise wakeup.
+     */
+    CEDAR_AUX_LIB_EXPORT void sleepUntil
+    (
+      const std::chrono::steady_clock::time_point& deadline,
+      cedar::unit::Time busyWait = cedar::unit::Time(0.0 * cedar::unit::seconds)
+    );
   }
 }
 
@@ -34,10 +34,47 @@
 
 ======================================================================================================================*/
 
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
 // CEDAR INCLUDES
 #include "cedar/auxiliaries/threadingUtilities.h"
 
 // SYSTEM INCLUDES
+#ifdef CEDAR_OS_LINUX
+  #include <pthread.h>
+  #include <sched.h>
+  #include <unistd.h>
+#endif // CEDAR_OS_LINUX
+#include <algorithm>
+
+//----------------------------------------------------------------------------------------------------------------------
+// constants
+//----------------------------------------------------------------------------------------------------------------------
+
+#ifdef CEDAR_OS_LINUX
+namespace
+{
+  //! Reads the CPUs the process may run on, e.g., as restricted by taskset or a cpuset; all CPUs if that fails.
+  cpu_set_t readProcessAffinity()
+  {
+    cpu_set_t cpus;
+    CPU_ZERO(&cpus);
+    if (sched_getaffinity(0, sizeof(cpus), &cpus) != 0)
+    {
+      long number_of_cpus = sysconf(_SC_NPROCESSORS_CONF);
+      for (long i = 0; i < number_of_cpus && i < CPU_SETSIZE; ++i)
+      {
+        CPU_SET(i, &cpus);
+      }
+    }
+    return cpus;
+  }
+
+  //! Read when the library is loaded, before any thread could have been pinned.
+  const cpu_set_t PROCESS_AFFINITY = readProcessAffinity();
+}
+#endif // CEDAR_OS_LINUX
 
 //----------------------------------------------------------------------------------------------------------------------
 // constructors and destructor
@@ -75,3 +112,49 @@ void cedar::aux::LockSetLocker::applyUnlock()
 {
   cedar::aux::unlock(this->mLockSet);
 }
+
+//----------------------------------------------------------------------------------------------------------------------
+// free functions
+//----------------------------------------------------------------------------------------------------------------------
+
+bool cedar::aux::setCurrentThreadRealTimePriority(unsigned int priority)
+{
+#ifdef CEDAR_OS_LINUX
+  struct sched_param parameters;
+  int policy = SCHED_OTHER;
+  parameters.sched_priority = 0;
+  if (priority > 0)
+  {
+    policy = SCHED_FIFO;
+    parameters.sched_priority = std::min<int>
+                                (
+                                  std::max<int>(static_cast<int>(priority), sched_get_priority_min(SCHED_FIFO)),
+                                  sched_get_priority_max(SCHED_FIFO)
+                                );
+  }
+  return pthread_setschedparam(pthread_self(), policy, &parameters) == 0;
+#else
+  return priority == 0;
+#endif // CEDAR_OS_LINUX
+}
+
+bool cedar::aux::setCurrentThreadAffinity(int cpu)
+{
+#ifdef CEDAR_OS_LINUX
+  long number_of_cpus = sysconf(_SC_NPROCESSORS_CONF);
+  if (cpu >= number_of_cpus || cpu >= CPU_SETSIZE)
+  {
+    return false;
+  }
+
+  cpu_set_t cpus = PROCESS_AFFINITY;
+  if (cpu >= 0)
+  {
+    CPU_ZERO(&cpus);
+    CPU_SET(cpu, &cpus);
+  }
+  return pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus) == 0;
+#else
+  return cpu < 0;
+#endif // CEDAR_OS_LINUX
+}
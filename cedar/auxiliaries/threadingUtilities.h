@@ -193,6 +193,20 @@ namespace cedar
       private:
         cedar::aux::LockSet mLockSet;
     };
+
+    /*!@brief Runs the calling thread with the given SCHED_FIFO priority (1 to 99), or with the default scheduling
+     *        policy if the priority is zero.
+     *
+     * @returns False if the system refused, e.g., because the process lacks the permission, or does not support it.
+     */
+    CEDAR_AUX_LIB_EXPORT bool setCurrentThreadRealTimePriority(unsigned int priority);
+
+    /*!@brief Pins the calling thread to the given CPU, or lets it run on the CPUs the process started with again if
+     *        cpu is negative.
+     *
+     * @returns False if the system refused or does not support it.
+     */
+    CEDAR_AUX_LIB_EXPORT bool setCurrentThreadAffinity(int cpu);
   }
 }
 
@@ -44,6 +44,7 @@
 #include "cedar/auxiliaries/MovingAverage.h"
 #include "cedar/auxiliaries/threadingUtilities.h"
 #include "cedar/auxiliaries/sleepFunctions.h"
+#include "cedar/auxiliaries/TripleBuffer.h"
 #include "cedar/units/Time.h"
 
 // SYSTEM INCLUDES
@@ -52,6 +53,11 @@
 #include "boost/lexical_cast.hpp"
 #include <QReadLocker>
 #include <QWriteLocker>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
 
 
 #define COMPONENT_CV_MAT_TYPE CV_32F
@@ -62,6 +68,69 @@
 
 class cedar::dev::Component::DataCollection
 {
+  private:
+    //! Types below this value are handed between the processing side and the communication thread through triple
+    //! buffers that live in a fixed array; all others only use the locked buffers.
+    static const cedar::dev::Component::ComponentDataType MAX_EXCHANGED_TYPE = 512;
+
+    //! A matrix handed between the two sides together with the time it was published.
+    struct ExchangedBuffer
+    {
+      cv::Mat mData;
+      std::chrono::steady_clock::time_point mPublished;
+    };
+
+    //! Accumulates the time from publishing a buffer to taking it on the other side without locking.
+    class LatencyAccumulator
+    {
+      public:
+        LatencyAccumulator()
+        {
+          this->reset();
+        }
+
+        void record(const std::chrono::steady_clock::time_point& published)
+        {
+          long long latency = std::chrono::duration_cast<std::chrono::nanoseconds>
+                              (
+                                std::chrono::steady_clock::now() - published
+                              ).count();
+          this->mNumberOfExchanges.fetch_add(1, std::memory_order_relaxed);
+          this->mTotalNanoseconds.fetch_add(latency, std::memory_order_relaxed);
+
+          long long worst = this->mWorstCaseNanoseconds.load(std::memory_order_relaxed);
+          while (latency > worst && !this->mWorstCaseNanoseconds.compare_exchange_weak(worst, latency))
+          {
+          }
+        }
+
+        cedar::dev::Component::LatencyStatistics get() const
+        {
+          cedar::dev::Component::LatencyStatistics statistics;
+          statistics.mNumberOfExchanges = this->mNumberOfExchanges.load();
+          statistics.mAverage = 0.0 * cedar::unit::seconds;
+          if (statistics.mNumberOfExchanges > 0)
+          {
+            statistics.mAverage = static_cast<double>(this->mTotalNanoseconds.load())
+                                  / static_cast<double>(statistics.mNumberOfExchanges) * 1e-9 * cedar::unit::seconds;
+          }
+          statistics.mWorstCase = static_cast<double>(this->mWorstCaseNanoseconds.load()) * 1e-9 * cedar::unit::seconds;
+          return statistics;
+        }
+
+        void reset()
+        {
+          this->mNumberOfExchanges = 0;
+          this->mTotalNanoseconds = 0;
+          this->mWorstCaseNanoseconds = 0;
+        }
+
+      private:
+        std::atomic<unsigned long> mNumberOfExchanges;
+        std::atomic<long long> mTotalNanoseconds;
+        std::atomic<long long> mWorstCaseNanoseconds;
+    };
+
   public:
     DataCollection():
     mCommunicationErrorCount(20)
@@ -123,6 +192,87 @@ class cedar::dev::Component::DataCollection
       return this->mInstalledTypes.member();
     }
 
+    //! Fills the vector with the installed types; does not allocate once the vector has grown to their number.
+    void getInstalledTypes(std::vector<cedar::dev::Component::ComponentDataType>& types) const
+    {
+      QReadLocker locker(this->mInstalledTypes.getLockPtr());
+      types.assign(this->mInstalledTypes.member().begin(), this->mInstalledTypes.member().end());
+    }
+
+    //! Returns whether the type is handed between the processing side and the communication thread in a triple buffer.
+    bool isExchanged(cedar::dev::Component::ComponentDataType type) const
+    {
+      return type < MAX_EXCHANGED_TYPE && this->mExchangedBuffers[type];
+    }
+
+    //! Hands the current user side buffer to the communication thread. Called on the processing side.
+    void publishUserSideBuffer(cedar::dev::Component::ComponentDataType type)
+    {
+      if (!this->isExchanged(type))
+      {
+        return;
+      }
+
+      std::lock_guard<std::mutex> processing_side_locker(this->mProcessingSideLock);
+      ExchangedBuffer& buffer = this->mExchangedBuffers[type]->getWriteBuffer();
+      {
+        QReadLocker locker(this->mUserSideBuffer.getLockPtr());
+        this->getBufferUnlocked(this->mUserSideBuffer, type).copyTo(buffer.mData);
+      }
+      buffer.mPublished = std::chrono::steady_clock::now();
+      this->mExchangedBuffers[type]->publish();
+    }
+
+    //! Hands data to the processing side. Called on the communication thread; never blocks and, once the buffers have
+    //! their final size, never allocates.
+    void publishOnCommunicationThread(cedar::dev::Component::ComponentDataType type, const cv::Mat& data)
+    {
+      CEDAR_DEBUG_ASSERT(this->isExchanged(type));
+      ExchangedBuffer& buffer = this->mExchangedBuffers[type]->getWriteBuffer();
+      data.copyTo(buffer.mData);
+      buffer.mPublished = std::chrono::steady_clock::now();
+      this->mExchangedBuffers[type]->publish();
+    }
+
+    //! Returns the latest data published by the processing side. Called on the communication thread; never blocks.
+    //! The returned matrix stays valid until the next call for the same type.
+    const cv::Mat& takeOnCommunicationThread(cedar::dev::Component::ComponentDataType type)
+    {
+      CEDAR_DEBUG_ASSERT(this->isExchanged(type));
+      auto& exchange = *this->mExchangedBuffers[type];
+      if (exchange.update())
+      {
+        this->mLatency.record(exchange.getReadBuffer().mPublished);
+      }
+      return exchange.getReadBuffer().mData;
+    }
+
+    //! Returns a copy of the latest data published by the communication thread. Called on the processing side.
+    cv::Mat readOnProcessingSide(cedar::dev::Component::ComponentDataType type)
+    {
+      std::lock_guard<std::mutex> processing_side_locker(this->mProcessingSideLock);
+      return this->updateOnProcessingSideUnlocked(type).clone();
+    }
+
+    //! Returns one entry of the latest data published by the communication thread. Called on the processing side.
+    float readIndexOnProcessingSide(cedar::dev::Component::ComponentDataType type, int index)
+    {
+      std::lock_guard<std::mutex> processing_side_locker(this->mProcessingSideLock);
+      const cv::Mat& data = this->updateOnProcessingSideUnlocked(type);
+      CEDAR_DEBUG_ASSERT(data.rows > index);
+      return data.at<float>(index, 0);
+    }
+
+    cedar::dev::Component::LatencyStatistics getLatencyStatistics() const
+    {
+      return this->mLatency.get();
+    }
+
+    void resetLatencyStatistics()
+    {
+      this->mLatency.reset();
+    }
+
     bool hasType(const cedar::dev::Component::ComponentDataType &type) const
     {
       QReadLocker locker(this->mInstalledTypes.getLockPtr());
@@ -415,6 +565,11 @@ class cedar::dev::Component::DataCollection
       this->lazyInitializeUnlocked(mUserSideBuffer, type);
       this->lazyInitializeUnlocked(mPreviousDeviceSideBuffer, type);
       this->lazyInitializeUnlocked(mInitialUserSideSubmittedData, type);
+
+      if (type < MAX_EXCHANGED_TYPE)
+      {
+        this->mExchangedBuffers[type].reset(new cedar::aux::TripleBuffer<ExchangedBuffer>());
+      }
     }
 
     virtual void resetBuffers(cedar::dev::Component::ComponentDataType type, int matrixType)
@@ -429,6 +584,20 @@ class cedar::dev::Component::DataCollection
         this->resetBufferUnlocked(mUserSideBuffer, type, matrixType);
         this->resetBufferUnlocked(mPreviousDeviceSideBuffer, type, matrixType);
         this->resetBufferUnlocked(mInitialUserSideSubmittedData, type, matrixType);
+
+        // sizes the exchanged buffers once so that the exchange itself never allocates
+        if (this->isExchanged(type))
+        {
+          const cv::Mat& zeros = this->mUserSideBuffer.member()[type]->getData();
+          this->mExchangedBuffers[type]->initialize
+          (
+            [&](ExchangedBuffer& buffer)
+            {
+              buffer.mData = zeros.clone();
+              buffer.mPublished = std::chrono::steady_clock::now();
+            }
+          );
+        }
       }
     }
 
@@ -572,9 +741,33 @@ class cedar::dev::Component::DataCollection
     // Cache for the user-interface
     cedar::aux::LockableMember<BufferDataType> mPreviousDeviceSideBuffer; // was: mPreviousDeviceSideMeasurementsBuffer
 
+  private:
+    const cv::Mat& updateOnProcessingSideUnlocked(cedar::dev::Component::ComponentDataType type)
+    {
+      if (!this->isExchanged(type))
+      {
+        CEDAR_THROW(TypeNotFoundException, "This type is not installed.");
+      }
+      auto& exchange = *this->mExchangedBuffers[type];
+      if (exchange.update())
+      {
+        this->mLatency.record(exchange.getReadBuffer().mPublished);
+      }
+      return exchange.getReadBuffer().mData;
+    }
+
   private:
     std::map<ComponentDataType, cedar::dev::Component::DimensionalityType> mInstalledDimensions;
 
+    //! Triple buffers between the processing side and the communication thread, indexed by type.
+    std::array<std::unique_ptr<cedar::aux::TripleBuffer<ExchangedBuffer> >, MAX_EXCHANGED_TYPE> mExchangedBuffers;
+
+    //! Serializes processing side threads; the communication thread never takes this lock.
+    std::mutex mProcessingSideLock;
+
+    //! Time from publishing a buffer on one side to taking it on the other.
+    LatencyAccumulator mLatency;
+
     cedar::aux::LockableMember<TransformationHookContainerType> mTransformationHooks;
 
     cedar::aux::LockableMember<std::set<cedar::dev::Component::ComponentDataType> > mInstalledTypes;
@@ -611,9 +804,10 @@ public:
     this->setData(mDeviceSideRetrievedData, type, data);
   }
 
-  void setDeviceSideRetrievedBufferUnlocked(ComponentDataType type, cv::Mat data)
+  void setDeviceSideRetrievedBufferUnlocked(ComponentDataType type, const cv::Mat& data)
   {
-    this->setDataUnlocked(mDeviceSideRetrievedData, type, data);
+    // the retrieved buffer never leaves the communication thread, so it can be overwritten in place
+    data.copyTo(mDeviceSideRetrievedData.member()[type]->getData());
   }
 
   void resetDeviceSideRetrievedBufferUnlocked(ComponentDataType type ,int matrixType)
@@ -1036,6 +1230,11 @@ void cedar::dev::Component::resetComponent()
       this->mCommandData->resetDeviceSideSubmittedBufferUnlocked(type,matrixType);
     }
   }
+
+  for (auto type : this->mCommandData->getInstalledTypes())
+  {
+    this->mCommandData->publishUserSideBuffer(type);
+  }
 }
 
 void cedar::dev::Component::applyDeviceSideCommandsAs(ComponentDataType type)
@@ -1053,6 +1252,7 @@ void cedar::dev::Component::setUserSideCommandBuffer(ComponentDataType type, cv:
   QWriteLocker locker(this->mUserSideCommandUsed.getLockPtr());    
 
   this->mCommandData->setUserSideBuffer(type, data);
+  this->mCommandData->publishUserSideBuffer(type);
   this->mUserSideCommandUsed.member().insert(type);
 }
 
@@ -1078,19 +1278,44 @@ void cedar::dev::Component::setUserSideCommandBufferIndex(ComponentDataType type
   this->checkExclusivenessOfCommand(type);
   QWriteLocker locker(this->mUserSideCommandUsed.getLockPtr());
   this->mCommandData->setUserSideBufferIndex(type, index, value);
+  this->mCommandData->publishUserSideBuffer(type);
   this->mUserSideCommandUsed.member().insert(type);
 }
 
 cv::Mat cedar::dev::Component::getUserSideMeasurementBuffer(ComponentDataType type) const
 {
+  if (this->mMeasurementData->isExchanged(type))
+  {
+    return this->mMeasurementData->readOnProcessingSide(type);
+  }
   return this->mMeasurementData->getUserSideBuffer(type);
 }
 
 float cedar::dev::Component::getUserSideMeasurementBufferIndex(ComponentDataType type, int index) const
 {
+  if (this->mMeasurementData->isExchanged(type))
+  {
+    return this->mMeasurementData->readIndexOnProcessingSide(type, index);
+  }
   return this->mMeasurementData->getUserSideBufferIndex(type, index);
 }
 
+cedar::dev::Component::LatencyStatistics cedar::dev::Component::getCommandLatency() const
+{
+  return this->mCommandData->getLatencyStatistics();
+}
+
+cedar::dev::Component::LatencyStatistics cedar::dev::Component::getMeasurementLatency() const
+{
+  return this->mMeasurementData->getLatencyStatistics();
+}
+
+void cedar::dev::Component::resetLatencyStatistics()
+{
+  this->mCommandData->resetLatencyStatistics();
+  this->mMeasurementData->resetLatencyStatistics();
+}
+
 cv::Mat cedar::dev::Component::getPreviousDeviceSideMeasurementBuffer(ComponentDataType type) const
 {
   return this->mMeasurementData->getPreviousDeviceSideBuffer(type);
@@ -1475,8 +1700,16 @@ void cedar::dev::Component::stepCommandCommunication(cedar::unit::Time dt)
     // we know the map has exactly one entry
     type_from_user = *(this->mUserSideCommandUsed.member().begin());
 
-    QReadLocker lock(this->mCommandData->mUserSideBuffer.getLockPtr());
-    userData = this->mCommandData->getUserSideBufferUnlocked(type_from_user).clone();
+    if (this->mCommandData->isExchanged(type_from_user))
+    {
+      // published by setUserSideCommandBuffer; taking it neither blocks nor copies
+      userData = this->mCommandData->takeOnCommunicationThread(type_from_user);
+    }
+    else
+    {
+      QReadLocker lock(this->mCommandData->mUserSideBuffer.getLockPtr());
+      userData = this->mCommandData->getUserSideBufferUnlocked(type_from_user).clone();
+    }
   }
 
   locker.unlock();
@@ -1504,7 +1737,8 @@ void cedar::dev::Component::stepCommandCommunication(cedar::unit::Time dt)
   }
   else
   {
-    ioData = userData.clone();
+    userData.copyTo(this->mDeviceSideCommand);
+    ioData = this->mDeviceSideCommand;
   }
 
   if(this->mCheckCommandHook.member())
@@ -1560,8 +1794,13 @@ void cedar::dev::Component::stepMeasurementCommunication(cedar::unit::Time dt)
 {
   cedar::aux::Timer timer;
 
-  std::vector< ComponentDataType > types_to_transform;
-  std::vector< ComponentDataType > types_we_measured;
+  // members keep their capacity between steps
+  std::vector< ComponentDataType >& types_to_transform = this->mTypesToTransform;
+  std::vector< ComponentDataType >& types_we_measured = this->mTypesMeasured;
+  types_to_transform.clear();
+  types_we_measured.clear();
+  // this is here to preserve lock order (getInstalledTypes locks internally)
+  this->mMeasurementData->getInstalledTypes(this->mMeasurementTypes);
 
   if (isReadyForMeasurements())
   {
@@ -1576,7 +1815,7 @@ void cedar::dev::Component::stepMeasurementCommunication(cedar::unit::Time dt)
       return;
 
     // thinks I can get directly from HW:
-    for (const auto& type : this->mMeasurementData->getInstalledTypes())
+    for (const auto& type : this->mMeasurementTypes)
     {
       auto found = mRetrieveMeasurementHooks.member().find( type );
 
@@ -1630,20 +1869,37 @@ void cedar::dev::Component::stepMeasurementCommunication(cedar::unit::Time dt)
 void cedar::dev::Component::updateUserSideMeasurements()
 {
   // this is here to preserve lock order (getInstalledTypes locks internally)
-  auto measurement_types = this->mMeasurementData->getInstalledTypes();
+  this->mMeasurementData->getInstalledTypes(this->mMeasurementTypes);
+  const auto& measurement_types = this->mMeasurementTypes;
 
   // lock caches
   cedar::aux::LockSet locks;
-  cedar::aux::append(locks, this->mMeasurementData->mPreviousDeviceSideBuffer.getLockPtr(), cedar::aux::LOCK_TYPE_READ);
+  cedar::aux::append
+  (
+    locks,
+    this->mMeasurementData->mPreviousDeviceSideBuffer.getLockPtr(),
+    cedar::aux::LOCK_TYPE_WRITE
+  );
   cedar::aux::append(locks, this->mMeasurementData->mUserSideBuffer.getLockPtr(), cedar::aux::LOCK_TYPE_WRITE);
   cedar::aux::append(locks, this->mMeasurementData->mDeviceSideRetrievedData.getLockPtr(), cedar::aux::LOCK_TYPE_WRITE);
   cedar::aux::LockSetLocker locker(locks);
 
   for (auto type : measurement_types)
   {
-    this->mMeasurementData->mPreviousDeviceSideBuffer.member()[type]->getData() = this->mMeasurementData->mUserSideBuffer.member()[type]->getData().clone();
-    this->mMeasurementData->mUserSideBuffer.member()[type]->getData() = this->mMeasurementData->mDeviceSideRetrievedData.member()[type]->getData().clone();
+    // the buffers are sized when the dimensionality of the type is set, so copying does not allocate
+    cv::Mat& user_side = this->mMeasurementData->mUserSideBuffer.member()[type]->getData();
+    user_side.copyTo(this->mMeasurementData->mPreviousDeviceSideBuffer.member()[type]->getData());
+    this->mMeasurementData->mDeviceSideRetrievedData.member()[type]->getData().copyTo(user_side);
     this->mMeasurementData->mDeviceSideRetrievedData.member()[type]->getData() = 0.0; // Warum 0.0 ? Warum ist das keine Matrix?
+
+    if (this->mMeasurementData->isExchanged(type))
+    {
+      this->mMeasurementData->publishOnCommunicationThread
+      (
+        type,
+        this->mMeasurementData->mUserSideBuffer.member()[type]->getData()
+      );
+    }
   }
 
   locker.unlock();
@@ -1966,15 +2222,31 @@ void cedar::dev::Component::processStart()
   // todo: test that mUserSideCommands is empty!
   if (!this->mCommandData->mInitialUserSideSubmittedData.member().empty())
   {
-     // do as if the initial user command was the user command
-     QWriteLocker lock1(this->mCommandData->mUserSideBuffer.getLockPtr());
-     
-     this->mCommandData->mUserSideBuffer.member() = this->mCommandData->mInitialUserSideSubmittedData.member();
-     //for(int i=0; i < this->mCommandData->mUserSideBuffer.member().size(); ++i)
-     //{
-     //  std::cout << this->mCommandData->mUserSideBuffer.member()[i] << "\n";
-     //}
-     lock1.unlock();
+    // do as if the initial user command was the user command; the data is copied so that the user side data objects
+    // stay the same, and published so that the communication thread actually sends it
+    std::vector<ComponentDataType> initial_types;
+    {
+      cedar::aux::LockSet locks;
+      cedar::aux::append(locks, this->mCommandData->mUserSideBuffer.getLockPtr(), cedar::aux::LOCK_TYPE_WRITE);
+      cedar::aux::append
+      (
+        locks,
+        this->mCommandData->mInitialUserSideSubmittedData.getLockPtr(),
+        cedar::aux::LOCK_TYPE_READ
+      );
+      cedar::aux::LockSetLocker locker(locks);
+
+      for (const auto& type_data_pair : this->mCommandData->mInitialUserSideSubmittedData.member())
+      {
+        this->mCommandData->setUserSideBufferUnlocked(type_data_pair.first, type_data_pair.second->getData());
+        initial_types.push_back(type_data_pair.first);
+      }
+    }
+
+    for (auto type : initial_types)
+    {
+      this->mCommandData->publishUserSideBuffer(type);
+    }
   }
 
   // todo: this will probably not work as expected, anymore
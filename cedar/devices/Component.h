@@ -136,6 +136,18 @@ public:
   //--------------------------------------------------------------------------------------------------------------------
   // nested types
   //--------------------------------------------------------------------------------------------------------------------
+public:
+  //! Latency of handing buffers between the processing side and the communication thread.
+  struct LatencyStatistics
+  {
+    //! Number of buffers that were handed over.
+    unsigned long mNumberOfExchanges;
+    //! Average time from publishing a buffer on one side until the other side picked it up.
+    cedar::unit::Time mAverage;
+    //! Longest time from publishing a buffer on one side until the other side picked it up.
+    cedar::unit::Time mWorstCase;
+  };
+
 private:
   class DataCollection;
   CEDAR_GENERATE_POINTER_TYPES(DataCollection);
@@ -318,6 +330,16 @@ public:
   //! Returns the last communication errors.
   std::vector<std::string> getLastMeasurementCommunicationErrors() const;
 
+  /*!@brief Returns how long commands took from setUserSideCommandBuffer until the communication thread picked them up.
+   *
+   *        Commands that are replaced before the communication thread picks them up are not counted.
+   */
+  LatencyStatistics getCommandLatency() const;
+  //! Returns how long measurements took from the communication thread until the processing side first read them.
+  LatencyStatistics getMeasurementLatency() const;
+  //! Restarts the latency statistics.
+  void resetLatencyStatistics();
+
   //! public hooks intended for GUI communication
   boost::signals2::connection registerConnectedHook(boost::function<void ()> slot);
   boost::signals2::connection registerDisconnectedHook(boost::function<void ()> slot);
@@ -452,6 +474,18 @@ private:
   //! Integration time that is lost due to skipping stepCommunication calls.
   cedar::unit::Time mLostTime;
 
+  //! Command sent to the device; reused so that the communication thread does not allocate.
+  cv::Mat mDeviceSideCommand;
+
+  //! Installed measurement types as seen by the communication thread; reused to avoid allocations.
+  std::vector<ComponentDataType> mMeasurementTypes;
+
+  //! Measurement types that have to be calculated by transformation hooks; reused to avoid allocations.
+  std::vector<ComponentDataType> mTypesToTransform;
+
+  //! Measurement types retrieved from the device in the current step; reused to avoid allocations.
+  std::vector<ComponentDataType> mTypesMeasured;
+
   static std::map< cedar::dev::Component*, boost::posix_time::ptime > mRunningComponentInstancesAliveTime;
   static std::map< cedar::dev::Component*, boost::posix_time::ptime > mRunningComponentInstancesStartTime;
   static std::unique_ptr<cedar::aux::LoopFunctionInThread> mWatchDogThread;
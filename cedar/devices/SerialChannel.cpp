@@ -50,6 +50,9 @@
 #include <boost/bind.hpp>
 #include <istream>
 #include <sstream>
+#ifndef CEDAR_OS_WINDOWS
+  #include <termios.h>
+#endif // CEDAR_OS_WINDOWS
 
 
 #undef DEBUG_VERBOSE
@@ -64,6 +67,7 @@ mCommandDelimiter("\r\n"),
 mIoService(),
 mPort(mIoService),
 mTimer(mIoService),
+mReaderActive(false),
 _mDevicePath(new cedar::aux::StringParameter(this, "device path", "/dev/rfcomm0")),
 _mEscapedCommandDelimiter(new cedar::aux::StringParameter(this, "escaped command delimiter", "\\r\\n")),
 _mBaudRate(new cedar::aux::UIntParameter(this, "baud rate", 115200, 0, 8000000)),
@@ -77,7 +81,8 @@ _mTimeout
     0.0 * cedar::unit::seconds,
     1000.0 * cedar::unit::seconds
   )
-)
+),
+_mMaximumNumberOfCommandsInFlight(new cedar::aux::UIntParameter(this, "maximum commands in flight", 8, 1, 1024))
 {
   // whenever the user changes the (escaped) command delimiter, the unescaped version needs to be updated accordingly
   QObject::connect(_mEscapedCommandDelimiter.get(), SIGNAL(valueChanged()),
@@ -122,19 +127,152 @@ const cedar::unit::Time& cedar::dev::SerialChannel::getTimeout() const
   return _mTimeout->getValue();
 }
 
+unsigned int cedar::dev::SerialChannel::getMaximumNumberOfCommandsInFlight() const
+{
+  return _mMaximumNumberOfCommandsInFlight->getValue();
+}
+
 std::string cedar::dev::SerialChannel::writeAndReadLocked(const std::string& command)
 {
-  QWriteLocker lock(&(this->mLock));
-  this->write(command);
-  return this->read();
+  return this->waitForAnswer(this->queueCommand(command));
 }
 
-void cedar::dev::SerialChannel::write(std::string command)
+std::vector<std::string> cedar::dev::SerialChannel::writeAndReadBatch(const std::vector<std::string>& commands)
 {
-  CEDAR_ASSERT(this->isOpen());
+  std::vector<PendingCommandPtr> pending;
+  pending.reserve(commands.size());
+  for (const auto& command : commands)
+  {
+    pending.push_back(this->queueCommand(command));
+  }
+
+  std::vector<std::string> answers;
+  answers.reserve(commands.size());
+  for (const auto& command : pending)
+  {
+    answers.push_back(this->waitForAnswer(command));
+  }
+  return answers;
+}
+
+cedar::dev::SerialChannel::PendingCommandPtr cedar::dev::SerialChannel::queueCommand(const std::string& command)
+{
+  PendingCommandPtr pending(new PendingCommand(command));
+
+  QMutexLocker lock(&(this->mPipelineMutex));
+  this->mQueuedCommands.push_back(pending);
+  return pending;
+}
+
+std::string cedar::dev::SerialChannel::waitForAnswer(PendingCommandPtr command)
+{
+  QMutexLocker lock(&(this->mPipelineMutex));
+  while (!command->mDone)
+  {
+    // someone else is reading; the answer will arrive with theirs, or they hand over
+    if (this->mReaderActive)
+    {
+      this->mAnswersArrived.wait(&(this->mPipelineMutex));
+      continue;
+    }
+
+    this->mReaderActive = true;
+    lock.unlock();
+    this->transceive(command);
+    lock.relock();
+    this->mReaderActive = false;
+    this->mAnswersArrived.wakeAll();
+  }
+
+  if (command->mError)
+  {
+    std::rethrow_exception(command->mError);
+  }
+  return command->mAnswer;
+}
+
+void cedar::dev::SerialChannel::transceive(PendingCommandPtr command)
+{
+  QWriteLocker io_lock(&(this->mLock));
+
+  std::string batch;
+  for (;;)
+  {
+    batch.clear();
+    {
+      QMutexLocker lock(&(this->mPipelineMutex));
+      if (command->mDone)
+      {
+        return;
+      }
+
+      // everything that was queued in the meantime goes out in a single write
+      unsigned int max_in_flight = this->getMaximumNumberOfCommandsInFlight();
+      while (!this->mQueuedCommands.empty() && this->mCommandsInFlight.size() < max_in_flight)
+      {
+        PendingCommandPtr next = this->mQueuedCommands.front();
+        this->mQueuedCommands.pop_front();
+        batch.append(next->mCommand).append(this->mCommandDelimiter);
+        this->mCommandsInFlight.push_back(next);
+      }
+    }
+
+    try
+    {
+      if (!batch.empty())
+      {
+        this->writeBytes(batch);
+      }
+
+      std::string answer = this->read();
+
+      QMutexLocker lock(&(this->mPipelineMutex));
+      CEDAR_DEBUG_ASSERT(!this->mCommandsInFlight.empty());
+      PendingCommandPtr answered = this->mCommandsInFlight.front();
+      this->mCommandsInFlight.pop_front();
+      answered->mAnswer = answer;
+      answered->mDone = true;
+    }
+    catch (...)
+    {
+      // the remaining answers can no longer be matched to their commands
+      std::exception_ptr error = std::current_exception();
+      this->discardInput();
+
+      QMutexLocker lock(&(this->mPipelineMutex));
+      for (const auto& failed : this->mCommandsInFlight)
+      {
+        failed->mError = error;
+        failed->mDone = true;
+      }
+      this->mCommandsInFlight.clear();
+    }
+    this->mAnswersArrived.wakeAll();
+  }
+}
 
+void cedar::dev::SerialChannel::discardInput()
+{
+  this->mReadData.consume(this->mReadData.size());
+#ifndef CEDAR_OS_WINDOWS
+  if (this->isOpen())
+  {
+    ::tcflush(this->mPort.native_handle(), TCIFLUSH);
+  }
+#endif // CEDAR_OS_WINDOWS
+}
+
+void cedar::dev::SerialChannel::write(std::string command)
+{
   // append the command delimiter to the sent command
   command.append(mCommandDelimiter);
+  this->writeBytes(command);
+}
+
+void cedar::dev::SerialChannel::writeBytes(const std::string& command)
+{
+  CEDAR_ASSERT(this->isOpen());
+
   try
   {
     boost::asio::write(mPort, boost::asio::buffer(command.c_str(), command.size()));
@@ -195,8 +333,12 @@ std::string cedar::dev::SerialChannel::read()
     setupRead();
 
     // start the timer for the timeout
-    boost::posix_time::seconds timeout_boost_seconds(static_cast<long>(getTimeout() / cedar::unit::Time(1.0 * cedar::unit::second)));
-    mTimer.expires_from_now(boost::posix_time::time_duration(timeout_boost_seconds));
+    // (in microseconds, as whole seconds would truncate the default timeout of 0.25 s to zero)
+    boost::posix_time::microseconds timeout_boost
+    (
+      static_cast<long>(1e6 * (getTimeout() / cedar::unit::Time(1.0 * cedar::unit::second)))
+    );
+    mTimer.expires_from_now(boost::posix_time::time_duration(timeout_boost));
     // wait for the timeout to expire and call cedar::dev::SerialChannel::timeoutExpired when it does
     mTimer.async_wait(boost::bind(&cedar::dev::SerialChannel::timeoutExpired, this, boost::asio::placeholders::error));
 
@@ -358,6 +500,7 @@ void cedar::dev::SerialChannel::openHook()
   _mEscapedCommandDelimiter->setConstant(true);
   _mBaudRate->setConstant(true);
   _mTimeout->setConstant(true);
+  _mMaximumNumberOfCommandsInFlight->setConstant(true);
 
   if (this->isOpen())
   {
@@ -433,4 +576,5 @@ void cedar::dev::SerialChannel::closeHook()
   _mEscapedCommandDelimiter->setConstant(false);
   _mBaudRate->setConstant(false);
   _mTimeout->setConstant(false);
+  _mMaximumNumberOfCommandsInFlight->setConstant(false);
 }
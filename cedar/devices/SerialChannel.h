@@ -49,14 +49,25 @@
 
 // SYSTEM INCLUDES
 #include <QObject>
+#include <QMutex>
+#include <QWaitCondition>
 #ifndef Q_MOC_RUN
   #include <boost/utility.hpp>
   #include <boost/asio.hpp>
 #endif // Q_MOC_RUN
 #include <string>
-
-
-//!@brief Channel to serial devies, based on Boost ASIO.
+#include <vector>
+#include <deque>
+#include <exception>
+
+
+/*!@brief Channel to serial devies, based on Boost ASIO.
+ *
+ *        Commands are pipelined: commands queued by any thread are written to the port together in a single write,
+ *        and the answers, which the device sends in the order of the commands, are handed to the respective callers.
+ *        While one caller reads answers, commands queued in the meantime are already written, up to the maximum
+ *        number of commands in flight.
+ */
 class cedar::dev::SerialChannel : public QObject, public cedar::dev::Channel
 {
   Q_OBJECT
@@ -69,6 +80,37 @@ public:
   class WriteException : public cedar::aux::ExceptionBase {};
   class BoostException : public cedar::aux::ExceptionBase {};
 
+  //! A command queued on the channel whose answer has not necessarily arrived yet, see queueCommand.
+  class PendingCommand
+  {
+    friend class cedar::dev::SerialChannel;
+
+  public:
+    //! Returns the command, without the command delimiter.
+    const std::string& getCommand() const
+    {
+      return this->mCommand;
+    }
+
+  private:
+    PendingCommand(const std::string& command)
+    :
+    mCommand(command),
+    mDone(false)
+    {
+    }
+
+    //! the command, without the command delimiter
+    std::string mCommand;
+    //! the answer, once it arrived
+    std::string mAnswer;
+    //! whether the answer arrived or an error occurred
+    bool mDone;
+    //! the error that occurred while sending the command or receiving its answer, if any
+    std::exception_ptr mError;
+  };
+  CEDAR_GENERATE_POINTER_TYPES(PendingCommand);
+
   //--------------------------------------------------------------------------------------------------------------------
   // constructors and destructor
   //--------------------------------------------------------------------------------------------------------------------
@@ -117,8 +159,34 @@ public:
 
   /*!@brief Writes a string and reads the answer. While doing so, the channel is locked.
    * Always supply commands without the trailing command delimiter, as it is automatically added.
+   *
+   * @remarks The command goes through the command pipeline, i.e., it may be written together with the commands of
+   *          other threads.
    */
   std::string writeAndReadLocked(const std::string& command);
+
+  /*!@brief Writes all commands in a single write and returns their answers in the same order.
+   * Always supply commands without the trailing command delimiter, as it is automatically added.
+   */
+  std::vector<std::string> writeAndReadBatch(const std::vector<std::string>& commands);
+
+  /*!@brief Queues a command without waiting for its answer.
+   *
+   *        The command is written as soon as anyone waits for an answer, together with all other queued commands.
+   *        Always supply commands without the trailing command delimiter, as it is automatically added.
+   */
+  PendingCommandPtr queueCommand(const std::string& command);
+
+  /*!@brief Waits for the answer to a queued command, writing the command first if this has not happened yet.
+   *
+   * @throws The exception that occurred while writing the command or reading its answer, e.g., a
+   *         cedar::dev::TimeoutException. If reading fails, all commands in flight fail, as their answers can no longer
+   *         be matched.
+   */
+  std::string waitForAnswer(PendingCommandPtr command);
+
+  //!@brief Returns the maximum number of commands that are written before their answers arrive.
+  unsigned int getMaximumNumberOfCommandsInFlight() const;
   //--------------------------------------------------------------------------------------------------------------------
   // protected methods
   //--------------------------------------------------------------------------------------------------------------------
@@ -143,6 +211,18 @@ private:
   //!@brief Handler that is called whenever the timeout expires on read operations.
   void timeoutExpired(const boost::system::error_code& error);
 
+  //!@brief Writes the given string as is, i.e., it has to contain the command delimiters already.
+  void writeBytes(const std::string& command);
+
+  /*!@brief Writes queued commands and reads answers until the given command is done.
+   *
+   *        Only one thread at a time does this; the others wait for their answers.
+   */
+  void transceive(PendingCommandPtr command);
+
+  //!@brief Discards all input that was received but not read yet, so that late answers are not mismatched.
+  void discardInput();
+
 private slots:
   //!@brief Constructs the actual command delimiter from an escaped version that the user inputs.
   void updateCommandDelimiter();
@@ -179,6 +259,17 @@ private:
   //! current status of the read operation
   enum ReadResult mReadResult;
 
+  //! protects the command queues and mReaderActive
+  QMutex mPipelineMutex;
+  //! notified whenever answers arrived or the reading thread finished
+  QWaitCondition mAnswersArrived;
+  //! commands that have not been written yet
+  std::deque<PendingCommandPtr> mQueuedCommands;
+  //! commands that were written, in the order in which their answers are expected
+  std::deque<PendingCommandPtr> mCommandsInFlight;
+  //! whether a thread is currently writing and reading for the pipeline
+  bool mReaderActive;
+
   //--------------------------------------------------------------------------------------------------------------------
   // parameters
   //--------------------------------------------------------------------------------------------------------------------
@@ -206,5 +297,10 @@ private:
    */
   cedar::aux::TimeParameterPtr _mTimeout;
 
+  /*!@brief Maximum number of commands that are written before their answers arrive.
+   *        Keep this below what the input buffer of the device can hold. Default is 8.
+   */
+  cedar::aux::UIntParameterPtr _mMaximumNumberOfCommandsInFlight;
+
 }; // class cedar::dev::SerialChannel
 #endif // CEDAR_DEV_SERIAL_CHANNEL_H
@@ -116,20 +116,51 @@ void cedar::dev::kteam::DriveSerial::sendMovementCommand()
           << ","
           << static_cast<int>(wheel_speed_pulses[1] / cedar::unit::DEFAULT_FREQUENCY_UNIT);
 
+  cedar::dev::kteam::SerialChannelPtr channel = convertToSerialChannel(getChannel());
+  cedar::dev::SerialChannel::PendingCommandPtr speed_command = channel->queueCommand(command.str());
+
+  // if the encoders are measured in this communication step, request them along with the command; both go out in a
+  // single write and the encoder answer is read in retrieveEncoders
+  if (this->isEncoderMeasurementDue())
+  {
+    cedar::dev::SerialChannel::PendingCommandPtr encoder_request
+      = channel->queueCommand(_mCommandGetEncoder->getValue());
+
+    QMutexLocker locker(&this->mPrefetchedEncodersLock);
+    // an unused earlier request is simply dropped; its answer is still matched and discarded by the channel
+    this->mPrefetchedEncoders = encoder_request;
+  }
+
   // wait for an answer
-  std::string answer = convertToSerialChannel(getChannel())->writeAndReadLocked(command.str());
+  std::string answer = channel->waitForAnswer(speed_command);
 
   checkSerialCommunicationAnswer(answer, _mCommandSetSpeed->getValue());
 }
 
+bool cedar::dev::kteam::DriveSerial::isEncoderMeasurementDue() const
+{
+  // the measurement step right after the command step only runs when the component is ready for measurements
+  return this->isReadyForMeasurements();
+}
+
 cv::Mat cedar::dev::kteam::DriveSerial::retrieveEncoders() const
 {
   // the left and right encoder value will be saved in this vector
   cv::Mat encoders = cv::Mat(2, 1, CV_32F);
 
-  // send the command to receive the values of the encoders
-  std::string answer
-    = convertToSerialChannel(getChannel())->writeAndReadLocked(_mCommandGetEncoder->getValue());
+  cedar::dev::kteam::SerialChannelPtr channel = convertToSerialChannel(getChannel());
+
+  QMutexLocker locker(&this->mPrefetchedEncodersLock);
+  cedar::dev::SerialChannel::PendingCommandPtr request = this->mPrefetchedEncoders;
+  this->mPrefetchedEncoders.reset();
+  locker.unlock();
+
+  // send the command to receive the values of the encoders, unless it went out with the last movement command
+  if (!request)
+  {
+    request = channel->queueCommand(_mCommandGetEncoder->getValue());
+  }
+  std::string answer = channel->waitForAnswer(request);
 
   // check whether the answer begins with the correct character
   checkSerialCommunicationAnswer(answer, _mCommandGetEncoder->getValue());
@@ -162,6 +193,11 @@ void cedar::dev::kteam::DriveSerial::sendEncoders(const cv::Mat &mat)
   std::ostringstream command;
   command << _mCommandSetEncoder->getValue() << "," << mat.at<float>(0,0) << "," << mat.at<float>(1,0);
 
+  // encoders requested before are outdated now
+  QMutexLocker locker(&this->mPrefetchedEncodersLock);
+  this->mPrefetchedEncoders.reset();
+  locker.unlock();
+
   std::string answer = convertToSerialChannel(getChannel())->writeAndReadLocked(command.str());
 
   // check whether the answer begins with the correct character
@@ -39,10 +39,12 @@
 
 // CEDAR INCLUDES
 #include "cedar/devices/kteam/Drive.h"
+#include "cedar/devices/SerialChannel.h"
 #include "cedar/devices/namespace.h"
 #include "cedar/devices/kteam/namespace.h"
 
 // SYSTEM INCLUDES
+#include <QMutex>
 #include <vector>
 
 
@@ -66,7 +68,10 @@ public:
   // public methods
   //--------------------------------------------------------------------------------------------------------------------
 public:
-  //!@brief Returns the current encoder value of the left and right wheel.
+  /*!@brief Returns the current encoder value of the left and right wheel.
+   *
+   *        If the encoders were requested together with the last movement command, that answer is used.
+   */
   cv::Mat retrieveEncoders() const;
 
   /*!@brief Sets the encoder values of both wheels.
@@ -78,7 +83,11 @@ public:
   // protected methods
   //--------------------------------------------------------------------------------------------------------------------
 protected:
-  //! @see Base class.
+  /*!@brief Sends the wheel speeds and waits for the confirmation.
+   *
+   *        If the encoders are measured in the same communication step, they are requested in the same write, so
+   *        that the measurement does not need a round trip of its own.
+   */
   virtual void sendMovementCommand();
 
   //--------------------------------------------------------------------------------------------------------------------
@@ -87,13 +96,20 @@ protected:
 private:
   void init();
 
+  //!@brief Whether the encoders will be measured right after the current command step.
+  bool isEncoderMeasurementDue() const;
+
   //--------------------------------------------------------------------------------------------------------------------
   // members
   //--------------------------------------------------------------------------------------------------------------------
 protected:
   // none yet
 private:
-  // none yet
+  //! encoder request sent along with the last movement command, if its answer was not used yet
+  mutable cedar::dev::SerialChannel::PendingCommandPtr mPrefetchedEncoders;
+
+  //! protects mPrefetchedEncoders
+  mutable QMutex mPrefetchedEncodersLock;
 
   //--------------------------------------------------------------------------------------------------------------------
   // parameters
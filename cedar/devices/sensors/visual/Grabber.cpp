@@ -282,6 +282,10 @@ void cedar::dev::sensors::visual::Grabber::onCleanUp()
 {
 }
 
+void cedar::dev::sensors::visual::Grabber::onBeforeGrab()
+{
+}
+
 bool cedar::dev::sensors::visual::Grabber::applyParameter()
 {
   // lock creation of grabber
@@ -413,8 +417,13 @@ void cedar::dev::sensors::visual::Grabber::setFramerate(double fps)
                                              );
   }
   // cycle time in ms: 1000ms/frames_per_second
+  // a cycle time of zero lets the LoopedThread step as fast as possible
   cedar::unit::Time one_second(1.0 * cedar::unit::second);
-  cedar::unit::Time cycle_time(one_second / fps);
+  cedar::unit::Time cycle_time(0.0 * cedar::unit::second);
+  if (fps > 0.0)
+  {
+    cycle_time = one_second / fps;
+  }
 
   //!@todo this is how it should be done, but this creates a deadlock
 //  LoopedThread::setStepSize(cycle_time);        // change speed in thread
@@ -489,6 +498,8 @@ void cedar::dev::sensors::visual::Grabber::grab()
   bool result = true;
   std::string error_info = "";
 
+  this->onBeforeGrab();
+
   //lock grabber to block recreation due to parameter changes
   mpLockIsCreating->lockForRead();
 
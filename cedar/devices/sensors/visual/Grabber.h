@@ -235,6 +235,7 @@ public:
    *          This value doesn't indicate, if the thread is running or not.
    *          The LoopedThread have to be restarted for changing the framerate.
    *          This is done in this function, but keep it in mind.
+   *          A framerate of zero (or less) grabs as fast as possible, i.e., the LoopedThread gets a step size of zero.
    *  @see start(), stop()
    */
   void setFramerate(double fps);
@@ -567,6 +568,12 @@ protected:
    */
   virtual void onGrab(unsigned int channel) = 0;
 
+  /*! @brief  Called by grab() before it locks the grabber and the image matrices.
+   *
+   *      Override this method to wait for a source without blocking readers of the images. Does nothing by default.
+   */
+  virtual void onBeforeGrab();
+
 
   /*! @brief Get the channel informations from the derived grabber-classes
    *
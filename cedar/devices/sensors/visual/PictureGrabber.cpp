@@ -171,9 +171,12 @@ void cedar::dev::sensors::visual::PictureGrabber::fileNameChanged()
   {
     const std::string filename = getPictureChannel(channel)->_mSourceFileName->getPath(true);
 
+    // decode before locking, so grabbing and readers of the image aren't stalled while the file is read
+    cv::Mat frame = cv::imread(filename);
+
     // lock image-matrix for writing
     mpReadWriteLock->lockForWrite();
-    getImageMat(channel) = cv::imread(filename);
+    getImageMat(channel) = frame;
     mpReadWriteLock->unlock();
 
     if (getImageMat(channel).empty())
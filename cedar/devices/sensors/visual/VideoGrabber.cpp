@@ -43,8 +43,10 @@
 #include "cedar/auxiliaries/exceptions.h"
 #include "cedar/auxiliaries/casts.h"
 #include "cedar/auxiliaries/opencv_helper.h"
+#include "cedar/auxiliaries/stringFunctions.h"
 
 // SYSTEM INCLUDES
+#include <boost/bind.hpp>
 
 //----------------------------------------------------------------------------------------------------------------------
 // register the class
@@ -54,6 +56,9 @@ namespace
   bool declared
     = cedar::dev::sensors::visual::Grabber::ChannelManagerSingleton::getInstance()
         ->registerType<cedar::dev::sensors::visual::VideoChannelPtr>();
+
+  //! How long a grab waits at the end of a file that isn't looped before the grabbing thread checks in again, in ms.
+  const unsigned long END_OF_FILE_PAUSE = 100;
 }
 
 
@@ -116,10 +121,19 @@ void cedar::dev::sensors::visual::VideoGrabber::init(double speedFactor)
   cedar::aux::LogSingleton::getInstance()->allocating(this);
 
   this->_mSpeedFactor = new cedar::aux::DoubleParameter(this, "speed factor", speedFactor, 0.001, 20.0);
+  this->_mPrefetchFrames = new cedar::aux::UIntParameter(this, "prefetch frames", 4, 0, 1000);
+  this->_mReplayAsFastAsPossible = new cedar::aux::BoolParameter(this, "replay as fast as possible", false);
 
   mFramesCount = 0;
+  mStopDecoding = false;
+  mPrefetching = false;
+  mTakenFrames = 0;
+  mPrefetchPosition = 0;
+  mLateFrames = 0;
 
   QObject::connect (_mSpeedFactor.get(),SIGNAL(valueChanged()),this, SLOT(speedFactorChanged()));
+  QObject::connect (_mReplayAsFastAsPossible.get(),SIGNAL(valueChanged()),this, SLOT(replayModeChanged()));
+  QObject::connect (_mPrefetchFrames.get(),SIGNAL(valueChanged()),this, SLOT(prefetchFramesChanged()));
 
   // watch filename on every channel
   for (unsigned int channel=0; channel<_mChannels->size(); ++channel)
@@ -144,6 +158,7 @@ void cedar::dev::sensors::visual::VideoGrabber::init(double speedFactor)
 cedar::dev::sensors::visual::VideoGrabber::~VideoGrabber()
 {
   doCleanUp();
+  this->stopPrefetching();
   cedar::aux::LogSingleton::getInstance()->freeing(this);
 }
 
@@ -168,13 +183,34 @@ void cedar::dev::sensors::visual::VideoGrabber::speedFactorChanged()
 {
   if (isCreated())
   {
-    double fps = this->getSourceFramerate(0);
-    setFramerate(fps * _mSpeedFactor->getValue());
+    this->updateFramerate();
     emit doSpeedFactorChanged();
   }
 }
 
 
+void cedar::dev::sensors::visual::VideoGrabber::replayModeChanged()
+{
+  if (isCreated())
+  {
+    this->updateFramerate();
+  }
+}
+
+
+void cedar::dev::sensors::visual::VideoGrabber::prefetchFramesChanged()
+{
+  if (isCreated())
+  {
+    // the captures are ahead of the grabbed frames; stopping rewinds them to the grabbed position
+    mpReadWriteLock->lockForWrite();
+    this->stopPrefetching();
+    this->startPrefetching();
+    mpReadWriteLock->unlock();
+  }
+}
+
+
 void cedar::dev::sensors::visual::VideoGrabber::fileNameChanged()
 {
   // set all channels to their parameters
@@ -193,6 +229,236 @@ void cedar::dev::sensors::visual::VideoGrabber::onCleanUp()
 {
   // close all captures
   // mChannels.clear() is done in Grabberinterface
+  this->stopPrefetching();
+}
+
+
+void cedar::dev::sensors::visual::VideoGrabber::updateFramerate()
+{
+  if (_mReplayAsFastAsPossible->getValue())
+  {
+    setFramerate(0.0);
+    return;
+  }
+
+  double fps = this->getSourceFramerate(0);
+  if (fps < 1)
+  {
+    fps = 1;
+  }
+  setFramerate(fps * _mSpeedFactor->getValue());
+}
+
+
+void cedar::dev::sensors::visual::VideoGrabber::startPrefetching()
+{
+  unsigned int slots = _mPrefetchFrames->getValue();
+  unsigned int num_channels = getNumChannels();
+  if (slots == 0 || !mDecoderThreads.empty())
+  {
+    return;
+  }
+
+  {
+    // onBeforeGrab reads this state without holding the image lock
+    QMutexLocker lock(&mPrefetchMutex);
+    mPrefetchedFrames.assign(slots, std::vector<cv::Mat>(num_channels));
+    mPrefetchedPositions.assign(slots, 0);
+    mDecodedFrames.assign(num_channels, 0);
+    mDecodingFinished.assign(num_channels, false);
+    mTakenFrames = 0;
+    mPrefetchPosition = getVideoChannel(0)->mVideoCapture.get(CEDAR_OPENCV_CONSTANT(CAP_PROP_POS_FRAMES));
+    mStopDecoding = false;
+    mPrefetching = true;
+  }
+
+  for (unsigned int channel = 0; channel < num_channels; ++channel)
+  {
+    cedar::aux::CallFunctionInThreadPtr decoder
+    (
+      new cedar::aux::CallFunctionInThread
+      (
+        boost::bind(&cedar::dev::sensors::visual::VideoGrabber::decodeAhead, this, channel)
+      )
+    );
+    decoder->setThreadName(this->getName() + " decoder " + cedar::aux::toString(channel));
+    decoder->start();
+    mDecoderThreads.push_back(decoder);
+  }
+}
+
+
+void cedar::dev::sensors::visual::VideoGrabber::stopPrefetching()
+{
+  if (mDecoderThreads.empty())
+  {
+    return;
+  }
+
+  {
+    QMutexLocker lock(&mPrefetchMutex);
+    mStopDecoding = true;
+  }
+  mFrameTaken.wakeAll();
+  mFrameDecoded.wakeAll();
+  for (auto& decoder : mDecoderThreads)
+  {
+    decoder->stop();
+  }
+  mDecoderThreads.clear();
+
+  // frames decoded ahead are discarded, so the captures continue right after the frame that was grabbed last
+  for (unsigned int channel = 0; channel < getNumChannels(); ++channel)
+  {
+    getVideoChannel(channel)->mVideoCapture.set(CEDAR_OPENCV_CONSTANT(CAP_PROP_POS_FRAMES), mPrefetchPosition);
+  }
+
+  QMutexLocker lock(&mPrefetchMutex);
+  mPrefetching = false;
+  mPrefetchedFrames.clear();
+}
+
+
+void cedar::dev::sensors::visual::VideoGrabber::decodeAhead(unsigned int channel)
+{
+  cv::VideoCapture& capture = getVideoChannel(channel)->mVideoCapture;
+  const unsigned int slots = mPrefetchedFrames.size();
+  // every channel walks through the same frame numbers, which keeps the slots of all channels in sync
+  unsigned int position = mPrefetchPosition;
+
+  QMutexLocker lock(&mPrefetchMutex);
+  while (true)
+  {
+    while (mDecodedFrames.at(channel) >= mTakenFrames + slots && !mStopDecoding)
+    {
+      mFrameTaken.wait(&mPrefetchMutex);
+    }
+    if (mStopDecoding)
+    {
+      break;
+    }
+    unsigned int slot = mDecodedFrames.at(channel) % slots;
+    lock.unlock();
+
+    // the shortest file determines the end of all channels
+    if (position >= mFramesCount)
+    {
+      if (!_mLooped->getValue())
+      {
+        lock.relock();
+        mDecodingFinished.at(channel) = true;
+        lock.unlock();
+        mFrameDecoded.wakeAll();
+        return;
+      }
+      capture.set(CEDAR_OPENCV_CONSTANT(CAP_PROP_POS_FRAMES), 0);
+      position = 0;
+    }
+
+    // the grabbing thread only touches this slot after the counter below is increased. It takes the frame over, so
+    // this allocates a new one and images handed out by getImage() are never overwritten.
+    cv::Mat& frame = mPrefetchedFrames.at(slot).at(channel);
+    capture >> frame;
+    // an empty frame is skipped; the grabbing thread keeps the previous image for this channel
+    if (frame.empty() && position + 1 < mFramesCount)
+    {
+      capture.set(CEDAR_OPENCV_CONSTANT(CAP_PROP_POS_FRAMES), position + 1);
+    }
+    ++position;
+
+    lock.relock();
+    if (channel == 0)
+    {
+      mPrefetchedPositions.at(slot) = position;
+    }
+    ++mDecodedFrames.at(channel);
+    mFrameDecoded.wakeAll();
+  }
+}
+
+
+bool cedar::dev::sensors::visual::VideoGrabber::prefetchedFramesReady() const
+{
+  for (auto decoded : mDecodedFrames)
+  {
+    if (decoded <= mTakenFrames)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+
+bool cedar::dev::sensors::visual::VideoGrabber::prefetchingFinished() const
+{
+  for (unsigned int channel = 0; channel < mDecodedFrames.size(); ++channel)
+  {
+    if (mDecodingFinished.at(channel) && mDecodedFrames.at(channel) <= mTakenFrames)
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+
+void cedar::dev::sensors::visual::VideoGrabber::onBeforeGrab()
+{
+  if (!_mReplayAsFastAsPossible->getValue())
+  {
+    return;
+  }
+
+  QMutexLocker lock(&mPrefetchMutex);
+  if (!mPrefetching)
+  {
+    return;
+  }
+
+  // wait here rather than in onGrab, so that readers of the images are not blocked meanwhile
+  while (!prefetchedFramesReady() && !prefetchingFinished() && !mStopDecoding)
+  {
+    mFrameDecoded.wait(&mPrefetchMutex);
+  }
+
+  // at the end of a file that isn't looped, nothing changes until the position is set; pause instead of spinning
+  if (!prefetchedFramesReady() && prefetchingFinished() && !mStopDecoding)
+  {
+    mFrameDecoded.wait(&mPrefetchMutex, END_OF_FILE_PAUSE);
+  }
+}
+
+
+void cedar::dev::sensors::visual::VideoGrabber::takePrefetchedFrames()
+{
+  const unsigned int num_channels = getNumChannels();
+  QMutexLocker lock(&mPrefetchMutex);
+
+  if (!this->prefetchedFramesReady())
+  {
+    // at the end of a file that isn't looped, the last frame stays; otherwise, decoding is behind
+    if (!this->prefetchingFinished() && !mStopDecoding && !_mReplayAsFastAsPossible->getValue())
+    {
+      ++mLateFrames;
+    }
+    return;
+  }
+
+  unsigned int slot = mTakenFrames % mPrefetchedFrames.size();
+  for (unsigned int channel = 0; channel < num_channels; ++channel)
+  {
+    cv::Mat& frame = mPrefetchedFrames.at(slot).at(channel);
+    if (!frame.empty())
+    {
+      this->getImageMat(channel) = frame;
+    }
+    frame = cv::Mat();
+  }
+  mPrefetchPosition = mPrefetchedPositions.at(slot);
+  ++mTakenFrames;
+  lock.unlock();
+  mFrameTaken.wakeAll();
 }
 
 
@@ -246,11 +512,6 @@ void cedar::dev::sensors::visual::VideoGrabber::onCreateGrabber()
   // check for equal FPS
   double fps_ch0 = this->getSourceFramerate(0);
 
-  if (fps_ch0 < 1)
-  {
-    fps_ch0 = 1;
-  }
-
   if (num_channels > 1)
   {
     double fps_ch1 = this->getSourceFramerate(1);
@@ -262,12 +523,16 @@ void cedar::dev::sensors::visual::VideoGrabber::onCreateGrabber()
   }
 
   // set stepsize for LoopedThread to the framerate from the video-files
-  setFramerate(fps_ch0 * _mSpeedFactor->getValue());
+  this->updateFramerate();
+
+  this->startPrefetching();
 }
 
 
 void cedar::dev::sensors::visual::VideoGrabber::onCloseGrabber()
 {
+  this->stopPrefetching();
+
   unsigned int num_channels = getNumChannels();
   for(unsigned int channel = 0; channel < num_channels; ++channel)
   {
@@ -279,6 +544,16 @@ void cedar::dev::sensors::visual::VideoGrabber::onCloseGrabber()
 
 void cedar::dev::sensors::visual::VideoGrabber::onGrab(unsigned int channel)
 {
+  if (!mDecoderThreads.empty())
+  {
+    // the frames of all channels are taken together to keep them synchronized
+    if (channel == 0)
+    {
+      this->takePrefetchedFrames();
+    }
+    return;
+  }
+
   // read next frame from file for this channel
   cv::Mat frame;
   getVideoChannel(channel)->mVideoCapture >> frame;
@@ -327,6 +602,36 @@ void cedar::dev::sensors::visual::VideoGrabber::setSpeedFactor(double speedFacto
 }
 
 
+void cedar::dev::sensors::visual::VideoGrabber::setPrefetchFrames(unsigned int frames)
+{
+  _mPrefetchFrames->setValue(frames);
+}
+
+
+unsigned int cedar::dev::sensors::visual::VideoGrabber::getPrefetchFrames() const
+{
+  return _mPrefetchFrames->getValue();
+}
+
+
+void cedar::dev::sensors::visual::VideoGrabber::setReplayAsFastAsPossible(bool asFastAsPossible)
+{
+  _mReplayAsFastAsPossible->setValue(asFastAsPossible);
+}
+
+
+bool cedar::dev::sensors::visual::VideoGrabber::getReplayAsFastAsPossible() const
+{
+  return _mReplayAsFastAsPossible->getValue();
+}
+
+
+unsigned int cedar::dev::sensors::visual::VideoGrabber::getLateFrames() const
+{
+  return mLateFrames;
+}
+
+
 double cedar::dev::sensors::visual::VideoGrabber::getSpeedFactor() const
 {
   return _mSpeedFactor->getValue();
@@ -374,6 +679,10 @@ void cedar::dev::sensors::visual::VideoGrabber::setPositionRelative(double newPo
   }
 
   // set to new values
+  // the image lock keeps the grabbing thread out while the decoding threads are replaced
+  mpReadWriteLock->lockForWrite();
+  bool prefetching = !mDecoderThreads.empty();
+  this->stopPrefetching();
   unsigned int num_channels = getNumChannels();
   for(unsigned int channel = 0; channel < num_channels; ++channel)
   {
@@ -383,6 +692,11 @@ void cedar::dev::sensors::visual::VideoGrabber::setPositionRelative(double newPo
       new_pos_abs
     );
   }
+  if (prefetching)
+  {
+    this->startPrefetching();
+  }
+  mpReadWriteLock->unlock();
 }
 
 
@@ -407,7 +721,11 @@ void cedar::dev::sensors::visual::VideoGrabber::setPositionAbsolute(unsigned int
     CEDAR_THROW(cedar::aux::IndexOutOfRangeException, "VideoGrabber::setPositionAbsolute");
   }
 
-  // set new position
+  // set new position; frames decoded ahead belong to the old one
+  // the image lock keeps the grabbing thread out while the decoding threads are replaced
+  mpReadWriteLock->lockForWrite();
+  bool prefetching = !mDecoderThreads.empty();
+  this->stopPrefetching();
   unsigned int num_channels = getNumChannels();
   for(unsigned int channel = 0; channel < num_channels; ++channel)
   {
@@ -417,11 +735,23 @@ void cedar::dev::sensors::visual::VideoGrabber::setPositionAbsolute(unsigned int
       newPositionAbs
     );
   }
+  if (prefetching)
+  {
+    this->startPrefetching();
+  }
+  mpReadWriteLock->unlock();
 }
 
 
 unsigned int cedar::dev::sensors::visual::VideoGrabber::getPositionAbsolute()
 {
+  // the captures are ahead of the grabbed frames when prefetching
+  if (!mDecoderThreads.empty())
+  {
+    QMutexLocker lock(&mPrefetchMutex);
+    return mPrefetchPosition;
+  }
+
   // the position in all avi's should be the same
   return getVideoChannel(0)->mVideoCapture.get(CEDAR_OPENCV_CONSTANT(CAP_PROP_POS_FRAMES));
 }
@@ -45,16 +45,27 @@
 #include "cedar/devices/sensors/visual/VideoChannel.h"
 #include "cedar/auxiliaries/BoolParameter.h"
 #include "cedar/auxiliaries/IntParameter.h"
+#include "cedar/auxiliaries/UIntParameter.h"
 #include "cedar/auxiliaries/FileParameter.h"
+#include "cedar/auxiliaries/CallFunctionInThread.h"
 
 // SYSTEM INCLUDES
+#include <QMutex>
+#include <QWaitCondition>
+#include <atomic>
 #include <string>
+#include <vector>
 
 
 /*! @brief This grabber grabs images from video-files
  *
  *    This grabber will grab from all video-files known by OpenCV and/or ffmpeg
  *    Please look at their documentation for supported types (i.e. mpg, avi, ogg,...)
+ *
+ *    If "prefetch frames" is larger than zero, every channel is decoded on its own thread, which keeps up to that many
+ *    frames ready ahead of the grabbing thread. The channels decode the same sequence of frame numbers, so a stereo
+ *    pair stays frame-synchronized. With "replay as fast as possible", the grabber does not run at the framerate of
+ *    the file; instead, every step waits for and delivers the next decoded frame, which is what offline runs want.
  */
 class cedar::dev::sensors::visual::VideoGrabber
 :
@@ -74,6 +85,12 @@ public cedar::dev::sensors::visual::Grabber
   //! @brief A slot that is triggered if the speedfactor is set
   void speedFactorChanged();
 
+  //! @brief A slot that is triggered if the replay mode is switched
+  void replayModeChanged();
+
+  //! @brief A slot that is triggered if the number of prefetched frames is changed
+  void prefetchFramesChanged();
+
   signals:
 
   //! @brief This signal is emitted, when a new videofile is successfully opened.
@@ -159,6 +176,27 @@ public:
    */
   double getSpeedFactor() const;
 
+  //! @brief Set the number of frames that are decoded ahead of grabbing. Zero decodes in the grabbing thread.
+  void setPrefetchFrames(unsigned int frames);
+
+  //! @brief Get the number of frames that are decoded ahead of grabbing.
+  unsigned int getPrefetchFrames() const;
+
+  /*! @brief Replay the files as fast as they can be decoded instead of at their framerate
+   *
+   *    In this mode, each grab waits for the next decoded frame, i.e., no frame is skipped or repeated.
+   */
+  void setReplayAsFastAsPossible(bool asFastAsPossible);
+
+  //! @brief Check if the files are replayed as fast as possible.
+  bool getReplayAsFastAsPossible() const;
+
+  /*! @brief The number of grabs that found no prefetched frame and kept the previous one.
+   *
+   *    This only happens when replaying at the framerate of the files and decoding can't keep up.
+   */
+  unsigned int getLateFrames() const;
+
   /*! @brief Set postion in the AVI-Files relative
    *
    *    Range is from 0..1<br>
@@ -247,6 +285,9 @@ protected:
    */
   void onGrab(unsigned int channel);
 
+  //! @brief When replaying as fast as possible, waits for the next prefetched frames before the images are locked.
+  void onBeforeGrab();
+
   //--------------------------------------------------------------------------------------------------------------------
   // private methods
   //--------------------------------------------------------------------------------------------------------------------
@@ -255,6 +296,30 @@ private:
    */
   void init(double speedFactor);
 
+  //! @brief Sets the framerate of the grabbing thread according to the source files and the replay mode.
+  void updateFramerate();
+
+  //! @brief Starts one decoding thread per channel if prefetching is enabled.
+  void startPrefetching();
+
+  //! @brief Stops and joins the decoding threads and discards all frames decoded ahead.
+  void stopPrefetching();
+
+  //! @brief Decodes frames of the given channel into the prefetch slots until stopped. Runs in its own thread.
+  void decodeAhead(unsigned int channel);
+
+  /*! @brief Moves the next prefetched frame of every channel into the image matrices.
+   *
+   *    Never waits; if the frames aren't ready, the current images are kept.
+   */
+  void takePrefetchedFrames();
+
+  //! @brief Whether every channel has decoded the next frame set. Must be called with mPrefetchMutex held.
+  bool prefetchedFramesReady() const;
+
+  //! @brief Whether a channel reached the end of a file that isn't looped. Must be called with mPrefetchMutex held.
+  bool prefetchingFinished() const;
+
 
   /*! @brief Cast the storage vector from base channel struct "GrabberChannelPtr" to
    *  derived class VideoChannelPtr
@@ -292,7 +357,44 @@ protected:
   unsigned int mFramesCount;
 
 private:
-  // none yet
+  //! @brief One decoding thread per channel; empty if frames are decoded in the grabbing thread.
+  std::vector<cedar::aux::CallFunctionInThreadPtr> mDecoderThreads;
+
+  //! @brief Guards the prefetch slots and counters below.
+  QMutex mPrefetchMutex;
+
+  //! @brief Notified whenever a channel has decoded a frame or has reached the end of its file.
+  QWaitCondition mFrameDecoded;
+
+  //! @brief Notified whenever the grabbing thread has taken a set of frames and freed a slot.
+  QWaitCondition mFrameTaken;
+
+  //! @brief Set to stop the decoding threads.
+  bool mStopDecoding;
+
+  //! @brief Whether the decoding threads are running; guarded by mPrefetchMutex for onBeforeGrab.
+  bool mPrefetching;
+
+  //! @brief The prefetched frames, indexed by slot and channel. Frame set n is kept in slot n modulo the size.
+  std::vector<std::vector<cv::Mat> > mPrefetchedFrames;
+
+  //! @brief The file position after the frame in each slot, i.e., the value CAP_PROP_POS_FRAMES would report.
+  std::vector<unsigned int> mPrefetchedPositions;
+
+  //! @brief The number of frames each channel has decoded since prefetching started.
+  std::vector<unsigned long long> mDecodedFrames;
+
+  //! @brief Set for a channel that reached the end of a file that isn't looped.
+  std::vector<bool> mDecodingFinished;
+
+  //! @brief The number of frame sets the grabbing thread has taken since prefetching started.
+  unsigned long long mTakenFrames;
+
+  //! @brief The file position of the frames currently in the image matrices when prefetching.
+  unsigned int mPrefetchPosition;
+
+  //! @brief Counts grabs that found no prefetched frame.
+  std::atomic<unsigned int> mLateFrames;
 
 
   //--------------------------------------------------------------------------------------------------------------------
@@ -311,6 +413,12 @@ private:
    */
   cedar::aux::DoubleParameterPtr _mSpeedFactor;
 
+  //! @brief Number of frames decoded ahead of grabbing; zero decodes in the grabbing thread
+  cedar::aux::UIntParameterPtr _mPrefetchFrames;
+
+  //! @brief If set, the files are replayed as fast as they can be decoded instead of at their framerate
+  cedar::aux::BoolParameterPtr _mReplayAsFastAsPossible;
+
 }; // class cedar::dev::sensors::visual::VideoGrabber
 
 #endif // CEDAR_DEV_SENSORS_VISUAL_VIDEO_GRABBER_H
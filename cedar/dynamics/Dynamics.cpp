@@ -40,8 +40,13 @@
 
 // CEDAR INCLUDES
 #include "cedar/dynamics/Dynamics.h"
+#include "cedar/dynamics/integrator/Euler.h"
+#include "cedar/dynamics/integrator/IntegratorManager.h"
 #include "cedar/processing/StepTime.h"
 #include "cedar/processing/exceptions.h"
+#include "cedar/auxiliaries/ObjectParameterTemplate.h"
+#include "cedar/auxiliaries/exceptions.h"
+#include "cedar/auxiliaries/assert.h"
 
 // SYSTEM INCLUDES
 
@@ -66,10 +71,95 @@ void cedar::dyn::Dynamics::compute(const cedar::proc::Arguments& arguments)
 
     this->setTimeMeasurement(this->mTimestepMeasurementId, step_time.getStepTime());
 
-    this->eulerStep(step_time.getStepTime());
+    cedar::dyn::integrator::IntegratorPtr integrator = this->getIntegrator();
+    if (integrator && !boost::dynamic_pointer_cast<cedar::dyn::integrator::Euler>(integrator))
+    {
+      integrator->integrate(*this, step_time.getStepTime());
+    }
+    else
+    {
+      // Euler steps go through eulerStep so that subclasses can provide a fused implementation
+      this->eulerStep(step_time.getStepTime());
+    }
   }
   catch (const std::bad_cast& e)
   {
     CEDAR_THROW(cedar::proc::InvalidArgumentsException, "Bad arguments passed to dynamics. Expected StepTime.");
   }
 }
+
+void cedar::dyn::Dynamics::eulerStep(const cedar::unit::Time& time)
+{
+  // dynamics without a derivative have to override this method; for all others, the Euler integrator is selected
+  CEDAR_ASSERT(this->_mIntegrator);
+  this->getIntegrator()->integrate(*this, time);
+}
+
+void cedar::dyn::Dynamics::addIntegratorParameter()
+{
+  CEDAR_ASSERT(!this->_mIntegrator);
+  this->_mIntegrator = cedar::dyn::integrator::IntegratorParameterPtr
+  (
+    new cedar::dyn::integrator::IntegratorParameter
+    (
+      this,
+      "integrator",
+      cedar::dyn::integrator::EulerPtr(new cedar::dyn::integrator::Euler())
+    )
+  );
+  this->_mIntegrator->markAdvanced();
+}
+
+cedar::dyn::integrator::IntegratorPtr cedar::dyn::Dynamics::getIntegrator() const
+{
+  if (!this->_mIntegrator)
+  {
+    return cedar::dyn::integrator::IntegratorPtr();
+  }
+  return this->_mIntegrator->getValue();
+}
+
+void cedar::dyn::Dynamics::setIntegrator(cedar::dyn::integrator::IntegratorPtr integrator)
+{
+  if (!this->_mIntegrator)
+  {
+    CEDAR_THROW
+    (
+      cedar::aux::NotImplementedException,
+      "The dynamics \"" + this->getName() + "\" do not implement a derivative and can only be integrated with Euler "
+      "steps."
+    );
+  }
+  this->_mIntegrator->setValue(integrator);
+}
+
+void cedar::dyn::Dynamics::beginIntegrationStep(const cedar::unit::Time&)
+{
+}
+
+void cedar::dyn::Dynamics::getStateVariables(std::vector<const cv::Mat*>&) const
+{
+}
+
+void cedar::dyn::Dynamics::computeDerivative(const std::vector<const cv::Mat*>&, std::vector<cv::Mat>&)
+{
+  CEDAR_THROW
+  (
+    cedar::aux::NotImplementedException,
+    "The dynamics \"" + this->getName() + "\" do not implement a derivative."
+  );
+}
+
+double cedar::dyn::Dynamics::getDecayRate(unsigned int) const
+{
+  return 0.0;
+}
+
+void cedar::dyn::Dynamics::endIntegrationStep(const std::vector<cv::Mat>&, const cedar::unit::Time&)
+{
+  CEDAR_THROW
+  (
+    cedar::aux::NotImplementedException,
+    "The dynamics \"" + this->getName() + "\" do not implement a derivative."
+  );
+}
@@ -47,11 +47,23 @@
 
 // FORWARD DECLARATIONS
 #include "cedar/dynamics/Dynamics.fwd.h"
+#include "cedar/dynamics/integrator/Integrator.fwd.h"
+#include "cedar/dynamics/integrator/IntegratorParameter.fwd.h"
 
 // SYSTEM INCLUDES
+#include <opencv2/opencv.hpp>
+#include <vector>
 
 
 /*!@brief A cedar::proc::Step that approximates the solution of some dynamical system.
+ *
+ *        There are two ways for subclasses to describe their dynamics: they can implement eulerStep, which advances
+ *        the state by one explicit Euler step, or they can implement the derivative interface (getStateVariables,
+ *        computeDerivative and, optionally, beginIntegrationStep, endIntegrationStep and getDecayRate). Dynamics that
+ *        implement the derivative interface call addIntegratorParameter in their constructor; the integration scheme
+ *        can then be selected per step (see cedar::dyn::integrator::Integrator). They may still override eulerStep
+ *        with a faster implementation of the Euler method, which is then used whenever the Euler integrator is
+ *        selected.
  */
 class cedar::dyn::Dynamics : public cedar::proc::Step
 {
@@ -70,25 +82,65 @@ public:
   // public methods
   //--------------------------------------------------------------------------------------------------------------------
 public:
-  // none yet
+  //! Returns the integrator of these dynamics, or a null pointer if they only provide an Euler step.
+  cedar::dyn::integrator::IntegratorPtr getIntegrator() const;
+
+  //! Sets the integrator. This is only possible for dynamics that implement the derivative interface.
+  void setIntegrator(cedar::dyn::integrator::IntegratorPtr integrator);
+
+  /*!@brief Prepares an integration step; called once per time step before the derivative is evaluated.
+   *
+   *        Subclasses can use this to compute values that stay constant during the step, e.g., the sum of the inputs.
+   */
+  virtual void beginIntegrationStep(const cedar::unit::Time& time);
+
+  /*!@brief Appends pointers to the state variables of the dynamics to state.
+   *
+   *        Integrators only read from these matrices; the new state is handed back in endIntegrationStep.
+   */
+  virtual void getStateVariables(std::vector<const cv::Mat*>& state) const;
+
+  /*!@brief Computes the derivative (per second) of the state variables for the given state.
+   *
+   *        The state may differ from the current state of the dynamics, e.g., for the intermediate stages of
+   *        higher-order integrators. derivative already has the sizes and types of the state variables.
+   */
+  virtual void computeDerivative(const std::vector<const cv::Mat*>& state, std::vector<cv::Mat>& derivative);
+
+  /*!@brief Returns the rate (per second) of a linear decay term -rate * x contained in the derivative of the given
+   *        state variable, or zero if there is none. Used by exponential integrators.
+   */
+  virtual double getDecayRate(unsigned int stateVariable) const;
+
+  /*!@brief Finishes an integration step by taking over the new state computed by the integrator.
+   *
+   *        Subclasses have to copy the new state into their state variables here; they can also update values that
+   *        depend on the state, e.g., outputs.
+   */
+  virtual void endIntegrationStep(const std::vector<cv::Mat>& newState, const cedar::unit::Time& time);
 
   //--------------------------------------------------------------------------------------------------------------------
   // protected methods
   //--------------------------------------------------------------------------------------------------------------------
 protected:
-  // none yet
+  //! Makes the integration scheme selectable. Only call this in subclasses that implement the derivative interface.
+  void addIntegratorParameter();
 
   //--------------------------------------------------------------------------------------------------------------------
   // private methods
   //--------------------------------------------------------------------------------------------------------------------
 private:
-  //!@brief compute calls eulerStep
+  //!@brief compute calls eulerStep or, if a different integrator is selected, the integrator
   void compute(const cedar::proc::Arguments& arguments);
 
   /*!@brief this is the core method of dynamics - here, an euler step is executed with a given Time interval time
+   *
+   *        Dynamics that implement the derivative interface don't have to override this; by default, the Euler step is
+   *        computed from the derivative.
+   *
    * @param time the time that has passed since the last call to this method
    */
-  virtual void eulerStep(const cedar::unit::Time& time) = 0;
+  virtual void eulerStep(const cedar::unit::Time& time);
 
   //--------------------------------------------------------------------------------------------------------------------
   // members
@@ -98,6 +150,9 @@ protected:
 private:
   unsigned int mTimestepMeasurementId;
 
+  //! The integration scheme; only set for dynamics that implement the derivative interface.
+  cedar::dyn::integrator::IntegratorParameterPtr _mIntegrator;
+
 }; // class cedar::dyn::Dynamics
 
 #endif // CEDAR_DYN_DYNAMICS_H
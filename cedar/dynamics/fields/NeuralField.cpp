@@ -56,8 +56,10 @@
 #include "cedar/auxiliaries/math/transferFunctions/AbsSigmoid.h"
 #include "cedar/auxiliaries/kernel/Gauss.h"
 #include "cedar/auxiliaries/assert.h"
+#include "cedar/auxiliaries/casts.h"
 #include "cedar/auxiliaries/math/tools.h"
 #include "cedar/auxiliaries/Log.h"
+#include "cedar/auxiliaries/Settings.h"
 #include "cedar/units/Time.h"
 #include "cedar/auxiliaries/MatrixIterator.h"
 #include "cedar/units/prefixes.h"
@@ -73,6 +75,7 @@
 #include <vector>
 #include <set>
 #include <string>
+#include <algorithm>
 
 //----------------------------------------------------------------------------------------------------------------------
 // internal class: icon view for DNFs
@@ -132,6 +135,142 @@ namespace
   bool declared = declare();
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+// local functions
+//----------------------------------------------------------------------------------------------------------------------
+namespace
+{
+  //! Number of elements the sigmoid pass works on at once; small enough for a block to stay in the cache.
+  const size_t SIGMOID_BLOCK_SIZE = 4096;
+
+  /* Computes sigmoidU = sigmoid(u + noiseScale * noise) block by block and returns the sum over sigmoidU. Each block is
+   * summed right after the sigmoid is applied to it, while it is still cached. All matrices must be CV_32F and of equal
+   * size. No memory is allocated.
+   */
+  double computeSigmoidAndSum
+  (
+    const cedar::aux::math::TransferFunction& sigmoid,
+    const cv::Mat& u,
+    bool useNoise,
+    const cv::Mat& noise,
+    float noiseScale,
+    cv::Mat& sigmoidU,
+    bool computeSum
+  )
+  {
+    const cv::Mat* arrays[] = {&u, &sigmoidU, useNoise ? &noise : 0, 0};
+    cv::Mat planes[3];
+    cv::NAryMatIterator iter(arrays, planes);
+
+    double sum = 0.0;
+    for (size_t plane = 0; plane < iter.nplanes; ++plane, ++iter)
+    {
+      float* p_u = planes[0].ptr<float>();
+      float* p_sigmoid_u = planes[1].ptr<float>();
+      const float* p_noise = useNoise ? planes[2].ptr<float>() : 0;
+
+      for (size_t begin = 0; begin < iter.size; begin += SIGMOID_BLOCK_SIZE)
+      {
+        const int length = static_cast<int>(std::min(SIGMOID_BLOCK_SIZE, iter.size - begin));
+        cv::Mat block_out(1, length, CV_32F, p_sigmoid_u + begin);
+
+        if (useNoise)
+        {
+          float* p_out = p_sigmoid_u + begin;
+          const float* p_in = p_u + begin;
+          const float* p_block_noise = p_noise + begin;
+          for (int i = 0; i < length; ++i)
+          {
+            p_out[i] = p_in[i] + noiseScale * p_block_noise[i];
+          }
+          sigmoid.compute(block_out, block_out);
+        }
+        else
+        {
+          const cv::Mat block_in(1, length, CV_32F, p_u + begin);
+          sigmoid.compute(block_in, block_out);
+        }
+
+        if (computeSum)
+        {
+          sum += cv::sum(block_out)[0];
+        }
+      }
+    }
+    return sum;
+  }
+
+  /* Integrates one Euler step of the field equation in a single pass over memory:
+   * u = previous + timeFactor * (-previous + offset + lateral + input) + noiseFactor * noise
+   * Here, offset is the sum of resting level and global inhibition. previous and u may be the same matrix. All matrices
+   * must be CV_32F and of equal size.
+   */
+  void integrateFieldEquation
+  (
+    const cv::Mat& previous,
+    cv::Mat& u,
+    const cv::Mat& lateral,
+    const cv::Mat& input,
+    const cv::Mat& noise,
+    float timeFactor,
+    float offset,
+    float noiseFactor
+  )
+  {
+    const cv::Mat* arrays[] = {&previous, &u, &lateral, &input, &noise, 0};
+    cv::Mat planes[5];
+    cv::NAryMatIterator iter(arrays, planes);
+
+    for (size_t plane = 0; plane < iter.nplanes; ++plane, ++iter)
+    {
+      const float* p_previous = planes[0].ptr<float>();
+      float* p_u = planes[1].ptr<float>();
+      const float* p_lateral = planes[2].ptr<float>();
+      const float* p_input = planes[3].ptr<float>();
+      const float* p_noise = planes[4].ptr<float>();
+
+      // simple enough for the compiler to vectorize
+      for (size_t i = 0; i < iter.size; ++i)
+      {
+        p_u[i] = p_previous[i]
+                 + timeFactor * (offset - p_previous[i] + p_lateral[i] + p_input[i]) + noiseFactor * p_noise[i];
+      }
+    }
+  }
+
+  /* Evaluates the field equation without noise in a single pass over memory:
+   * derivative = rate * (-u + offset + lateral + input)
+   * All matrices must be CV_32F and of equal size.
+   */
+  void computeFieldDerivative
+  (
+    const cv::Mat& u,
+    const cv::Mat& lateral,
+    const cv::Mat& input,
+    float rate,
+    float offset,
+    cv::Mat& derivative
+  )
+  {
+    const cv::Mat* arrays[] = {&u, &lateral, &input, &derivative, 0};
+    cv::Mat planes[4];
+    cv::NAryMatIterator iter(arrays, planes);
+
+    for (size_t plane = 0; plane < iter.nplanes; ++plane, ++iter)
+    {
+      const float* p_u = planes[0].ptr<float>();
+      const float* p_lateral = planes[1].ptr<float>();
+      const float* p_input = planes[2].ptr<float>();
+      float* p_derivative = planes[3].ptr<float>();
+
+      for (size_t i = 0; i < iter.size; ++i)
+      {
+        p_derivative[i] = rate * (offset - p_u[i] + p_lateral[i] + p_input[i]);
+      }
+    }
+  }
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 // constructors and destructor
 //----------------------------------------------------------------------------------------------------------------------
@@ -146,6 +285,7 @@ mNeuralNoise(new cedar::aux::MatData(cv::Mat::zeros(50, 50, CV_32F))),
 mMaximumLocation(new cedar::aux::MatData(cv::Mat::zeros(2, 1, CV_32F))),
 mCurrentDeltaT(new cedar::aux::MatData(cv::Mat::zeros(1, 1, CV_32F))),
 mIsActive(false),
+mSigmoidSum(0.0),
 // parameters
 _mOutputActivation(new cedar::aux::BoolParameter(this, "activation as output", false)),
 _mDiscreteMetric(new cedar::aux::BoolParameter(this, "discrete metric (workaround)", false)),
@@ -238,6 +378,13 @@ _mNoiseCorrelationKernelConvolution(new cedar::aux::conv::Convolution())
 {
   this->setAutoLockInputsAndOutputs(false);
 
+  // consumers that read snapshots never wait for the locks taken in eulerStep if activation and output are published
+  if (cedar::aux::SettingsSingleton::getInstance()->getPublishFieldSnapshots())
+  {
+    this->mActivation->setPublishing(true);
+    this->mSigmoidalActivation->setPublishing(true);
+  }
+
   this->declareBuffer("activation", mActivation);
   this->declareBuffer("lateral interaction", mLateralInteraction);
   this->declareBuffer("lateral kernel", this->_mLateralKernelConvolution->getCombinedKernel());
@@ -250,7 +397,9 @@ _mNoiseCorrelationKernelConvolution(new cedar::aux::conv::Convolution())
   this->declareOutput("sigmoided activation", mSigmoidalActivation);
   this->mSigmoidalActivation->setAnnotation(cedar::aux::annotation::AnnotationPtr(new cedar::aux::annotation::ValueRangeHint(0, 1)));
 
-  this->declareInputCollection("input");
+  // inputs are summed from their snapshots if they are publishing (see cedar::proc::steps::Sum::sumSlot)
+  auto input_slot = this->declareInputCollection("input");
+  cedar::aux::asserted_pointer_cast<cedar::proc::ExternalData>(input_slot)->setReadsSnapshots(true);
 
   this->_mOutputActivation->markAdvanced();
   this->_mDiscreteMetric->markAdvanced();
@@ -314,6 +463,8 @@ _mNoiseCorrelationKernelConvolution(new cedar::aux::conv::Convolution())
 
   // now check the dimensionality and sizes of all matrices
   this->updateMatrices();
+
+  this->addIntegratorParameter();
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -489,17 +640,21 @@ void cedar::dyn::NeuralField::readConfiguration(const cedar::aux::ConfigurationN
       this->_mSigmoid->getValue()->readConfiguration(sigmoid_iter->second);
     }
   }
+
+  this->prepareConvolutions();
 }
 
 void cedar::dyn::NeuralField::reset()
 {
   // these buffers are still locked automatically
+  this->mActivation->prepareWrite(false);
   this->mActivation->getData() = mRestingLevel->getValue();
   this->mLateralInteraction->getData() = cv::Scalar(0);
   this->mInputNoise->getData() = cv::Scalar(0);
   this->mNeuralNoise->getData() = cv::Scalar(0);
 
   this->lockOutputs();
+  this->mSigmoidalActivation->prepareWrite(false);
   this->mSigmoidalActivation->getData() = cv::Scalar(0);
   this->unlockOutputs();
 }
@@ -528,44 +683,49 @@ cedar::proc::DataSlot::VALIDITY cedar::dyn::NeuralField::determineInputValidity
   return cedar::proc::DataSlot::VALIDITY_ERROR;
 }
 
-void cedar::dyn::NeuralField::eulerStep(const cedar::unit::Time& time)
+double cedar::dyn::NeuralField::updateOutputAndInteraction(const cedar::unit::Time& time)
 {
-  // get all members needed for the Euler step
   cv::Mat& lateral_interaction = this->mLateralInteraction->getData();
-  cv::Mat& input_noise = this->mInputNoise->getData();
   cv::Mat& neural_noise = this->mNeuralNoise->getData();
   cv::Mat& u = this->mActivation->getData();
   cv::Mat& input_sum = this->mInputSum->getData();
-  const double& h = mRestingLevel->getValue();
-  const double& tau = mTau->getValue();
   const double& global_inhibition = mGlobalInhibition->getValue();
 
-  boost::shared_ptr<QReadLocker> activation_read_locker;
-  if (this->activationIsOutput())
-  {
-    activation_read_locker = boost::shared_ptr<QReadLocker>(new QReadLocker(&this->mActivation->getLock()));
-  }
+  // the activation only needs to be locked if it is an output; lockers without a lock do nothing
+  QReadWriteLock* activation_lock = this->activationIsOutput() ? &this->mActivation->getLock() : nullptr;
+  QReadLocker activation_read_locker(activation_lock);
 
   QWriteLocker sigmoid_u_lock(&this->mSigmoidalActivation->getLock());
+  // the output is overwritten completely, so its old contents need not be kept
+  this->mSigmoidalActivation->prepareWrite(false);
   cv::Mat& sigmoid_u = this->mSigmoidalActivation->getData();
+  CEDAR_ASSERT(u.size == sigmoid_u.size);
+  CEDAR_DEBUG_ASSERT(u.type() == CV_32F && sigmoid_u.type() == CV_32F);
+
   // if the neural noise correlation kernel has an amplitude != 0, create new random values and convolve
-  if (mNoiseCorrelationKernel->getAmplitude() != 0.0)
+  bool use_neural_noise = (mNoiseCorrelationKernel->getAmplitude() != 0.0);
+  float neural_noise_scale = 0.0f;
+  if (use_neural_noise)
   {
     cv::randn(neural_noise, cv::Scalar(0), cv::Scalar(1));
-    neural_noise = this->_mNoiseCorrelationKernelConvolution->convolve(neural_noise);
+    this->_mNoiseCorrelationKernelConvolution->convolveInto(neural_noise, neural_noise);
 
     //!@todo document why this has to use sqrt(time) for noise
-    sigmoid_u = _mSigmoid->getValue()->compute
-                (
-                  u
-                  + sqrt(time / (1.0 * cedar::unit::second)) * neural_noise
-                );
-  }
-  else
-  {
-    // calculate output
-    sigmoid_u = _mSigmoid->getValue()->compute(u);
+    neural_noise_scale = static_cast<float>(sqrt(time / (1.0 * cedar::unit::second)));
   }
+
+  // calculate output; the sum of the output is only needed for the global inhibition
+  double sigmoid_sum = computeSigmoidAndSum
+                       (
+                         *_mSigmoid->getValue(),
+                         u,
+                         use_neural_noise,
+                         neural_noise,
+                         neural_noise_scale,
+                         sigmoid_u,
+                         global_inhibition != 0.0
+                       );
+
 //  //Experimental Part to Update the GUI
   if(_mUpdateStepGui->getValue() && cedar::proc::gui::SettingsSingleton::getInstance()->getUseDynamicFieldIcons() )
   {
@@ -634,30 +794,142 @@ void cedar::dyn::NeuralField::eulerStep(const cedar::unit::Time& time)
   sigmoid_u_lock.unlock();
 
   QReadLocker sigmoid_u_readlock(&this->mSigmoidalActivation->getLock());
-  lateral_interaction = this->_mLateralKernelConvolution->convolve(sigmoid_u);
+  this->_mLateralKernelConvolution->convolveInto(sigmoid_u, lateral_interaction);
 
   this->updateInputSum();
 
-  CEDAR_ASSERT(u.size == sigmoid_u.size);
   CEDAR_ASSERT(u.size == lateral_interaction.size);
   CEDAR_ASSERT(u.size == input_sum.size);
+  CEDAR_DEBUG_ASSERT(lateral_interaction.type() == CV_32F && input_sum.type() == CV_32F);
 
-  // the field equation
-  cv::Mat d_u = -u + h + lateral_interaction + global_inhibition * cv::sum(sigmoid_u)[0] + input_sum;
+  return sigmoid_sum;
+}
 
-  boost::shared_ptr<QWriteLocker> activation_write_locker;
-  if (this->activationIsOutput())
+void cedar::dyn::NeuralField::eulerStep(const cedar::unit::Time& time)
+{
+  // get all members needed for the Euler step
+  cv::Mat& lateral_interaction = this->mLateralInteraction->getData();
+  cv::Mat& input_noise = this->mInputNoise->getData();
+  cv::Mat& u = this->mActivation->getData();
+  cv::Mat& input_sum = this->mInputSum->getData();
+  const double& h = mRestingLevel->getValue();
+  const double& tau = mTau->getValue();
+  const double& global_inhibition = mGlobalInhibition->getValue();
+
+  double sigmoid_sum = this->updateOutputAndInteraction(time);
+
+  // the activation only needs to be locked if it is an output; lockers without a lock do nothing
+  QReadWriteLock* activation_lock = this->activationIsOutput() ? &this->mActivation->getLock() : nullptr;
+  QWriteLocker activation_write_locker(activation_lock);
+
+  cv::randn(input_noise, cv::Scalar(0), cv::Scalar(1));
+
+  // the new activation is computed from the old one, which may still be read as a snapshot
+  cv::Mat previous_u = this->mActivation->prepareWrite(false);
+
+  // integrate one time step of the field equation
+  //   d_u = -u + h + lateral_interaction + global_inhibition * sum(sigmoid_u) + input_sum
+  // in a single pass without temporary matrices
+  double time_factor = time / cedar::unit::Time(tau * cedar::unit::milli * cedar::unit::seconds);
+  double noise_factor = (sqrt(time / (cedar::unit::Time(1.0 * cedar::unit::milli * cedar::unit::seconds))) / tau)
+                        * _mInputNoiseGain->getValue();
+  integrateFieldEquation
+  (
+    previous_u,
+    u,
+    lateral_interaction,
+    input_sum,
+    input_noise,
+    static_cast<float>(time_factor),
+    static_cast<float>(h + global_inhibition * sigmoid_sum),
+    static_cast<float>(noise_factor)
+  );
+
+  mCurrentDeltaT->getData().at<float>(0,0)= time / cedar::unit::seconds;
+}
+
+void cedar::dyn::NeuralField::beginIntegrationStep(const cedar::unit::Time& time)
+{
+  this->mSigmoidSum = this->updateOutputAndInteraction(time);
+}
+
+void cedar::dyn::NeuralField::getStateVariables(std::vector<const cv::Mat*>& state) const
+{
+  state.push_back(&this->mActivation->getData());
+}
+
+double cedar::dyn::NeuralField::getDecayRate(unsigned int) const
+{
+  // tau is given in milliseconds
+  return 1000.0 / this->mTau->getValue();
+}
+
+void cedar::dyn::NeuralField::computeDerivative
+(
+  const std::vector<const cv::Mat*>& state,
+  std::vector<cv::Mat>& derivative
+)
+{
+  CEDAR_DEBUG_ASSERT(state.size() == 1 && derivative.size() == 1);
+  const cv::Mat& u = *state.at(0);
+  const cv::Mat& input_sum = this->mInputSum->getData();
+  const double& h = mRestingLevel->getValue();
+  const double& global_inhibition = mGlobalInhibition->getValue();
+
+  const cv::Mat* lateral_interaction = &this->mLateralInteraction->getData();
+  double sigmoid_sum = this->mSigmoidSum;
+
+  // at intermediate states, output and lateral interaction have to be computed anew
+  if (u.data != this->mActivation->getData().data)
   {
-    activation_read_locker->unlock();
-    activation_write_locker = boost::shared_ptr<QWriteLocker>(new QWriteLocker(&this->mActivation->getLock()));
+    this->mIntermediateSigmoid.create(u.dims, u.size.p, CV_32F);
+    this->mIntermediateLateral.create(u.dims, u.size.p, CV_32F);
+    sigmoid_sum = computeSigmoidAndSum
+                  (
+                    *_mSigmoid->getValue(),
+                    u,
+                    false,
+                    cv::Mat(),
+                    0.0f,
+                    this->mIntermediateSigmoid,
+                    global_inhibition != 0.0
+                  );
+    this->_mLateralKernelConvolution->convolveInto(this->mIntermediateSigmoid, this->mIntermediateLateral);
+    lateral_interaction = &this->mIntermediateLateral;
   }
 
-  cv::randn(input_noise, cv::Scalar(0), cv::Scalar(1));
+  computeFieldDerivative
+  (
+    u,
+    *lateral_interaction,
+    input_sum,
+    static_cast<float>(this->getDecayRate(0)),
+    static_cast<float>(h + global_inhibition * sigmoid_sum),
+    derivative.at(0)
+  );
+}
+
+void cedar::dyn::NeuralField::endIntegrationStep(const std::vector<cv::Mat>& newState, const cedar::unit::Time& time)
+{
+  CEDAR_DEBUG_ASSERT(newState.size() == 1);
+  cv::Mat& u = this->mActivation->getData();
+  cv::Mat& input_noise = this->mInputNoise->getData();
+  const double& tau = mTau->getValue();
 
-  // integrate one time step
-  u += time / cedar::unit::Time(tau * cedar::unit::milli * cedar::unit::seconds) * d_u
-       + (sqrt(time / (cedar::unit::Time(1.0 * cedar::unit::milli * cedar::unit::seconds))) / tau)
-           * _mInputNoiseGain->getValue() * input_noise;
+  QReadWriteLock* activation_lock = this->activationIsOutput() ? &this->mActivation->getLock() : nullptr;
+  QWriteLocker activation_write_locker(activation_lock);
+
+  this->mActivation->prepareWrite(false);
+  newState.at(0).copyTo(u);
+
+  // the noise is not part of the derivative; it is added once per step, scaled as in eulerStep
+  double noise_factor = (sqrt(time / (cedar::unit::Time(1.0 * cedar::unit::milli * cedar::unit::seconds))) / tau)
+                        * _mInputNoiseGain->getValue();
+  if (noise_factor != 0.0)
+  {
+    cv::randn(input_noise, cv::Scalar(0), cv::Scalar(1));
+    cv::scaleAdd(input_noise, noise_factor, u, u);
+  }
 
   mCurrentDeltaT->getData().at<float>(0,0)= time / cedar::unit::seconds;
 }
@@ -749,6 +1021,9 @@ void cedar::dyn::NeuralField::updateMatrices()
     this->mNeuralNoise->getData() = cv::Mat(dimensionality, &sizes.at(0), CV_32F, cv::Scalar(0));
     this->mInputSum->setData(cv::Mat(dimensionality, &sizes.at(0), CV_32F, cv::Scalar(0)));
   }
+  // snapshot readers have to see the new sizes before the next compute call
+  this->mActivation->publish();
+  this->mSigmoidalActivation->publish();
   this->unlockAll();
   if (dimensionality > 0) // only adapt kernel in non-0D case
   {
@@ -772,6 +1047,20 @@ void cedar::dyn::NeuralField::onStart()
 {
   this->_mDimensionality->setConstant(true);
   this->_mSizes->setConstant(true);
+
+  // the sizes may have changed since the architecture was loaded
+  this->prepareConvolutions();
+}
+
+void cedar::dyn::NeuralField::prepareConvolutions()
+{
+  // only size and type are used, so a copy of the header suffices
+  QReadLocker locker(&this->mActivation->getLock());
+  cv::Mat activation = this->mActivation->getData();
+  locker.unlock();
+
+  this->_mLateralKernelConvolution->prepare(activation);
+  this->_mNoiseCorrelationKernelConvolution->prepare(activation);
 }
 
 void cedar::dyn::NeuralField::onStop()
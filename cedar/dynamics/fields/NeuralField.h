@@ -197,6 +197,25 @@ protected:
    */
   void eulerStep(const cedar::unit::Time& time);
 
+  //!@brief Computes output, lateral interaction and input sum for the current activation.
+  void beginIntegrationStep(const cedar::unit::Time& time);
+
+  //!@brief The only state variable is the field activation.
+  void getStateVariables(std::vector<const cv::Mat*>& state) const;
+
+  /*!@brief Evaluates the right-hand side of the field equation (per second) at the given activation.
+   *
+   * When evaluated at the current activation, the output and lateral interaction computed in beginIntegrationStep are
+   * reused; at intermediate states, they are computed again without neural noise.
+   */
+  void computeDerivative(const std::vector<const cv::Mat*>& state, std::vector<cv::Mat>& derivative);
+
+  //!@brief The relaxation rate of the field, i.e., 1/tau.
+  double getDecayRate(unsigned int stateVariable) const;
+
+  //!@brief Writes the integrated activation back and adds the input noise once per step.
+  void endIntegrationStep(const std::vector<cv::Mat>& newState, const cedar::unit::Time& time);
+
   //--------------------------------------------------------------------------------------------------------------------
   // private methods
   //--------------------------------------------------------------------------------------------------------------------
@@ -204,12 +223,21 @@ private:
   //!@brief update the size and dimensionality of internal matrices
   void updateMatrices();
 
+  //!@brief Lets the convolutions prepare for the current field size, e.g., by planning FFTW transformations.
+  void prepareConvolutions();
+
   //!@brief check if input fits to field in dimension and size
   bool isMatrixCompatibleInput(const cv::Mat& matrix) const;
 
   //!@brief Resets the field.
   void reset();
 
+  /*!@brief Computes the (noisy) output, the lateral interaction and the input sum from the current activation.
+   *
+   * @returns The sum over the output, which is needed for the global inhibition.
+   */
+  double updateOutputAndInteraction(const cedar::unit::Time& time);
+
   /*!@brief Returns the convolution object currently selected.
    */
   inline cedar::aux::conv::ConvolutionPtr getConvolution()
@@ -276,6 +304,15 @@ private:
   boost::signals2::connection mKernelRemovedConnection;
   bool mIsActive;
 
+  //! Sum over the output at the beginning of the current integration step.
+  double mSigmoidSum;
+
+  //! Output at intermediate states of an integration step; kept to reuse its memory.
+  cv::Mat mIntermediateSigmoid;
+
+  //! Lateral interaction at intermediate states of an integration step; kept to reuse its memory.
+  cv::Mat mIntermediateLateral;
+
   //--------------------------------------------------------------------------------------------------------------------
   // parameters
   //--------------------------------------------------------------------------------------------------------------------
@@ -84,6 +84,7 @@ namespace
 cedar::dyn::Preshape::Preshape()
 :
 mActivation(new cedar::aux::MatData(cv::Mat::zeros(50,50,CV_32F))),
+mPeak(1.0),
 _mDimensionality
 (
   new cedar::aux::UIntParameter(this, "dimensionality", 2, cedar::aux::UIntParameter::LimitType::positiveZero(4))
@@ -120,6 +121,8 @@ _mSigmoid
   this->updateMatrices();
 
   this->registerFunction("reset memory", boost::bind(&cedar::dyn::Preshape::resetMemory, this));
+
+  this->addIntegratorParameter();
 }
 //----------------------------------------------------------------------------------------------------------------------
 // methods
@@ -132,7 +135,7 @@ void cedar::dyn::Preshape::eulerStep(const cedar::unit::Time& time)
   const cv::Mat& input_mat = input->getData<cv::Mat>();
   const double& tau_build_up = this->_mTimeScaleBuildUp->getValue();
   const double& tau_decay = this->_mTimeScaleDecay->getValue();
-  cv::Mat sigmoided_input = this->_mSigmoid->getValue()->compute(input_mat);
+  this->_mSigmoid->getValue()->compute(input_mat, this->mSigmoidedInput);
   double peak = 1.0;
   if (auto peak_detector = boost::dynamic_pointer_cast<cedar::aux::ConstMatData>(this->getInput("peak detector")))
   {
@@ -140,13 +143,28 @@ void cedar::dyn::Preshape::eulerStep(const cedar::unit::Time& time)
   }
 
   // one possible preshape dynamic
-  preshape +=
-  (
-    time / cedar::unit::Time(tau_build_up * cedar::unit::milli * cedar::unit::seconds)
-      * (-1.0 * preshape + input_mat).mul(sigmoided_input)
-    + time / cedar::unit::Time(tau_decay * cedar::unit::milli * cedar::unit::seconds)
-      * (-1.0 * preshape.mul((1.0 - sigmoided_input)))
-  ) * peak;
+  //   d_preshape = peak * (build_up * (input - preshape) * sigmoid(input) - decay * preshape * (1 - sigmoid(input)))
+  // computed in a single pass without temporary matrices
+  const float build_up
+    = static_cast<float>(peak * (time / cedar::unit::Time(tau_build_up * cedar::unit::milli * cedar::unit::seconds)));
+  const float decay
+    = static_cast<float>(peak * (time / cedar::unit::Time(tau_decay * cedar::unit::milli * cedar::unit::seconds)));
+
+  CEDAR_DEBUG_ASSERT(preshape.type() == CV_32F && input_mat.type() == CV_32F);
+  const cv::Mat* arrays[] = {&preshape, &input_mat, &this->mSigmoidedInput, 0};
+  cv::Mat planes[3];
+  cv::NAryMatIterator iter(arrays, planes);
+  for (size_t plane = 0; plane < iter.nplanes; ++plane, ++iter)
+  {
+    float* p_preshape = planes[0].ptr<float>();
+    const float* p_input = planes[1].ptr<float>();
+    const float* p_sigmoided = planes[2].ptr<float>();
+    for (size_t i = 0; i < iter.size; ++i)
+    {
+      p_preshape[i] += build_up * (p_input[i] - p_preshape[i]) * p_sigmoided[i]
+                       - decay * p_preshape[i] * (1.0f - p_sigmoided[i]);
+    }
+  }
 }
 
 cedar::proc::DataSlot::VALIDITY cedar::dyn::Preshape::determineInputValidity
@@ -187,6 +205,61 @@ cedar::proc::DataSlot::VALIDITY cedar::dyn::Preshape::determineInputValidity
   return cedar::proc::DataSlot::VALIDITY_ERROR;
 }
 
+void cedar::dyn::Preshape::beginIntegrationStep(const cedar::unit::Time&)
+{
+  const cv::Mat& input_mat = this->getInput("input")->getData<cv::Mat>();
+  this->_mSigmoid->getValue()->compute(input_mat, this->mSigmoidedInput);
+  this->mPeak = 1.0;
+  if (auto peak_detector = boost::dynamic_pointer_cast<cedar::aux::ConstMatData>(this->getInput("peak detector")))
+  {
+    this->mPeak = cedar::aux::math::getMatrixEntry<double>(peak_detector->getData(), 0, 0);
+  }
+}
+
+void cedar::dyn::Preshape::getStateVariables(std::vector<const cv::Mat*>& state) const
+{
+  state.push_back(&this->mActivation->getData());
+}
+
+void cedar::dyn::Preshape::computeDerivative
+(
+  const std::vector<const cv::Mat*>& state,
+  std::vector<cv::Mat>& derivative
+)
+{
+  CEDAR_DEBUG_ASSERT(state.size() == 1 && derivative.size() == 1);
+  const cv::Mat& preshape = *state.at(0);
+  const cv::Mat& input_mat = this->getInput("input")->getData<cv::Mat>();
+  cv::Mat& d_preshape = derivative.at(0);
+
+  // same dynamics as in eulerStep, but per second: tau is given in milliseconds
+  const float build_up = static_cast<float>(this->mPeak * 1000.0 / this->_mTimeScaleBuildUp->getValue());
+  const float decay = static_cast<float>(this->mPeak * 1000.0 / this->_mTimeScaleDecay->getValue());
+
+  CEDAR_DEBUG_ASSERT(preshape.type() == CV_32F && input_mat.type() == CV_32F && d_preshape.type() == CV_32F);
+  const cv::Mat* arrays[] = {&preshape, &input_mat, &this->mSigmoidedInput, &d_preshape, 0};
+  cv::Mat planes[4];
+  cv::NAryMatIterator iter(arrays, planes);
+  for (size_t plane = 0; plane < iter.nplanes; ++plane, ++iter)
+  {
+    const float* p_preshape = planes[0].ptr<float>();
+    const float* p_input = planes[1].ptr<float>();
+    const float* p_sigmoided = planes[2].ptr<float>();
+    float* p_derivative = planes[3].ptr<float>();
+    for (size_t i = 0; i < iter.size; ++i)
+    {
+      p_derivative[i] = build_up * (p_input[i] - p_preshape[i]) * p_sigmoided[i]
+                        - decay * p_preshape[i] * (1.0f - p_sigmoided[i]);
+    }
+  }
+}
+
+void cedar::dyn::Preshape::endIntegrationStep(const std::vector<cv::Mat>& newState, const cedar::unit::Time&)
+{
+  CEDAR_DEBUG_ASSERT(newState.size() == 1);
+  newState.at(0).copyTo(this->mActivation->getData());
+}
+
 bool cedar::dyn::Preshape::isMatrixCompatibleInput(const cv::Mat& matrix) const
 {
   if (matrix.type() != CV_32F)
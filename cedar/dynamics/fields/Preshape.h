@@ -50,6 +50,7 @@
 #include "cedar/dynamics/fields/Preshape.fwd.h"
 
 // SYSTEM INCLUDES
+#include <opencv2/opencv.hpp>
 
 
 /*!@brief A step that implements preshape dynamics.
@@ -111,6 +112,18 @@ protected:
    */
   void eulerStep(const cedar::unit::Time& time);
 
+  //!@brief Computes the sigmoided input and reads the peak detector; both are constant during one step.
+  void beginIntegrationStep(const cedar::unit::Time& time);
+
+  //!@brief The only state variable is the preshape activation.
+  void getStateVariables(std::vector<const cv::Mat*>& state) const;
+
+  //!@brief Evaluates the preshape dynamics (per second) at the given activation.
+  void computeDerivative(const std::vector<const cv::Mat*>& state, std::vector<cv::Mat>& derivative);
+
+  //!@brief Writes the integrated activation back to the output.
+  void endIntegrationStep(const std::vector<cv::Mat>& newState, const cedar::unit::Time& time);
+
   //--------------------------------------------------------------------------------------------------------------------
   // private methods
   //--------------------------------------------------------------------------------------------------------------------
@@ -131,7 +144,11 @@ protected:
   cedar::aux::MatDataPtr mActivation;
 
 private:
-  // none yet
+  //! The sigmoided input; kept as a member so that its memory is reused across Euler steps.
+  cv::Mat mSigmoidedInput;
+
+  //! Value of the peak detector input during the current integration step.
+  double mPeak;
 
   //--------------------------------------------------------------------------------------------------------------------
   // parameters
@@ -0,0 +1,150 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        AdaptiveHeun.cpp
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 18
+
+    Description: Implementation of the class cedar::dyn::integrator::AdaptiveHeun.
+
+    Credits:
+
+======================================================================================================================*/
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CLASS HEADER
+#include "cedar/dynamics/integrator/AdaptiveHeun.h"
+
+// CEDAR INCLUDES
+#include "cedar/dynamics/integrator/IntegratorManager.h"
+#include "cedar/dynamics/Dynamics.h"
+
+// SYSTEM INCLUDES
+#include <algorithm>
+#include <cmath>
+
+//----------------------------------------------------------------------------------------------------------------------
+// register type with the factory
+//----------------------------------------------------------------------------------------------------------------------
+namespace
+{
+  bool registered
+    = cedar::dyn::integrator::IntegratorManagerSingleton::getInstance()
+        ->registerType<cedar::dyn::integrator::AdaptiveHeunPtr>();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// constructors and destructor
+//----------------------------------------------------------------------------------------------------------------------
+
+cedar::dyn::integrator::AdaptiveHeun::AdaptiveHeun()
+:
+mStepSize(0.0),
+mNumberOfSubsteps(0),
+_mTolerance
+(
+  new cedar::aux::DoubleParameter(this, "tolerance", 1e-3, cedar::aux::DoubleParameter::LimitType::positive())
+),
+_mMaximumSubsteps(new cedar::aux::UIntParameter(this, "maximum substeps", 20, 1, 10000))
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// methods
+//----------------------------------------------------------------------------------------------------------------------
+
+unsigned int cedar::dyn::integrator::AdaptiveHeun::getNumberOfSubsteps() const
+{
+  return this->mNumberOfSubsteps;
+}
+
+void cedar::dyn::integrator::AdaptiveHeun::computeStep
+     (
+       cedar::dyn::Dynamics& dynamics,
+       const std::vector<const cv::Mat*>& state,
+       double seconds,
+       std::vector<cv::Mat>& newState
+     )
+{
+  const double tolerance = this->_mTolerance->getValue();
+  const unsigned int maximum_substeps = this->_mMaximumSubsteps->getValue();
+
+  // the substeps are taken on the new state, which starts out as a copy of the current one
+  for (size_t i = 0; i < state.size(); ++i)
+  {
+    state.at(i)->copyTo(newState.at(i));
+  }
+  pointTo(newState, this->mCurrentState);
+  allocateLike(state, this->mPredictor);
+  pointTo(this->mPredictor, this->mPredictorState);
+
+  double remaining = seconds;
+  double step_size = (this->mStepSize > 0.0) ? this->mStepSize : seconds;
+  this->mNumberOfSubsteps = 0;
+
+  while (remaining > 1e-9 * seconds)
+  {
+    ++this->mNumberOfSubsteps;
+    bool last_substep = this->mNumberOfSubsteps >= maximum_substeps;
+    double h = last_substep ? remaining : std::min(step_size, remaining);
+    // substeps shortened to fit the end of the time step don't say anything about the step size to use next
+    bool shortened = h < step_size;
+
+    this->evaluate(dynamics, this->mCurrentState, this->mK1);
+    for (size_t i = 0; i < state.size(); ++i)
+    {
+      cv::scaleAdd(this->mK1.at(i), h, newState.at(i), this->mPredictor.at(i));
+    }
+    this->evaluate(dynamics, this->mPredictorState, this->mK2);
+
+    // the difference between the Euler and the Heun step estimates the error of the Euler step
+    double error = 0.0;
+    for (size_t i = 0; i < state.size(); ++i)
+    {
+      error = std::max(error, 0.5 * h * cv::norm(this->mK1.at(i), this->mK2.at(i), cv::NORM_INF));
+    }
+
+    bool accepted = error <= tolerance || last_substep;
+    if (accepted)
+    {
+      for (size_t i = 0; i < state.size(); ++i)
+      {
+        cv::scaleAdd(this->mK1.at(i), 0.5 * h, newState.at(i), newState.at(i));
+        cv::scaleAdd(this->mK2.at(i), 0.5 * h, newState.at(i), newState.at(i));
+      }
+      remaining -= h;
+    }
+
+    // the error of the Euler step is of second order in h; the factor is limited to avoid oscillating step sizes
+    double factor = (error > 0.0) ? 0.9 * std::sqrt(tolerance / error) : 5.0;
+    double proposed_step_size = h * std::min(5.0, std::max(0.2, factor));
+    step_size = (accepted && shortened) ? std::max(step_size, proposed_step_size) : proposed_step_size;
+  }
+
+  this->mStepSize = step_size;
+}
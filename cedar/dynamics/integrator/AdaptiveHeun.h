@@ -0,0 +1,141 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        AdaptiveHeun.h
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 18
+
+    Description: Header file for the class cedar::dyn::integrator::AdaptiveHeun.
+
+    Credits:
+
+======================================================================================================================*/
+
+#ifndef CEDAR_DYN_INTEGRATOR_ADAPTIVE_HEUN_H
+#define CEDAR_DYN_INTEGRATOR_ADAPTIVE_HEUN_H
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CEDAR INCLUDES
+#include "cedar/dynamics/integrator/Integrator.h"
+#include "cedar/auxiliaries/DoubleParameter.h"
+#include "cedar/auxiliaries/UIntParameter.h"
+
+// FORWARD DECLARATIONS
+#include "cedar/dynamics/integrator/AdaptiveHeun.fwd.h"
+
+// SYSTEM INCLUDES
+#include <vector>
+
+
+/*!@brief Heun's method with adaptive step sizes.
+ *
+ *        Each time step is divided into substeps. For each substep, the difference between the Euler and the Heun
+ *        step estimates the local error; substeps whose error exceeds the tolerance are repeated with a smaller size.
+ *        The step size is adapted after each substep and carried over to the next time step.
+ *
+ *        The number of substeps per time step is limited; when the limit is reached, the rest of the time step is
+ *        integrated in a single substep regardless of the error.
+ */
+class cedar::dyn::integrator::AdaptiveHeun : public cedar::dyn::integrator::Integrator
+{
+  //--------------------------------------------------------------------------------------------------------------------
+  // constructors and destructor
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //!@brief The standard constructor.
+  AdaptiveHeun();
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // public methods
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //! Returns the number of substeps taken during the last time step, including rejected ones.
+  unsigned int getNumberOfSubsteps() const;
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // protected methods
+  //--------------------------------------------------------------------------------------------------------------------
+protected:
+  void computeStep
+       (
+         cedar::dyn::Dynamics& dynamics,
+         const std::vector<const cv::Mat*>& state,
+         double seconds,
+         std::vector<cv::Mat>& newState
+       );
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // private methods
+  //--------------------------------------------------------------------------------------------------------------------
+private:
+  // none yet
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // members
+  //--------------------------------------------------------------------------------------------------------------------
+protected:
+  // none yet
+private:
+  //! The derivative at the current state.
+  std::vector<cv::Mat> mK1;
+
+  //! The derivative at the predicted state.
+  std::vector<cv::Mat> mK2;
+
+  //! The state predicted by an Euler step.
+  std::vector<cv::Mat> mPredictor;
+
+  //! Pointers to the matrices in mPredictor.
+  std::vector<const cv::Mat*> mPredictorState;
+
+  //! Pointers to the matrices of the new state, which holds the state during the substeps.
+  std::vector<const cv::Mat*> mCurrentState;
+
+  //! The substep size (in seconds) proposed after the last substep; zero if there was no substep yet.
+  double mStepSize;
+
+  //! Number of substeps taken during the last time step.
+  unsigned int mNumberOfSubsteps;
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // parameters
+  //--------------------------------------------------------------------------------------------------------------------
+protected:
+  // none yet
+
+private:
+  //! The largest accepted local error (maximum norm) per substep.
+  cedar::aux::DoubleParameterPtr _mTolerance;
+
+  //! The largest number of substeps per time step.
+  cedar::aux::UIntParameterPtr _mMaximumSubsteps;
+
+}; // class cedar::dyn::integrator::AdaptiveHeun
+
+#endif // CEDAR_DYN_INTEGRATOR_ADAPTIVE_HEUN_H
+
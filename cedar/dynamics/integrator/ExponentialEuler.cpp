@@ -0,0 +1,84 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        ExponentialEuler.cpp
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 18
+
+    Description: Implementation of the class cedar::dyn::integrator::ExponentialEuler.
+
+    Credits:
+
+======================================================================================================================*/
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CLASS HEADER
+#include "cedar/dynamics/integrator/ExponentialEuler.h"
+
+// CEDAR INCLUDES
+#include "cedar/dynamics/integrator/IntegratorManager.h"
+#include "cedar/dynamics/Dynamics.h"
+
+// SYSTEM INCLUDES
+#include <cmath>
+
+//----------------------------------------------------------------------------------------------------------------------
+// register type with the factory
+//----------------------------------------------------------------------------------------------------------------------
+namespace
+{
+  bool registered
+    = cedar::dyn::integrator::IntegratorManagerSingleton::getInstance()
+        ->registerType<cedar::dyn::integrator::ExponentialEulerPtr>();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// methods
+//----------------------------------------------------------------------------------------------------------------------
+
+void cedar::dyn::integrator::ExponentialEuler::computeStep
+     (
+       cedar::dyn::Dynamics& dynamics,
+       const std::vector<const cv::Mat*>& state,
+       double seconds,
+       std::vector<cv::Mat>& newState
+     )
+{
+  this->evaluate(dynamics, state, this->mDerivative);
+
+  for (size_t i = 0; i < state.size(); ++i)
+  {
+    double rate = dynamics.getDecayRate(static_cast<unsigned int>(i));
+    double factor = seconds;
+    if (rate > 0.0)
+    {
+      factor = -std::expm1(-rate * seconds) / rate;
+    }
+    cv::scaleAdd(this->mDerivative.at(i), factor, *state.at(i), newState.at(i));
+  }
+}
@@ -0,0 +1,104 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        ExponentialEuler.h
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 18
+
+    Description: Header file for the class cedar::dyn::integrator::ExponentialEuler.
+
+    Credits:
+
+======================================================================================================================*/
+
+#ifndef CEDAR_DYN_INTEGRATOR_EXPONENTIAL_EULER_H
+#define CEDAR_DYN_INTEGRATOR_EXPONENTIAL_EULER_H
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CEDAR INCLUDES
+#include "cedar/dynamics/integrator/Integrator.h"
+
+// FORWARD DECLARATIONS
+#include "cedar/dynamics/integrator/ExponentialEuler.fwd.h"
+
+// SYSTEM INCLUDES
+#include <vector>
+
+
+/*!@brief The exponential Euler method.
+ *
+ *        For state variables whose derivative contains a linear decay term -a * x (see
+ *        cedar::dyn::Dynamics::getDecayRate), the decay is integrated exactly: with the derivative f, a step of size h
+ *        is x + (1 - exp(-a * h)) / a * f(x). For the relaxation of neural fields towards their input, this is exact as
+ *        long as the input and lateral interaction are constant during the step, and it stays stable for step sizes
+ *        much larger than the time scale. Variables without a decay rate are integrated with an explicit Euler step.
+ */
+class cedar::dyn::integrator::ExponentialEuler : public cedar::dyn::integrator::Integrator
+{
+  //--------------------------------------------------------------------------------------------------------------------
+  // constructors and destructor
+  //--------------------------------------------------------------------------------------------------------------------
+  // none yet
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // public methods
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  // none yet
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // protected methods
+  //--------------------------------------------------------------------------------------------------------------------
+protected:
+  void computeStep
+       (
+         cedar::dyn::Dynamics& dynamics,
+         const std::vector<const cv::Mat*>& state,
+         double seconds,
+         std::vector<cv::Mat>& newState
+       );
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // private methods
+  //--------------------------------------------------------------------------------------------------------------------
+private:
+  // none yet
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // members
+  //--------------------------------------------------------------------------------------------------------------------
+protected:
+  // none yet
+private:
+  //! The derivative at the current state.
+  std::vector<cv::Mat> mDerivative;
+
+}; // class cedar::dyn::integrator::ExponentialEuler
+
+#endif // CEDAR_DYN_INTEGRATOR_EXPONENTIAL_EULER_H
+
@@ -0,0 +1,87 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        Heun.cpp
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 18
+
+    Description: Implementation of the class cedar::dyn::integrator::Heun.
+
+    Credits:
+
+======================================================================================================================*/
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CLASS HEADER
+#include "cedar/dynamics/integrator/Heun.h"
+
+// CEDAR INCLUDES
+#include "cedar/dynamics/integrator/IntegratorManager.h"
+#include "cedar/dynamics/Dynamics.h"
+
+// SYSTEM INCLUDES
+
+//----------------------------------------------------------------------------------------------------------------------
+// register type with the factory
+//----------------------------------------------------------------------------------------------------------------------
+namespace
+{
+  bool registered
+    = cedar::dyn::integrator::IntegratorManagerSingleton::getInstance()
+        ->registerType<cedar::dyn::integrator::HeunPtr>();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// methods
+//----------------------------------------------------------------------------------------------------------------------
+
+void cedar::dyn::integrator::Heun::computeStep
+     (
+       cedar::dyn::Dynamics& dynamics,
+       const std::vector<const cv::Mat*>& state,
+       double seconds,
+       std::vector<cv::Mat>& newState
+     )
+{
+  this->evaluate(dynamics, state, this->mK1);
+
+  allocateLike(state, this->mPredictor);
+  pointTo(this->mPredictor, this->mPredictorState);
+  for (size_t i = 0; i < state.size(); ++i)
+  {
+    cv::scaleAdd(this->mK1.at(i), seconds, *state.at(i), this->mPredictor.at(i));
+  }
+
+  this->evaluate(dynamics, this->mPredictorState, this->mK2);
+
+  for (size_t i = 0; i < state.size(); ++i)
+  {
+    cv::addWeighted(this->mK1.at(i), 0.5 * seconds, this->mK2.at(i), 0.5 * seconds, 0.0, newState.at(i));
+    cv::add(newState.at(i), *state.at(i), newState.at(i));
+  }
+}
@@ -0,0 +1,126 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        Integrator.cpp
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 18
+
+    Description: Implementation of the class cedar::dyn::integrator::Integrator.
+
+    Credits:
+
+======================================================================================================================*/
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CLASS HEADER
+#include "cedar/dynamics/integrator/Integrator.h"
+
+// CEDAR INCLUDES
+#include "cedar/dynamics/Dynamics.h"
+#include "cedar/auxiliaries/assert.h"
+
+// SYSTEM INCLUDES
+
+//----------------------------------------------------------------------------------------------------------------------
+// constructors and destructor
+//----------------------------------------------------------------------------------------------------------------------
+
+cedar::dyn::integrator::Integrator::Integrator()
+:
+mNumberOfEvaluations(0)
+{
+}
+
+cedar::dyn::integrator::Integrator::~Integrator()
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// methods
+//----------------------------------------------------------------------------------------------------------------------
+
+void cedar::dyn::integrator::Integrator::integrate(cedar::dyn::Dynamics& dynamics, const cedar::unit::Time& time)
+{
+  this->mNumberOfEvaluations = 0;
+
+  dynamics.beginIntegrationStep(time);
+
+  // clearing keeps the capacity of the vector, so this does not allocate after the first step
+  this->mState.clear();
+  dynamics.getStateVariables(this->mState);
+  CEDAR_ASSERT(!this->mState.empty());
+  allocateLike(this->mState, this->mNewState);
+
+  this->computeStep(dynamics, this->mState, time / cedar::unit::seconds, this->mNewState);
+
+  dynamics.endIntegrationStep(this->mNewState, time);
+}
+
+void cedar::dyn::integrator::Integrator::evaluate
+     (
+       cedar::dyn::Dynamics& dynamics,
+       const std::vector<const cv::Mat*>& state,
+       std::vector<cv::Mat>& derivative
+     )
+{
+  allocateLike(state, derivative);
+  dynamics.computeDerivative(state, derivative);
+  ++this->mNumberOfEvaluations;
+}
+
+unsigned int cedar::dyn::integrator::Integrator::getNumberOfEvaluations() const
+{
+  return this->mNumberOfEvaluations;
+}
+
+void cedar::dyn::integrator::Integrator::allocateLike
+     (
+       const std::vector<const cv::Mat*>& state,
+       std::vector<cv::Mat>& storage
+     )
+{
+  storage.resize(state.size());
+  for (size_t i = 0; i < state.size(); ++i)
+  {
+    const cv::Mat& variable = *state.at(i);
+    storage.at(i).create(variable.dims, variable.size.p, variable.type());
+  }
+}
+
+void cedar::dyn::integrator::Integrator::pointTo
+     (
+       const std::vector<cv::Mat>& storage,
+       std::vector<const cv::Mat*>& pointers
+     )
+{
+  pointers.resize(storage.size());
+  for (size_t i = 0; i < storage.size(); ++i)
+  {
+    pointers.at(i) = &storage.at(i);
+  }
+}
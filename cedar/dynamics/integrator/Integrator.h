@@ -0,0 +1,149 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        Integrator.h
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 18
+
+    Description: Header file for the class cedar::dyn::integrator::Integrator.
+
+    Credits:
+
+======================================================================================================================*/
+
+#ifndef CEDAR_DYN_INTEGRATOR_INTEGRATOR_H
+#define CEDAR_DYN_INTEGRATOR_INTEGRATOR_H
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CEDAR INCLUDES
+#include "cedar/auxiliaries/Configurable.h"
+#include "cedar/units/Time.h"
+
+// FORWARD DECLARATIONS
+#include "cedar/dynamics/Dynamics.fwd.h"
+#include "cedar/dynamics/integrator/Integrator.fwd.h"
+
+// SYSTEM INCLUDES
+#include <opencv2/opencv.hpp>
+#include <vector>
+
+
+/*!@brief Base class for integration schemes of cedar::dyn::Dynamics.
+ *
+ *        Integrators advance dynamics that implement the derivative interface of cedar::dyn::Dynamics (see
+ *        cedar::dyn::Dynamics::computeDerivative) by one time step. The state of the dynamics is only read while the
+ *        new state is computed; it is handed back to the dynamics in cedar::dyn::Dynamics::endIntegrationStep.
+ *
+ *        All intermediate matrices are kept by the integrator, so after the first step, integrating does not allocate
+ *        memory unless the shape of the state changes.
+ *
+ * @see   cedar::dyn::Dynamics
+ */
+class cedar::dyn::integrator::Integrator : public cedar::aux::Configurable
+{
+  //--------------------------------------------------------------------------------------------------------------------
+  // constructors and destructor
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //!@brief The standard constructor.
+  Integrator();
+
+  //!@brief Destructor
+  virtual ~Integrator();
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // public methods
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //! Advances the state of the given dynamics by the given time.
+  void integrate(cedar::dyn::Dynamics& dynamics, const cedar::unit::Time& time);
+
+  //! Returns how often the derivative was evaluated during the last call to integrate.
+  unsigned int getNumberOfEvaluations() const;
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // protected methods
+  //--------------------------------------------------------------------------------------------------------------------
+protected:
+  /*!@brief Computes the state of the dynamics after the given time.
+   *
+   * @param dynamics The dynamics to integrate.
+   * @param state    The current state of the dynamics; this must not be modified.
+   * @param seconds  The time by which to advance the state, in seconds.
+   * @param newState Matrices for the new state. They already have the sizes and types of the state variables.
+   */
+  virtual void computeStep
+               (
+                 cedar::dyn::Dynamics& dynamics,
+                 const std::vector<const cv::Mat*>& state,
+                 double seconds,
+                 std::vector<cv::Mat>& newState
+               ) = 0;
+
+  //! Evaluates the derivative of the dynamics at the given state and writes it into derivative.
+  void evaluate
+       (
+         cedar::dyn::Dynamics& dynamics,
+         const std::vector<const cv::Mat*>& state,
+         std::vector<cv::Mat>& derivative
+       );
+
+  /*!@brief Makes the matrices in storage match the sizes and types of the state variables.
+   *
+   *        Matrices that already match are kept as they are, so this only allocates if the state changed its shape.
+   */
+  static void allocateLike(const std::vector<const cv::Mat*>& state, std::vector<cv::Mat>& storage);
+
+  //! Points the entries of pointers to the matrices in storage so that they can be passed as a state.
+  static void pointTo(const std::vector<cv::Mat>& storage, std::vector<const cv::Mat*>& pointers);
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // private methods
+  //--------------------------------------------------------------------------------------------------------------------
+private:
+  // none yet
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // members
+  //--------------------------------------------------------------------------------------------------------------------
+protected:
+  // none yet
+private:
+  //! Pointers to the state variables of the dynamics that is being integrated.
+  std::vector<const cv::Mat*> mState;
+
+  //! The new state computed by the integrator.
+  std::vector<cv::Mat> mNewState;
+
+  //! Number of derivative evaluations during the last call to integrate.
+  unsigned int mNumberOfEvaluations;
+
+}; // class cedar::dyn::integrator::Integrator
+
+#endif // CEDAR_DYN_INTEGRATOR_INTEGRATOR_H
+
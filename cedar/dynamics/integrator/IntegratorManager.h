@@ -0,0 +1,56 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        IntegratorManager.h
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 18
+
+    Description: Header file for the class cedar::dyn::integrator::IntegratorManager.
+
+    Credits:
+
+======================================================================================================================*/
+
+#ifndef CEDAR_DYN_INTEGRATOR_INTEGRATOR_MANAGER_H
+#define CEDAR_DYN_INTEGRATOR_INTEGRATOR_MANAGER_H
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CEDAR INCLUDES
+#include "cedar/auxiliaries/FactoryManager.h"
+#include "cedar/dynamics/integrator/Integrator.h"
+
+// FORWARD DECLARATIONS
+#include "cedar/dynamics/integrator/IntegratorManager.fwd.h"
+#include "cedar/auxiliaries/Singleton.h"
+
+// SYSTEM INCLUDES
+
+CEDAR_DYN_EXPORT_SINGLETON(cedar::aux::FactoryManager<cedar::dyn::integrator::IntegratorPtr>);
+
+#endif // CEDAR_DYN_INTEGRATOR_INTEGRATOR_MANAGER_H
+
@@ -0,0 +1,103 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        RungeKutta4.cpp
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 18
+
+    Description: Implementation of the class cedar::dyn::integrator::RungeKutta4.
+
+    Credits:
+
+======================================================================================================================*/
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CLASS HEADER
+#include "cedar/dynamics/integrator/RungeKutta4.h"
+
+// CEDAR INCLUDES
+#include "cedar/dynamics/integrator/IntegratorManager.h"
+#include "cedar/dynamics/Dynamics.h"
+
+// SYSTEM INCLUDES
+
+//----------------------------------------------------------------------------------------------------------------------
+// register type with the factory
+//----------------------------------------------------------------------------------------------------------------------
+namespace
+{
+  bool registered
+    = cedar::dyn::integrator::IntegratorManagerSingleton::getInstance()
+        ->registerType<cedar::dyn::integrator::RungeKutta4Ptr>();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// methods
+//----------------------------------------------------------------------------------------------------------------------
+
+void cedar::dyn::integrator::RungeKutta4::computeStep
+     (
+       cedar::dyn::Dynamics& dynamics,
+       const std::vector<const cv::Mat*>& state,
+       double seconds,
+       std::vector<cv::Mat>& newState
+     )
+{
+  allocateLike(state, this->mStage);
+  pointTo(this->mStage, this->mStageState);
+
+  this->evaluate(dynamics, state, this->mK1);
+
+  for (size_t i = 0; i < state.size(); ++i)
+  {
+    cv::scaleAdd(this->mK1.at(i), 0.5 * seconds, *state.at(i), this->mStage.at(i));
+  }
+  this->evaluate(dynamics, this->mStageState, this->mK2);
+
+  for (size_t i = 0; i < state.size(); ++i)
+  {
+    cv::scaleAdd(this->mK2.at(i), 0.5 * seconds, *state.at(i), this->mStage.at(i));
+  }
+  this->evaluate(dynamics, this->mStageState, this->mK3);
+
+  for (size_t i = 0; i < state.size(); ++i)
+  {
+    cv::scaleAdd(this->mK3.at(i), seconds, *state.at(i), this->mStage.at(i));
+  }
+  this->evaluate(dynamics, this->mStageState, this->mK4);
+
+  // new state = state + h / 6 * (k1 + 2 * k2 + 2 * k3 + k4), accumulated in place
+  for (size_t i = 0; i < state.size(); ++i)
+  {
+    cv::Mat& new_state = newState.at(i);
+    cv::addWeighted(this->mK1.at(i), seconds / 6.0, this->mK4.at(i), seconds / 6.0, 0.0, new_state);
+    cv::scaleAdd(this->mK2.at(i), seconds / 3.0, new_state, new_state);
+    cv::scaleAdd(this->mK3.at(i), seconds / 3.0, new_state, new_state);
+    cv::add(new_state, *state.at(i), new_state);
+  }
+}
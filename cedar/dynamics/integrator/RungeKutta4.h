@@ -0,0 +1,109 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        RungeKutta4.h
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 18
+
+    Description: Header file for the class cedar::dyn::integrator::RungeKutta4.
+
+    Credits:
+
+======================================================================================================================*/
+
+#ifndef CEDAR_DYN_INTEGRATOR_RUNGE_KUTTA4_H
+#define CEDAR_DYN_INTEGRATOR_RUNGE_KUTTA4_H
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CEDAR INCLUDES
+#include "cedar/dynamics/integrator/Integrator.h"
+
+// FORWARD DECLARATIONS
+#include "cedar/dynamics/integrator/RungeKutta4.fwd.h"
+
+// SYSTEM INCLUDES
+#include <vector>
+
+
+/*!@brief The classical fourth-order Runge-Kutta method.
+ *
+ *        Uses four evaluations of the derivative per step.
+ */
+class cedar::dyn::integrator::RungeKutta4 : public cedar::dyn::integrator::Integrator
+{
+  //--------------------------------------------------------------------------------------------------------------------
+  // constructors and destructor
+  //--------------------------------------------------------------------------------------------------------------------
+  // none yet
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // public methods
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  // none yet
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // protected methods
+  //--------------------------------------------------------------------------------------------------------------------
+protected:
+  void computeStep
+       (
+         cedar::dyn::Dynamics& dynamics,
+         const std::vector<const cv::Mat*>& state,
+         double seconds,
+         std::vector<cv::Mat>& newState
+       );
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // private methods
+  //--------------------------------------------------------------------------------------------------------------------
+private:
+  // none yet
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // members
+  //--------------------------------------------------------------------------------------------------------------------
+protected:
+  // none yet
+private:
+  //! The derivatives at the four stages.
+  std::vector<cv::Mat> mK1;
+  std::vector<cv::Mat> mK2;
+  std::vector<cv::Mat> mK3;
+  std::vector<cv::Mat> mK4;
+
+  //! The state at which the next stage is evaluated.
+  std::vector<cv::Mat> mStage;
+
+  //! Pointers to the matrices in mStage.
+  std::vector<const cv::Mat*> mStageState;
+
+}; // class cedar::dyn::integrator::RungeKutta4
+
+#endif // CEDAR_DYN_INTEGRATOR_RUNGE_KUTTA4_H
+
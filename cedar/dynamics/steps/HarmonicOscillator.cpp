@@ -12,6 +12,7 @@
 #include "cedar/units/prefixes.h"
 #include "cedar/processing/ElementDeclaration.h"
 #include "cedar/processing/DeclarationRegistry.h"
+#include "cedar/auxiliaries/assert.h"
 
 
 namespace
@@ -58,11 +59,12 @@ cedar::dyn::steps::HarmonicOscillator::HarmonicOscillator()
       _lowerRestrictions(new cedar::aux::DoubleVectorParameter(this, "lower restrictions", 1, 0)),
       _upperRestrictions(new cedar::aux::DoubleVectorParameter(this, "upper restrictions", 1, 0)),
       _mPData(new cedar::aux::MatData(cv::Mat(2, 1, CV_32F, _initPos->getDefaultValue()))),
-      _mPDotData(new cedar::aux::MatData(cv::Mat::zeros(2, 1, CV_32F)))
+      _mPDotData(new cedar::aux::MatData(cv::Mat::zeros(2, 1, CV_32F))),
+      mLambda(nullptr)
 {
-  this->declareInput("lambda");
-  this->declareInput("overwriteInput", false);
-  this->declareInput("overwritePeakDetector", false);
+  this->mLambdaSlot = this->declareInput("lambda");
+  this->mOverwriteInputSlot = this->declareInput("overwriteInput", false);
+  this->mOverwritePeakDetectorSlot = this->declareInput("overwritePeakDetector", false);
 
   this->declareOutput("p", mOutput);
   this->declareOutput("pDot", mOutputDot);
@@ -73,6 +75,7 @@ cedar::dyn::steps::HarmonicOscillator::HarmonicOscillator()
   QObject::connect(_B.get(), SIGNAL(valueChanged()), this, SLOT(updateDampingB()));
   QObject::connect(_mDimensionality.get(), SIGNAL(valueChanged()), this, SLOT(updateDimensionality()));
 
+  this->addIntegratorParameter();
 }
 
 cedar::dyn::steps::HarmonicOscillator::~HarmonicOscillator()
@@ -82,7 +85,7 @@ cedar::dyn::steps::HarmonicOscillator::~HarmonicOscillator()
 void cedar::dyn::steps::HarmonicOscillator::eulerStep(const cedar::unit::Time& time)
 {
 
-  cedar::aux::ConstDataPtr lambda = this->getInputSlot("lambda")->getData();
+  cedar::aux::ConstDataPtr lambda = this->mLambdaSlot->getData();
 
   cv::Mat& output = mOutput->getData();
 
@@ -95,85 +98,176 @@ void cedar::dyn::steps::HarmonicOscillator::eulerStep(const cedar::unit::Time& t
 
   if (boost::dynamic_pointer_cast<const cedar::aux::MatData>(lambda))
   {
-    cv::Mat lambdaMat = lambda->getData<cv::Mat>().clone();
-    cv::Mat pDotDot = cv::Mat::zeros(_mDimensionality->getValue(), 1, CV_32F);
+    // K and B are diagonal, so the oscillator is integrated per dimension without any temporary matrices
+    const cv::Mat* lambdaMat = &lambda->getData<cv::Mat>();
 
-    cedar::aux::ConstDataPtr overWriteInput = this->getInputSlot("overwriteInput")->getData();
-    cedar::aux::ConstDataPtr overWritePeakDetector = this->getInputSlot("overwritePeakDetector")->getData();
+    cedar::aux::ConstDataPtr overWriteInput = this->mOverwriteInputSlot->getData();
+    cedar::aux::ConstDataPtr overWritePeakDetector = this->mOverwritePeakDetectorSlot->getData();
     if (boost::dynamic_pointer_cast<const cedar::aux::MatData>(overWriteInput) && boost::dynamic_pointer_cast<const cedar::aux::MatData>(overWritePeakDetector))
     {
-      auto overWriteMat = overWriteInput->getData<cv::Mat>().clone();
-      auto overWritePeak = overWritePeakDetector->getData<cv::Mat>().clone();
-      if (overWritePeak.at<float>(0, 0) > 0.5)
+      const cv::Mat& overWriteMat = overWriteInput->getData<cv::Mat>();
+      if (overWritePeakDetector->getData<cv::Mat>().at<float>(0, 0) > 0.5)
       {
-        p = overWriteMat;
-        lambdaMat = overWriteMat;
+        overWriteMat.copyTo(p);
+        lambdaMat = &overWriteMat;
       }
     }
 
-    cv::Mat K = cv::Mat::zeros(_mDimensionality->getValue(), _mDimensionality->getValue(), CV_32F);
-    cv::Mat B = cv::Mat::zeros(_mDimensionality->getValue(), _mDimensionality->getValue(), CV_32F);
-    for (unsigned int d = 0; d < _mDimensionality->getValue(); d++)
+    const unsigned int dimensionality = _mDimensionality->getValue();
+    const double dt = time / cedar::unit::Time(1.0 * cedar::unit::second);
+    // pDotDot is written directly into its output; this only allocates if the dimensionality changed
+    outputDotDot.create(dimensionality, 1, CV_32F);
+
+    for (unsigned int i = 0; i < dimensionality; i++)
     {
-      float newK = _K->getValue().at(d);
-      K.at<float>(d, d) = newK;
-      B.at<float>(d, d) = sqrt(newK) * 2 * _D->getValue();
+      float newK = _K->getValue().at(i);
+      float newB = sqrt(newK) * 2 * _D->getValue();
+
+      float dif = this->computeDifference(i, p.at<float>(i, 0), lambdaMat->at<float>(i, 0));
+
+      float pDotDot = -newK * dif - newB * pDot.at<float>(i, 0);
+      outputDotDot.at<float>(i, 0) = pDotDot;
+
+      pDot.at<float>(i, 0) += dt * pDotDot;
+
+      p.at<float>(i, 0) += dt * pDot.at<float>(i, 0);
     }
 
-    cv::Mat difMat = p - lambdaMat;
-    if (_cyclicRestrictions->getValue())
+    this->applyCyclicRestrictions(p);
+
+    output = p;
+    outputDot = pDot;
+  }
+}
+
+float cedar::dyn::steps::HarmonicOscillator::computeDifference(unsigned int i, float p, float lambda) const
+{
+  float dif = p - lambda;
+  if (_cyclicRestrictions->getValue())
+  {
+    if (abs(p - lambda) > ((_upperRestrictions->getValue().at(i) + _lowerRestrictions->getValue().at(i)) / 2.0))
     {
-      for (unsigned int i = 0; i < _mDimensionality->getValue(); i++)
+      if (p < lambda)
+        dif = p - lambda + _upperRestrictions->getValue().at(i);
+      else
+        dif = p - lambda - _upperRestrictions->getValue().at(i);
+    }
+  }
+  return dif;
+}
+
+void cedar::dyn::steps::HarmonicOscillator::applyCyclicRestrictions(cv::Mat& p) const
+{
+  if (_cyclicRestrictions->getValue())
+  {
+    for (unsigned int i = 0; i < _mDimensionality->getValue(); i++)
+    {
+      if (p.at<float>(i, 0) > _upperRestrictions->getValue().at(i))
+      {
+        double dif = p.at<float>(i, 0) - _upperRestrictions->getValue().at(i);
+        p.at<float>(i, 0) = _lowerRestrictions->getValue().at(i) + dif;
+      }
+
+      if (p.at<float>(i, 0) < _lowerRestrictions->getValue().at(i))
       {
-        if (abs(p.at<float>(i, 0) - lambdaMat.at<float>(i, 0)) > ((_upperRestrictions->getValue().at(i) + _lowerRestrictions->getValue().at(i)) / 2.0))
-        {
-          if (p.at<float>(i, 0) < lambdaMat.at<float>(i, 0))
-            difMat.at<float>(i, 0) = p.at<float>(i, 0) - lambdaMat.at<float>(i, 0) + _upperRestrictions->getValue().at(i);
-          else
-            difMat.at<float>(i, 0) = p.at<float>(i, 0) - lambdaMat.at<float>(i, 0) - _upperRestrictions->getValue().at(i);
-        }
-        else
-        {
-          difMat.at<float>(i, 0) = p.at<float>(i, 0) - lambdaMat.at<float>(i, 0);
-        }
+        double dif = p.at<float>(i, 0) - _lowerRestrictions->getValue().at(i);
+        p.at<float>(i, 0) = _upperRestrictions->getValue().at(i) + dif;
       }
+    }
+  }
+}
 
+void cedar::dyn::steps::HarmonicOscillator::beginIntegrationStep(const cedar::unit::Time&)
+{
+  this->mLambda = nullptr;
+
+  cedar::aux::ConstDataPtr lambda = this->mLambdaSlot->getData();
+  if (!boost::dynamic_pointer_cast<const cedar::aux::MatData>(lambda))
+  {
+    return;
+  }
+  this->mLambda = &lambda->getData<cv::Mat>();
+
+  cedar::aux::ConstDataPtr overWriteInput = this->mOverwriteInputSlot->getData();
+  cedar::aux::ConstDataPtr overWritePeakDetector = this->mOverwritePeakDetectorSlot->getData();
+  if
+  (
+    boost::dynamic_pointer_cast<const cedar::aux::MatData>(overWriteInput)
+    && boost::dynamic_pointer_cast<const cedar::aux::MatData>(overWritePeakDetector)
+  )
+  {
+    const cv::Mat& overWriteMat = overWriteInput->getData<cv::Mat>();
+    if (overWritePeakDetector->getData<cv::Mat>().at<float>(0, 0) > 0.5)
+    {
+      overWriteMat.copyTo(_mPData->getData());
+      this->mLambda = &overWriteMat;
     }
+  }
+}
 
-//    std::cout << "Lambda: " << lambdaMat << std::endl;
-    pDotDot = (-1 * (K) * (difMat)) - ((B) * pDot);
+void cedar::dyn::steps::HarmonicOscillator::getStateVariables(std::vector<const cv::Mat*>& state) const
+{
+  // without lambda, there is nothing to integrate
+  if (this->mLambda != nullptr)
+  {
+    state.push_back(&_mPData->getData());
+    state.push_back(&_mPDotData->getData());
+  }
+}
 
-//    std::cout << "PDotDot: " << pDotDot << std::endl;
+void cedar::dyn::steps::HarmonicOscillator::computeDerivative
+(
+  const std::vector<const cv::Mat*>& state,
+  std::vector<cv::Mat>& derivative
+)
+{
+  CEDAR_DEBUG_ASSERT(state.size() == 2 && derivative.size() == 2);
+  const cv::Mat& p = *state.at(0);
+  const cv::Mat& pDot = *state.at(1);
+  cv::Mat& d_p = derivative.at(0);
+  cv::Mat& d_pDot = derivative.at(1);
 
-    pDot += (time / cedar::unit::Time(1.0 * cedar::unit::second)) * pDotDot;
-//    std::cout << "PDot: " << pDot << std::endl;
+  for (unsigned int i = 0; i < _mDimensionality->getValue(); i++)
+  {
+    float newK = _K->getValue().at(i);
+    float newB = sqrt(newK) * 2 * _D->getValue();
+    float dif = this->computeDifference(i, p.at<float>(i, 0), this->mLambda->at<float>(i, 0));
 
-    p += (time / cedar::unit::Time(1.0 * cedar::unit::second)) * pDot;
+    d_p.at<float>(i, 0) = pDot.at<float>(i, 0);
+    d_pDot.at<float>(i, 0) = -newK * dif - newB * pDot.at<float>(i, 0);
+  }
+}
 
-//    std::cout << "P: " << p << std::endl;
+void cedar::dyn::steps::HarmonicOscillator::endIntegrationStep
+(
+  const std::vector<cv::Mat>& newState,
+  const cedar::unit::Time&
+)
+{
+  if (newState.empty())
+  {
+    return;
+  }
 
-    if (_cyclicRestrictions->getValue())
-    {
-      for (unsigned int i = 0; i < _mDimensionality->getValue(); i++)
-      {
-        if (p.at<float>(i, 0) > _upperRestrictions->getValue().at(i))
-        {
-          double dif = p.at<float>(i, 0) - _upperRestrictions->getValue().at(i);
-          p.at<float>(i, 0) = _lowerRestrictions->getValue().at(i) + dif;
-        }
-
-        if (p.at<float>(i, 0) < _lowerRestrictions->getValue().at(i))
-        {
-          double dif = p.at<float>(i, 0) - _lowerRestrictions->getValue().at(i);
-          p.at<float>(i, 0) = _upperRestrictions->getValue().at(i) + dif;
-        }
-      }
-    }
+  cv::Mat& p = _mPData->getData();
+  cv::Mat& pDot = _mPDotData->getData();
+  newState.at(0).copyTo(p);
+  newState.at(1).copyTo(pDot);
+  this->applyCyclicRestrictions(p);
 
-    output = p;
-    outputDot = pDot;
-    outputDotDot = pDotDot;
+  // pDotDot is reported for the new state
+  cv::Mat& outputDotDot = mOutputDotDot->getData();
+  outputDotDot.create(_mDimensionality->getValue(), 1, CV_32F);
+  for (unsigned int i = 0; i < _mDimensionality->getValue(); i++)
+  {
+    float newK = _K->getValue().at(i);
+    float newB = sqrt(newK) * 2 * _D->getValue();
+    float dif = this->computeDifference(i, p.at<float>(i, 0), this->mLambda->at<float>(i, 0));
+    outputDotDot.at<float>(i, 0) = -newK * dif - newB * pDot.at<float>(i, 0);
   }
+
+  mOutput->getData() = p;
+  mOutputDot->getData() = pDot;
 }
 
 cedar::aux::MatDataPtr cedar::dyn::steps::HarmonicOscillator::getCurrentPosition()
@@ -41,6 +41,15 @@ public:
 	virtual ~HarmonicOscillator();
 	void eulerStep(const cedar::unit::Time& time);
 
+	//!@brief Reads lambda and applies the overwrite input; both are constant during one step.
+	void beginIntegrationStep(const cedar::unit::Time& time);
+	//!@brief The state variables are position and velocity.
+	void getStateVariables(std::vector<const cv::Mat*>& state) const;
+	//!@brief Evaluates velocity and acceleration at the given state.
+	void computeDerivative(const std::vector<const cv::Mat*>& state, std::vector<cv::Mat>& derivative);
+	//!@brief Writes position and velocity back, applies the cyclic restrictions and updates the outputs.
+	void endIntegrationStep(const std::vector<cv::Mat>& newState, const cedar::unit::Time& time);
+
 	cedar::aux::MatDataPtr getCurrentPosition();
 	cedar::aux::MatDataPtr getCurrentVelocity();
 	void setK(unsigned int dimension,double k);
@@ -66,6 +75,10 @@ public:
 	cedar::proc::DataSlot::VALIDITY determineInputValidity(cedar::proc::ConstDataSlotPtr slot,cedar::aux::ConstDataPtr data) const;
 	//!@brief Resets the field.
 	void reset();
+	//!@brief Difference between position and lambda in the given dimension, taking cyclic restrictions into account.
+	float computeDifference(unsigned int dimension, float p, float lambda) const;
+	//!@brief Wraps the position back into the cyclic restrictions.
+	void applyCyclicRestrictions(cv::Mat& p) const;
 	private :
 
 
@@ -89,6 +102,14 @@ public:
 	cedar::aux::MatDataPtr _mPData;
 	cedar::aux::MatDataPtr _mPDotData;
 
+	//! Input slots, stored so that stepping doesn't look them up by name.
+	cedar::proc::DataSlotPtr mLambdaSlot;
+	cedar::proc::DataSlotPtr mOverwriteInputSlot;
+	cedar::proc::DataSlotPtr mOverwritePeakDetectorSlot;
+
+	//! Lambda of the current integration step; null if the input is missing.
+	const cv::Mat* mLambda;
+
 };
 
 #endif /* CEDAR_DYN_HARMONIC_OSCILLATOR_H */
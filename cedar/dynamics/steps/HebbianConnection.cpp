@@ -50,10 +50,12 @@
 #include "cedar/units/prefixes.h"
 #include "cedar/auxiliaries/math/Sigmoid.h"
 #include "cedar/auxiliaries/math/transferFunctions/AbsSigmoid.h"
+#include "cedar/auxiliaries/math/tools.h"
 
 // SYSTEM INCLUDES
 #include <iostream>
 #include <vector>
+#include <algorithm>
 #include <cstdlib>
 #include <ctime>
 
@@ -87,6 +89,43 @@ namespace
   }
 
   bool declared = declare();
+
+  /* Applies one step of the learning rule in place and in a single pass over memory:
+   * weights += rate * (association - weights)
+   * If sparse is set, only weights at which the association exceeds the threshold are updated. Both matrices must be
+   * CV_32F and of equal size.
+   */
+  void learn(cv::Mat& weights, const cv::Mat& association, float rate, bool sparse, float threshold)
+  {
+    const cv::Mat* arrays[] = {&weights, &association, 0};
+    cv::Mat planes[2];
+    cv::NAryMatIterator iter(arrays, planes);
+
+    for (size_t plane = 0; plane < iter.nplanes; ++plane, ++iter)
+    {
+      float* p_weights = planes[0].ptr<float>();
+      const float* p_association = planes[1].ptr<float>();
+
+      if (sparse)
+      {
+        for (size_t i = 0; i < iter.size; ++i)
+        {
+          if (p_association[i] > threshold)
+          {
+            p_weights[i] += rate * (p_association[i] - p_weights[i]);
+          }
+        }
+      }
+      else
+      {
+        // simple enough for the compiler to vectorize
+        for (size_t i = 0; i < iter.size; ++i)
+        {
+          p_weights[i] += rate * (p_association[i] - p_weights[i]);
+        }
+      }
+    }
+  }
 }
 
 
@@ -96,7 +135,16 @@ namespace
 cedar::dyn::steps::HebbianConnection::HebbianConnection()
     :
       // parameters
-      mAssociationDimension(new cedar::aux::UIntParameter(this, "association dimension", 2, 0, 2)),
+      mAssociationDimension
+      (
+        new cedar::aux::UIntParameter
+        (
+          this,
+          "association dimension",
+          2,
+          cedar::aux::UIntParameter::LimitType::positiveZero(4)
+        )
+      ),
       mAssociationSizes(new cedar::aux::UIntVectorParameter(this, "association sizes", 2, 50)),
       mLearnRatePositive(new cedar::aux::DoubleParameter(this, "learning rate", 0.01)),
       mUseRewardDuration(new cedar::aux::BoolParameter(this, "fixed reward duration", false)),
@@ -105,13 +153,14 @@ cedar::dyn::steps::HebbianConnection::HebbianConnection()
       mWeightCenters(new cedar::aux::DoubleVectorParameter(this, "weight centers", mAssociationDimension->getValue(), 3)),
       mWeightSigmas(new cedar::aux::DoubleVectorParameter(this, "weight sigmas", mAssociationDimension->getValue(), 3)),
       mWeightAmplitude(new cedar::aux::DoubleParameter(this, "weight amplitude", 6)),
+      mSparseUpdate(new cedar::aux::BoolParameter(this, "sparse update", false)),
+      mSparseThreshold(new cedar::aux::DoubleParameter(this, "sparse threshold", 0.5)),
       // outputs
       mConnectionWeights(new cedar::aux::MatData(cv::Mat::zeros(100, 100, CV_32F))),
       mWeightOutput((new cedar::aux::MatData(cv::Mat::zeros(100, 100, CV_32F)))),
       mRewardTrigger(new cedar::aux::MatData(cv::Mat::zeros(1, 1, CV_32F))),
       mReadOutTrigger(new cedar::aux::MatData(cv::Mat::zeros(1, 1, CV_32F))),
-      mWeightSizeX(mAssociationDimension->getValue() > 0 ? mAssociationSizes->getValue().at(0) : 1),
-      mWeightSizeY(mAssociationDimension->getValue() > 1 ? mAssociationSizes->getValue().at(1) : 1)
+      mNodeSigmoid(new cedar::aux::math::AbsSigmoid(0.5, 100.0))
 {
 
   // declare all data
@@ -129,6 +178,7 @@ cedar::dyn::steps::HebbianConnection::HebbianConnection()
   mWeightAmplitude->setConstant(!mSetWeights->getValue());
   mWeightSigmas->setConstant(!mSetWeights->getValue());
   mWeightCenters->setConstant(!mSetWeights->getValue());
+  mSparseThreshold->setConstant(!mSparseUpdate->getValue());
 
   this->registerFunction("reset Weights", boost::bind(&HebbianConnection::resetWeights, this), false);
 
@@ -139,6 +189,7 @@ cedar::dyn::steps::HebbianConnection::HebbianConnection()
   QObject::connect(mWeightCenters.get(), SIGNAL(valueChanged()), this, SLOT(resetWeights()));
   QObject::connect(mWeightSigmas.get(), SIGNAL(valueChanged()), this, SLOT(resetWeights()));
   QObject::connect(mWeightAmplitude.get(), SIGNAL(valueChanged()), this, SLOT(resetWeights()));
+  QObject::connect(mSparseUpdate.get(), SIGNAL(valueChanged()), this, SLOT(toggleSparseUpdate()));
 }
 //----------------------------------------------------------------------------------------------------------------------
 // methods
@@ -150,40 +201,38 @@ void cedar::dyn::steps::HebbianConnection::updateAssociationDimension()
   mAssociationSizes->resize(new_dim, mAssociationSizes->getDefaultValue());
   mWeightCenters->resize(new_dim, mWeightCenters->getDefaultValue());
   mWeightSigmas->resize(new_dim, mWeightCenters->getDefaultValue());
-  mWeightSizeX = mAssociationDimension->getValue() > 0 ? mAssociationSizes->getValue().at(0) : 1;
-  mWeightSizeY = mAssociationDimension->getValue() > 1 ? mAssociationSizes->getValue().at(1) : 1;
   this->resetWeights();
 }
 
 cv::Mat cedar::dyn::steps::HebbianConnection::initializeWeightMatrix()
 {
-  mWeightSizeX = mAssociationDimension->getValue() > 0 ? mAssociationSizes->getValue().at(0) : 1;
-  mWeightSizeY = mAssociationDimension->getValue() > 1 ? mAssociationSizes->getValue().at(1) : 1;
-  cv::Mat myWeightMat = cv::Mat::zeros(mWeightSizeX, mWeightSizeY, CV_32F);
+  unsigned int dimensionality = mAssociationDimension->getValue();
+  std::vector<int> sizes(std::max(dimensionality, 2u), 1);
+  for (unsigned int dim = 0; dim < dimensionality; ++dim)
+  {
+    sizes.at(dim) = static_cast<int>(mAssociationSizes->at(dim));
+  }
+  cv::Mat myWeightMat(static_cast<int>(sizes.size()), &sizes.front(), CV_32F, cv::Scalar(0));
+
   if (!mSetWeights->getValue())
   {
 //    std::cout<<"InitWeights: RANDOM!"<<std::endl;
     srand(static_cast<unsigned>(time(0)));
     float HIGH = 0.1;
     float LOW = 0;
-    for (unsigned int x = 0; x < mWeightSizeX; x++)
+    // the matrix was just allocated and is therefore continuous
+    float* p_weights = myWeightMat.ptr<float>();
+    for (size_t i = 0; i < myWeightMat.total(); ++i)
     {
-      for (unsigned int y = 0; y < mWeightSizeY; y++)
-      {
-        float random = LOW + static_cast<float>(rand()) / (static_cast<float>(RAND_MAX / (HIGH - LOW)));
-        myWeightMat.at<float>(x, y) = random;
-      }
+      p_weights[i] = LOW + static_cast<float>(rand()) / (static_cast<float>(RAND_MAX / (HIGH - LOW)));
     }
   }
   else
   {
 //    std::cout<<"InitWeights: MANUAL"<<std::endl;
-    std::vector<unsigned int> curSizes;
-    curSizes.push_back(mWeightSizeX);
-    curSizes.push_back(mWeightSizeY);
-    if (mAssociationDimension->getValue() != 0)
+    if (dimensionality != 0)
     {
-      myWeightMat = cedar::aux::math::gaussMatrix(mAssociationDimension->getValue(), curSizes,
+      myWeightMat = cedar::aux::math::gaussMatrix(dimensionality, mAssociationSizes->getValue(),
                                                   mWeightAmplitude->getValue(), mWeightSigmas->getValue(),
                                                   mWeightCenters->getValue(), true);
     }
@@ -213,22 +262,21 @@ void cedar::dyn::steps::HebbianConnection::eulerStep(const cedar::unit::Time& ti
       if (mElapsedTime < mRewardDuration->getValue() || !mUseRewardDuration->getValue())
       {
         //Apply Learning Rule
-        double learnRate = mLearnRatePositive->getValue();
-        cv::Mat currentWeights = mConnectionWeights->getData();
-        cv::Mat currentAssoMat = mAssoInput->getData();
-        for (unsigned int x = 0; x < mWeightSizeX; x++)
+        // the source node is a scalar, so its sigmoid is the same for all weights
+        float sigmoidedNodeInput = mNodeSigmoid->compute(mReadOutTrigger->getData().at<float>(0, 0));
+        float rate = static_cast<float>(mLearnRatePositive->getValue()) * sigmoidedNodeInput;
+        if (rate != 0.0f)
         {
-          for (unsigned int y = 0; y < mWeightSizeY; y++)
-          {
-            auto mySigmoid = cedar::aux::math::SigmoidPtr(new cedar::aux::math::AbsSigmoid(0.5, 100.0));
-            float sigmoidedNodeInput =  mySigmoid->compute(mReadOutTrigger->getData().at<float>(0, 0));
-
-
-            float weightChange = learnRate * sigmoidedNodeInput   * (currentAssoMat.at<float>(x, y) - currentWeights.at<float>(x, y));
-            currentWeights.at<float>(x, y) = currentWeights.at<float>(x, y) + weightChange;
-          }
+          learn
+          (
+            mConnectionWeights->getData(),
+            mAssoInput->getData(),
+            rate,
+            mSparseUpdate->getValue(),
+            static_cast<float>(mSparseThreshold->getValue())
+          );
+          mConnectionWeights->markChanged();
         }
-        mConnectionWeights->setData(currentWeights);
       }
     }
     else if (mUseRewardDuration->getValue())
@@ -236,20 +284,37 @@ void cedar::dyn::steps::HebbianConnection::eulerStep(const cedar::unit::Time& ti
       mIsRewarded = false;
     }
   }
-  if (mReadOutTrigger)
+  // It is assumed that a change greater than 0.5 is intentional
+  this->updateWeightOutput(mReadOutTrigger && mReadOutTrigger->getData().at<float>(0, 0) > 0.5);
+}
+
+void cedar::dyn::steps::HebbianConnection::updateWeightOutput(bool readOut)
+{
+  const cv::Mat& weights = mConnectionWeights->getData();
+  const cv::Mat& output = mWeightOutput->getData();
+  if (readOut)
   {
-    const cv::Mat& trigger = mReadOutTrigger->getData();
-    if (trigger.at<float>(0, 0) > 0.5) // It is assumed that a change greater than 0.5 is intentional
+    // the output shares its memory with the weights, so it only has to be marked as changed
+    if (output.data != weights.data)
     {
-      mWeightOutput->setData(mConnectionWeights->getData());
+      mWeightOutput->setData(weights);
     }
     else
     {
-      mWeightOutput->setData(cv::Mat::zeros(mWeightSizeX, mWeightSizeY, CV_32F));
+      mWeightOutput->markChanged();
     }
   }
   else
-    mWeightOutput->setData(cv::Mat::zeros(mWeightSizeX, mWeightSizeY, CV_32F));
+  {
+    if (mZeroWeights.empty() || !cedar::aux::math::matrixSizesEqual(mZeroWeights, weights))
+    {
+      mZeroWeights = cv::Mat(weights.dims, weights.size.p, CV_32F, cv::Scalar(0));
+    }
+    if (output.data != mZeroWeights.data)
+    {
+      mWeightOutput->setData(mZeroWeights);
+    }
+  }
 }
 
 void cedar::dyn::steps::HebbianConnection::inputConnectionChanged(const std::string& inputName)
@@ -274,8 +339,8 @@ cedar::proc::DataSlot::VALIDITY cedar::dyn::steps::HebbianConnection::determineI
 {
   if (cedar::aux::ConstMatDataPtr input = boost::dynamic_pointer_cast<const cedar::aux::MatData>(data))
   {
-    if (input && input->getDimensionality() == mAssociationDimension->getValue() && slot->getName() == mAssoInputName && (unsigned int) input->getData().rows == mWeightSizeX
-        && (unsigned int) input->getData().cols == mWeightSizeY)
+    if (input && input->getDimensionality() == mAssociationDimension->getValue() && slot->getName() == mAssoInputName
+        && input->getData().type() == CV_32F && input->getData().size == mConnectionWeights->getData().size)
     {
       return cedar::proc::DataSlot::VALIDITY_VALID;
     }
@@ -305,6 +370,11 @@ void cedar::dyn::steps::HebbianConnection::toggleUseReward()
   mRewardDuration->setConstant(!mUseRewardDuration->getValue());
 }
 
+void cedar::dyn::steps::HebbianConnection::toggleSparseUpdate()
+{
+  mSparseThreshold->setConstant(!mSparseUpdate->getValue());
+}
+
 void cedar::dyn::steps::HebbianConnection::toggleUseManualWeights()
 {
   if (mSetWeights->getValue())
@@ -324,9 +394,12 @@ unsigned int cedar::dyn::steps::HebbianConnection::getDimensionality()
 
 cv::Mat cedar::dyn::steps::HebbianConnection::getSizes()
 {
-  cv::Mat sizes = cv::Mat::zeros(2, 1, CV_32F);
-  sizes.at<float>(0, 0) = mWeightSizeX;
-  sizes.at<float>(1, 0) = mWeightSizeY;
+  const cv::Mat& weights = mConnectionWeights->getData();
+  cv::Mat sizes = cv::Mat::zeros(weights.dims, 1, CV_32F);
+  for (int dim = 0; dim < weights.dims; ++dim)
+  {
+    sizes.at<float>(dim, 0) = weights.size[dim];
+  }
   return sizes;
 }
 
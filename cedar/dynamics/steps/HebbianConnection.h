@@ -46,24 +46,21 @@
 #include "cedar/auxiliaries/UIntVectorParameter.h"
 #include "cedar/auxiliaries/BoolParameter.h"
 #include "cedar/auxiliaries/math/functions.h"
+#include "cedar/auxiliaries/math/Sigmoid.fwd.h"
 //#include <boost/enable_shared_from_this.hpp>
 
 #include "HebbianConnection.fwd.h"
 
 // SYSTEM INCLUDES
 
-/*!@brief   This is a static gain step that allows multiplying a matrix input with a factor.
+/*!@brief   Learns the projection from a node to a field of up to four dimensions with a Hebbian rule.
  *
- *          This step implements the cedar::proc::Step interface and allows a user to easily multiply any matrix with a
- *          gain factor. This step is called a static gain step because the gain factor is determined by a parameter,
- *          rather than being an input that might change over time.
+ *          While the reward signal is active, the weights move towards the activation of the target field:
+ *          weights += learning rate * sigmoid(source node) * (target field - weights). The weights are updated in place
+ *          in a single pass over memory. In sparse update mode, only the weights at which the target field exceeds the
+ *          sparse threshold are updated, i.e., weights of inactive locations are neither strengthened nor forgotten.
  *
- * @remarks This step declares the following interface:
- *          input - any matrix data
- *          output - the output, i.e., input multiplied by gainFactor
- *
- *          Parameters of the step are:
- *          gainFactor - the gain factor.
+ * @remarks While the source node is active, the learned output is the weight matrix; otherwise, it is zero.
  */
 class cedar::dyn::steps::HebbianConnection : public cedar::dyn::Dynamics
 //public boost::enable_shared_from_this<cedar::dyn::steps::HebbianConnection>
@@ -101,6 +98,7 @@ public slots:
  void resetWeights();
  void toggleUseReward();
  void toggleUseManualWeights();
+ void toggleSparseUpdate();
 
   //--------------------------------------------------------------------------------------------------------------------
   // protected methods
@@ -117,6 +115,9 @@ private:
 
   cv::Mat initializeWeightMatrix();
 
+  //!@brief Lets the learned output show either the weights or zeros; only assigns new data if this changes.
+  void updateWeightOutput(bool readOut);
+
   //!@brief Updates the output matrix.
   void eulerStep(const cedar::unit::Time& time);
 
@@ -141,6 +142,10 @@ protected:
   cedar::aux::DoubleVectorParameterPtr mWeightCenters;
   cedar::aux::DoubleVectorParameterPtr mWeightSigmas;
   cedar::aux::DoubleParameterPtr mWeightAmplitude;
+  //!@brief Whether only the weights at active locations of the target field are updated.
+  cedar::aux::BoolParameterPtr mSparseUpdate;
+  //!@brief The activation the target field has to exceed for a weight to be updated in sparse update mode.
+  cedar::aux::DoubleParameterPtr mSparseThreshold;
 
 private:
 
@@ -163,8 +168,11 @@ private:
   cedar::aux::ConstMatDataPtr mAssoInput;
   cedar::aux::ConstMatDataPtr mRewardTrigger;
   cedar::aux::ConstMatDataPtr mReadOutTrigger;
-  unsigned int mWeightSizeX;
-  unsigned int mWeightSizeY;
+
+  //! Sigmoid applied to the source node; created once instead of in every step.
+  cedar::aux::math::SigmoidPtr mNodeSigmoid;
+  //! Zeros of the size of the weights, shown as learned output while the source node is inactive.
+  cv::Mat mZeroWeights;
 };// class cedar::dyn::steps::ImprintHebb
 
 
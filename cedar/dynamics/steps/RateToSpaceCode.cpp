@@ -147,18 +147,18 @@ void cedar::dyn::RateToSpaceCode::compute(const cedar::proc::Arguments&)
 {
   // the result is simply input * gain.
   this->interpolate();
-  this->mOutput->setData
-                 (
-                   cedar::aux::math::gaussMatrix
-                   (
-                     mDimensionality,
-                     _mOutputSizes->getValue(),
-                     _mAmplitude->getValue(),
-                     _mSigmas->getValue(),
-                     mInterpolatedCenters,
-                     _mIsCyclic->getValue()
-                   )
-                 );
+  // write into the existing output; this only allocates if the output sizes changed
+  cedar::aux::math::gaussMatrix
+  (
+    mDimensionality,
+    _mOutputSizes->getValue(),
+    _mAmplitude->getValue(),
+    _mSigmas->getValue(),
+    mInterpolatedCenters,
+    _mIsCyclic->getValue(),
+    this->mOutput->getData(),
+    this->mGaussProfiles
+  );
 }
 
 void cedar::dyn::RateToSpaceCode::recompute()
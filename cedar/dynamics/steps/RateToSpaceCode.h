@@ -112,6 +112,8 @@ protected:
 private:
   unsigned int mDimensionality;
   std::vector<double> mInterpolatedCenters;
+  //! One-dimensional profiles of the output Gaussian; kept so that their memory is reused.
+  std::vector<cv::Mat> mGaussProfiles;
   //--------------------------------------------------------------------------------------------------------------------
   // parameters
   //--------------------------------------------------------------------------------------------------------------------
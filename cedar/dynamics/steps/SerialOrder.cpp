@@ -295,24 +295,25 @@ void cedar::dyn::SerialOrder::eulerStep(const cedar::unit::Time& time)
   CEDAR_ASSERT(mOrdinalNodes.size() == mMemoryNodes.size());
   CEDAR_ASSERT(mOrdinalNodes.size() == mOrdinalNodeOutputs.size());
 
+  // all nodes are single values (1x1 matrices), so the dynamics are computed on scalars; this avoids temporary matrices
+  const cedar::aux::math::TransferFunction& sigmoid = *this->_mSigmoid->getValue();
+
   // to implement the global inhibition between the ordinal and memory nodes, we need to sum up
   // all outputs of the ordinal layer
-  cv::Mat sum_of_ordinal_outputs = cv::Mat::zeros(1, 1, CV_32F);
+  float sum_of_ordinal_outputs = 0.0f;
 
   // go through all ordinal positions to compute the sigmoided output of all nodes
   for (unsigned int i = 0; i < mOrdinalNodes.size(); ++i)
   {
     // compute the sigmoided output of the ordinal nodes
-    cv::Mat& d = mOrdinalNodes.at(i)->getData();
-    cv::Mat& d_output = mOrdinalNodeOutputs.at(i)->getData();
-    d_output = _mSigmoid->getValue()->compute<float>(d);
+    float& d_output = mOrdinalNodeOutputs.at(i)->getData().at<float>(0, 0);
+    d_output = sigmoid.compute(mOrdinalNodes.at(i)->getData().at<float>(0, 0));
     // sum the outputs
     sum_of_ordinal_outputs += d_output;
 
     // compute the sigmoided output of the memory nodes
-    cv::Mat& dm = mMemoryNodes.at(i)->getData();
-    cv::Mat& dm_output = mMemoryNodeOutputs.at(i)->getData();
-    dm_output = _mSigmoid->getValue()->compute<float>(dm);
+    mMemoryNodeOutputs.at(i)->getData().at<float>(0, 0)
+      = sigmoid.compute(mMemoryNodes.at(i)->getData().at<float>(0, 0));
   }
 
   // go through all ordinal positions again, this time to do the actual Euler approximation
@@ -327,14 +328,16 @@ void cedar::dyn::SerialOrder::eulerStep(const cedar::unit::Time& time)
     const float& c1 = this->_mOrdinalNodeGlobalInhibitionWeight->getValue();
     const float& c2 = this->_mMemoryNodeToNextOrdinalNodeWeight->getValue();
     const float& c3 = this->_mMemoryNodeToSameOrdinalNodeWeight->getValue();
+    const float time_factor
+      = static_cast<float>(time / cedar::unit::Time(tau * cedar::unit::milli * cedar::unit::seconds));
 
     cv::Mat& f_d = mOrdinalNodeOutputs.at(i)->getData();
     cv::Mat& f_dm = mMemoryNodeOutputs.at(i)->getData();
 
     // compute the change rate of the ordinal node
-    cv::Mat d_dot = -d + h + c0 * f_d
-                    + c1 * (sum_of_ordinal_outputs - f_d)
-                    + c3 * f_dm;
+    float d_dot = -d.at<float>(0, 0) + h + c0 * f_d.at<float>(0, 0)
+                  + c1 * (sum_of_ordinal_outputs - f_d.at<float>(0, 0))
+                  + c3 * f_dm.at<float>(0, 0);
 
     // for the first ordinal position only
     if (i == 0)
@@ -344,16 +347,16 @@ void cedar::dyn::SerialOrder::eulerStep(const cedar::unit::Time& time)
     // for all other nodes
     else
     {
-      d_dot += c2 * mMemoryNodeOutputs.at(i-1)->getData();
+      d_dot += c2 * mMemoryNodeOutputs.at(i-1)->getData().at<float>(0, 0);
     }
 
     //!@todo explain that the expected input is positive (CoS signal)
     if (this->mCosSignalInput)
     {
-      d_dot -= this->mCosSignalInput->getData();
+      d_dot -= this->mCosSignalInput->getData().at<float>(0, 0);
     }
 
-    d += time / cedar::unit::Time(tau * cedar::unit::milli * cedar::unit::seconds) * d_dot;
+    d.at<float>(0, 0) += time_factor * d_dot;
 
     cv::Mat& dm = this->mMemoryNodes.at(i)->getData();
     const float& hm = this->_mMemoryNodeRestingLevel->getValue();
@@ -362,11 +365,11 @@ void cedar::dyn::SerialOrder::eulerStep(const cedar::unit::Time& time)
     const float& c6 = this->_mOrdinalNodeToSameMemoryNodeWeight->getValue(); // 2.6
 
     // compute the change rate of the memory node
-    cv::Mat dm_dot = -dm + hm + c4 * f_dm
-                    + c5 * (sum_of_ordinal_outputs - f_dm)
-                    + c6 * f_d;
+    float dm_dot = -dm.at<float>(0, 0) + hm + c4 * f_dm.at<float>(0, 0)
+                   + c5 * (sum_of_ordinal_outputs - f_dm.at<float>(0, 0))
+                   + c6 * f_d.at<float>(0, 0);
 
-    dm += time / cedar::unit::Time(tau * cedar::unit::milli * cedar::unit::seconds) * dm_dot;
+    dm.at<float>(0, 0) += time_factor * dm_dot;
 
     // save a copy of the output in the buffer
     //!@todo this is only needed because we don't have any nice way to plot all the discrete values yet
@@ -162,23 +162,25 @@ void cedar::dyn::SpaceCodeToRateMatrix::compute(const cedar::proc::Arguments&)
   unsigned int cols = static_cast<unsigned int>(this->mInput->getData().size[1]);
   cv::Mat& output = this->mOutput->getData();
   const cv::Mat& input = this->mInput->getData();
+  const cv::Mat& weights = this->mWeights->getData();
+  const int bins = input.size[2];
   output = 0.0;
 
   for (unsigned int row = 0; row < rows; ++row)
   {
     for (unsigned int col = 0; col < cols; ++col)
     {
-      std::vector<cv::Range> ranges(3, cv::Range::all());
-      ranges.at(0) = cv::Range(row, row + 1);
-      ranges.at(1) = cv::Range(col, col + 1);
-      cv::Mat temp_3d = input(&ranges.front()).clone();
-      cv::Mat temp = cv::Mat(input.size[2], 1, temp_3d.type(), temp_3d.data);
-      double min;
-      double max;
-      cv::Point min_loc;
-      cv::Point max_loc;
-      cv::minMaxLoc(temp, &min, &max, &min_loc, &max_loc);
-      output.at<float>(row,col) = this->mWeights->getData().at<float>(max_loc.y,0);
+      // the bins of one entry are contiguous in memory, so the maximum can be found without copying them
+      const float* bin_values = &input.at<float>(row, col, 0);
+      int max_bin = 0;
+      for (int bin = 1; bin < bins; ++bin)
+      {
+        if (bin_values[bin] > bin_values[max_bin])
+        {
+          max_bin = bin;
+        }
+      }
+      output.at<float>(row,col) = weights.at<float>(max_bin, 0);
     }
   }
 }
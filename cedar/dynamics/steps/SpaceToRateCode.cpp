@@ -216,7 +216,7 @@ void cedar::dyn::SpaceToRateCode::eulerStep(const cedar::unit::Time& time)
 {
   // the result is simply input * gain; see explanation above for variable names
   double s = cv::sum(this->mInput->getData()).val[0];
-  double o = cv::sum(this->mInput->getData().mul(mRamp)).val[0];
+  double o = this->mInput->getData().dot(mRamp); // same as sum(input .* ramp), but without a temporary matrix
   double dt = time / cedar::unit::Time(1.0 * cedar::unit::milli * cedar::unit::second);
   //!@todo use the time unit throughout the computation
   double tau = this->getTau() / cedar::unit::Time(1.0 * cedar::unit::milli * cedar::unit::second);
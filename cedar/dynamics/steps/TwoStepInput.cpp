@@ -284,11 +284,10 @@ void cedar::dyn::steps::TwoStepInput::eulerStep(const cedar::unit::Time& time)
             newPosY = newCenterY - (factor * (newCenterY - oldCenterY));
           }
 
-          std::vector<double> transientCenter;
-          transientCenter.push_back(newPosX);
-          transientCenter.push_back(newPosY);
-
-          curCenter = transientCenter;
+          // write the transient center in place so that no new vector has to be allocated
+          curCenter.resize(2);
+          curCenter.at(0) = newPosX;
+          curCenter.at(1) = newPosY;
 
 //        this->mOutput->setData(
 //            cedar::aux::math::gaussMatrix(_mDimensionality->getValue(), _mSizes->getValue(), _mAmplitude->getValue(),
@@ -299,10 +298,18 @@ void cedar::dyn::steps::TwoStepInput::eulerStep(const cedar::unit::Time& time)
       }
     }
 
-    auto setCenter = curCenter;
-    this->mOutput->setData(
-        cedar::aux::math::gaussMatrix(_mDimensionality->getValue(), _mSizes->getValue(), _mAmplitude->getValue(),
-            _mSigmas->getValue(), setCenter, _mIsCyclic->getValue()));
+    // the Gaussian only has to be recomputed if it changed since the last step
+    if (curCenter != mOutputCenter || _mSigmas->getValue() != mOutputSigmas || _mSizes->getValue() != mOutputSizes
+        || _mAmplitude->getValue() != mOutputAmplitude || _mIsCyclic->getValue() != mOutputIsCyclic)
+    {
+      cedar::aux::math::gaussMatrix(_mDimensionality->getValue(), _mSizes->getValue(), _mAmplitude->getValue(),
+          _mSigmas->getValue(), curCenter, _mIsCyclic->getValue(), this->mOutput->getData(), mGaussProfiles);
+      mOutputCenter = curCenter;
+      mOutputSigmas = _mSigmas->getValue();
+      mOutputSizes = _mSizes->getValue();
+      mOutputAmplitude = _mAmplitude->getValue();
+      mOutputIsCyclic = _mIsCyclic->getValue();
+    }
 
   }
   catch (std::out_of_range& exc)
@@ -375,6 +382,8 @@ void cedar::dyn::steps::TwoStepInput::updateMatrixSize()
   this->mOutput->setData(
       cedar::aux::math::gaussMatrix(_mDimensionality->getValue(), _mSizes->getValue(), _mAmplitude->getValue(),
           _mSigmas->getValue(), _mCenters->getValue(), _mIsCyclic->getValue()));
+  // the output no longer matches the cached parameters
+  mOutputCenter.clear();
   this->reset();
   //	this->unlock();
   //	this->emitOutputPropertiesChangedSignal("twostep");
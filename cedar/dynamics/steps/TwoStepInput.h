@@ -23,6 +23,8 @@
 #include "cedar/auxiliaries/MatData.fwd.h"
 
 // SYSTEM INCLUDES
+#include <opencv2/opencv.hpp>
+#include <vector>
 
 
 /*!@brief Generates a matrix with a Gaussian.
@@ -162,6 +164,15 @@ public:
 	bool isSwitch = false;
 
 	std::vector<double> curCenter;
+
+	//! The values the current output was computed with; the output is only recomputed if one of them changes.
+	std::vector<double> mOutputCenter;
+	std::vector<double> mOutputSigmas;
+	std::vector<unsigned int> mOutputSizes;
+	double mOutputAmplitude = 0.0;
+	bool mOutputIsCyclic = false;
+	//! One-dimensional profiles of the output Gaussian; kept so that their memory is reused.
+	std::vector<cv::Mat> mGaussProfiles;
 	private:
 
 
@@ -201,6 +201,8 @@ void cedar::proc::Connectable::callOutputConnectionRemoved(cedar::proc::DataSlot
 
 void cedar::proc::Connectable::revalidateInputSlot(const std::string& slot)
 {
+  // the connected data may have been resized without a new revision; make sure pure steps recompute
+  this->getInputSlot(slot)->markConnectionChanged();
   this->getInputSlot(slot)->setValidity(cedar::proc::DataSlot::VALIDITY_UNKNOWN);
   this->inputConnectionChanged(slot);
   this->signalInputConnectionChanged(slot);
@@ -317,7 +319,7 @@ void cedar::proc::Connectable::removeSlot(DataRole::Id role, const std::string&
 
   if (slot->getData())
   {
-    this->removeLock(slot->getData(), slot->getLockType(), this->getLockSetForRole(role));
+    this->removeLock(slot->getData(), slot->getLockTypeFor(slot->getData()), this->getLockSetForRole(role));
   }
 
   // also delete the slot from the ordered list of slots
@@ -458,6 +460,10 @@ void cedar::proc::Connectable::callInputConnectionChangedFor(cedar::proc::DataSl
 {
   if (auto slot_shared = slot.lock())
   {
+    if (auto external = boost::dynamic_pointer_cast<cedar::proc::ExternalData>(slot_shared))
+    {
+      external->markConnectionChanged();
+    }
     this->inputConnectionChanged(slot_shared->getName());
     this->signalInputConnectionChanged(slot_shared->getName());
   }
@@ -782,11 +788,11 @@ cedar::proc::DataSlotPtr cedar::proc::Connectable::declareData
   (
     boost::bind
     (
-      &cedar::proc::Connectable::removeLock,
+      &cedar::proc::Connectable::dataRemovedFromSlot,
       this,
-      _1,
-      slot_ptr->getLockType(),
-      this->getLockSetForRole(role)
+      role,
+      slot_ptr,
+      _1
     )
   );
 
@@ -1032,7 +1038,22 @@ void cedar::proc::Connectable::dataAddedToSlot(DataRole::Id role, cedar::proc::D
   auto slot = slotWeak.lock();
   CEDAR_ASSERT(slot);
 
-  this->addLock(&data->getLock(), slot->getLockType(), this->getLockSetForRole(role));
+  this->addLock(&data->getLock(), slot->getLockTypeFor(data), this->getLockSetForRole(role));
+}
+
+void cedar::proc::Connectable::dataRemovedFromSlot
+     (
+       DataRole::Id role,
+       cedar::proc::DataSlotWeakPtr slotWeak,
+       cedar::aux::ConstDataPtr data
+     )
+{
+  auto slot = slotWeak.lock();
+  CEDAR_ASSERT(slot);
+
+  // the lock type depends on the data (see cedar::proc::DataSlot::getLockTypeFor), so it is determined here rather
+  // than when connecting to the signal
+  this->removeLock(data, slot->getLockTypeFor(data), this->getLockSetForRole(role));
 }
 
 /*
@@ -422,6 +422,8 @@ private:
 
   void dataAddedToSlot(DataRole::Id role, cedar::proc::DataSlotWeakPtr slotWeak, cedar::aux::ConstDataPtr data);
 
+  void dataRemovedFromSlot(DataRole::Id role, cedar::proc::DataSlotWeakPtr slotWeak, cedar::aux::ConstDataPtr data);
+
   //!@brief Removes a slot from the connectable.
   void removeSlot(DataRole::Id role, const std::string& name);
 
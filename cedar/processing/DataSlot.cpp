@@ -141,6 +141,11 @@ bool cedar::proc::DataSlot::hasValidityCheck() const
   return !this->getCheck().empty();
 }
 
+cedar::aux::LOCK_TYPE cedar::proc::DataSlot::getLockTypeFor(cedar::aux::ConstDataPtr /* data */) const
+{
+  return this->getLockType();
+}
+
 cedar::proc::DataSlot::VALIDITY cedar::proc::DataSlot::checkValidityOf(cedar::aux::ConstDataPtr data) const
 {
   if (!this->hasValidityCheck())
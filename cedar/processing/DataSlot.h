@@ -185,6 +185,9 @@ public:
   //! Returns the lock type for this data slot.
   virtual cedar::aux::LOCK_TYPE getLockType() const = 0;
 
+  //! Returns the lock type with which the given data, stored in this slot, is locked. Defaults to getLockType().
+  virtual cedar::aux::LOCK_TYPE getLockTypeFor(cedar::aux::ConstDataPtr data) const;
+
   /*! @brief Marks the data slot as serializable.
    *
    *         Serializable data slots are automatically written to architectures, and can be read and written from
@@ -37,6 +37,7 @@
 // CEDAR INCLUDES
 #include "cedar/processing/ExternalData.h"
 #include "cedar/processing/exceptions.h"
+#include "cedar/auxiliaries/MatData.h"
 #include "cedar/auxiliaries/assert.h"
 
 // SYSTEM INCLUDES
@@ -53,7 +54,9 @@ cedar::proc::ExternalData::ExternalData(
                                        )
 :
 cedar::proc::DataSlot(role, name, pParent, isMandatory),
-mIsCollection(false)
+mIsCollection(false),
+mReadsSnapshots(false),
+mConnectionRevision(0)
 {
 }
 
@@ -70,6 +73,46 @@ cedar::aux::LOCK_TYPE cedar::proc::ExternalData::getLockType() const
   return cedar::aux::LOCK_TYPE_READ;
 }
 
+cedar::aux::LOCK_TYPE cedar::proc::ExternalData::getLockTypeFor(cedar::aux::ConstDataPtr data) const
+{
+  if (this->mReadsSnapshots)
+  {
+    auto mat_data = boost::dynamic_pointer_cast<const cedar::aux::MatData>(data);
+    if (mat_data && mat_data->isPublishing())
+    {
+      return cedar::aux::LOCK_TYPE_DONT_LOCK;
+    }
+  }
+  return this->getLockType();
+}
+
+void cedar::proc::ExternalData::setReadsSnapshots(bool readsSnapshots)
+{
+  this->mReadsSnapshots = readsSnapshots;
+}
+
+bool cedar::proc::ExternalData::readsSnapshots() const
+{
+  return this->mReadsSnapshots;
+}
+
+void cedar::proc::ExternalData::appendRevisions(std::vector<unsigned long>& revisions) const
+{
+  revisions.push_back(this->mConnectionRevision.load(std::memory_order_acquire));
+  for (const auto& weak_data : this->mData)
+  {
+    if (auto data = weak_data.lock())
+    {
+      revisions.push_back(data->getRevision());
+    }
+  }
+}
+
+void cedar::proc::ExternalData::markConnectionChanged()
+{
+  this->mConnectionRevision.fetch_add(1, std::memory_order_acq_rel);
+}
+
 void cedar::proc::ExternalData::setCollection(bool isCollection)
 {
   CEDAR_ASSERT(this->getRole() == cedar::proc::DataRole::INPUT);
@@ -137,6 +180,7 @@ void cedar::proc::ExternalData::removeDataInternal(cedar::aux::DataPtr data)
 
   // Erase the data.
   this->mData.erase(iter);
+  this->markConnectionChanged();
 }
 
 void cedar::proc::ExternalData::addDataInternal(cedar::aux::DataPtr data)
@@ -154,6 +198,7 @@ void cedar::proc::ExternalData::addDataInternal(cedar::aux::DataPtr data)
   }
   // if there was no free slot, create one
   this->mData.push_back(data);
+  this->markConnectionChanged();
 }
 
 void cedar::proc::ExternalData::setDataInternal(cedar::aux::DataPtr data)
@@ -192,6 +237,7 @@ void cedar::proc::ExternalData::setDataInternal(cedar::aux::DataPtr data, unsign
   }
 
   this->mData.at(index) = data;
+  this->markConnectionChanged();
 }
 
 cedar::aux::DataPtr cedar::proc::ExternalData::getData()
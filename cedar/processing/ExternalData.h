@@ -50,6 +50,7 @@
   #include <boost/function.hpp>
 #endif
 #include <vector>
+#include <atomic>
 
 /*!@brief   A slot for data that is not owned by a Connectable.
  *
@@ -129,6 +130,32 @@ public:
   //!@brief Returns the lock type.
   cedar::aux::LOCK_TYPE getLockType() const;
 
+  //!@brief Returns the lock type for the given data; publishing matrices are not locked if snapshots are read.
+  cedar::aux::LOCK_TYPE getLockTypeFor(cedar::aux::ConstDataPtr data) const;
+
+  /*!@brief Sets whether the owner of this slot reads publishing matrix data only through snapshots.
+   *
+   *         If so, cedar::aux::MatData that is in publishing mode is not locked when the owning step computes. The
+   *         step must then only access it via cedar::aux::MatData::getSnapshot.
+   *
+   * @remarks Set this before any data is connected, usually when declaring the input.
+   */
+  void setReadsSnapshots(bool readsSnapshots);
+
+  //!@brief Returns whether the owner of this slot reads publishing matrix data only through snapshots.
+  bool readsSnapshots() const;
+
+  /*!@brief Appends the revision of this slot's connections and the revisions of all its data to the given list.
+   *
+   *        Data passed along a cedar::proc::DataConnection is the very object owned by the source step, so its
+   *        revision (see cedar::aux::Data::getRevision) arrives here unchanged. If two lists collected from this slot
+   *        are equal, neither the connected data nor the data itself changed in between.
+   */
+  void appendRevisions(std::vector<unsigned long>& revisions) const;
+
+  //!@brief Increases the connection revision, e.g., when the properties of the connected data changed.
+  void markConnectionChanged();
+
   //!@brief Adds an incoming connection to the list of connections to this slot
   void addIncomingConnection(cedar::proc::DataConnectionPtr newConnection);
 
@@ -177,6 +204,12 @@ private:
 
   //!@brief Whether this slot can have multiple data items.
   bool mIsCollection;
+
+  //!@brief Whether publishing matrix data in this slot is read through snapshots rather than under a lock.
+  bool mReadsSnapshots;
+
+  //!@brief Increases whenever data is set in or removed from this slot.
+  std::atomic<unsigned long> mConnectionRevision;
 }; // class cedar::proc::ExternalData
 
 #endif // CEDAR_PROC_EXTERNAL_DATA_H
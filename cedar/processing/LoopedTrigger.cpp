@@ -50,10 +50,13 @@
 #include "cedar/units/prefixes.h"
 #include "cedar/auxiliaries/GlobalClock.h"
 #include "cedar/auxiliaries/MovingAverage.h"
+#include "cedar/auxiliaries/Tracer.h"
 
 // SYSTEM INCLUDES
 #include <QApplication>
 #include <algorithm>
+#include <map>
+#include <set>
 
 //----------------------------------------------------------------------------------------------------------------------
 // register the trigger class
@@ -207,15 +210,82 @@ void cedar::proc::LoopedTrigger::processQuit()
 
 void cedar::proc::LoopedTrigger::step(cedar::unit::Time time)
 {
+  // the trace event is only prepared while tracing, so that untraced steps only read the flag
+  bool tracing = cedar::aux::Tracer::isEnabled();
+  boost::posix_time::ptime trace_begin;
+  if (tracing)
+  {
+    trace_begin = boost::posix_time::microsec_clock::universal_time();
+  }
+
   cedar::proc::ArgumentsPtr arguments(new cedar::proc::StepTime(time));
 
   QReadLocker locker(this->mListeners.getLockPtr());
   auto this_ptr = boost::static_pointer_cast<cedar::proc::LoopedTrigger>(this->shared_from_this());
-  for (const auto& listener : this->mListeners.member())
+  if (this->isParallelExecutionEnabled() && this->mListeners.member().size() > 1)
   {
-    listener->onTrigger(arguments, this_ptr);
+    this->triggerListenersInParallel(arguments, this_ptr);
+  }
+  else
+  {
+    for (const auto& listener : this->mListeners.member())
+    {
+      listener->onTrigger(arguments, this_ptr);
+    }
   }
   this->mStatistics->append(time);
+
+  if (tracing)
+  {
+    cedar::aux::Tracer::record
+    (
+      "trigger",
+      this->getName(),
+      std::string(),
+      trace_begin,
+      boost::posix_time::microsec_clock::universal_time()
+    );
+  }
+}
+
+void cedar::proc::LoopedTrigger::triggerListenersInParallel
+     (
+       cedar::proc::ArgumentsPtr arguments,
+       cedar::proc::TriggerPtr sender
+     )
+{
+  // group the listeners by their depth; the triggering order also contains the triggerables that the listeners trigger
+  // in turn, and these are left to the listeners' own triggers
+  std::map<unsigned int, std::set<cedar::proc::TriggerablePtr> > levels;
+  {
+    QReadLocker order_locker(this->mTriggeringOrder.getLockPtr());
+    for (const auto& listener : this->mListeners.member())
+    {
+      unsigned int depth = 0;
+      for (const auto& order_triggerables_pair : this->mTriggeringOrder.member())
+      {
+        if (order_triggerables_pair.second.find(listener) != order_triggerables_pair.second.end())
+        {
+          depth = order_triggerables_pair.first;
+          break;
+        }
+      }
+      levels[depth].insert(listener);
+    }
+  }
+
+  for (const auto& depth_listeners_pair : levels)
+  {
+    const auto& listeners = depth_listeners_pair.second;
+    if (listeners.size() > 1)
+    {
+      this->triggerInParallel(listeners, arguments, sender);
+    }
+    else
+    {
+      (*listeners.begin())->onTrigger(arguments, sender);
+    }
+  }
 }
 
 cedar::proc::LoopedTrigger::ConstTimeAveragePtr cedar::proc::LoopedTrigger::getStatistics() const
@@ -156,6 +156,12 @@ private:
   //! Called when the trigger is started.
   void processQuit();
 
+  /*! Triggers the listeners level by level, handing each level of the triggering order to the thread pool.
+   *
+   *  The caller has to hold the read lock of the listeners.
+   */
+  void triggerListenersInParallel(cedar::proc::ArgumentsPtr arguments, cedar::proc::TriggerPtr sender);
+
   //--------------------------------------------------------------------------------------------------------------------
   // members
   //--------------------------------------------------------------------------------------------------------------------
@@ -42,15 +42,20 @@
 #include "cedar/processing/sources/GroupSource.h"
 #include "cedar/processing/Step.h"
 #include "cedar/processing/Arguments.h"
+#include "cedar/processing/ExternalData.h"
 #include "cedar/processing/exceptions.h"
 #include "cedar/processing/Group.h"
 #include "cedar/processing/Trigger.h"
 #include "cedar/processing/LoopedTrigger.h"
 #include "cedar/auxiliaries/BoolParameter.h"
+#include "cedar/auxiliaries/Parameter.h"
 #include "cedar/auxiliaries/systemFunctions.h"
 #include "cedar/auxiliaries/assert.h"
 #include "cedar/auxiliaries/stringFunctions.h"
 #include "cedar/auxiliaries/Log.h"
+#include "cedar/auxiliaries/MatData.h"
+#include "cedar/auxiliaries/Tracer.h"
+#include "cedar/auxiliaries/AllocationCounter.h"
 #include "cedar/units/Time.h"
 #include "cedar/units/prefixes.h"
 #include "cedar/defines.h"
@@ -76,6 +81,29 @@
 // Check for NaNs after every compute call
 //#define CEDAR_ENABLE_NAN_CHECK
 
+//----------------------------------------------------------------------------------------------------------------------
+// helpers
+//----------------------------------------------------------------------------------------------------------------------
+
+namespace
+{
+  //! Writes a name for the trigger that caused a step to run into the given string, for tracing.
+  void write_trace_name_of(cedar::proc::TriggerPtr trigger, std::string& name)
+  {
+    name.clear();
+    if (!trigger)
+    {
+      return;
+    }
+
+    if (auto owner = dynamic_cast<cedar::proc::Element*>(trigger->getOwner()))
+    {
+      name.append(owner->getName()).append(1, '.');
+    }
+    name.append(trigger->getName());
+  }
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 // constructors and destructor
 //----------------------------------------------------------------------------------------------------------------------
@@ -83,7 +111,12 @@ cedar::proc::Step::Step(bool isLooped)
 :
 Triggerable(isLooped),
 // initialize parameters
-mAutoLockInputsAndOutputs(true)
+mAutoLockInputsAndOutputs(true),
+mIsPure(false),
+mComputeRequired(true),
+mSkippedComputeCalls(0),
+mLastComputeAllocations(0),
+mComputeAllocations(cedar::aux::MovingAverage<double>(100))
 {
   this->mComputeTimeId = this->registerTimeMeasurement("compute call");
   this->mLockingTimeId = this->registerTimeMeasurement("locking");
@@ -96,6 +129,13 @@ mAutoLockInputsAndOutputs(true)
   // When the name changes, we need to tell the manager about this.
   QObject::connect(this->_mName.get(), SIGNAL(valueChanged()), this, SLOT(onNameChanged()));
 
+  // any parameter change may change the outputs of pure steps, including parameters declared by subclasses
+  for (auto parameter : this->getParameters())
+  {
+    this->connectToParameter(parameter);
+  }
+  this->connectToParameterAddedSignal(boost::bind(&cedar::proc::Step::connectToParameter, this, _1));
+
   //this->registerFunction("reset", boost::bind(&cedar::proc::Step::callReset, this), false);
 }
 
@@ -179,6 +219,8 @@ void cedar::proc::Step::callReset()
 
   // reset the step
   this->reset();
+  this->invalidateCompute();
+  this->commitData();
 
   // unlock everything
   locker.unlock();
@@ -186,6 +228,142 @@ void cedar::proc::Step::callReset()
   this->getFinishedTrigger()->trigger();
 }
 
+void cedar::proc::Step::commitData()
+{
+  for (auto role : {cedar::proc::DataRole::BUFFER, cedar::proc::DataRole::OUTPUT})
+  {
+    if (!this->hasSlotForRole(role))
+    {
+      continue;
+    }
+
+    for (const auto& slot : this->getOrderedDataSlots(role))
+    {
+      auto data = slot->getData();
+      if (!data || !data->commitChanges())
+      {
+        continue;
+      }
+
+      auto mat_data = boost::dynamic_pointer_cast<cedar::aux::MatData>(data);
+      if (!mat_data || !mat_data->isPublishing())
+      {
+        continue;
+      }
+
+      if (this->mAutoLockInputsAndOutputs || role == cedar::proc::DataRole::BUFFER)
+      {
+        // the step lock already holds the write lock of this data
+        mat_data->publish();
+      }
+      else
+      {
+        QReadLocker locker(&mat_data->getLock());
+        mat_data->publish();
+      }
+    }
+  }
+}
+
+void cedar::proc::Step::markDataUnchanged()
+{
+  for (auto role : {cedar::proc::DataRole::BUFFER, cedar::proc::DataRole::OUTPUT})
+  {
+    if (!this->hasSlotForRole(role))
+    {
+      continue;
+    }
+
+    for (const auto& slot : this->getOrderedDataSlots(role))
+    {
+      if (auto data = slot->getData())
+      {
+        data->markUnchanged();
+      }
+    }
+  }
+}
+
+bool cedar::proc::Step::canSkipCompute()
+{
+  if (!this->mIsPure)
+  {
+    return false;
+  }
+
+  this->mCurrentInputRevisions.clear();
+  if (this->hasSlotForRole(cedar::proc::DataRole::INPUT))
+  {
+    for (const auto& slot : this->getOrderedDataSlots(cedar::proc::DataRole::INPUT))
+    {
+      if (auto external = boost::dynamic_pointer_cast<cedar::proc::ExternalData>(slot))
+      {
+        external->appendRevisions(this->mCurrentInputRevisions);
+      }
+    }
+  }
+
+  bool compute_required = this->mComputeRequired.exchange(false);
+  bool unchanged = !compute_required && this->mCurrentInputRevisions == this->mLastInputRevisions;
+  this->mLastInputRevisions.swap(this->mCurrentInputRevisions);
+  return unchanged;
+}
+
+void cedar::proc::Step::setPure(bool pure)
+{
+  this->mIsPure = pure;
+  this->invalidateCompute();
+}
+
+bool cedar::proc::Step::isPure() const
+{
+  return this->mIsPure;
+}
+
+void cedar::proc::Step::invalidateCompute()
+{
+  this->mComputeRequired = true;
+}
+
+unsigned long cedar::proc::Step::getNumberOfSkippedComputeCalls() const
+{
+  return this->mSkippedComputeCalls;
+}
+
+bool cedar::proc::Step::hasAllocationMeasurement() const
+{
+  QReadLocker locker(this->mComputeAllocations.getLockPtr());
+  return this->mComputeAllocations.member().size() > 0;
+}
+
+unsigned long cedar::proc::Step::getLastComputeAllocations() const
+{
+  return this->mLastComputeAllocations;
+}
+
+double cedar::proc::Step::getComputeAllocationsAverage() const
+{
+  QReadLocker locker(this->mComputeAllocations.getLockPtr());
+  if (this->mComputeAllocations.member().size() > 0)
+  {
+    return this->mComputeAllocations.member().getAverage();
+  }
+  else
+  {
+    CEDAR_THROW(cedar::proc::NoMeasurementException, "No measurements, yet.");
+  }
+}
+
+void cedar::proc::Step::connectToParameter(cedar::aux::ParameterPtr parameter)
+{
+  QObject::connect(parameter.get(), SIGNAL(valueChanged()), this, SLOT(parameterValueChanged()));
+}
+
+void cedar::proc::Step::parameterValueChanged()
+{
+  this->invalidateCompute();
+}
+
 void cedar::proc::Step::reset()
 {
   // empty as default implementation
@@ -244,6 +422,9 @@ void cedar::proc::Step::callAction(const std::string& name)
 
   // call it
   function();
+
+  // actions may change what a pure step computes
+  this->invalidateCompute();
 }
 
 const cedar::proc::Step::ActionMap& cedar::proc::Step::getActions() const
@@ -376,9 +557,18 @@ void cedar::proc::Step::onTrigger(cedar::proc::ArgumentsPtr arguments, cedar::pr
   // start measuring the execution time.
   boost::posix_time::ptime run_start = boost::posix_time::microsec_clock::universal_time();
 
+  // count the heap allocations of the compute call (only does something when built with CEDAR_COUNT_ALLOCATIONS)
+  cedar::aux::AllocationCounter allocation_counter;
+
   try
   {
-    if (arguments.get() != nullptr)
+    if (this->canSkipCompute())
+    {
+      // a pure step would compute the same outputs again; keep their revisions so pure steps further down skip, too
+      this->markDataUnchanged();
+      ++this->mSkippedComputeCalls;
+    }
+    else if (arguments.get() != nullptr)
     {
       // call the compute function with the given arguments
       this->compute(*(arguments.get()));
@@ -412,6 +602,8 @@ void cedar::proc::Step::onTrigger(cedar::proc::ArgumentsPtr arguments, cedar::pr
       this->getName()
     );
     this->setState(cedar::proc::Triggerable::STATE_EXCEPTION, "An exception occurred:\n" + e.exceptionInfo());
+    // canSkipCompute already recorded these inputs as computed
+    this->invalidateCompute();
   }
   catch(const std::exception& e)
   {
@@ -422,6 +614,7 @@ void cedar::proc::Step::onTrigger(cedar::proc::ArgumentsPtr arguments, cedar::pr
       this->getName()
     );
     this->setState(cedar::proc::Triggerable::STATE_EXCEPTION, "An exception occurred:\n" + std::string(e.what()));
+    this->invalidateCompute();
   }
   catch(...)
   {
@@ -432,8 +625,10 @@ void cedar::proc::Step::onTrigger(cedar::proc::ArgumentsPtr arguments, cedar::pr
       this->getName()
     );
     this->setState(cedar::proc::Triggerable::STATE_EXCEPTION, "An unknown exception type occurred.");
+    this->invalidateCompute();
   }
 
+  unsigned long allocations = allocation_counter.getCount();
   boost::posix_time::ptime run_end = boost::posix_time::microsec_clock::universal_time();
   boost::posix_time::time_duration run_elapsed = run_end - run_start;
   cedar::unit::Time run_elapsed_s(run_elapsed.total_microseconds() * cedar::unit::micro * cedar::unit::seconds);
@@ -441,6 +636,21 @@ void cedar::proc::Step::onTrigger(cedar::proc::ArgumentsPtr arguments, cedar::pr
   // take time measurements
   this->setRunTimeMeasurement(run_elapsed_s);
 
+  if (cedar::aux::AllocationCounter::isEnabled())
+  {
+    this->mLastComputeAllocations = allocations;
+    QWriteLocker locker(this->mComputeAllocations.getLockPtr());
+    this->mComputeAllocations.member().append(static_cast<double>(allocations));
+  }
+
+  if (cedar::aux::Tracer::isEnabled())
+  {
+    // the lock events are told apart from the step events by their category, so the name needs no suffix
+    write_trace_name_of(trigger, this->mTraceTriggerName);
+    cedar::aux::Tracer::record("step", this->getName(), this->mTraceTriggerName, lock_start, run_end);
+    cedar::aux::Tracer::record("lock", this->getName(), this->mTraceTriggerName, lock_start, lock_end);
+  }
+
 #ifdef CEDAR_ENABLE_NAN_CHECK
   if (this->hasSlotForRole(cedar::proc::DataRole::OUTPUT))
   {
@@ -462,6 +672,9 @@ void cedar::proc::Step::onTrigger(cedar::proc::ArgumentsPtr arguments, cedar::pr
   }
 #endif // CEDAR_ENABLE_NAN_CHECK
 
+  // count the changes of the outputs and make the new values visible to readers of snapshots
+  this->commitData();
+
   // unlock the step
   step_locker.unlock();
 
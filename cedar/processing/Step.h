@@ -51,6 +51,7 @@
 
 // FORWARD DECLARATIONS
 #include "cedar/auxiliaries/BoolParameter.fwd.h"
+#include "cedar/auxiliaries/Parameter.fwd.h"
 #include "cedar/processing/Trigger.fwd.h"
 #include "cedar/processing/Step.fwd.h"
 
@@ -74,6 +75,7 @@
 #include <utility>
 #include <vector>
 #include <deque>
+#include <atomic>
 
 
 /*!@brief This class represents a processing step in the processing framework.
@@ -298,10 +300,31 @@ public:
 
   void emitOutputPropertiesChangedSignal(const std::string& slot);
 
+  //! Returns whether the step declared that its outputs depend only on its inputs and parameters (see setPure).
+  bool isPure() const;
+
+  //! Returns how often compute was skipped because nothing this pure step depends on had changed.
+  unsigned long getNumberOfSkippedComputeCalls() const;
+
+  /*!@brief True if the heap allocations of the compute calls are counted, i.e., if cedar was built with
+   *        CEDAR_COUNT_ALLOCATIONS and the step has been computed at least once.
+   */
+  bool hasAllocationMeasurement() const;
+
+  //! Returns the number of heap allocations made during the last compute call.
+  unsigned long getLastComputeAllocations() const;
+
+  //! Returns the average number of heap allocations made during the recent compute calls.
+  double getComputeAllocationsAverage() const;
+
 public slots:
   //!@brief This slot is called when the step's name is changed.
   void onNameChanged();
 
+private slots:
+  //! Makes pure steps recompute after one of their parameters changed.
+  void parameterValueChanged();
+
 signals:
   //!@brief Signal that is emitted whenever the step's name is changed.
   void nameChanged();
@@ -386,6 +409,21 @@ protected:
    */
   void setAutoLockInputsAndOutputs(bool autoLock);
 
+  /*!@brief Declares whether the outputs of this step depend only on its inputs and parameters.
+   *
+   *        When a pure step is triggered while neither the revisions of its inputs (see cedar::aux::Data::getRevision)
+   *        nor any of its parameters changed since its last compute call, compute is skipped and the outputs keep
+   *        their revisions, so pure steps further down can skip as well. Steps with internal state, time dependence
+   *        or side effects must not be pure.
+   *
+   *        @remarks Call this from the constructor. If the outputs also depend on something else, e.g., on kernels
+   *                 held in object parameters, call invalidateCompute whenever that changes.
+   */
+  void setPure(bool pure);
+
+  //! Makes the next trigger call compute, even if the step is pure and nothing it depends on has changed.
+  void invalidateCompute();
+
   /*!@brief Locks the data and parameters of the step.
    *
    * @remarks Usually, this should only be called automatically.
@@ -460,6 +498,26 @@ private:
   //! Processes all slots that have been changed during the compute call.
   void processChangedSlots();
 
+  /*!@brief Commits the changes of all buffers and outputs (see cedar::aux::Data::commitChanges).
+   *
+   *        Changed cedar::aux::MatData in publishing mode is also published. Called after each compute and reset call,
+   *        while the step is still locked.
+   */
+  void commitData();
+
+  //! Marks all buffers and outputs as unchanged.
+  void markDataUnchanged();
+
+  /*!@brief Returns true if the step is pure and nothing it depends on changed since the last call.
+   *
+   *        Records the current input revisions for the next call; run() invalidates the compute again if the
+   *        following compute call throws, so that the next trigger retries it.
+   */
+  bool canSkipCompute();
+
+  //! Connects the parameter so that changing it makes pure steps recompute.
+  void connectToParameter(cedar::aux::ParameterPtr parameter);
+
   //--------------------------------------------------------------------------------------------------------------------
   // members
   //--------------------------------------------------------------------------------------------------------------------
@@ -504,6 +562,30 @@ private:
 
   double mNumberOfStepsMissed;
 
+  //! Whether the outputs of this step depend only on its inputs and parameters.
+  std::atomic<bool> mIsPure;
+
+  //! Whether something other than the inputs changed since the last compute call, e.g., a parameter.
+  std::atomic<bool> mComputeRequired;
+
+  //! Number of compute calls skipped because nothing changed.
+  std::atomic<unsigned long> mSkippedComputeCalls;
+
+  //! Heap allocations made during the last compute call; only counted when built with CEDAR_COUNT_ALLOCATIONS.
+  std::atomic<unsigned long> mLastComputeAllocations;
+
+  //! Moving average of the heap allocations made during compute calls.
+  cedar::aux::LockableMember<cedar::aux::MovingAverage<double> > mComputeAllocations;
+
+  //! Input revisions at the time of the last compute call; only used while the step is busy.
+  std::vector<unsigned long> mLastInputRevisions;
+
+  //! Scratch buffer for the current input revisions, kept to avoid allocations in each trigger call.
+  std::vector<unsigned long> mCurrentInputRevisions;
+
+  //! Scratch buffer for the name of the trigger recorded in trace events; only used while the step is busy.
+  std::string mTraceTriggerName;
+
   //--------------------------------------------------------------------------------------------------------------------
   // parameters
   //--------------------------------------------------------------------------------------------------------------------
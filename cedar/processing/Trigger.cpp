@@ -56,6 +56,13 @@
 // SYSTEM INCLUDES
 #include <QReadLocker>
 #include <QWriteLocker>
+#ifdef CEDAR_USE_QT5
+  #include <QtConcurrent/QtConcurrentRun>
+#else
+  #include <QtConcurrentRun>
+#endif
+#include <QFuture>
+#include <boost/bind.hpp>
 #include <algorithm>
 #include <string>
 #include <iostream>
@@ -74,7 +81,8 @@
 cedar::proc::Trigger::Trigger(const std::string& name, bool isLooped)
 :
 Triggerable(isLooped),
-mpOwner(nullptr)
+mpOwner(nullptr),
+_mParallelExecution(new cedar::aux::BoolParameter(this, "parallel execution", false))
 {
   cedar::aux::LogSingleton::getInstance()->allocating(this);
 
@@ -154,6 +162,18 @@ size_t cedar::proc::Trigger::getTriggerCount() const
   return count;
 }
 
+void cedar::proc::Trigger::setParallelExecution(bool parallel)
+{
+  this->_mParallelExecution->setValue(parallel, true);
+}
+
+bool cedar::proc::Trigger::isParallelExecutionEnabled() const
+{
+  cedar::aux::Parameter::ReadLocker locker(this->_mParallelExecution);
+  bool copy = this->_mParallelExecution->getValue();
+  return copy;
+}
+
 bool cedar::proc::Trigger::canTrigger(cedar::proc::TriggerablePtr target) const
 {
   std::string reason;
@@ -784,9 +804,19 @@ void cedar::proc::Trigger::trigger(cedar::proc::ArgumentsPtr arguments)
 /* DEBUG_TRIGGERING */  std::cout << "> Triggering " << nameTrigger(this) << std::endl;
 #endif
 
-  for (auto order_triggerables_pair : this->mTriggeringOrder.member())
+  bool parallel = this->isParallelExecutionEnabled();
+
+  for (const auto& order_triggerables_pair : this->mTriggeringOrder.member())
   {
-    auto triggerables = order_triggerables_pair.second;
+    const auto& triggerables = order_triggerables_pair.second;
+
+    // triggerables with the same depth do not depend on each other; the next level only starts once all are done
+    if (parallel && triggerables.size() > 1)
+    {
+      this->triggerInParallel(triggerables, arguments, this_ptr);
+      continue;
+    }
+
     for (cedar::proc::TriggerablePtr triggerable : triggerables)
     {
 #ifdef DEBUG_TRIGGERING
@@ -809,6 +839,54 @@ void cedar::proc::Trigger::onTrigger(cedar::proc::ArgumentsPtr, cedar::proc::Tri
 {
 }
 
+void cedar::proc::Trigger::triggerInParallel
+     (
+       const std::set<cedar::proc::TriggerablePtr>& triggerables,
+       cedar::proc::ArgumentsPtr arguments,
+       cedar::proc::TriggerPtr sender
+     )
+{
+  std::vector<QFuture<void> > results;
+  results.reserve(triggerables.size() - 1);
+
+  auto last = triggerables.end();
+  --last;
+  for (auto iter = triggerables.begin(); iter != last; ++iter)
+  {
+#ifdef DEBUG_TRIGGERING
+/* DEBUG_TRIGGERING */ std::cout << "  > Triggering chain item in parallel " << nameTriggerable(*iter) << std::endl;
+#endif
+    results.push_back
+    (
+      QtConcurrent::run(boost::bind(&cedar::proc::Triggerable::onTrigger, *iter, arguments, sender))
+    );
+  }
+
+  // barrier; waiting on a future that has not been started yet runs it in this thread, so nested parallel triggers
+  // cannot exhaust the thread pool
+  auto wait_for_listeners = [&results]()
+  {
+    for (auto& result : results)
+    {
+      result.waitForFinished();
+    }
+  };
+
+  // the calling thread takes over the last triggerable instead of idling
+  try
+  {
+    (*last)->onTrigger(arguments, sender);
+  }
+  catch (...)
+  {
+    // no listener may still run once the caller has moved on and released its locks
+    wait_for_listeners();
+    throw;
+  }
+
+  wait_for_listeners();
+}
+
 void cedar::proc::Trigger::addListener(cedar::proc::TriggerablePtr triggerable)
 {
   auto this_ptr = boost::static_pointer_cast<cedar::proc::Trigger>(this->shared_from_this());
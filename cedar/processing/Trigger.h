@@ -45,6 +45,7 @@
 #include "cedar/processing/Element.h"
 #include "cedar/processing/Triggerable.h"
 #include "cedar/auxiliaries/LockableMember.h"
+#include "cedar/auxiliaries/BoolParameter.h"
 #include "cedar/auxiliaries/GraphTemplate.h"
 #include "cedar/auxiliaries/boostSignalsHelper.h"
 
@@ -144,6 +145,17 @@ public:
   //! Returns the number of triggerables directly listening to this trigger.
   size_t getTriggerCount() const;
 
+  /*! Sets whether triggerables with the same depth in the triggering order are executed in parallel.
+   *
+   *  If enabled, each depth level is distributed to a thread pool and the trigger waits for all of its triggerables
+   *  to finish before moving on to the next level. The order of the levels is the same as in sequential execution.
+   *  Looped triggers distribute their own listeners in the same way.
+   */
+  void setParallelExecution(bool parallel);
+
+  //! Returns whether triggerables with the same depth in the triggering order are executed in parallel.
+  bool isParallelExecutionEnabled() const;
+
   //--------------------------------------------------------------------------------------------------------------------
   // protected methods
   //--------------------------------------------------------------------------------------------------------------------
@@ -157,6 +169,14 @@ protected:
   //!@brief adds a listener, which will receive trigger signals from this instance from now on
   virtual void addListener(cedar::proc::TriggerablePtr triggerable);
 
+  //! Calls onTrigger for all given triggerables, using the thread pool for all but the last one.
+  void triggerInParallel
+  (
+    const std::set<cedar::proc::TriggerablePtr>& triggerables,
+    cedar::proc::ArgumentsPtr arguments,
+    cedar::proc::TriggerPtr sender
+  );
+
   //--------------------------------------------------------------------------------------------------------------------
   // private methods
   //--------------------------------------------------------------------------------------------------------------------
@@ -238,6 +258,16 @@ protected:
 private:
   // none yet
 
+  //--------------------------------------------------------------------------------------------------------------------
+  // parameters
+  //--------------------------------------------------------------------------------------------------------------------
+protected:
+  // none yet
+
+private:
+  //! Whether the triggerables of one depth level are executed in parallel.
+  cedar::aux::BoolParameterPtr _mParallelExecution;
+
   //--------------------------------------------------------------------------------------------------------------------
   // boost signals
   //--------------------------------------------------------------------------------------------------------------------
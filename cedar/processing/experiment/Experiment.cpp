@@ -48,6 +48,8 @@
 #include "cedar/auxiliaries/FileLog.h"
 #include "cedar/auxiliaries/ParameterDeclaration.h"
 #include "cedar/auxiliaries/sleepFunctions.h"
+#include "cedar/auxiliaries/stringFunctions.h"
+#include "cedar/auxiliaries/assert.h"
 
 // SYSTEM INCLUDES
 #include <boost/bind.hpp>
@@ -73,6 +75,8 @@ cedar::proc::experiment::Experiment::Experiment(cedar::proc::GroupPtr group)
 :
 mCurrentTrial(0),
 mIsRunning(false),
+mTrialIsRunning(false),
+mSimulated(false),
 _mFileName(new cedar::aux::StringParameter(this, "filename", "")),
 _mTrials(new cedar::aux::UIntParameter(this, "repetitions", 1)),
 _mActionSequences
@@ -264,7 +268,11 @@ void cedar::proc::experiment::Experiment::stopExperiment()
 void cedar::proc::experiment::Experiment::startTrial()
 {
   cedar::aux::GlobalClockSingleton::getInstance()->reset();
-  cedar::aux::GlobalClockSingleton::getInstance()->start();
+  // in simulated trials, the clock is advanced by stepping the triggers
+  if (!this->mSimulated)
+  {
+    cedar::aux::GlobalClockSingleton::getInstance()->start();
+  }
   mTrialIsRunning = true;
   // reset all action sequences
   for (size_t i = 0; i < this->_mActionSequences->size(); ++i)
@@ -278,13 +286,24 @@ void cedar::proc::experiment::Experiment::startTrial()
   ss << this->mCurrentTrial;
   std::string trial_number = ss.str();
   cedar::aux::RecorderSingleton::getInstance()->setSubfolder(this->mRecordFolderName + "/" + "Trial_" + trial_number);
-  cedar::aux::RecorderSingleton::getInstance()->start();
-  this->mStartGroup->start();
+  if (this->mSimulated)
+  {
+    // recorded in simulated time by runSimulatedTrial
+    cedar::aux::RecorderSingleton::getInstance()->startSimulated();
+  }
+  else
+  {
+    cedar::aux::RecorderSingleton::getInstance()->start();
+    this->mStartGroup->start();
+  }
 }
 
 void cedar::proc::experiment::Experiment::startAllTriggers()
 {
-  this->mStartGroup->start();
+  if (!this->mSimulated)
+  {
+    this->mStartGroup->start();
+  }
 }
 
 void cedar::proc::experiment::Experiment::addActionSequence(cedar::proc::experiment::ActionSequencePtr actionSequence)
@@ -304,12 +323,19 @@ std::vector<cedar::proc::experiment::ActionSequencePtr> cedar::proc::experiment:
 
 void cedar::proc::experiment::Experiment::stopTrial(ResetType::Id reset, bool stopTriggers)
 {
-  if (stopTriggers)
+  if (stopTriggers && !this->mSimulated)
   {
     this->mStopGroup->start();
     cedar::aux::GlobalClockSingleton::getInstance()->stop();
   }
-  cedar::aux::RecorderSingleton::getInstance()->stop();
+  if (this->mSimulated)
+  {
+    cedar::aux::RecorderSingleton::getInstance()->stopSimulated();
+  }
+  else
+  {
+    cedar::aux::RecorderSingleton::getInstance()->stop();
+  }
 
   // Apply the different reset types
   switch (reset)
@@ -478,6 +504,51 @@ bool cedar::proc::experiment::Experiment::hasMoreTrials() const
   return false;
 }
 
+bool cedar::proc::experiment::Experiment::isSimulated() const
+{
+  return this->mSimulated;
+}
+
+void cedar::proc::experiment::Experiment::runSimulatedTrial
+(
+  unsigned int trial,
+  const std::string& recordFolderName,
+  cedar::unit::Time timeLimit
+)
+{
+  CEDAR_ASSERT(!this->isRunning() && !this->trialIsRunning());
+
+  this->mSimulated = true;
+  this->mRecordFolderName = recordFolderName;
+  this->mCurrentTrial = trial;
+
+  this->preExperiment();
+  this->startTrial();
+
+  auto clock = cedar::aux::GlobalClockSingleton::getInstance();
+  auto recorder = cedar::aux::RecorderSingleton::getInstance();
+  while (this->trialIsRunning())
+  {
+    if (clock->getTime() >= timeLimit)
+    {
+      cedar::aux::LogSingleton::getInstance()->warning
+      (
+        "Trial " + cedar::aux::toString(trial) + " reached the time limit of " + cedar::aux::toString(timeLimit)
+          + " without being ended by an action; stopping it.",
+        CEDAR_CURRENT_FUNCTION_NAME
+      );
+      this->stopTrial(ResetType::None);
+      break;
+    }
+
+    this->mGroup->stepTriggers();
+    recorder->stepSimulated(clock->getTime());
+    this->executeActionSequences();
+  }
+
+  this->mSimulated = false;
+}
+
 void cedar::proc::experiment::Experiment::step(cedar::unit::Time)
 {
   if (this->trialIsRunning()) // trial is running
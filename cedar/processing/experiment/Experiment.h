@@ -264,6 +264,18 @@ public:
   //! Returns if there are any more trials to run.
   bool hasMoreTrials() const;
 
+  /*!@brief Runs a single trial from the calling thread instead of starting the looped triggers and the recorder.
+   *
+   *        Instead of running the triggers of the group in real time, they are single-stepped in simulated time as
+   *        fast as possible. The action sequences are checked after every step. The trial ends when one of the actions
+   *        ends it, or when the simulated time exceeds timeLimit. The recorder is sampled after every step, with its
+   *        record intervals measured in simulated time, and writes to the folder recordFolderName/Trial_<trial>.
+   */
+  void runSimulatedTrial(unsigned int trial, const std::string& recordFolderName, cedar::unit::Time timeLimit);
+
+  //! Returns true if the experiment is currently running a trial in simulated time, see runSimulatedTrial.
+  bool isSimulated() const;
+
   /*! Checks if the experiment is valid. If it returns false, errors are written to the vectors passed as arguments and
    * can be used to give hints about what is wrong. Warnings may always be generated, even for valid experiments.
    */
@@ -351,6 +363,9 @@ private:
 
   bool mTrialIsRunning;
 
+  //! Whether the current trial is stepped in simulated time by runSimulatedTrial instead of running the triggers.
+  bool mSimulated;
+
   std::string mRecordFolderName;
 
   //! Logger used while the experiment is running.
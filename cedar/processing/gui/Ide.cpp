@@ -69,6 +69,8 @@
 #include "cedar/auxiliaries/Settings.h"
 #include "cedar/auxiliaries/StringVectorParameter.h"
 #include "cedar/auxiliaries/PluginProxy.h"
+#include "cedar/auxiliaries/Tracer.h"
+#include "cedar/auxiliaries/exceptions.h"
 #include "cedar/auxiliaries/Log.h"
 #include "cedar/auxiliaries/assert.h"
 #include "cedar/auxiliaries/CallFunctionInThread.h"
@@ -531,6 +533,8 @@ void cedar::proc::gui::Ide::init(bool loadDefaultPlugins, bool redirectLogToGui,
 
   QObject::connect(mpActionPerformanceOverview, SIGNAL(triggered()), this->mpPerformanceOverview, SLOT(show()));
   QObject::connect(mpActionParameterLinker, SIGNAL(triggered()), this, SLOT(openParameterLinker()));
+  QObject::connect(mpActionTraceExecution, SIGNAL(triggered(bool)), this, SLOT(toggleTracing(bool)));
+  QObject::connect(mpActionExportTrace, SIGNAL(triggered()), this, SLOT(exportTrace()));
 
 
   QObject::connect(this->mpRecorderWidget,
@@ -986,6 +990,50 @@ void cedar::proc::gui::Ide::exportSvg()
   }
 }
 
+void cedar::proc::gui::Ide::toggleTracing(bool enabled)
+{
+  if (enabled)
+  {
+    // start a new trace
+    cedar::aux::Tracer::clear();
+  }
+  cedar::aux::Tracer::setEnabled(enabled);
+}
+
+void cedar::proc::gui::Ide::exportTrace()
+{
+  cedar::aux::DirectoryParameterPtr last_dir = cedar::proc::gui::SettingsSingleton::getInstance()->lastArchitectureExportDialogDirectory();
+
+  QString file = QFileDialog::getSaveFileName(this, // parent
+                                              "Select where to export the trace", // caption
+                                              last_dir->getValue().absolutePath(), // initial directory;
+                                              "Chrome trace (*.json)", // filter(s), separated by ';;'
+                                              0,
+                                              // js: Workaround for freezing file dialogs in QT5 (?)
+                                              QFileDialog::DontUseNativeDialog
+                                              );
+
+  if (!file.isEmpty())
+  {
+    if (!file.endsWith(".json"))
+    {
+      file += ".json";
+    }
+
+    try
+    {
+      cedar::aux::Tracer::writeChromeTrace(cedar::aux::Path(file.toStdString()));
+    }
+    catch (const cedar::aux::FileNotFoundException& e)
+    {
+      cedar::aux::LogSingleton::getInstance()->error(e.getMessage(), CEDAR_CURRENT_FUNCTION_NAME);
+    }
+
+    QString path = file.remove(file.lastIndexOf(QDir::separator()), file.length());
+    last_dir->setValue(path);
+  }
+}
+
 void cedar::proc::gui::Ide::duplicateSelected()
 {
   //!@todo Doesn't this code belong into scene?
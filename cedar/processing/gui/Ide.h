@@ -250,6 +250,12 @@ public slots:
    */
   void openParameterLinker();
 
+  //! Switches tracing of step execution on or off.
+  void toggleTracing(bool enabled);
+
+  //! Writes the recorded execution trace to a file chosen by the user.
+  void exportTrace();
+
   //!@brief toggle smart connections
   void toggleSmartConnections(bool smart);
 
@@ -261,6 +261,15 @@ void cedar::proc::gui::StepItem::updateToolTip()
     tool_tip += "</tr>";
   }
 
+  if (step->hasAllocationMeasurement())
+  {
+    QString allocation_str = "<tr><td></td><td>allocations in compute</td><td align=\"right\">%1</td>"
+                             "<td align=\"right\">%2</td></tr>";
+    allocation_str = allocation_str.arg(static_cast<qulonglong>(step->getLastComputeAllocations()));
+    allocation_str = allocation_str.arg(step->getComputeAllocationsAverage(), 0, 'f', 1);
+    tool_tip += allocation_str;
+  }
+
   tool_tip += "</table>";
 
   const auto& annotation = this->getStep()->getStateAnnotation();
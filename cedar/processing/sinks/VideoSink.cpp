@@ -46,8 +46,36 @@
 #include "cedar/processing/StepTime.h"
 #include "cedar/auxiliaries/MatData.h"
 #include "cedar/auxiliaries/opencv_helper.h"
+#include "cedar/auxiliaries/Log.h"
+#include "cedar/auxiliaries/stringFunctions.h"
 
 // SYSTEM INCLUDES
+#include <QFileInfo>
+#include <QDir>
+#include <boost/bind.hpp>
+
+//----------------------------------------------------------------------------------------------------------------------
+// static members
+//----------------------------------------------------------------------------------------------------------------------
+
+cedar::aux::EnumType<cedar::proc::sinks::VideoSink::Codec> cedar::proc::sinks::VideoSink::Codec::mType;
+cedar::aux::EnumType<cedar::proc::sinks::VideoSink::Container> cedar::proc::sinks::VideoSink::Container::mType;
+cedar::aux::EnumType<cedar::proc::sinks::VideoSink::DropPolicy> cedar::proc::sinks::VideoSink::DropPolicy::mType;
+
+#ifndef CEDAR_COMPILER_MSVC
+const cedar::proc::sinks::VideoSink::Codec::Id cedar::proc::sinks::VideoSink::Codec::MPEG1;
+const cedar::proc::sinks::VideoSink::Codec::Id cedar::proc::sinks::VideoSink::Codec::MJPEG;
+const cedar::proc::sinks::VideoSink::Codec::Id cedar::proc::sinks::VideoSink::Codec::XVID;
+const cedar::proc::sinks::VideoSink::Codec::Id cedar::proc::sinks::VideoSink::Codec::H264;
+const cedar::proc::sinks::VideoSink::Codec::Id cedar::proc::sinks::VideoSink::Codec::FFV1;
+const cedar::proc::sinks::VideoSink::Container::Id cedar::proc::sinks::VideoSink::Container::FILE_NAME;
+const cedar::proc::sinks::VideoSink::Container::Id cedar::proc::sinks::VideoSink::Container::AVI;
+const cedar::proc::sinks::VideoSink::Container::Id cedar::proc::sinks::VideoSink::Container::MATROSKA;
+const cedar::proc::sinks::VideoSink::Container::Id cedar::proc::sinks::VideoSink::Container::MP4;
+const cedar::proc::sinks::VideoSink::DropPolicy::Id cedar::proc::sinks::VideoSink::DropPolicy::DROP_NEWEST;
+const cedar::proc::sinks::VideoSink::DropPolicy::Id cedar::proc::sinks::VideoSink::DropPolicy::DROP_OLDEST;
+const cedar::proc::sinks::VideoSink::DropPolicy::Id cedar::proc::sinks::VideoSink::DropPolicy::BLOCK;
+#endif // CEDAR_COMPILER_MSVC
 
 //----------------------------------------------------------------------------------------------------------------------
 // register the class
@@ -79,6 +107,15 @@ namespace
   }
 
   bool declared = declare();
+
+  int fourcc(char c1, char c2, char c3, char c4)
+  {
+#if CEDAR_OPENCV_MAJOR_VERSION >= 3
+    return cv::VideoWriter::fourcc(c1, c2, c3, c4);
+#else
+    return static_cast<int>(CV_FOURCC(c1, c2, c3, c4));
+#endif
+  }
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -89,9 +126,57 @@ cedar::proc::sinks::VideoSink::VideoSink()
 :
 cedar::proc::Step(true),
 mCurrentFrameDuration(0.0),
+mFirstQueuedFrame(0),
+mNumberOfQueuedFrames(0),
+mStopRequested(false),
+mEncodedFrames(0),
+mDroppedFrames(0),
 _mOutputFileName(new cedar::aux::FileParameter(this, "output file name", cedar::aux::FileParameter::WRITE)),
-_mFrameRate(new cedar::aux::DoubleParameter(this, "frame rate", 30.0))
+_mFrameRate(new cedar::aux::DoubleParameter(this, "frame rate", 30.0)),
+_mCodec
+(
+  new cedar::aux::EnumParameter
+  (
+    this,
+    "codec",
+    cedar::proc::sinks::VideoSink::Codec::typePtr(),
+    cedar::proc::sinks::VideoSink::Codec::MPEG1
+  )
+),
+_mContainer
+(
+  new cedar::aux::EnumParameter
+  (
+    this,
+    "container",
+    cedar::proc::sinks::VideoSink::Container::typePtr(),
+    cedar::proc::sinks::VideoSink::Container::FILE_NAME
+  )
+),
+_mAsynchronous(new cedar::aux::BoolParameter(this, "asynchronous encoding", true)),
+_mFramePoolSize(new cedar::aux::UIntParameter(this, "frame pool size", 8, 1, 1000)),
+_mDropPolicy
+(
+  new cedar::aux::EnumParameter
+  (
+    this,
+    "drop policy",
+    cedar::proc::sinks::VideoSink::DropPolicy::typePtr(),
+    cedar::proc::sinks::VideoSink::DropPolicy::DROP_NEWEST
+  )
+)
 {
+  _mFramePoolSize->markAdvanced();
+  _mDropPolicy->markAdvanced();
+
+  mEncoderThread = cedar::aux::CallFunctionInThreadPtr
+                   (
+                     new cedar::aux::CallFunctionInThread
+                     (
+                       boost::bind(&cedar::proc::sinks::VideoSink::encodeFrames, this)
+                     )
+                   );
+
   auto input_slot = this->declareInput("input");
 
   cedar::proc::typecheck::Matrix matrix_check;
@@ -103,31 +188,197 @@ _mFrameRate(new cedar::aux::DoubleParameter(this, "frame rate", 30.0))
 
 cedar::proc::sinks::VideoSink::~VideoSink()
 {
+  this->stopEncoder();
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 // methods
 //----------------------------------------------------------------------------------------------------------------------
+std::string cedar::proc::sinks::VideoSink::getOutputPath() const
+{
+  QString path = _mOutputFileName->getValue().absolutePath();
+  QString extension;
+  switch (_mContainer->getValue())
+  {
+    case cedar::proc::sinks::VideoSink::Container::AVI:
+      extension = "avi";
+      break;
+
+    case cedar::proc::sinks::VideoSink::Container::MATROSKA:
+      extension = "mkv";
+      break;
+
+    case cedar::proc::sinks::VideoSink::Container::MP4:
+      extension = "mp4";
+      break;
+
+    default:
+      return path.toStdString();
+  }
+
+  QFileInfo info(path);
+  return info.dir().filePath(info.completeBaseName() + "." + extension).toStdString();
+}
+
+int cedar::proc::sinks::VideoSink::getFourCC() const
+{
+  switch (_mCodec->getValue())
+  {
+    case cedar::proc::sinks::VideoSink::Codec::MJPEG:
+      return fourcc('M','J','P','G');
+
+    case cedar::proc::sinks::VideoSink::Codec::XVID:
+      return fourcc('X','V','I','D');
+
+    case cedar::proc::sinks::VideoSink::Codec::H264:
+      return fourcc('H','2','6','4');
+
+    case cedar::proc::sinks::VideoSink::Codec::FFV1:
+      return fourcc('F','F','V','1');
+
+    case cedar::proc::sinks::VideoSink::Codec::MPEG1:
+    default:
+      return fourcc('P','I','M','1');
+  }
+}
+
 void cedar::proc::sinks::VideoSink::onStart()
 {
-  mVideoWriter.open
-               (
-                 _mOutputFileName->getValue().absolutePath().toStdString(),
-#if CEDAR_OPENCV_MAJOR_VERSION >= 3
-                 cv::VideoWriter::fourcc('P','I','M','1')
-#else
-                 static_cast<unsigned int>(CV_FOURCC('P','I','M','1'))
-#endif
-                 ,
-                 _mFrameRate->getValue(),
-                 this->getInput("input")->getData<cv::Mat>().size(),
-                 true
-               );
+  const cv::Mat& frame = this->getInput("input")->getData<cv::Mat>();
+  mVideoWriter.open(this->getOutputPath(), this->getFourCC(), _mFrameRate->getValue(), frame.size(), true);
+
+  mEncodedFrames = 0;
+  mDroppedFrames = 0;
+  if (_mAsynchronous->getValue())
+  {
+    this->startEncoder(frame);
+  }
 }
 
 void cedar::proc::sinks::VideoSink::onStop()
 {
+  // the encoder thread writes the remaining frames before the file is closed
+  this->stopEncoder();
   mVideoWriter = cv::VideoWriter();
+
+  if (mDroppedFrames > 0)
+  {
+    cedar::aux::LogSingleton::getInstance()->warning
+    (
+      "\"" + this->getName() + "\" dropped " + cedar::aux::toString(mDroppedFrames.load()) + " of "
+        + cedar::aux::toString(mDroppedFrames + mEncodedFrames) + " frames because the encoder fell behind.",
+      CEDAR_CURRENT_FUNCTION_NAME
+    );
+  }
+}
+
+unsigned long cedar::proc::sinks::VideoSink::getNumberOfEncodedFrames() const
+{
+  return mEncodedFrames;
+}
+
+unsigned long cedar::proc::sinks::VideoSink::getNumberOfDroppedFrames() const
+{
+  return mDroppedFrames;
+}
+
+void cedar::proc::sinks::VideoSink::startEncoder(const cv::Mat& frame)
+{
+  this->stopEncoder();
+
+  // all frames are allocated up front; copying into them and swapping them with mEncodingFrame does not allocate
+  mFramePool.resize(_mFramePoolSize->getValue());
+  for (auto& pool_frame : mFramePool)
+  {
+    pool_frame.create(frame.size(), frame.type());
+  }
+  mEncodingFrame.create(frame.size(), frame.type());
+  mFirstQueuedFrame = 0;
+  mNumberOfQueuedFrames = 0;
+  mStopRequested = false;
+
+  mEncoderThread->setThreadName("video encoder of " + this->getName());
+  mEncoderThread->start();
+}
+
+void cedar::proc::sinks::VideoSink::stopEncoder()
+{
+  if (!mEncoderThread->isRunning())
+  {
+    return;
+  }
+
+  QMutexLocker lock(&mFramePoolMutex);
+  mStopRequested = true;
+  lock.unlock();
+  mFrameQueued.wakeOne();
+  mFrameTaken.wakeAll();
+  mEncoderThread->stop();
+}
+
+void cedar::proc::sinks::VideoSink::enqueueFrame(const cv::Mat& frame)
+{
+  QMutexLocker lock(&mFramePoolMutex);
+  if (mNumberOfQueuedFrames == mFramePool.size())
+  {
+    switch (_mDropPolicy->getValue())
+    {
+      case cedar::proc::sinks::VideoSink::DropPolicy::DROP_OLDEST:
+        mFirstQueuedFrame = (mFirstQueuedFrame + 1) % mFramePool.size();
+        --mNumberOfQueuedFrames;
+        ++mDroppedFrames;
+        break;
+
+      case cedar::proc::sinks::VideoSink::DropPolicy::BLOCK:
+        while (mNumberOfQueuedFrames == mFramePool.size() && !mStopRequested)
+        {
+          mFrameTaken.wait(&mFramePoolMutex);
+        }
+        if (mStopRequested)
+        {
+          return;
+        }
+        break;
+
+      case cedar::proc::sinks::VideoSink::DropPolicy::DROP_NEWEST:
+      default:
+        ++mDroppedFrames;
+        return;
+    }
+  }
+
+  frame.copyTo(mFramePool.at((mFirstQueuedFrame + mNumberOfQueuedFrames) % mFramePool.size()));
+  ++mNumberOfQueuedFrames;
+  lock.unlock();
+  mFrameQueued.wakeOne();
+}
+
+void cedar::proc::sinks::VideoSink::encodeFrames()
+{
+  QMutexLocker lock(&mFramePoolMutex);
+  while (true)
+  {
+    while (mNumberOfQueuedFrames == 0 && !mStopRequested)
+    {
+      mFrameQueued.wait(&mFramePoolMutex);
+    }
+    // when asked to stop, the queue is emptied first
+    if (mNumberOfQueuedFrames == 0)
+    {
+      break;
+    }
+
+    cv::swap(mFramePool.at(mFirstQueuedFrame), mEncodingFrame);
+    mFirstQueuedFrame = (mFirstQueuedFrame + 1) % mFramePool.size();
+    --mNumberOfQueuedFrames;
+    lock.unlock();
+    mFrameTaken.wakeOne();
+
+    mVideoWriter << mEncodingFrame;
+    ++mEncodedFrames;
+
+    lock.relock();
+  }
 }
 
 void cedar::proc::sinks::VideoSink::compute(const cedar::proc::Arguments& arguments)
@@ -143,7 +394,16 @@ void cedar::proc::sinks::VideoSink::compute(const cedar::proc::Arguments& argume
       mCurrentFrameDuration += elapsed_time;
       if (mCurrentFrameDuration > frame_duration)
       {
-        mVideoWriter << this->getInput("input")->getData<cv::Mat>();
+        const cv::Mat& frame = this->getInput("input")->getData<cv::Mat>();
+        if (mEncoderThread->isRunning())
+        {
+          this->enqueueFrame(frame);
+        }
+        else
+        {
+          mVideoWriter << frame;
+          ++mEncodedFrames;
+        }
         mCurrentFrameDuration -= frame_duration;
       }
     }
@@ -44,21 +44,181 @@
 #include "cedar/processing/Step.h"
 #include "cedar/auxiliaries/FileParameter.h"
 #include "cedar/auxiliaries/DoubleParameter.h"
+#include "cedar/auxiliaries/BoolParameter.h"
+#include "cedar/auxiliaries/UIntParameter.h"
+#include "cedar/auxiliaries/EnumParameter.h"
+#include "cedar/auxiliaries/CallFunctionInThread.h"
 
 // FORWARD DECLARATIONS
 #include "cedar/processing/sinks/VideoSink.fwd.h"
 
 // SYSTEM INCLUDES
 #include <opencv2/opencv.hpp>
+#include <QMutex>
+#include <QWaitCondition>
+#include <atomic>
+#include <string>
+#include <vector>
 
 
 /*!@brief Writes its input into a video file.
+ *
+ *        By default, frames are encoded on a separate thread: compute only copies the input into a bounded pool of
+ *        frames that is allocated when recording starts, so encoding does not prolong the time step of the trigger.
+ *        If the encoder falls behind and the pool is full, the drop policy decides whether the new frame or the oldest
+ *        queued one is dropped, or whether the trigger waits. Dropped frames are counted and reported when recording
+ *        stops.
  */
 class cedar::proc::sinks::VideoSink : public cedar::proc::Step
 {
   //--------------------------------------------------------------------------------------------------------------------
   // nested types
   //--------------------------------------------------------------------------------------------------------------------
+public:
+  //! Enum of the codecs used to encode the video.
+  class Codec
+  {
+    public:
+      //! Typedef for the enum id.
+      typedef cedar::aux::EnumId Id;
+
+      //! Shared-pointer typedef for the base type pointer.
+      typedef boost::shared_ptr<cedar::aux::EnumBase> TypePtr;
+
+      //! Static constructor function.
+      static void construct()
+      {
+        mType.type()->def(cedar::aux::Enum(MPEG1, "MPEG1", "MPEG-1"));
+        mType.type()->def(cedar::aux::Enum(MJPEG, "MJPEG", "Motion JPEG"));
+        mType.type()->def(cedar::aux::Enum(XVID, "XVID", "Xvid (MPEG-4)"));
+        mType.type()->def(cedar::aux::Enum(H264, "H264", "H.264"));
+        mType.type()->def(cedar::aux::Enum(FFV1, "FFV1", "FFV1 (lossless)"));
+      }
+
+      //! Returns a const reference to the enum's type object.
+      static const cedar::aux::EnumBase& type()
+      {
+        return *mType.type();
+      }
+
+      //! Returns a const reference to the pointer of the enum's type object.
+      static const TypePtr& typePtr()
+      {
+        return mType.type();
+      }
+
+      //! MPEG-1, available almost everywhere.
+      static const Id MPEG1 = 0;
+
+      //! Motion JPEG; every frame is encoded separately, which is fast but results in large files.
+      static const Id MJPEG = 1;
+
+      //! MPEG-4 part 2.
+      static const Id XVID = 2;
+
+      //! H.264; small files, but expensive to encode.
+      static const Id H264 = 3;
+
+      //! Lossless encoding.
+      static const Id FFV1 = 4;
+
+    private:
+      //! Static pointer to the cedar::aux::EnumType object that manages the enum values.
+      static cedar::aux::EnumType<Codec> mType;
+  };
+
+  //! Enum of the containers the video is stored in.
+  class Container
+  {
+    public:
+      //! Typedef for the enum id.
+      typedef cedar::aux::EnumId Id;
+
+      //! Shared-pointer typedef for the base type pointer.
+      typedef boost::shared_ptr<cedar::aux::EnumBase> TypePtr;
+
+      //! Static constructor function.
+      static void construct()
+      {
+        mType.type()->def(cedar::aux::Enum(FILE_NAME, "FILE_NAME", "from file name"));
+        mType.type()->def(cedar::aux::Enum(AVI, "AVI", "AVI (.avi)"));
+        mType.type()->def(cedar::aux::Enum(MATROSKA, "MATROSKA", "Matroska (.mkv)"));
+        mType.type()->def(cedar::aux::Enum(MP4, "MP4", "MPEG-4 (.mp4)"));
+      }
+
+      //! Returns a const reference to the enum's type object.
+      static const cedar::aux::EnumBase& type()
+      {
+        return *mType.type();
+      }
+
+      //! Returns a const reference to the pointer of the enum's type object.
+      static const TypePtr& typePtr()
+      {
+        return mType.type();
+      }
+
+      //! The container is determined by the extension of the output file name.
+      static const Id FILE_NAME = 0;
+
+      //! The extension of the output file name is replaced by .avi.
+      static const Id AVI = 1;
+
+      //! The extension of the output file name is replaced by .mkv.
+      static const Id MATROSKA = 2;
+
+      //! The extension of the output file name is replaced by .mp4.
+      static const Id MP4 = 3;
+
+    private:
+      //! Static pointer to the cedar::aux::EnumType object that manages the enum values.
+      static cedar::aux::EnumType<Container> mType;
+  };
+
+  //! Enum of what happens to a frame when the frame pool is full.
+  class DropPolicy
+  {
+    public:
+      //! Typedef for the enum id.
+      typedef cedar::aux::EnumId Id;
+
+      //! Shared-pointer typedef for the base type pointer.
+      typedef boost::shared_ptr<cedar::aux::EnumBase> TypePtr;
+
+      //! Static constructor function.
+      static void construct()
+      {
+        mType.type()->def(cedar::aux::Enum(DROP_NEWEST, "DROP_NEWEST", "drop new frame"));
+        mType.type()->def(cedar::aux::Enum(DROP_OLDEST, "DROP_OLDEST", "drop oldest queued frame"));
+        mType.type()->def(cedar::aux::Enum(BLOCK, "BLOCK", "wait for encoder"));
+      }
+
+      //! Returns a const reference to the enum's type object.
+      static const cedar::aux::EnumBase& type()
+      {
+        return *mType.type();
+      }
+
+      //! Returns a const reference to the pointer of the enum's type object.
+      static const TypePtr& typePtr()
+      {
+        return mType.type();
+      }
+
+      //! The new frame is not recorded.
+      static const Id DROP_NEWEST = 0;
+
+      //! The oldest frame that has not been encoded yet is replaced by the new frame.
+      static const Id DROP_OLDEST = 1;
+
+      //! The trigger waits until the encoder has taken a frame from the pool; no frames are dropped.
+      static const Id BLOCK = 2;
+
+    private:
+      //! Static pointer to the cedar::aux::EnumType object that manages the enum values.
+      static cedar::aux::EnumType<DropPolicy> mType;
+  };
+
 
   //--------------------------------------------------------------------------------------------------------------------
   // constructors and destructor
@@ -79,6 +239,12 @@ public:
   void onStart();
   void onStop();
 
+  //!@brief Returns the number of frames written to the file since recording started.
+  unsigned long getNumberOfEncodedFrames() const;
+
+  //!@brief Returns the number of frames dropped since recording started because the frame pool was full.
+  unsigned long getNumberOfDroppedFrames() const;
+
   //--------------------------------------------------------------------------------------------------------------------
   // protected methods
   //--------------------------------------------------------------------------------------------------------------------
@@ -89,7 +255,23 @@ protected:
   // private methods
   //--------------------------------------------------------------------------------------------------------------------
 private:
-  // none yet
+  //! Returns the path of the output file, with the extension of the selected container.
+  std::string getOutputPath() const;
+
+  //! Returns the four character code of the selected codec.
+  int getFourCC() const;
+
+  //! Allocates the frame pool for frames like the given one and starts the encoder thread.
+  void startEncoder(const cv::Mat& frame);
+
+  //! Lets the encoder thread write all queued frames and waits for it to finish.
+  void stopEncoder();
+
+  //! Copies the frame into the pool, applying the drop policy if the pool is full.
+  void enqueueFrame(const cv::Mat& frame);
+
+  //! Main loop of the encoder thread.
+  void encodeFrames();
 
   //--------------------------------------------------------------------------------------------------------------------
   // members
@@ -100,6 +282,39 @@ private:
   cv::VideoWriter mVideoWriter;
   double mCurrentFrameDuration;
 
+  //! Frames waiting to be encoded, used as a ring buffer starting at mFirstQueuedFrame.
+  std::vector<cv::Mat> mFramePool;
+
+  //! Index of the oldest queued frame in the pool.
+  size_t mFirstQueuedFrame;
+
+  //! Number of queued frames.
+  size_t mNumberOfQueuedFrames;
+
+  //! The frame being encoded; swapped with a pool entry so that no frame data is copied or allocated.
+  cv::Mat mEncodingFrame;
+
+  //! Thread that encodes the queued frames.
+  cedar::aux::CallFunctionInThreadPtr mEncoderThread;
+
+  //! Protects the frame pool and the fields used to wake up the threads.
+  QMutex mFramePoolMutex;
+
+  //! Signals the encoder thread that a frame was queued or that it should stop.
+  QWaitCondition mFrameQueued;
+
+  //! Signals a blocked trigger that the encoder took a frame from the pool.
+  QWaitCondition mFrameTaken;
+
+  //! Whether the encoder thread should stop once the queue is empty.
+  bool mStopRequested;
+
+  //! Number of frames written since recording started.
+  std::atomic<unsigned long> mEncodedFrames;
+
+  //! Number of frames dropped since recording started.
+  std::atomic<unsigned long> mDroppedFrames;
+
   //--------------------------------------------------------------------------------------------------------------------
   // parameters
   //--------------------------------------------------------------------------------------------------------------------
@@ -109,6 +324,13 @@ protected:
 private:
   cedar::aux::FileParameterPtr _mOutputFileName;
   cedar::aux::DoubleParameterPtr _mFrameRate;
+  cedar::aux::EnumParameterPtr _mCodec;
+  cedar::aux::EnumParameterPtr _mContainer;
+  //! Whether frames are encoded on a separate thread.
+  cedar::aux::BoolParameterPtr _mAsynchronous;
+  //! Number of frames that can wait for the encoder; takes effect when recording starts.
+  cedar::aux::UIntParameterPtr _mFramePoolSize;
+  cedar::aux::EnumParameterPtr _mDropPolicy;
 
 }; // class cedar::proc::sinks::VideoSink
 
@@ -88,6 +88,7 @@ cedar::proc::sources::BoxInput::BoxInput()
 :
 cedar::proc::Step(),
 mOutput(new cedar::aux::MatData(cv::Mat())),
+mParametersChanged(true),
 _mDimensionality(new cedar::aux::UIntParameter(this, "dimensionality", 2, 1, 4)),
 _mSizes(new cedar::aux::UIntVectorParameter(this, "sizes", 2, 50, 1, 1000)),
 _mAmplitude(new cedar::aux::DoubleParameter(this, "amplitude", 1.0, cedar::aux::DoubleParameter::LimitType::full(), 0.5)),
@@ -95,6 +96,7 @@ _mWidths(new cedar::aux::UIntVectorParameter(this, "widths", 2, 1, 1, 10000)),
 _mLeftBounds(new cedar::aux::UIntVectorParameter(this, "left bounds", 2, 0, 0, 10000)),
 _mReferenceLevel(new cedar::aux::DoubleParameter(this, "reference level", 0.0))
 {
+  this->mOutput->setPublishing(true);
   this->declareOutput("box input", mOutput);
   QObject::connect(_mAmplitude.get(), SIGNAL(valueChanged()), this, SLOT(updateMatrix()));
   QObject::connect(_mReferenceLevel.get(), SIGNAL(valueChanged()), this, SLOT(updateMatrix()));
@@ -134,8 +136,19 @@ double cedar::proc::sources::BoxInput::getReferenceLevel() const
   return this->_mReferenceLevel->getValue();
 }
 
+void cedar::proc::sources::BoxInput::invalidateMatrix()
+{
+  this->mParametersChanged = true;
+}
+
 void cedar::proc::sources::BoxInput::compute(const cedar::proc::Arguments&)
 {
+  if (!this->mParametersChanged.exchange(false))
+  {
+    this->mOutput->markUnchanged();
+    return;
+  }
+
   this->mOutput->setData
                  (
                    cedar::aux::math::boxMatrix
@@ -148,10 +161,13 @@ void cedar::proc::sources::BoxInput::compute(const cedar::proc::Arguments&)
                      _mLeftBounds->getValue()
                    )
                  );
+  // setData has published the new matrix already
+  this->mOutput->markUnchanged();
 }
 
 void cedar::proc::sources::BoxInput::updateMatrix()
 {
+  this->invalidateMatrix();
   this->lock(cedar::aux::LOCK_TYPE_READ);
   this->compute(cedar::proc::Arguments());
   this->unlock();
@@ -168,6 +184,7 @@ void cedar::proc::sources::BoxInput::updateDimensionality()
   _mLeftBounds->setDefaultSize(new_dimensionality);
   _mSizes->resize(new_dimensionality, _mSizes->getDefaultValue());
   _mSizes->setDefaultSize(new_dimensionality);
+  this->invalidateMatrix();
   this->lock(cedar::aux::LOCK_TYPE_READ);
   this->compute(cedar::proc::Arguments());
   this->unlock();
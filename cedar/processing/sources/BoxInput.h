@@ -51,9 +51,12 @@
 #include "cedar/processing/sources/BoxInput.fwd.h"
 
 // SYSTEM INCLUDES
+#include <atomic>
 
 
 /*!@brief Generates a matrix with a box input at a specified position, amplitude, and extent.
+ *
+ *        The matrix is only recomputed when a parameter changes; otherwise, the output is marked unchanged.
  */
 class cedar::proc::sources::BoxInput : public cedar::proc::Step
 {
@@ -111,6 +114,9 @@ private:
   //!@brief refreshes the internal matrix containing the box input
   void compute(const cedar::proc::Arguments& arguments);
 
+  //! Makes the next call to compute rebuild the matrix.
+  void invalidateMatrix();
+
   //--------------------------------------------------------------------------------------------------------------------
   // members
   //--------------------------------------------------------------------------------------------------------------------
@@ -118,6 +124,8 @@ protected:
   //!@brief the buffer containing the output
   cedar::aux::MatDataPtr mOutput;
 private:
+  //! Whether a parameter changed since the matrix was last computed.
+  std::atomic<bool> mParametersChanged;
 
   //--------------------------------------------------------------------------------------------------------------------
   // parameters
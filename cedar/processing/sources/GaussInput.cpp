@@ -91,6 +91,7 @@ cedar::proc::sources::GaussInput::GaussInput()
 :
 cedar::proc::Step(),
 mOutput(new cedar::aux::MatData(cv::Mat())),
+mParametersChanged(true),
 _mDimensionality(new cedar::aux::UIntParameter(this, "dimensionality", 2, 1, 4)),
 _mSizes(new cedar::aux::UIntVectorParameter(this, "sizes", 2, 50, 1, 1000.0)),
 _mAmplitude(new cedar::aux::DoubleParameter(this, "amplitude", 1.0, cedar::aux::DoubleParameter::LimitType::full(), 0.5)),
@@ -98,6 +99,7 @@ _mCenters(new cedar::aux::DoubleVectorParameter(this, "centers", 2, 24.0, -10000
 _mSigmas(new cedar::aux::DoubleVectorParameter(this, "sigma", 2, 3.0, 0.01, 1000.0, 0.5)),
 _mIsCyclic(new cedar::aux::BoolParameter(this, "cyclic", false))
 {
+  this->mOutput->setPublishing(true);
   this->declareOutput("Gauss input", mOutput);
   QObject::connect(_mAmplitude.get(), SIGNAL(valueChanged()), this, SLOT(updateMatrix()));
   QObject::connect(_mSigmas.get(), SIGNAL(valueChanged()), this, SLOT(updateMatrix()));
@@ -143,8 +145,19 @@ void cedar::proc::sources::GaussInput::setAmplitude(double amplitude)
   this->_mAmplitude->setValue(amplitude);
 }
 
+void cedar::proc::sources::GaussInput::invalidateMatrix()
+{
+  this->mParametersChanged = true;
+}
+
 void cedar::proc::sources::GaussInput::compute(const cedar::proc::Arguments&)
 {
+  if (!this->mParametersChanged.exchange(false))
+  {
+    this->mOutput->markUnchanged();
+    return;
+  }
+
   try
   {
     this->mOutput->setData
@@ -159,15 +172,19 @@ void cedar::proc::sources::GaussInput::compute(const cedar::proc::Arguments&)
                        _mIsCyclic->getValue()
                      )
                    );
+    // setData has published the new matrix already
+    this->mOutput->markUnchanged();
   }
   catch (std::out_of_range& exc)
   {
     // this might happen if GaussInput is triggered and dimensionality is changed, just ignore
+    this->invalidateMatrix();
   }
 }
 
 void cedar::proc::sources::GaussInput::updateMatrix()
 {
+  this->invalidateMatrix();
   this->onTrigger();
 }
 
@@ -180,6 +197,7 @@ void cedar::proc::sources::GaussInput::updateDimensionality()
   _mCenters->setDefaultSize(new_dimensionality);
   _mSizes->resize(new_dimensionality, _mSizes->getDefaultValue());
   _mSizes->setDefaultSize(new_dimensionality);
+  this->invalidateMatrix();
   this->lock(cedar::aux::LOCK_TYPE_READ);
   this->compute(cedar::proc::Arguments());
   this->unlock();
@@ -189,6 +207,7 @@ void cedar::proc::sources::GaussInput::updateDimensionality()
 
 void cedar::proc::sources::GaussInput::updateMatrixSize()
 {
+  this->invalidateMatrix();
   this->lock(cedar::aux::LOCK_TYPE_READ);
   this->compute(cedar::proc::Arguments());
   this->unlock();
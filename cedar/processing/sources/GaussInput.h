@@ -53,12 +53,13 @@
 #include "cedar/processing/sources/GaussInput.fwd.h"
 
 // SYSTEM INCLUDES
+#include <atomic>
 
 
 /*!@brief Generates a matrix with a Gaussian.
  *
  *        The output matrix will contain values of a Gauss function, sampled based on the indices of the matrix taken as
- *        x,y,... coordinates.
+ *        x,y,... coordinates. It is only recomputed when a parameter changes; otherwise, the output is marked unchanged.
  */
 class cedar::proc::sources::GaussInput : public cedar::proc::Step
 {
@@ -121,6 +122,9 @@ private:
 
   void calculateOutput();
 
+  //! Makes the next call to compute rebuild the matrix.
+  void invalidateMatrix();
+
   //--------------------------------------------------------------------------------------------------------------------
   // members
   //--------------------------------------------------------------------------------------------------------------------
@@ -128,6 +132,8 @@ protected:
   //!@brief the buffer containing the output
   cedar::aux::MatDataPtr mOutput;
 private:
+  //! Whether a parameter changed since the matrix was last computed.
+  std::atomic<bool> mParametersChanged;
 
   //--------------------------------------------------------------------------------------------------------------------
   // parameters
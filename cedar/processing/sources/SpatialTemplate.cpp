@@ -52,6 +52,7 @@
 #include <cedar/auxiliaries/math/constants.h>
 
 // SYSTEM INCLUDES
+#include <QWriteLocker>
 #include <cmath>
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -98,6 +99,7 @@ _mMuR(new cedar::aux::DoubleParameter(this, "mu r", 15.0, cedar::aux::DoublePara
 _mSigmaR(new cedar::aux::DoubleParameter(this, "sigma r", 100.0, cedar::aux::DoubleParameter::LimitType::positiveZero(1000.0)))
 {
   // output
+  this->mPattern->setPublishing(true);
   this->declareOutput("spatial pattern", mPattern);
 
   QObject::connect(_mSizeX.get(), SIGNAL(valueChanged()), this, SLOT(recompute()));
@@ -127,11 +129,12 @@ void cedar::proc::sources::SpatialTemplate::recompute()
   double mu_r = _mMuR->getValue();
   double sigma_r = _mSigmaR->getValue();
 
-  mPattern->getData() = cv::Mat(size_x, size_y, CV_32F);
+  cv::Mat pattern(size_x, size_y, CV_32F);
 
   // go through all positions of the pattern
   for (unsigned int i = 0; i < size_x; ++i)
   {
+    float* pattern_row = pattern.ptr<float>(i);
     for (unsigned int j = 0; j < size_y; ++j)
     {
       // shift the indices so that the pattern is centered in the output matrix
@@ -162,15 +165,21 @@ void cedar::proc::sources::SpatialTemplate::recompute()
       }
 
       // generate the pattern as a weighted sum of the gaussian and the sigmoid
-      mPattern->getData().at<float>(i, j)
-        = static_cast<float>(gaussian);
+      pattern_row[j] = static_cast<float>(gaussian);
     }
   }
 
+  // the pattern is built outside the lock; setData also publishes it
+  QWriteLocker locker(&mPattern->getLock());
+  mPattern->setData(pattern);
+  locker.unlock();
+
   // this triggers all connected steps.
   this->onTrigger();
 }
 
 void cedar::proc::sources::SpatialTemplate::compute(const cedar::proc::Arguments&)
 {
+  // the pattern is only changed by recompute, which publishes it right away
+  this->mPattern->markUnchanged();
 }
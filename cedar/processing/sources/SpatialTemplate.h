@@ -52,6 +52,8 @@
 
 
 /*!@brief A processing step that generates spatial patterns for "left", "right", "above", and "below".
+ *
+ *        The pattern is only recomputed when a parameter changes; otherwise, the output is marked unchanged.
  */
 class cedar::proc::sources::SpatialTemplate : public cedar::proc::Step
 {
@@ -99,8 +99,8 @@ mOutput(new cedar::aux::MatData(cv::Mat()))
 
 void cedar::proc::steps::AbsoluteValue::compute(const cedar::proc::Arguments&)
 {
-  // the result is simply input * gain.
-  this->mOutput->setData(cv::abs(this->mInput->getData()));
+  // the result is simply |input|; assigning to the existing output reuses its memory
+  this->mOutput->getData() = cv::abs(this->mInput->getData());
 }
 
 void cedar::proc::steps::AbsoluteValue::inputConnectionChanged(const std::string& inputName)
@@ -414,18 +414,11 @@ void cedar::proc::steps::Component::compute(const cedar::proc::Arguments&)
   for (const auto& measurement : measurements)
   {
     std::string name = component->getNameForMeasurementType(measurement);
-    if(auto measurementDataOriginal = component->getMeasurementData(measurement))
+    // the component hands out a copy of its latest published measurement without blocking its communication thread
+    cv::Mat measurementMat = component->getUserSideMeasurementBuffer(measurement);
+    if(auto outPutPtr = mOutputs.at(name))
     {
-      auto measurementData = measurementDataOriginal; // There was a clone here that seemed unneccesary and only caused a crash on windows.
-      if (boost::dynamic_pointer_cast<const cedar::aux::MatData>(measurementData))
-      {
-        cv::Mat measurementMat = measurementData->getData<cv::Mat>().clone();
-        std::string name = component->getNameForMeasurementType(measurement);
-        if(auto outPutPtr = mOutputs.at(name))
-        {
-          outPutPtr->setData(measurementMat);
-        }
-      }
+      outPutPtr->setData(measurementMat);
     }
   }
 //
@@ -159,11 +159,12 @@ void cedar::proc::steps::ComponentMultiply::compute(const cedar::proc::Arguments
     {
       if (mat_data->getDimensionality() == 0)
       {
-        prod = cedar::aux::math::getMatrixEntry<double>(input, 0) * prod;
+        // in-place operations, so that no temporary matrices are allocated
+        prod.convertTo(prod, -1, cedar::aux::math::getMatrixEntry<double>(input, 0));
       }
       else
       {
-        prod = prod.mul(input);
+        cv::multiply(prod, input, prod);
       }
     }
   }
@@ -133,6 +133,9 @@ _mKernels
       );
 
   this->transferKernelsToConvolution();
+
+  // the outputs depend only on the inputs, parameters and kernels; kernel changes call invalidateCompute
+  this->setPure(true);
 }
 //----------------------------------------------------------------------------------------------------------------------
 // methods
@@ -152,16 +155,17 @@ void cedar::proc::steps::Convolution::compute(const cedar::proc::Arguments&)
     {
       this->inputDimensionalityChanged();
     }
-    mOutput->setData(this->mConvolution->convolve(matrix));
+    this->mConvolution->convolveInto(matrix, mOutput->getData());
   }
   else
   {
-    mOutput->setData(this->mMatrix->getData().clone());
+    matrix.copyTo(mOutput->getData());
   }
 }
 
 void cedar::proc::steps::Convolution::recompute()
 {
+  this->invalidateCompute();
   this->onTrigger();
 }
 
@@ -347,6 +351,7 @@ void cedar::proc::steps::Convolution::slotKernelAdded(size_t kernelIndex)
   cedar::aux::kernel::KernelPtr kernel = this->_mKernels->at(kernelIndex);
   this->addKernelToConvolution(kernel);
 
+  this->invalidateCompute();
   this->onTrigger();
 }
 
@@ -389,5 +394,6 @@ void cedar::proc::steps::Convolution::removeKernelFromConvolution(size_t index)
   //!@todo remove this const cast
   const_cast<cedar::aux::kernel::Kernel*>(kernel.get())->disconnect(SIGNAL(kernelUpdated()), this, SLOT(recompute()));
   this->getConvolution()->getKernelList()->remove(index);
+  this->invalidateCompute();
   this->onTrigger();
 }
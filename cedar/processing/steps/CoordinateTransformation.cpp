@@ -41,6 +41,7 @@
 #include "cedar/auxiliaries/math/constants.h"
 #include "cedar/auxiliaries/math/tools.h"
 #include "cedar/auxiliaries/MatData.h"
+#include "cedar/auxiliaries/parallelFunctions.h"
 #include "cedar/auxiliaries/EnumBase.h"
 #include "cedar/auxiliaries/EnumType.h"
 #include "cedar/processing/ElementDeclaration.h"
@@ -350,48 +351,60 @@ void cedar::proc::steps::CoordinateTransformation::compute(const cedar::proc::Ar
     CEDAR_DEBUG_ASSERT(this->mInput->getDimensionality() == 3);
     CEDAR_DEBUG_ASSERT(output.dims == 3);
 
-    //!@todo The special case dim_sliced == 0 can be implemented more efficiently
     int dim_sliced = this->_mSlicedDimension->getValue();
     int dim_0, dim_1;
     getSetup(dim_0, dim_1, dim_sliced);
 
-    cv::Range range[3];
-    range[dim_0] = cv::Range::all();
-    range[dim_1] = cv::Range::all();
-    cv::Mat output_slice = cv::Mat(output.size[dim_0], output.size[dim_1], output.type());
-    std::vector<int> dst_sizes(3);
-    dst_sizes[dim_0] = output.size[dim_0];
-    dst_sizes[dim_1] = output.size[dim_1];
-    dst_sizes[dim_sliced] = 1;
+    const cv::Mat& map_x = this->mMapXConverted->getData();
+    const cv::Mat& map_y = this->mMapYConverted->getData();
 
-    for (int d3 = 0; d3 < this->mInput->getData().size[dim_sliced]; ++d3)
+    // slices are independent of each other, so they are transformed in parallel
+    auto transform_slices = [&](int begin, int end)
     {
-      range[dim_sliced].start = d3;
-      range[dim_sliced].end = d3 + 1;
+      if (dim_sliced == 0 && input.isContinuous() && output.isContinuous())
+      {
+        // slices along the first dimension are contiguous planes that can be used directly
+        for (int d3 = begin; d3 < end; ++d3)
+        {
+          cv::Mat input_slice(input.size[1], input.size[2], input.type(), const_cast<uchar*>(input.ptr(d3)));
+          cv::Mat output_slice(output.size[1], output.size[2], output.type(), output.ptr(d3));
+          output_slice.setTo(0.0);
+          cv::remap(input_slice, output_slice, map_x, map_y, interpolation, border_handling, 0);
+        }
+        return;
+      }
 
-      // extract 2d slices
-      //!@todo Find a way to avoid this clone
-      cv::Mat slice_3d = input(range).clone();
-      // create a header for the current slice
-      cv::Mat input_slice = cv::Mat(input.size[dim_0], input.size[dim_1], input.type(), slice_3d.data);
+      cv::Range range[3];
+      range[dim_0] = cv::Range::all();
+      range[dim_1] = cv::Range::all();
+      cv::Mat output_slice = cv::Mat(output.size[dim_0], output.size[dim_1], output.type());
+      std::vector<int> dst_sizes(3);
+      dst_sizes[dim_0] = output.size[dim_0];
+      dst_sizes[dim_1] = output.size[dim_1];
+      dst_sizes[dim_sliced] = 1;
 
-      output_slice.setTo(0.0);
+      for (int d3 = begin; d3 < end; ++d3)
+      {
+        range[dim_sliced].start = d3;
+        range[dim_sliced].end = d3 + 1;
 
-      // transform coordinate system
-      cv::remap
-      (
-        input_slice,
-        output_slice,
-        this->mMapXConverted->getData(),
-        this->mMapYConverted->getData(),
-        interpolation,
-        border_handling,
-        0
-      );
-
-      // write to output
-      output(range) = 1.0 * cv::Mat(3, &dst_sizes.front(), output.type(), output_slice.data);
-    }
+        // extract 2d slices
+        //!@todo Find a way to avoid this clone
+        cv::Mat slice_3d = input(range).clone();
+        // create a header for the current slice
+        cv::Mat input_slice = cv::Mat(input.size[dim_0], input.size[dim_1], input.type(), slice_3d.data);
+
+        output_slice.setTo(0.0);
+
+        // transform coordinate system
+        cv::remap(input_slice, output_slice, map_x, map_y, interpolation, border_handling, 0);
+
+        // write to output
+        output(range) = 1.0 * cv::Mat(3, &dst_sizes.front(), output.type(), output_slice.data);
+      }
+    };
+
+    cedar::aux::parallelForSlices(input.size[dim_sliced], output.total(), transform_slices);
   }
 }
 
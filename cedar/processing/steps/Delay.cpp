@@ -44,11 +44,27 @@
 #include "cedar/processing/typecheck/IsMatrix.h"
 #include "cedar/processing/ElementDeclaration.h"
 #include "cedar/auxiliaries/GlobalClock.h"
+#include "cedar/auxiliaries/Log.h"
 #include "cedar/units/Time.h"
 
 // SYSTEM INCLUDES
+#include <algorithm>
 
 
+//----------------------------------------------------------------------------------------------------------------------
+// static members
+//----------------------------------------------------------------------------------------------------------------------
+
+cedar::aux::EnumType<cedar::proc::steps::Delay::DelayUnit> cedar::proc::steps::Delay::DelayUnit::mType;
+cedar::aux::EnumType<cedar::proc::steps::Delay::Interpolation> cedar::proc::steps::Delay::Interpolation::mType;
+
+#ifndef CEDAR_COMPILER_MSVC
+const cedar::proc::steps::Delay::DelayUnit::Id cedar::proc::steps::Delay::DelayUnit::STEPS;
+const cedar::proc::steps::Delay::DelayUnit::Id cedar::proc::steps::Delay::DelayUnit::TIME;
+const cedar::proc::steps::Delay::Interpolation::Id cedar::proc::steps::Delay::Interpolation::NEAREST;
+const cedar::proc::steps::Delay::Interpolation::Id cedar::proc::steps::Delay::Interpolation::LINEAR;
+#endif // CEDAR_COMPILER_MSVC
+
 //----------------------------------------------------------------------------------------------------------------------
 // register the class
 //----------------------------------------------------------------------------------------------------------------------
@@ -71,7 +87,8 @@ bool declare()
   declaration->setIconPath(":/steps/delay.svg");
   declaration->setDescription
   (
-    "Delays an input for exactly one time-step. Also provides the time difference between those two last time-steps."
+    "Delays an input by a number of time-steps or by a time, using a ring buffer of past inputs. Also provides the "
+    "time difference between the two last time-steps."
   );
 
   declaration->declare();
@@ -91,8 +108,43 @@ cedar::proc::steps::Delay::Delay()
 // outputs
 mOutput(new cedar::aux::MatData(cv::Mat())),
 mOutputTimeStep(new cedar::aux::MatData(cv::Mat::zeros(1,1,CV_32F))),
-mOldInput(new cedar::aux::MatData(cv::Mat())),
-mFirstIteration(true)
+mNewestFrame(0),
+mNumberOfStoredFrames(0),
+mBufferTooShortWarningIssued(false),
+mFirstIteration(true),
+// parameters
+_mDelayUnit
+(
+  new cedar::aux::EnumParameter
+  (
+    this,
+    "delay unit",
+    cedar::proc::steps::Delay::DelayUnit::typePtr(),
+    cedar::proc::steps::Delay::DelayUnit::STEPS
+  )
+),
+_mDelaySteps(new cedar::aux::UIntParameter(this, "delay steps", 1, 0, 100000)),
+_mDelayTime
+(
+  new cedar::aux::TimeParameter
+  (
+    this,
+    "delay time",
+    cedar::unit::Time(100.0 * cedar::unit::milli * cedar::unit::seconds),
+    cedar::aux::TimeParameter::LimitType::positiveZero()
+  )
+),
+_mBufferSize(new cedar::aux::UIntParameter(this, "buffer size", 200, 1, 100000)),
+_mInterpolation
+(
+  new cedar::aux::EnumParameter
+  (
+    this,
+    "interpolation",
+    cedar::proc::steps::Delay::Interpolation::typePtr(),
+    cedar::proc::steps::Delay::Interpolation::NEAREST
+  )
+)
 {
   // declare all data
   cedar::proc::DataSlotPtr input = this->declareInput("input");
@@ -102,6 +154,18 @@ mFirstIteration(true)
   input->setCheck(cedar::proc::typecheck::IsMatrix());
 
   mLastTime= cedar::aux::GlobalClockSingleton::getInstance()->getTime();
+
+  QObject::connect(_mDelayUnit.get(), SIGNAL(valueChanged()), this, SLOT(delayUnitChanged()), Qt::DirectConnection);
+  QObject::connect
+  (
+    _mDelaySteps.get(), SIGNAL(valueChanged()), this, SLOT(bufferParameterChanged()), Qt::DirectConnection
+  );
+  QObject::connect
+  (
+    _mBufferSize.get(), SIGNAL(valueChanged()), this, SLOT(bufferParameterChanged()), Qt::DirectConnection
+  );
+
+  this->delayUnitChanged();
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -110,8 +174,6 @@ mFirstIteration(true)
 
 void cedar::proc::steps::Delay::inputConnectionChanged(const std::string& inputName)
 {
-  // TODO: you may want to replace this code by using a cedar::proc::InputSlotHelper
-
   // Again, let's first make sure that this is really the input in case anyone ever changes our interface.
   CEDAR_DEBUG_ASSERT(inputName == "input");
 
@@ -123,7 +185,6 @@ void cedar::proc::steps::Delay::inputConnectionChanged(const std::string& inputN
   {
     // no input -> no output
     this->mOutput->setData(cv::Mat());
-    this->mOldInput->setData(cv::Mat());
     output_changed = true;
   }
   else
@@ -139,11 +200,12 @@ void cedar::proc::steps::Delay::inputConnectionChanged(const std::string& inputN
 
     // Make a copy to create a matrix of the same type, dimensions, ...
     this->mOutput->setData(input.clone());
-    this->mOldInput->setData(input.clone());
 
     this->mOutput->copyAnnotationsFrom(this->mInput);
   }
 
+  this->allocateBuffer();
+
   if (output_changed)
   {
     this->emitOutputPropertiesChangedSignal("output");
@@ -152,23 +214,175 @@ void cedar::proc::steps::Delay::inputConnectionChanged(const std::string& inputN
   mFirstIteration= true;
 }
 
+void cedar::proc::steps::Delay::delayUnitChanged()
+{
+  bool by_time = this->_mDelayUnit->getValue() == cedar::proc::steps::Delay::DelayUnit::TIME;
+  this->_mDelaySteps->setHidden(by_time);
+  this->_mDelayTime->setHidden(!by_time);
+  this->_mBufferSize->setHidden(!by_time);
+  this->_mInterpolation->setHidden(!by_time);
+
+  this->bufferParameterChanged();
+}
+
+void cedar::proc::steps::Delay::bufferParameterChanged()
+{
+  // the output is locked while computing, so this makes sure that the buffer is not reallocated during a compute call
+  QWriteLocker locker(&this->mOutput->getLock());
+  this->allocateBuffer();
+}
+
+unsigned int cedar::proc::steps::Delay::getRequiredBufferCapacity() const
+{
+  if (this->_mDelayUnit->getValue() == cedar::proc::steps::Delay::DelayUnit::TIME)
+  {
+    return this->_mBufferSize->getValue();
+  }
+  else
+  {
+    // the current input plus one frame per step of delay
+    return this->_mDelaySteps->getValue() + 1;
+  }
+}
+
+unsigned int cedar::proc::steps::Delay::getBufferCapacity() const
+{
+  return static_cast<unsigned int>(this->mFrames.size());
+}
+
+void cedar::proc::steps::Delay::allocateBuffer()
+{
+  this->mNewestFrame = 0;
+  this->mNumberOfStoredFrames = 0;
+  this->mBufferTooShortWarningIssued = false;
+
+  if (!this->mInput)
+  {
+    this->mFrames.clear();
+    this->mFrameTimes.clear();
+    return;
+  }
+
+  const cv::Mat& input = this->mInput->getData();
+  unsigned int capacity = this->getRequiredBufferCapacity();
+  this->mFrames.resize(capacity);
+  this->mFrameTimes.assign(capacity, 0.0);
+  for (auto& frame : this->mFrames)
+  {
+    // does nothing if the frame already has the right size and type
+    frame.create(input.dims, input.size.p, input.type());
+  }
+}
+
+const cv::Mat& cedar::proc::steps::Delay::getFrame(unsigned int age) const
+{
+  CEDAR_DEBUG_ASSERT(age < this->mNumberOfStoredFrames);
+  return this->mFrames.at((this->mNewestFrame + this->mFrames.size() - age) % this->mFrames.size());
+}
+
+double cedar::proc::steps::Delay::getFrameTime(unsigned int age) const
+{
+  CEDAR_DEBUG_ASSERT(age < this->mNumberOfStoredFrames);
+  return this->mFrameTimes.at((this->mNewestFrame + this->mFrameTimes.size() - age) % this->mFrameTimes.size());
+}
+
+void cedar::proc::steps::Delay::writeTimeDelayedOutput(double delayedTime, cv::Mat& output)
+{
+  // find the newest frame that was stored at or before the delayed time
+  unsigned int age = 0;
+  while (age < this->mNumberOfStoredFrames && this->getFrameTime(age) > delayedTime)
+  {
+    ++age;
+  }
+
+  if (age == this->mNumberOfStoredFrames)
+  {
+    // the buffer does not reach back far enough; use the oldest frame available
+    if (this->mNumberOfStoredFrames == this->mFrames.size() && !this->mBufferTooShortWarningIssued)
+    {
+      this->mBufferTooShortWarningIssued = true;
+      cedar::aux::LogSingleton::getInstance()->warning
+      (
+        "The buffer of \"" + this->getName() + "\" does not cover the delay time. Increase its buffer size.",
+        CEDAR_CURRENT_FUNCTION_NAME
+      );
+    }
+    this->getFrame(this->mNumberOfStoredFrames - 1).copyTo(output);
+    return;
+  }
+
+  if (age == 0)
+  {
+    // the delayed time is not older than the newest frame (i.e., there is no delay)
+    this->getFrame(0).copyTo(output);
+    return;
+  }
+
+  // the delayed time lies between this frame and the next newer one
+  const cv::Mat& older = this->getFrame(age);
+  const cv::Mat& newer = this->getFrame(age - 1);
+  double older_time = this->getFrameTime(age);
+  double newer_time = this->getFrameTime(age - 1);
+  double weight = (newer_time > older_time) ? (delayedTime - older_time) / (newer_time - older_time) : 0.0;
+
+  switch (this->_mInterpolation->getValue())
+  {
+    case cedar::proc::steps::Delay::Interpolation::LINEAR:
+      cv::addWeighted(older, 1.0 - weight, newer, weight, 0.0, output);
+      break;
+
+    case cedar::proc::steps::Delay::Interpolation::NEAREST:
+    default:
+      if (weight < 0.5)
+      {
+        older.copyTo(output);
+      }
+      else
+      {
+        newer.copyTo(output);
+      }
+  }
+}
+
 void cedar::proc::steps::Delay::compute(const cedar::proc::Arguments& )//arguments)
 {
   cedar::unit::Time newtime = cedar::aux::GlobalClockSingleton::getInstance()->getTime();
+  double now = newtime / boost::units::si::second;
+
+  const cv::Mat& input = this->mInput->getData();
+  cv::Mat& output = this->mOutput->getData();
+
+  if (this->mFrames.empty() || this->mFrames.front().type() != input.type() || this->mFrames.front().size != input.size)
+  {
+    // the input changed its size or type since the buffer was allocated
+    this->allocateBuffer();
+  }
+
+  // store the input in the oldest frame; this only copies, as all frames already have the size of the input
+  this->mNewestFrame = (this->mNewestFrame + 1) % this->mFrames.size();
+  input.copyTo(this->mFrames.at(this->mNewestFrame));
+  this->mFrameTimes.at(this->mNewestFrame) = now;
+  this->mNumberOfStoredFrames = std::min(this->mNumberOfStoredFrames + 1, this->getBufferCapacity());
+
+  if (this->_mDelayUnit->getValue() == cedar::proc::steps::Delay::DelayUnit::TIME)
+  {
+    this->writeTimeDelayedOutput(now - this->_mDelayTime->getValue() / boost::units::si::second, output);
+  }
+  else
+  {
+    // before enough inputs have been stored, the oldest one is used so that there are no big jumps
+    unsigned int age = std::min(this->_mDelaySteps->getValue(), this->mNumberOfStoredFrames - 1);
+    this->getFrame(age).copyTo(output);
+  }
 
   if (mFirstIteration)
   {
     // no changes, dont generate big jumps
-    this->mOutput->setData( this->mInput->getData().clone() );
     this->mOutputTimeStep->getData().at<float>(0,0)= 0;
     mFirstIteration= false;
   }
   else
   {
-    this->mOutput->setData( this->mOldInput->getData().clone() );
-    this->mOldInput->setData( this->mInput->getData().clone() );
-
-
     this->mOutputTimeStep->getData().at<float>(0,0)= (newtime - mLastTime) / boost::units::si::second;
   }
 
@@ -178,5 +392,7 @@ void cedar::proc::steps::Delay::compute(const cedar::proc::Arguments& )//argumen
 void cedar::proc::steps::Delay::reset()
 {
   mFirstIteration= true;
+  this->mNewestFrame = 0;
+  this->mNumberOfStoredFrames = 0;
+  this->mBufferTooShortWarningIssued = false;
 }
-
@@ -44,23 +44,121 @@
 #include <cedar/processing/Step.h>
 #include <cedar/processing/InputSlotHelper.h>
 #include <cedar/auxiliaries/MatData.h>
+#include "cedar/auxiliaries/EnumParameter.h"
+#include "cedar/auxiliaries/UIntParameter.h"
+#include "cedar/auxiliaries/TimeParameter.h"
 #include "cedar/units/Time.h"
 
 // FORWARD DECLARATIONS
 #include "cedar/processing/steps/Delay.fwd.h"
 
 // SYSTEM INCLUDES
+#include <vector>
 
 
-/*!@todo describe.
+/*!@brief Delays its input by a number of time steps or by a duration.
  *
- * @todo describe more.
+ *        The last inputs are kept in a ring buffer of frames that are allocated once, when the input or the buffer
+ *        parameters change; delaying an input thus makes no allocations while the step is running.
+ *
+ *        When delaying by time, each frame is stamped with the time of the global clock when it was stored. The output
+ *        is either the frame closest to the delayed time or a linear interpolation of the two frames around it, so
+ *        varying step sizes are handled correctly. If the buffer does not reach back far enough, the oldest frame is
+ *        used.
+ *
+ *        Until enough inputs have been seen, the output is the oldest input available, so there are no jumps from
+ *        zero at the start.
  */
 class cedar::proc::steps::Delay : public cedar::proc::Step
 {
+  //--------------------------------------------------------------------------------------------------------------------
+  // macros
+  //--------------------------------------------------------------------------------------------------------------------
+  Q_OBJECT
+
   //--------------------------------------------------------------------------------------------------------------------
   // nested types
   //--------------------------------------------------------------------------------------------------------------------
+public:
+  //! Enum describing whether the delay is given as a number of steps or as a time.
+  class DelayUnit
+  {
+    public:
+      //! Typedef for the enum id.
+      typedef cedar::aux::EnumId Id;
+
+      //! Shared-pointer typedef for the base type pointer.
+      typedef boost::shared_ptr<cedar::aux::EnumBase> TypePtr;
+
+      //! Static constructor function.
+      static void construct()
+      {
+        mType.type()->def(cedar::aux::Enum(STEPS, "STEPS", "steps"));
+        mType.type()->def(cedar::aux::Enum(TIME, "TIME", "time"));
+      }
+
+      //! Returns a const reference to the enum's type object.
+      static const cedar::aux::EnumBase& type()
+      {
+        return *mType.type();
+      }
+
+      //! Returns a const reference to the pointer of the enum's type object.
+      static const TypePtr& typePtr()
+      {
+        return mType.type();
+      }
+
+      //! The input is delayed by a fixed number of compute calls.
+      static const Id STEPS = 0;
+
+      //! The input is delayed by a fixed time.
+      static const Id TIME = 1;
+
+    private:
+      //! Static pointer to the cedar::aux::EnumType object that manages the enum values.
+      static cedar::aux::EnumType<DelayUnit> mType;
+  };
+
+  //! Enum describing how outputs that fall between two buffered frames are computed.
+  class Interpolation
+  {
+    public:
+      //! Typedef for the enum id.
+      typedef cedar::aux::EnumId Id;
+
+      //! Shared-pointer typedef for the base type pointer.
+      typedef boost::shared_ptr<cedar::aux::EnumBase> TypePtr;
+
+      //! Static constructor function.
+      static void construct()
+      {
+        mType.type()->def(cedar::aux::Enum(NEAREST, "NEAREST", "Nearest"));
+        mType.type()->def(cedar::aux::Enum(LINEAR, "LINEAR", "Linear"));
+      }
+
+      //! Returns a const reference to the enum's type object.
+      static const cedar::aux::EnumBase& type()
+      {
+        return *mType.type();
+      }
+
+      //! Returns a const reference to the pointer of the enum's type object.
+      static const TypePtr& typePtr()
+      {
+        return mType.type();
+      }
+
+      //! The frame closest to the delayed time is used.
+      static const Id NEAREST = 0;
+
+      //! The two frames around the delayed time are interpolated linearly.
+      static const Id LINEAR = 1;
+
+    private:
+      //! Static pointer to the cedar::aux::EnumType object that manages the enum values.
+      static cedar::aux::EnumType<Interpolation> mType;
+  };
 
   //--------------------------------------------------------------------------------------------------------------------
   // constructors and destructor
@@ -73,7 +171,8 @@ public:
   // public methods
   //--------------------------------------------------------------------------------------------------------------------
 public:
-  // none yet
+  //! Returns the number of frames the ring buffer currently holds memory for.
+  unsigned int getBufferCapacity() const;
 
   //--------------------------------------------------------------------------------------------------------------------
   // protected methods
@@ -89,6 +188,28 @@ private:
 
   void compute(const cedar::proc::Arguments& arguments);
 
+  //! Allocates the frames of the ring buffer for the current input and parameters. This discards the buffered inputs.
+  void allocateBuffer();
+
+  //! Returns the number of frames needed for the current parameters.
+  unsigned int getRequiredBufferCapacity() const;
+
+  //! Returns the frame that was stored the given number of compute calls ago.
+  const cv::Mat& getFrame(unsigned int age) const;
+
+  //! Returns the time at which the frame of the given age was stored, in seconds.
+  double getFrameTime(unsigned int age) const;
+
+  //! Writes the input as it was the given time ago into the output.
+  void writeTimeDelayedOutput(double delayedTime, cv::Mat& output);
+
+private slots:
+  //! Reallocates the buffer when one of the parameters that determine its size changes.
+  void bufferParameterChanged();
+
+  //! Shows only the parameters that apply to the selected unit.
+  void delayUnitChanged();
+
   //--------------------------------------------------------------------------------------------------------------------
   // members
   //--------------------------------------------------------------------------------------------------------------------
@@ -102,7 +223,20 @@ private:
   cedar::aux::MatDataPtr mOutput;
   cedar::aux::MatDataPtr mOutputTimeStep;
 
-  cedar::aux::MatDataPtr mOldInput;
+  //! The frames of the ring buffer.
+  std::vector<cv::Mat> mFrames;
+
+  //! The times (in seconds) at which the frames in mFrames were stored.
+  std::vector<double> mFrameTimes;
+
+  //! Index of the most recently stored frame in mFrames.
+  unsigned int mNewestFrame;
+
+  //! Number of frames in mFrames that hold an input.
+  unsigned int mNumberOfStoredFrames;
+
+  //! Whether a warning about a buffer that is too short for the delay time has been issued already.
+  bool mBufferTooShortWarningIssued;
 
   //--------------------------------------------------------------------------------------------------------------------
   // parameters
@@ -114,6 +248,21 @@ private:
   cedar::unit::Time mLastTime;
   bool              mFirstIteration;
 
+  //! Whether the delay is given in steps or as a time.
+  cedar::aux::EnumParameterPtr _mDelayUnit;
+
+  //! Number of compute calls by which the input is delayed.
+  cedar::aux::UIntParameterPtr _mDelaySteps;
+
+  //! Time by which the input is delayed.
+  cedar::aux::TimeParameterPtr _mDelayTime;
+
+  //! Number of frames kept when delaying by time; this must cover the delay time at the smallest expected step size.
+  cedar::aux::UIntParameterPtr _mBufferSize;
+
+  //! How the output is computed from the frames around the delayed time.
+  cedar::aux::EnumParameterPtr _mInterpolation;
+
 }; // class cedar::proc::steps::Delay
 
 #endif // PROC_STEPS_DELAY_H
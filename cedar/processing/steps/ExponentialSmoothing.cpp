@@ -169,14 +169,14 @@ void cedar::proc::steps::ExponentialSmoothing::recompute()
 
   cv::Mat input_mat = data->getData();
 
-  cv::Mat out_mat;
+  cv::Mat& out_mat = this->mOutput->getData();
 
   // first time step:
   if (mDataEstimate.empty())
   {
     mDataEstimate= input_mat.clone(); // prepare
 
-    out_mat= input_mat.clone(); // no filtering yet
+    input_mat.copyTo(out_mat); // no filtering yet
   }
   else if (mTrendEstimate.empty())
   {
@@ -184,41 +184,28 @@ void cedar::proc::steps::ExponentialSmoothing::recompute()
     mTrendEstimate= input_mat - mDataEstimate;
     mDataEstimate= input_mat.clone();
 
-    out_mat= input_mat.clone(); // no filtering yet
+    input_mat.copyTo(out_mat); // no filtering yet
   }
   else
   {
     auto alpha = mDataSmoothingFactor->getValue();
     auto gamma = mTrendSmoothingFactor->getValue();
 
-    // smoothed data:
-    cv::Mat last_data_estimate = mDataEstimate.clone();
-    cv::Mat new_data_estimate;
+    // the estimates are updated in place, so no memory is allocated in steady state
+    mDataEstimate.copyTo(mLastDataEstimate);
 
-    // best trend estimate (i.e. where the data is going ...)
-    cv::Mat last_trend_estimate = mTrendEstimate.clone();
-    cv::Mat new_trend_estimate;
+    // smoothed data: mix of new data and last forecast (last data estimate + last trend estimate)
+    cv::add(mDataEstimate, mTrendEstimate, mDataEstimate);
+    cv::addWeighted(input_mat, alpha, mDataEstimate, 1 - alpha, 0.0, mDataEstimate);
 
-    // mix of new data and last forecast:
-    new_data_estimate= alpha * input_mat
-                        + ( 1 - alpha ) 
-                          // and the last forecast:
-                          * ( last_data_estimate
-                             + last_trend_estimate ); 
-
-    // mix of new and last trend estimates:
-    new_trend_estimate= gamma * ( new_data_estimate - last_data_estimate )
-                        + ( 1 - gamma ) * last_trend_estimate;
+    // best trend estimate (i.e. where the data is going ...): mix of new and last trend estimates
+    cv::subtract(mDataEstimate, mLastDataEstimate, mLastDataEstimate);
+    cv::addWeighted(mLastDataEstimate, gamma, mTrendEstimate, 1 - gamma, 0.0, mTrendEstimate);
 
     // the new forecast:
-    out_mat = new_data_estimate + new_trend_estimate;
-
-    mDataEstimate= new_data_estimate;
-    mTrendEstimate= new_trend_estimate;
+    cv::add(mDataEstimate, mTrendEstimate, out_mat);
   }
 
-
-  this->mOutput->setData(out_mat);
   //this->mOutput->cloneAnnotationsFrom(this->mInput);
 }
 
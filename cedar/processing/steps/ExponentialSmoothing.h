@@ -106,6 +106,9 @@ private:
 
   cv::Mat mDataEstimate;
   cv::Mat mTrendEstimate;
+
+  //! Data estimate of the previous step; a member so that its memory is reused.
+  cv::Mat mLastDataEstimate;
   //--------------------------------------------------------------------------------------------------------------------
   // parameters
   //--------------------------------------------------------------------------------------------------------------------
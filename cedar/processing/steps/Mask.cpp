@@ -220,7 +220,7 @@ void cedar::proc::steps::Mask::compute(const cedar::proc::Arguments&)
 
     if (input.channels() == mask.channels())
     {
-      output = input.mul(mask);
+      cv::multiply(input, mask, output);
     }
     else
     {
@@ -387,5 +387,6 @@ void cedar::proc::steps::MatrixSlice::compute(const cedar::proc::Arguments&)
   CEDAR_DEBUG_ASSERT(this->_mRangeLower->size() == cedar::aux::math::getDimensionalityOf(input));
   CEDAR_DEBUG_ASSERT(this->_mRangeUpper->size() == cedar::aux::math::getDimensionalityOf(input));
 
-  output = input(&mRanges.front()).clone();
+  // copies into the existing output; this only allocates if the slice's size changed
+  input(&mRanges.front()).copyTo(output);
 }
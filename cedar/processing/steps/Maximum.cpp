@@ -111,37 +111,31 @@ mOutput(new cedar::aux::MatData(cv::Mat::zeros(1, 1, CV_32F)))
 
 void cedar::proc::steps::Maximum::sumSlot(cedar::proc::ExternalDataPtr slot, cv::Mat& sum, bool lock)
 {
-  cv::Mat tmp;
+  // the result is written into sum directly; this only allocates if its size or type changes
+  bool first = true;
 
   for (size_t i = 0; i < slot->getDataCount(); ++i)
   {
     auto mat_data = boost::dynamic_pointer_cast<cedar::aux::MatData>(slot->getData(i));
     if (mat_data)
     {
-      boost::shared_ptr<QReadLocker> locker;
-      if (lock)
-      {
-        locker = boost::shared_ptr<QReadLocker>(new QReadLocker(&mat_data->getLock()));
-      }
+      // a locker without a lock does nothing
+      QReadLocker locker(lock ? &mat_data->getLock() : nullptr);
 
-      cv::Mat& input_mat = mat_data->getData();
+      const cv::Mat& input_mat = mat_data->getData();
 
-      if (tmp.empty())
+      if (first || sum.empty())
       {
-        tmp= input_mat.clone();
+        input_mat.copyTo(sum);
+        first = false;
       }
       else
       {
-        tmp= cv::max( tmp.clone(), input_mat );
+        cv::max(sum, input_mat, sum);
       }
 
     }
   }
-
-  if (!tmp.empty())
-  {
-    sum= tmp;
-  }
 }
 
 void cedar::proc::steps::Maximum::compute(const cedar::proc::Arguments&)
@@ -231,15 +231,18 @@ void cedar::proc::steps::NumericalIntegration::recompute()
 
   cv::Mat input_mat = data->getData();
 
-  cv::Mat out_mat;
+  cv::Mat& out_mat = this->mOutput->getData();
 
+  // shift the history; the memory of the entry that dropped out last time is reused for the new one
   cv::Mat five_back;
 
   five_back= mFourBack;
   mFourBack= mThreeBack;
   mThreeBack= mTwoBack;
   mTwoBack= mOneBack;
-  mOneBack= mLastState.clone(); // !! not the input !!
+  mOneBack= mRecycledBack;
+  mLastState.copyTo(mOneBack); // !! not the input !!
+  mRecycledBack= five_back;
 
   cedar::unit::Time newtime = cedar::aux::GlobalClockSingleton::getInstance()->getTime();
 
@@ -274,41 +277,28 @@ void cedar::proc::steps::NumericalIntegration::recompute()
     return; // ignore here, will treat in reset()
   }
 
+  // all results are written into the existing output with in-place operations, so no memory is allocated in steady
+  // state
   if (mUseBDF5->getValue())
   {
     if (mOneBack.empty())
     {
       reinitialize();
-      out_mat= mLastState.clone();
+      mLastState.copyTo(out_mat);
     }
-    else if (mTwoBack.empty())
+    else if (mTwoBack.empty() || mThreeBack.empty() || mFourBack.empty())
     {
       // use Euler:
-      out_mat= mLastState
-               + dt * mOneBack;
-    }
-    else if (mThreeBack.empty())
-    {
-      // use Euler:
-      out_mat= mLastState
-               + dt * mOneBack;
-    }
-    else if (mFourBack.empty())
-    {
-      // use Euler:
-      out_mat= mLastState
-               + dt * mOneBack;
+      cv::scaleAdd(mOneBack, dt, mLastState, out_mat);
     }
     else
     {
       // BDF 5
-      out_mat= ( 300.0 * mOneBack
-                    -300.0 * mTwoBack
-                    + 200.0 * mThreeBack
-                    -75.0 * mFourBack
-                    + 12.0 * five_back
-                    + 60.0 * dt * input_mat)
-                  / 137.0;
+      cv::addWeighted(mOneBack, 300.0 / 137.0, mTwoBack, -300.0 / 137.0, 0.0, out_mat);
+      cv::scaleAdd(mThreeBack, 200.0 / 137.0, out_mat, out_mat);
+      cv::scaleAdd(mFourBack, -75.0 / 137.0, out_mat, out_mat);
+      cv::scaleAdd(five_back, 12.0 / 137.0, out_mat, out_mat);
+      cv::scaleAdd(input_mat, 60.0 * dt / 137.0, out_mat, out_mat);
     }
   }
   else
@@ -316,22 +306,21 @@ void cedar::proc::steps::NumericalIntegration::recompute()
     if (mOneBack.empty())
     {
       reinitialize();
+      out_mat= cv::Mat();
     }
     else
     {
       // use Euler:
-      out_mat = mLastState 
-                + dt * input_mat;
+      cv::scaleAdd(input_mat, dt, mLastState, out_mat);
     }
   }
 
 
   if (!out_mat.empty())
   {
-    mLastState= out_mat.clone();
+    out_mat.copyTo(mLastState);
   }
 
-  this->mOutput->setData(out_mat);
   //this->mOutput->cloneAnnotationsFrom(this->mInput);
 }
 
@@ -112,6 +112,9 @@ private:
   cv::Mat mThreeBack;
   cv::Mat mFourBack;
 
+  //! Memory of the history entry that dropped out last; reused for the next entry so that no memory is allocated.
+  cv::Mat mRecycledBack;
+
   cv::Mat mLastState;
 
   //--------------------------------------------------------------------------------------------------------------------
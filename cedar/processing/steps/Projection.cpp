@@ -126,6 +126,8 @@ _mCompressionType(new cedar::aux::EnumParameter(
   QObject::connect(_mCompressionType.get(), SIGNAL(valueChanged()), this, SLOT(reconfigure()), Qt::DirectConnection);
   QObject::connect(_mOutputDimensionality.get(), SIGNAL(valueChanged()), this, SLOT(outputDimensionalityChanged()), Qt::DirectConnection);
   QObject::connect(_mOutputDimensionSizes.get(), SIGNAL(valueChanged()), this, SLOT(outputDimensionSizesChanged()), Qt::DirectConnection);
+
+  this->setPure(true);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
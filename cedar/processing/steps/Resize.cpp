@@ -44,6 +44,7 @@
 #include "cedar/auxiliaries/exceptions.h"
 #include "cedar/auxiliaries/math/tools.h"
 #include "cedar/auxiliaries/MatrixIterator.h"
+#include "cedar/auxiliaries/parallelFunctions.h"
 #include "cedar/auxiliaries/MatData.h"
 
 // SYSTEM INCLUDES
@@ -124,6 +125,8 @@ _mInterpolationType(new cedar::aux::EnumParameter(this,
   // connect the parameter's change signal
   QObject::connect(_mOutputSize.get(), SIGNAL(valueChanged()), this, SLOT(outputSizeChanged()), Qt::DirectConnection);
   QObject::connect(_mInterpolationType.get(), SIGNAL(valueChanged()), this, SLOT(recompute()), Qt::DirectConnection);
+
+  this->setPure(true);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -176,13 +179,28 @@ void cedar::proc::steps::Resize::compute(const cedar::proc::Arguments&)
           this->_mInterpolationType->setValue(cedar::proc::steps::Resize::Interpolation::LINEAR);
         case cedar::proc::steps::Resize::Interpolation::LINEAR:
         {
-          cedar::aux::MatrixIterator iter(output);
-          do
+          // each entry is interpolated independently, so slices along the first dimension are resized in parallel
+          auto resize_slices = [&](int begin, int end)
           {
-            double interpolated_value = this->linearInterpolationND(input, output, iter.getCurrentIndexVector());
-            cedar::aux::math::assignMatrixEntry(output, iter.getCurrentIndexVector(), interpolated_value);
-          }
-          while (iter.increment());
+            // iterates over the entries of one slice; the index along the first dimension is then set per slice
+            std::vector<int> slice_sizes(output.size.p, output.size.p + output.dims);
+            slice_sizes.at(0) = 1;
+            cv::Mat slice_shape(output.dims, &slice_sizes.front(), output.type(), output.data);
+            std::vector<int> index;
+            for (int slice = begin; slice < end; ++slice)
+            {
+              cedar::aux::MatrixIterator iter(slice_shape);
+              do
+              {
+                index = iter.getCurrentIndexVector();
+                index.at(0) = slice;
+                double interpolated_value = this->linearInterpolationND(input, output, index);
+                cedar::aux::math::assignMatrixEntry(output, index, interpolated_value);
+              }
+              while (iter.increment());
+            }
+          };
+          cedar::aux::parallelForSlices(output, resize_slices);
           break;
         }
       }
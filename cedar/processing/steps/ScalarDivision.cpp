@@ -123,11 +123,12 @@ void cedar::proc::steps::ScalarDivision::compute(const cedar::proc::Arguments&)
 
   if (this->_mTreatDivZero->getValue() && std::abs(divisor) <= std::numeric_limits<float>::epsilon())
   {
-    this->mResult->setData(matrix / this->_mDivZeroReplacement->getValue());
+    matrix.convertTo(this->mResult->getData(), -1, 1.0 / this->_mDivZeroReplacement->getValue());
   }
   else
   {
-    this->mResult->setData(matrix / divisor);
+    // dividing by scaling writes into the existing result instead of allocating a new matrix
+    matrix.convertTo(this->mResult->getData(), -1, 1.0 / divisor);
   }
 }
 
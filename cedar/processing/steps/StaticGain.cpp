@@ -98,6 +98,8 @@ _mGainFactor(new cedar::aux::DoubleParameter(this, "gain factor", 1.0, -10000.0,
 
   // connect the parameter's change signal
   QObject::connect(_mGainFactor.get(), SIGNAL(valueChanged()), this, SLOT(gainChanged()));
+
+  this->setPure(true);
 }
 //----------------------------------------------------------------------------------------------------------------------
 // methods
@@ -105,8 +107,8 @@ _mGainFactor(new cedar::aux::DoubleParameter(this, "gain factor", 1.0, -10000.0,
 
 void cedar::proc::steps::StaticGain::compute(const cedar::proc::Arguments&)
 {
-  // the result is simply input * gain.
-  this->mOutput->setData(this->mInput->getData() * this->_mGainFactor->getValue());
+  // the result is simply input * gain; convertTo writes into the existing output unless its size or type changed
+  this->mInput->getData().convertTo(this->mOutput->getData(), -1, this->_mGainFactor->getValue());
 }
 
 void cedar::proc::steps::StaticGain::gainChanged()
@@ -100,9 +100,14 @@ mOutput(new cedar::aux::MatData(cv::Mat::zeros(1, 1, CV_32F)))
   sum_check.addCheck(type_check);
 
   input_slot->setCheck(sum_check);
+  // publishing terms are summed from their snapshots, so they need not be locked while computing
+  cedar::aux::asserted_pointer_cast<cedar::proc::ExternalData>(input_slot)->setReadsSnapshots(true);
 
   this->declareOutput("sum", this->mOutput);
 
+  // constant terms such as the output of cedar::proc::sources::GaussInput keep their revision, so the sum is skipped
+  this->setPure(true);
+
   this->mInputs = this->getInputSlot("terms");
 }
 //----------------------------------------------------------------------------------------------------------------------
@@ -119,13 +124,16 @@ void cedar::proc::steps::Sum::sumSlot(cedar::proc::ExternalDataPtr slot, cv::Mat
     auto mat_data = boost::dynamic_pointer_cast<cedar::aux::MatData>(slot->getData(i));
     if (mat_data)
     {
-      boost::shared_ptr<QReadLocker> locker;
-      if (lock)
+      // publishing data is read from its last snapshot, which needs no lock (see cedar::aux::MatData::publish)
+      cedar::aux::MatData::ConstSnapshotPtr snapshot;
+      if (mat_data->isPublishing())
       {
-        locker = boost::shared_ptr<QReadLocker>(new QReadLocker(&mat_data->getLock()));
+        snapshot = mat_data->getSnapshot();
       }
+      // a locker without a lock does nothing; this avoids allocating the locker on the heap
+      QReadLocker locker(lock && !snapshot ? &mat_data->getLock() : nullptr);
 
-      cv::Mat& input_mat = mat_data->getData();
+      const cv::Mat& input_mat = snapshot ? snapshot->mData : mat_data->getData();
 
       unsigned int input_dim = cedar::aux::math::getDimensionalityOf(input_mat);
       if (input_dim == 0)
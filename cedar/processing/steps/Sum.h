@@ -73,6 +73,7 @@ public:
    *
    * @remarks This function assumes that the output matrix, sum, is initialized to the appropriate size, and that all
    *          matrices in the slot are the same size (0D matrices are treated as scalar additions).
+   *          Matrices in publishing mode are read from their snapshots without locking them.
    */
   static void sumSlot(cedar::proc::ExternalDataPtr slot, cv::Mat& sum, bool lock = false);
 
@@ -118,6 +118,8 @@ _mUpperThresholdValue(new cedar::aux::DoubleParameter(this, "upper threshold", 2
 
   this->applyLowerThesholdChanged();
   this->applyUpperThesholdChanged();
+
+  this->setPure(true);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -130,8 +130,8 @@ void cedar::proc::steps::TransferFunction::compute(const cedar::proc::Arguments&
   const cv::Mat& input = this->mInput->getData();
   cv::Mat& sigmoid_u = this->mOutput->getData();
 
-  // calculate output
-  sigmoid_u = _mTransferFunction->getValue()->compute(input);
+  // calculate output; this reuses the memory of the output
+  _mTransferFunction->getValue()->compute(input, sigmoid_u);
 }
 
 void cedar::proc::steps::TransferFunction::inputConnectionChanged(const std::string& inputName)
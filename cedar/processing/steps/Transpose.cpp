@@ -142,5 +142,6 @@ mTransposed(new cedar::aux::MatData(cv::Mat()))
 
 void cedar::proc::steps::Transpose::compute(const cedar::proc::Arguments&)
 {
-  this->mTransposed->setData(this->mInput.getData().t());
+  // transposes into the existing output; this only allocates if the input's size changed
+  cv::transpose(this->mInput.getData(), this->mTransposed->getData());
 }
@@ -212,23 +212,24 @@ void cedar::proc::steps::VariableGauss::recompute()
   if (mat.empty())
     return;
 
-  std::vector<double> tmpvec{ static_cast<double>(mat.at<float>(0,0)) };
+  this->mCenters.resize(mat.rows > 1 ? 2 : 1);
+  this->mCenters.at(0) = static_cast<double>(mat.at<float>(0,0));
 
   if (mat.rows > 1 )
-    tmpvec.push_back( static_cast<double>(mat.at<float>(1,0) ) );
-
-  this->mOutput->setData
-                 (
-                   cedar::aux::math::gaussMatrix
-                   (
-                     _mDimensionality->getValue(),
-                     _mSizes->getValue(),
-                     _mAmplitude->getValue(),
-                     _mSigmas->getValue(),
-                     tmpvec,
-                     false // cyclic
-                   )
-                 );
+    this->mCenters.at(1) = static_cast<double>(mat.at<float>(1,0));
+
+  // write into the existing output; this only allocates if the sizes changed
+  cedar::aux::math::gaussMatrix
+  (
+    _mDimensionality->getValue(),
+    _mSizes->getValue(),
+    _mAmplitude->getValue(),
+    _mSigmas->getValue(),
+    this->mCenters,
+    false, // cyclic
+    this->mOutput->getData(),
+    this->mGaussProfiles
+  );
 }
 
 
@@ -51,6 +51,8 @@
 #include "cedar/processing/steps/VariableGauss.fwd.h"
 
 // SYSTEM INCLUDES
+#include <opencv2/opencv.hpp>
+#include <vector>
 
 
 /*!@brief Generates a matrix with a box input at a specified position, amplitude, and extent.
@@ -119,6 +121,11 @@ protected:
   //!@brief the buffer containing the output
   cedar::aux::MatDataPtr mOutput;
 private:
+  //! The centers read from the input; kept as a member so that its memory is reused.
+  std::vector<double> mCenters;
+
+  //! One-dimensional profiles of the output Gaussian (see cedar::aux::math::gaussMatrix).
+  std::vector<cv::Mat> mGaussProfiles;
 
   //--------------------------------------------------------------------------------------------------------------------
   // parameters
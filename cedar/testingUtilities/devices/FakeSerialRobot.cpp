@@ -0,0 +1,210 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        FakeSerialRobot.cpp
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 18
+
+    Description: Stands in for a K-Team robot on the other side of a pseudo terminal.
+
+    Credits:
+
+======================================================================================================================*/
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CEDAR INCLUDES
+#include "cedar/testingUtilities/devices/FakeSerialRobot.h"
+
+// SYSTEM INCLUDES
+#include <cctype>
+#include <iostream>
+#ifndef CEDAR_OS_WINDOWS
+  #include <fcntl.h>
+  #include <poll.h>
+  #include <stdlib.h>
+  #include <unistd.h>
+#endif // CEDAR_OS_WINDOWS
+
+//----------------------------------------------------------------------------------------------------------------------
+// constructors and destructor
+//----------------------------------------------------------------------------------------------------------------------
+
+cedar::test::dev::FakeSerialRobot::FakeSerialRobot()
+:
+mMaster(-1),
+mStop(false),
+mCommandsReceived(0),
+mLargestBatch(0)
+{
+#ifndef CEDAR_OS_WINDOWS
+  this->mMaster = posix_openpt(O_RDWR | O_NOCTTY);
+  if (this->mMaster >= 0 && grantpt(this->mMaster) == 0 && unlockpt(this->mMaster) == 0)
+  {
+    this->mSlavePath = ptsname(this->mMaster);
+  }
+#endif // CEDAR_OS_WINDOWS
+}
+
+cedar::test::dev::FakeSerialRobot::~FakeSerialRobot()
+{
+  this->stop();
+#ifndef CEDAR_OS_WINDOWS
+  if (this->mMaster >= 0)
+  {
+    close(this->mMaster);
+  }
+#endif // CEDAR_OS_WINDOWS
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// methods
+//----------------------------------------------------------------------------------------------------------------------
+
+bool cedar::test::dev::FakeSerialRobot::isValid() const
+{
+  return !this->mSlavePath.empty();
+}
+
+const std::string& cedar::test::dev::FakeSerialRobot::getSlavePath() const
+{
+  return this->mSlavePath;
+}
+
+void cedar::test::dev::FakeSerialRobot::start()
+{
+  if (this->isValid() && !this->mThread.joinable())
+  {
+    this->mStop = false;
+    this->mThread = std::thread(&cedar::test::dev::FakeSerialRobot::run, this);
+  }
+}
+
+void cedar::test::dev::FakeSerialRobot::stop()
+{
+  this->mStop = true;
+  if (this->mThread.joinable())
+  {
+    this->mThread.join();
+  }
+}
+
+void cedar::test::dev::FakeSerialRobot::setAnswer(const std::string& command, const std::string& answer)
+{
+  std::lock_guard<std::mutex> lock(this->mCommandsLock);
+  this->mAnswers[command] = answer;
+}
+
+unsigned int cedar::test::dev::FakeSerialRobot::getNumberOfCommandsReceived() const
+{
+  return this->mCommandsReceived;
+}
+
+unsigned int cedar::test::dev::FakeSerialRobot::getNumberOfCommandsReceived(const std::string& command) const
+{
+  std::lock_guard<std::mutex> lock(this->mCommandsLock);
+  auto iter = this->mCommandCounts.find(command);
+  if (iter == this->mCommandCounts.end())
+  {
+    return 0;
+  }
+  return iter->second;
+}
+
+unsigned int cedar::test::dev::FakeSerialRobot::getLargestBatch() const
+{
+  return this->mLargestBatch;
+}
+
+std::string cedar::test::dev::FakeSerialRobot::answer(const std::string& command)
+{
+  std::string name = command.substr(0, command.find(','));
+
+  std::lock_guard<std::mutex> lock(this->mCommandsLock);
+  ++this->mCommandCounts[name];
+
+  auto iter = this->mAnswers.find(name);
+  if (iter != this->mAnswers.end())
+  {
+    return iter->second;
+  }
+
+  std::string answer = command;
+  if (!answer.empty())
+  {
+    answer[0] = static_cast<char>(std::tolower(answer[0]));
+  }
+  return answer;
+}
+
+void cedar::test::dev::FakeSerialRobot::run()
+{
+#ifndef CEDAR_OS_WINDOWS
+  std::string received;
+  char buffer[1024];
+  while (!this->mStop)
+  {
+    pollfd poll_fd;
+    poll_fd.fd = this->mMaster;
+    poll_fd.events = POLLIN;
+    if (poll(&poll_fd, 1, 10) <= 0 || !(poll_fd.revents & POLLIN))
+    {
+      continue;
+    }
+
+    // give the rest of a batch time to arrive, like a slow micro controller would
+    usleep(5000);
+    ssize_t count = read(this->mMaster, buffer, sizeof(buffer));
+    if (count <= 0)
+    {
+      continue;
+    }
+    received.append(buffer, static_cast<size_t>(count));
+
+    std::string answers;
+    unsigned int batch = 0;
+    for (size_t end = received.find("\r\n"); end != std::string::npos; end = received.find("\r\n"))
+    {
+      std::string command = received.substr(0, end);
+      received.erase(0, end + 2);
+      answers += this->answer(command) + "\r\n";
+      ++batch;
+    }
+
+    this->mCommandsReceived += batch;
+    if (batch > this->mLargestBatch)
+    {
+      this->mLargestBatch = batch;
+    }
+
+    if (!answers.empty() && write(this->mMaster, answers.c_str(), answers.size()) < 0)
+    {
+      std::cout << "ERROR: the fake serial robot could not answer." << std::endl;
+    }
+  }
+#endif // CEDAR_OS_WINDOWS
+}
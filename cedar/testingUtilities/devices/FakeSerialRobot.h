@@ -0,0 +1,138 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        FakeSerialRobot.h
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 18
+
+    Description: Stands in for a K-Team robot on the other side of a pseudo terminal.
+
+    Credits:
+
+======================================================================================================================*/
+
+#ifndef CEDAR_TESTING_DEV_FAKE_SERIAL_ROBOT_H
+#define CEDAR_TESTING_DEV_FAKE_SERIAL_ROBOT_H
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CEDAR INCLUDES
+
+// FORWARD DECLARATIONS
+#include "cedar/testingUtilities/devices/FakeSerialRobot.fwd.h"
+
+// SYSTEM INCLUDES
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+
+/*!@brief Stands in for a K-Team robot on the master side of a pseudo terminal.
+ *
+ *        Each command is answered with its copy starting in lower case, unless a fixed answer was set for it. Serial
+ *        channels talk to the robot by opening getSlavePath(). Pseudo terminals are not available on Windows, where
+ *        isValid() always returns false.
+ */
+class cedar::test::dev::FakeSerialRobot
+{
+  //--------------------------------------------------------------------------------------------------------------------
+  // constructors and destructor
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //!@brief The constructor opens the pseudo terminal.
+  FakeSerialRobot();
+
+  //!@brief The destructor stops answering and closes the pseudo terminal.
+  ~FakeSerialRobot();
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // public methods
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //!@brief Whether the pseudo terminal could be opened.
+  bool isValid() const;
+
+  //!@brief Path of the device that serial channels open to talk to the robot.
+  const std::string& getSlavePath() const;
+
+  //!@brief Starts answering commands in a thread of its own.
+  void start();
+
+  //!@brief Stops answering commands.
+  void stop();
+
+  /*!@brief Answers every command whose name, i.e., the part before the first comma, is @em command with @em answer.
+   */
+  void setAnswer(const std::string& command, const std::string& answer);
+
+  //!@brief Number of commands received so far.
+  unsigned int getNumberOfCommandsReceived() const;
+
+  //!@brief Number of commands with the given name received so far.
+  unsigned int getNumberOfCommandsReceived(const std::string& command) const;
+
+  //!@brief Largest number of commands that arrived in a single read.
+  unsigned int getLargestBatch() const;
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // private methods
+  //--------------------------------------------------------------------------------------------------------------------
+private:
+  void run();
+
+  std::string answer(const std::string& command);
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // members
+  //--------------------------------------------------------------------------------------------------------------------
+private:
+  //! file descriptor of the master side
+  int mMaster;
+
+  std::string mSlavePath;
+
+  std::thread mThread;
+
+  std::atomic<bool> mStop;
+
+  std::atomic<unsigned int> mCommandsReceived;
+
+  std::atomic<unsigned int> mLargestBatch;
+
+  //! fixed answers by command name
+  std::map<std::string, std::string> mAnswers;
+
+  //! number of commands received by command name
+  std::map<std::string, unsigned int> mCommandCounts;
+
+  //! protects mAnswers and mCommandCounts
+  mutable std::mutex mCommandsLock;
+
+}; // class cedar::test::dev::FakeSerialRobot
+
+#endif // CEDAR_TESTING_DEV_FAKE_SERIAL_ROBOT_H
@@ -1,7 +1,8 @@
 # Find FFTW and create the following output:
 # FFTW_FOUND - whether FFTW was found or not
 # FFTW_INCLUDE_DIRS - the FFTW include directories
-# FFTW_LIBS - FFTW libraries
+# FFTW_LIBS - FFTW libraries (double precision and, if found, single precision)
+# FFTW_FLOAT_FOUND - whether the single precision library was found
 
 # find include dir in set of paths
 find_path(FFTW_INCLUDE_DIRS
@@ -13,13 +14,21 @@ find_library(FFTW_LIBS
   NAMES fftw3 libfftw3 libfftw3-3
   PATHS ${CEDAR_DEPENDENCY_LIBRARIES}
 )
+find_library(FFTW_LIBS_FLOAT
+  NAMES fftw3f libfftw3f libfftw3f-3
+  PATHS ${CEDAR_DEPENDENCY_LIBRARIES}
+)
 find_library(FFTW_LIBS_THREADED
 #  NAMES fftw3_threads
   NAMES fftw3_omp
   PATHS ${CEDAR_DEPENDENCY_LIBRARIES}
 )
+find_library(FFTW_LIBS_FLOAT_THREADED
+  NAMES fftw3f_omp
+  PATHS ${CEDAR_DEPENDENCY_LIBRARIES}
+)
 
-# now check if anything is missing
+# now check if anything is missing; single precision is optional, without it all transformations use double precision
 if(FFTW_INCLUDE_DIRS AND FFTW_LIBS)
   set(FFTW_FOUND true)
 else(FFTW_INCLUDE_DIRS AND FFTW_LIBS)
@@ -28,10 +37,19 @@ else(FFTW_INCLUDE_DIRS AND FFTW_LIBS)
   set(FFTW_FOUND false)
 endif(FFTW_INCLUDE_DIRS AND FFTW_LIBS)
 
-if(FFTW_LIBS_THREADED)
+if(FFTW_FOUND AND FFTW_LIBS_FLOAT)
+  set(FFTW_LIBS ${FFTW_LIBS} ${FFTW_LIBS_FLOAT})
+  set(FFTW_FLOAT_FOUND true)
+else(FFTW_FOUND AND FFTW_LIBS_FLOAT)
+  set(FFTW_FLOAT_FOUND false)
+endif(FFTW_FOUND AND FFTW_LIBS_FLOAT)
+
+if(FFTW_LIBS_THREADED AND (FFTW_LIBS_FLOAT_THREADED OR NOT FFTW_FLOAT_FOUND))
+  if(FFTW_FLOAT_FOUND)
+    set(FFTW_LIBS_THREADED ${FFTW_LIBS_THREADED} ${FFTW_LIBS_FLOAT_THREADED})
+  endif(FFTW_FLOAT_FOUND)
   set(FFTW_THREADED true)
-else(FFTW_LIBS_THREADED)
+else(FFTW_LIBS_THREADED AND (FFTW_LIBS_FLOAT_THREADED OR NOT FFTW_FLOAT_FOUND))
   set(FFTW_LIBS_THREADED "")
-    set(FFTW_THREADED false)
-endif(FFTW_LIBS_THREADED)
-
+  set(FFTW_THREADED false)
+endif(FFTW_LIBS_THREADED AND (FFTW_LIBS_FLOAT_THREADED OR NOT FFTW_FLOAT_FOUND))
@@ -0,0 +1,269 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        cedar-batch.cpp
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 18
+
+    Description: Headless runner for experiments that steps the architecture in simulated time and runs trials in
+                 parallel processes.
+
+    Credits:
+
+======================================================================================================================*/
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CEDAR INCLUDES
+#include "cedar/processing/experiment/Experiment.h"
+#include "cedar/processing/Group.h"
+#include "cedar/auxiliaries/CommandLineParser.h"
+#include "cedar/auxiliaries/CallFunctionInThread.h"
+#include "cedar/auxiliaries/Recorder.h"
+#include "cedar/auxiliaries/Settings.h"
+#include "cedar/auxiliaries/Path.h"
+#include "cedar/auxiliaries/ExceptionBase.h"
+#include "cedar/auxiliaries/stringFunctions.h"
+#include "cedar/units/Time.h"
+
+// SYSTEM INCLUDES
+#include <QCoreApplication>
+#include <QProcess>
+#include <QStringList>
+#include <QThread>
+#ifndef Q_MOC_RUN
+  #include <boost/property_tree/json_parser.hpp>
+  #include <boost/bind.hpp>
+#endif
+#include <iostream>
+#include <exception>
+#include <algorithm>
+#include <vector>
+#include <string>
+
+// exit code of the process
+int result = 0;
+
+//! Runs a single trial of the experiment in this process.
+void run_trial
+     (
+       const std::string& architecture,
+       const std::string& experimentFile,
+       unsigned int trial,
+       const std::string& recordFolder,
+       cedar::unit::Time timeLimit
+     )
+{
+  try
+  {
+    cedar::aux::SettingsSingleton::getInstance()->loadDefaultPlugins();
+
+    cedar::proc::GroupPtr group(new cedar::proc::Group());
+    group->readJson(architecture);
+
+    cedar::proc::experiment::ExperimentPtr experiment(new cedar::proc::experiment::Experiment(group));
+    experiment->readJson(experimentFile);
+
+    cedar::aux::RecorderSingleton::getInstance()->setRecordedProjectName(architecture);
+    experiment->runSimulatedTrial(trial, recordFolder, timeLimit);
+  }
+  catch (const cedar::aux::ExceptionBase& e)
+  {
+    std::cerr << "Trial " << trial << " failed: " << e.exceptionInfo() << std::endl;
+    result = 1;
+  }
+  catch (const std::exception& e)
+  {
+    std::cerr << "Trial " << trial << " failed: " << e.what() << std::endl;
+    result = 1;
+  }
+}
+
+//! Runs all trials, each in a separate process running this executable, with at most jobs processes at a time.
+int run_batch
+    (
+      const std::string& architecture,
+      const std::string& experimentFile,
+      unsigned int trials,
+      unsigned int jobs,
+      const std::string& recordFolder,
+      double timeLimit
+    )
+{
+  struct Worker
+  {
+    unsigned int mTrial;
+    QProcess* mpProcess;
+  };
+
+  std::vector<Worker> workers;
+  unsigned int next_trial = 0;
+  unsigned int failed = 0;
+
+  std::cout << "Running " << trials << " trial(s) of " << experimentFile << " with " << jobs << " parallel job(s)."
+            << std::endl;
+
+  while (next_trial < trials || !workers.empty())
+  {
+    // keep the number of running trials at the requested number of jobs
+    while (workers.size() < jobs && next_trial < trials)
+    {
+      QStringList arguments;
+      arguments << "--architecture" << QString::fromStdString(architecture)
+                << "--experiment" << QString::fromStdString(experimentFile)
+                << "--output" << QString::fromStdString(recordFolder)
+                << "--time-limit" << QString::number(timeLimit)
+                << "--trial" << QString::number(next_trial);
+
+      Worker worker;
+      worker.mTrial = next_trial;
+      worker.mpProcess = new QProcess();
+      worker.mpProcess->setProcessChannelMode(QProcess::ForwardedChannels);
+      worker.mpProcess->start(QCoreApplication::applicationFilePath(), arguments);
+      workers.push_back(worker);
+      ++next_trial;
+    }
+
+    for (auto it = workers.begin(); it != workers.end(); )
+    {
+      if (it->mpProcess->waitForFinished(10))
+      {
+        bool success = it->mpProcess->exitStatus() == QProcess::NormalExit && it->mpProcess->exitCode() == 0;
+        if (!success)
+        {
+          ++failed;
+        }
+        std::cout << "Trial " << it->mTrial << (success ? " finished." : " failed.") << std::endl;
+        delete it->mpProcess;
+        it = workers.erase(it);
+      }
+      else if (it->mpProcess->state() == QProcess::NotRunning)
+      {
+        // the process could not be started at all
+        std::cerr << "Could not start trial " << it->mTrial << ": "
+                  << it->mpProcess->errorString().toStdString() << std::endl;
+        ++failed;
+        delete it->mpProcess;
+        it = workers.erase(it);
+      }
+      else
+      {
+        ++it;
+      }
+    }
+  }
+
+  std::cout << (trials - failed) << " of " << trials << " trial(s) finished successfully. Recordings were written to "
+            << recordFolder << "." << std::endl;
+  return failed == 0 ? 0 : 1;
+}
+
+int main(int argc, char** argv)
+{
+  QCoreApplication app(argc, argv);
+
+  cedar::aux::CommandLineParser parser;
+  parser.setDescription
+         (
+           "Runs the trials of an experiment without a graphical interface. The triggers of the architecture are "
+           "stepped in simulated time as fast as possible, and trials are run in parallel processes, each with its own "
+           "instance of the architecture. The recordings of each trial are written into a separate folder."
+         );
+  parser.defineValue("architecture", "The architecture file the experiment runs on.", 'a');
+  parser.defineValue("experiment", "The experiment file.", 'e');
+  parser.defineValue<unsigned int>
+  (
+    "jobs",
+    "Number of trials that run in parallel.",
+    static_cast<unsigned int>(std::max(1, QThread::idealThreadCount())),
+    'j'
+  );
+  parser.defineValue<unsigned int>("trials", "Number of trials to run. Use 0 for the experiment's repetitions.", 0, 't');
+  parser.defineValue<double>("time-limit", "Simulated time in seconds after which a trial is stopped.", 600.0, 'l');
+  parser.defineValue<std::string>
+  (
+    "output",
+    "Recording folder, relative to the recorder's output directory. Defaults to the experiment's name and a time stamp.",
+    "",
+    'o'
+  );
+  parser.defineValue<int>("trial", "Runs only this trial in the current process; used by the batch runner.", -1);
+  parser.parse(argc, argv, true);
+
+  std::string architecture = cedar::aux::Path(parser.getValue<std::string>("architecture")).absolute().toString();
+  std::string experiment = cedar::aux::Path(parser.getValue<std::string>("experiment")).absolute().toString();
+  std::string record_folder = parser.getValue<std::string>("output");
+  double time_limit = parser.getValue<double>("time-limit");
+  int trial = parser.getValue<int>("trial");
+
+  if (trial >= 0)
+  {
+    cedar::aux::CallFunctionInThread caller
+    (
+      boost::bind
+      (
+        &run_trial,
+        architecture,
+        experiment,
+        static_cast<unsigned int>(trial),
+        record_folder,
+        time_limit * cedar::unit::seconds
+      )
+    );
+    QObject::connect(&caller, SIGNAL(finishedThread()), &app, SLOT(quit()), Qt::QueuedConnection);
+    caller.start();
+    app.exec();
+    return result;
+  }
+
+  // only the number of repetitions and the name are needed here, so there is no need to load the architecture
+  cedar::aux::ConfigurationNode experiment_node;
+  try
+  {
+    boost::property_tree::read_json(experiment, experiment_node);
+  }
+  catch (const boost::property_tree::json_parser::json_parser_error& e)
+  {
+    std::cerr << "Could not read the experiment: " << e.what() << std::endl;
+    return 1;
+  }
+
+  unsigned int trials = parser.getValue<unsigned int>("trials");
+  if (trials == 0)
+  {
+    trials = experiment_node.get<unsigned int>("repetitions", 1);
+  }
+
+  if (record_folder.empty())
+  {
+    record_folder = experiment_node.get<std::string>("name", "experiment") + "_"
+                    + cedar::aux::RecorderSingleton::getInstance()->getTimeStamp();
+  }
+
+  unsigned int jobs = std::max(1u, parser.getValue<unsigned int>("jobs"));
+  return run_batch(architecture, experiment, trials, jobs, record_folder, time_limit);
+}
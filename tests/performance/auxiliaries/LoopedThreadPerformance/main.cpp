@@ -46,6 +46,9 @@
 // SYSTEM INCLUDES
 #include <QReadWriteLock>
 #include <QCoreApplication>
+#include <string>
+#include <utility>
+#include <vector>
 
 
 // global variables
@@ -65,8 +68,8 @@ struct MyThread : public cedar::aux::LoopedThread
   cedar::unit::Time mTotalRealStep;
   cedar::unit::Time mMaxRealStep;
 
-  MyThread() 
-  : mNumSteps(0), mTotalRealStep(0), mMaxRealStep(0)
+  MyThread(cedar::aux::EnumId mode)
+  : cedar::aux::LoopedThread(mode, step_size), mNumSteps(0), mTotalRealStep(0), mMaxRealStep(0)
   {
   }
 
@@ -101,13 +104,14 @@ private:
 };
 
 std::list< MyThread* > threads;
+cedar::aux::EnumId current_mode = cedar::aux::LoopMode::RealDT;
 
 void create_test()
 {
   unsigned int i= 0;
   for (; i <= MAX_THREADS; i++ )
   {
-    threads.push_back( new MyThread() );
+    threads.push_back( new MyThread(current_mode) );
     threads.back()->setStepSize(step_size);
   }
 }
@@ -142,16 +146,24 @@ void delete_test()
   }
 }
 
-void run_test()
+void run_mode(cedar::aux::EnumId mode, const std::string& modeName)
 {
-  errors = 0;
+  current_mode = mode;
+  std::string suffix = " (" + modeName + ")";
 
-  cedar::test::test_time("create threads", create_test);
+  cedar::test::test_time("create threads" + suffix, create_test);
   cedar::test::test_time("start threads", start_test);
 
   cedar::aux::sleep(cedar::unit::Time(3.0 * cedar::unit::seconds));
 
-  cedar::test::test_time("stop threads", stop_test);
+  // collect the wakeup latencies before the threads are stopped and their statistics are gone
+  cedar::aux::LatencyHistogram wakeup_latencies;
+  for (auto thread : threads)
+  {
+    wakeup_latencies.merge(thread->getWakeupLatencyHistogram());
+  }
+
+  cedar::test::test_time("stop threads" + suffix, stop_test);
 
   // evaluation statistics for all threads:
 
@@ -173,12 +185,32 @@ void run_test()
 
   cedar::unit::Time one_second(1.0 * cedar::unit::second);
 
-  cedar::test::write_measurement("num steps", num_steps_all7);
-  cedar::test::write_measurement("real-step size", total_real_step_all / one_second);
-  cedar::test::write_measurement("real-step max", max_real_step_all / one_second);
+  cedar::test::write_measurement("num steps" + suffix, num_steps_all7);
+  cedar::test::write_measurement("real-step size" + suffix, total_real_step_all / one_second);
+  cedar::test::write_measurement("real-step max" + suffix, max_real_step_all / one_second);
   double deviation = ((total_real_step_all / one_second) / num_steps_all7) - (step_size / one_second);
-  cedar::test::write_measurement("rel deviatiation", deviation);
-  cedar::test::test_time("delete threads", delete_test);
+  cedar::test::write_measurement("rel deviatiation" + suffix, deviation);
+  cedar::test::write_measurement("wakeup latency p50" + suffix, wakeup_latencies.getPercentile(0.5) / one_second);
+  cedar::test::write_measurement("wakeup latency p99" + suffix, wakeup_latencies.getPercentile(0.99) / one_second);
+  cedar::test::write_measurement("wakeup latency max" + suffix, wakeup_latencies.getMaximum() / one_second);
+  cedar::test::test_time("delete threads" + suffix, delete_test);
+  threads.clear();
+}
+
+void run_test()
+{
+  errors = 0;
+
+  std::vector<std::pair<cedar::aux::EnumId, std::string> > modes;
+  modes.push_back(std::make_pair(cedar::aux::LoopMode::Fixed, "fixed"));
+  modes.push_back(std::make_pair(cedar::aux::LoopMode::FixedAdaptive, "fixed adaptive"));
+  modes.push_back(std::make_pair(cedar::aux::LoopMode::RealDT, "real deltaT"));
+  modes.push_back(std::make_pair(cedar::aux::LoopMode::Deadline, "deadline"));
+
+  for (const auto& mode_name : modes)
+  {
+    run_mode(mode_name.first, mode_name.second);
+  }
 }
 
 int main(int argc, char* argv[])
@@ -38,6 +38,7 @@
 // LOCAL INCLUDES
 #include "cedar/configuration.h"
 #include "cedar/auxiliaries/Recorder.h"
+#include "cedar/auxiliaries/BinaryRecording.h"
 #include "cedar/auxiliaries/MatData.h"
 #include "cedar/auxiliaries/CallFunctionInThread.h"
 #include "cedar/auxiliaries/sleepFunctions.h"
@@ -48,18 +49,58 @@
 
 //SYSTEM INCLUDES
 #include <iostream>
-#include<boost/filesystem.hpp>
+#include <cstring>
+#include <boost/filesystem.hpp>
+#include <boost/bind.hpp>
 
 // global variables
 int errors = 0;
 
-void record()
+//! Returns the size of all files in the given directory (recursively).
+boost::uintmax_t directory_size(const std::string& path)
 {
+  boost::uintmax_t size = 0;
+  for (boost::filesystem::recursive_directory_iterator iter(path), end; iter != end; ++iter)
+  {
+    if (boost::filesystem::is_regular_file(iter->path()))
+    {
+      size += boost::filesystem::file_size(iter->path());
+    }
+  }
+  return size;
+}
+
+void check_binary_recording(const std::string& directory, const std::string& name, const cv::Mat& expected)
+{
+  cedar::aux::BinaryRecording recording(directory + "/" + name + ".bin");
+  if (recording.getNumberOfFrames() == 0)
+  {
+    std::cout << "ERROR: binary recording of " << name << " contains no frames." << std::endl;
+    ++errors;
+    return;
+  }
+
+  cv::Mat frame = recording.getFrame(recording.getNumberOfFrames() - 1);
+  if (frame.type() != expected.type() || frame.total() != expected.total()
+      || std::memcmp(frame.data, expected.data, expected.total() * expected.elemSize()) != 0)
+  {
+    std::cout << "ERROR: binary recording of " << name << " does not match the recorded matrix." << std::endl;
+    ++errors;
+  }
+  else
+  {
+    std::cout << "Read back " << recording.getNumberOfFrames() << " frames of " << name << "." << std::endl;
+  }
+}
 
+void record(cedar::aux::SerializationFormat::Id mode)
+{
   int sz[] = {40, 40, 40};
   cv::Mat mat1(3, sz, CV_32F, cv::Scalar::all(0));
+  cv::randu(mat1, cv::Scalar(0), cv::Scalar(1));
   cv::Mat mat2(3, sz, CV_8S, cv::Scalar::all(-42));
   cv::Mat mat3(100,100,CV_8UC3);
+  cv::randu(mat3, cv::Scalar::all(0), cv::Scalar::all(255));
 
   cedar::unit::Time timestep(20.0 * cedar::unit::milli * cedar::unit::seconds);
 
@@ -67,29 +108,54 @@ void record()
   cedar::aux::MatDataPtr dataPtr2 = cedar::aux::MatDataPtr(new cedar::aux::MatData(mat2));
   cedar::aux::MatDataPtr dataPtr3 = cedar::aux::MatDataPtr(new cedar::aux::MatData(mat3));
 
-  cedar::aux::RecorderSingleton::getInstance()->registerData(dataPtr, timestep, "Mat1");
-  cedar::aux::RecorderSingleton::getInstance()->registerData(dataPtr2, timestep, "Mat2");
-  cedar::aux::RecorderSingleton::getInstance()->registerData(dataPtr3, timestep, "Mat3");
-
+  auto recorder = cedar::aux::RecorderSingleton::getInstance();
+  recorder->setSerializationMode(mode);
+  recorder->registerData(dataPtr, timestep, "Mat1");
+  recorder->registerData(dataPtr2, timestep, "Mat2");
+  recorder->registerData(dataPtr3, timestep, "Mat3");
 
   //Rename PerformanceTest Folder
-  cedar::aux::RecorderSingleton::getInstance()->setRecordedProjectName("PerformanceTest");
+  recorder->setRecordedProjectName("PerformanceTest");
 
-  cedar::aux::RecorderSingleton::getInstance()->start();
+  recorder->start();
   cedar::aux::sleep(cedar::unit::Time(5.0 * cedar::unit::seconds));
-  cedar::aux::RecorderSingleton::getInstance()->stop();
+  recorder->stop();
 
-  std::string path = cedar::aux::SettingsSingleton::getInstance()->getRecorderOutputDirectory();
-  boost::filesystem::remove_all(cedar::aux::SettingsSingleton::getInstance()->getRecorderOutputDirectory()+"/PerformanceTest");
+  std::string directory = recorder->getOutputDirectory();
+  std::cout << cedar::aux::SerializationFormat::type().get(mode).prettyString() << ": wrote "
+            << directory_size(directory) << " bytes, dropped " << recorder->getNumberOfDroppedFrames()
+            << " frames." << std::endl;
 
+  if (mode == cedar::aux::SerializationFormat::Binary)
+  {
+    check_binary_recording(directory, "Mat1", mat1);
+    check_binary_recording(directory, "Mat2", mat2);
+    check_binary_recording(directory, "Mat3", mat3);
+  }
 
+  recorder->clear();
+  boost::filesystem::remove_all(cedar::aux::SettingsSingleton::getInstance()->getRecorderOutputDirectory()+"/PerformanceTest");
 }
 
 void run_test()
 {
   errors = 0;
 
-  cedar::test::test_time("Recording different Mats", record);
+  auto previous_mode = cedar::aux::RecorderSingleton::getInstance()->getSerializationMode();
+
+  cedar::test::test_time("Recording different Mats (CSV)", boost::bind(record, cedar::aux::SerializationFormat::CSV));
+  cedar::test::test_time
+  (
+    "Recording different Mats (Compact)",
+    boost::bind(record, cedar::aux::SerializationFormat::Compact)
+  );
+  cedar::test::test_time
+  (
+    "Recording different Mats (Binary)",
+    boost::bind(record, cedar::aux::SerializationFormat::Binary)
+  );
+
+  cedar::aux::RecorderSingleton::getInstance()->setSerializationMode(previous_mode);
 }
 
 
@@ -38,6 +38,11 @@
 // LOCAL INCLUDES
 #include "cedar/testingUtilities/measurementFunctions.h"
 #include "cedar/auxiliaries/math/transferFunctions/AbsSigmoid.h"
+#include "cedar/auxiliaries/math/transferFunctions/ExpSigmoid.h"
+#include "cedar/auxiliaries/math/transferFunctions/HeavisideSigmoid.h"
+#include "cedar/auxiliaries/math/transferFunctions/LinearTransferFunction.h"
+#include "cedar/auxiliaries/math/transferFunctions/Logarithm.h"
+#include "cedar/auxiliaries/math/transferFunctions/SemiLinearTransferFunction.h"
 #include "cedar/auxiliaries/math/tools.h"
 #include "cedar/configuration.h"
 
@@ -49,8 +54,19 @@
 
 struct TestSet
 {
-  TestSet(unsigned dim, unsigned int imsize, unsigned int reps)
+  TestSet
+  (
+    const std::string& functionName,
+    cedar::aux::math::TransferFunctionPtr function,
+    bool batch,
+    unsigned dim,
+    unsigned int imsize,
+    unsigned int reps
+  )
   :
+  mFunctionName(functionName),
+  mFunction(function),
+  mBatch(batch),
   mDimensionality(dim),
   mMatrixSize(imsize),
   mReps(reps),
@@ -60,12 +76,17 @@ struct TestSet
 
   std::string id() const
   {
-    std::string case_id = "transfer - dimensionality = " + cedar::aux::toString(this->mDimensionality)
+    std::string case_id = "transfer - function = " + this->mFunctionName
+                          + ", path = " + (this->mBatch ? "batch" : "scalar")
+                          + ", dimensionality = " + cedar::aux::toString(this->mDimensionality)
                           + ", matrix size = " + cedar::aux::toString(this->mMatrixSize)
                           + ", reps = " + cedar::aux::toString(this->mReps);
     return case_id;
   }
 
+  std::string mFunctionName;
+  cedar::aux::math::TransferFunctionPtr mFunction;
+  bool mBatch;
   unsigned int mDimensionality;
   unsigned int mMatrixSize;
   unsigned int mReps;
@@ -79,35 +100,70 @@ void test_sigmoid(TestSet& test)
 
   std::string case_id = test.id();
 
-  cedar::aux::math::TransferFunctionPtr sigmoid(new cedar::aux::math::AbsSigmoid());
-
   std::vector<int> sizes;
   for (unsigned int dim = 0; dim < test.mDimensionality; ++dim)
   {
     sizes.push_back(static_cast<int>(test.mMatrixSize));
   }
   cv::Mat matrix(static_cast<int>(test.mDimensionality), &(sizes.front()), CV_32F);
-  matrix = 1.0;
+  cv::randu(matrix, cv::Scalar(0.0), cv::Scalar(2.0));
+  cv::Mat result(static_cast<int>(test.mDimensionality), &(sizes.front()), CV_32F);
 
   ptime start = microsec_clock::local_time();
   for (unsigned int i = 0; i < test.mReps; ++i)
   {
-    // volatile so this doesn't get optimized away
-    volatile cv::Mat test = sigmoid->compute<float>(matrix);
+    if (test.mBatch)
+    {
+      test.mFunction->compute(matrix, result);
+    }
+    else
+    {
+      // volatile so this doesn't get optimized away
+      volatile cv::Mat output = test.mFunction->compute<float>(matrix);
+    }
   }
   ptime end = microsec_clock::local_time();
   test.mDuration = static_cast<double>((end - start).total_milliseconds()) / 1000.0;
   cedar::test::write_measurement(case_id, test.mDuration);
 }
 
+void add_tests(std::vector<TestSet>& test, const std::string& name, cedar::aux::math::TransferFunctionPtr function)
+{
+  for (int batch = 0; batch < 2; ++batch)
+  {
+//    test.push_back(TestSet(name, function, batch == 1, 1, 100, 100));
+    test.push_back(TestSet(name, function, batch == 1, 2, 20, 100));
+    test.push_back(TestSet(name, function, batch == 1, 2, 100, 10));
+    test.push_back(TestSet(name, function, batch == 1, 3, 20, 100));
+    test.push_back(TestSet(name, function, batch == 1, 3, 100, 10));
+  }
+}
+
 int main(int, char**)
 {
   std::vector<TestSet> test;
-//  test.push_back(TestSet(1, 100, 100));
-  test.push_back(TestSet(2, 20, 100));
-  test.push_back(TestSet(2, 100, 10));
-  test.push_back(TestSet(3, 20, 100));
-  test.push_back(TestSet(3, 100, 10));
+  add_tests(test, "AbsSigmoid", cedar::aux::math::TransferFunctionPtr(new cedar::aux::math::AbsSigmoid(1.0)));
+  add_tests(test, "ExpSigmoid", cedar::aux::math::TransferFunctionPtr(new cedar::aux::math::ExpSigmoid(1.0)));
+  add_tests
+  (
+    test,
+    "HeavisideSigmoid",
+    cedar::aux::math::TransferFunctionPtr(new cedar::aux::math::HeavisideSigmoid(1.0))
+  );
+  add_tests
+  (
+    test,
+    "LinearTransferFunction",
+    cedar::aux::math::TransferFunctionPtr(new cedar::aux::math::LinearTransferFunction())
+  );
+  add_tests
+  (
+    test,
+    "SemiLinearTransferFunction",
+    cedar::aux::math::TransferFunctionPtr(new cedar::aux::math::SemiLinearTransferFunction(1.0))
+  );
+  add_tests(test, "Logarithm", cedar::aux::math::TransferFunctionPtr(new cedar::aux::math::Logarithm()));
+
   // measure
   for (size_t i = 0; i < test.size(); ++i)
   {
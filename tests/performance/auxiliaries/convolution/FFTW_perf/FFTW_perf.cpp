@@ -51,13 +51,24 @@
 
 struct TestSet
 {
-  TestSet(double sigma, double limit, unsigned int imsize, unsigned int reps, cedar::aux::conv::BorderType::Id borderType)
+  TestSet
+  (
+    double sigma,
+    double limit,
+    unsigned int imsize,
+    unsigned int reps,
+    cedar::aux::conv::BorderType::Id borderType,
+    int type = CV_32F,
+    bool into = false
+  )
   :
   mSigma(sigma),
   mLimit(limit),
   mImsize(imsize),
   mReps(reps),
   mBorderType(borderType),
+  mType(type),
+  mInto(into),
   mDuration(-1.0)
   {
   }
@@ -68,7 +79,9 @@ struct TestSet
                           + ", limit = " + cedar::aux::toString(this->mLimit)
                           + ", imsize = " + cedar::aux::toString(this->mImsize)
                           + ", reps = " + cedar::aux::toString(this->mReps)
-                          + ", border = " + cedar::aux::conv::BorderType::type().get(this->mBorderType).name();
+                          + ", border = " + cedar::aux::conv::BorderType::type().get(this->mBorderType).name()
+                          + ", type = " + (this->mType == CV_32F ? "CV_32F" : "CV_64F")
+                          + ", " + (this->mInto ? "convolveInto" : "convolve");
     return case_id;
   }
 
@@ -77,6 +90,8 @@ struct TestSet
   unsigned int mImsize;
   unsigned int mReps;
   cedar::aux::conv::BorderType::Id mBorderType;
+  int mType;
+  bool mInto;
   double mDuration;
 };
 
@@ -98,35 +113,80 @@ void test_convolution_time_1d(TestSet& test)
 
   int size = static_cast<int>(test.mImsize);
   int sizes_3D[3] = {size, size, size};
-  cv::Mat matrix_3D(3, sizes_3D, CV_32F);
+  cv::Mat matrix_3D(3, sizes_3D, test.mType);
+  cv::randu(matrix_3D, cv::Scalar(0), cv::Scalar(1));
   cv::Mat image = matrix_3D;
 //  cv::Mat image = cv::Mat::ones(test.mImsize, 1, CV_32F);
   // do this once before measuring (initializing FFTW)
-  conv->convolve(image);
+  cv::Mat output = conv->convolve(image);
   ptime start = microsec_clock::local_time();
   for (unsigned int i = 0; i < test.mReps; ++i)
   {
-    // volatile so this doesn't get optimized away
-    volatile cv::Mat test = conv->convolve(image);
+    if (test.mInto)
+    {
+      // reuses the memory of output
+      conv->convolveInto(image, output);
+    }
+    else
+    {
+      // volatile so this doesn't get optimized away
+      volatile cv::Mat test = conv->convolve(image);
+    }
   }
   ptime end = microsec_clock::local_time();
   test.mDuration = static_cast<double>((end - start).total_milliseconds()) / 1000.0;
   cedar::test::write_measurement(case_id, test.mDuration);
 }
 
+// planning happens in warmUp, so the first convolution afterwards should be as fast as any later one
+void test_warm_up(int size)
+{
+  using boost::posix_time::ptime;
+  using boost::posix_time::microsec_clock;
+
+  std::string case_id = "warm up - imsize = " + cedar::aux::toString(size);
+  std::vector<int> sizes(3, size);
+
+  ptime start = microsec_clock::local_time();
+  cedar::aux::conv::FFTW::warmUp(sizes, CV_32F);
+  ptime end = microsec_clock::local_time();
+  cedar::test::write_measurement(case_id, static_cast<double>((end - start).total_microseconds()) / 1000000.0);
+
+  cedar::aux::conv::ConvolutionPtr conv(new cedar::aux::conv::Convolution());
+  conv->setBorderType(cedar::aux::conv::BorderType::Cyclic);
+  conv->setEngine(cedar::aux::conv::FFTWPtr(new cedar::aux::conv::FFTW()));
+  conv->getKernelList()->append(cedar::aux::kernel::GaussPtr(new cedar::aux::kernel::Gauss(3, 1.0, 1.0, 0.0, 5.0)));
+
+  cv::Mat matrix(3, &sizes.front(), CV_32F);
+  cv::randu(matrix, cv::Scalar(0), cv::Scalar(1));
+
+  start = microsec_clock::local_time();
+  volatile cv::Mat first = conv->convolve(matrix);
+  end = microsec_clock::local_time();
+  cedar::test::write_measurement
+  (
+    "first convolution after " + case_id,
+    static_cast<double>((end - start).total_microseconds()) / 1000000.0
+  );
+}
+
 int main(int, char**)
 {
   std::vector<TestSet> test;
 //  test.push_back(TestSet(1.0, 5.0, 20, 10, cedar::aux::conv::BorderType::Cyclic));
 //  test.push_back(TestSet(1.0, 5.0, 30, 10, cedar::aux::conv::BorderType::Cyclic));
 //  test.push_back(TestSet(1.0, 5.0, 40, 10, cedar::aux::conv::BorderType::Cyclic));
-  test.push_back(TestSet(1.0, 5.0, 100, 10, cedar::aux::conv::BorderType::Cyclic));
+  test.push_back(TestSet(1.0, 5.0, 100, 10, cedar::aux::conv::BorderType::Cyclic, CV_64F));
+  test.push_back(TestSet(1.0, 5.0, 100, 10, cedar::aux::conv::BorderType::Cyclic, CV_32F));
+  test.push_back(TestSet(1.0, 5.0, 100, 10, cedar::aux::conv::BorderType::Cyclic, CV_32F, true));
   // measure
   for (size_t i = 0; i < test.size(); ++i)
   {
     test_convolution_time_1d(test[i]);
   }
 
+  test_warm_up(64);
+
   // summarize results
   for (size_t i = 0; i < test.size(); ++i)
   {
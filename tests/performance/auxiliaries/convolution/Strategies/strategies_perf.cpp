@@ -0,0 +1,217 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        strategies_perf.cpp
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 18
+
+    Description: Compares the strategies of the OpenCV convolution engine and the choices of its planner.
+
+    Credits:
+
+======================================================================================================================*/
+
+// LOCAL INCLUDES
+#include "cedar/testingUtilities/measurementFunctions.h"
+#include "cedar/auxiliaries/convolution/OpenCV.h"
+#include "cedar/auxiliaries/convolution/Strategy.h"
+#include "cedar/auxiliaries/convolution/BorderType.h"
+#include "cedar/auxiliaries/kernel/Gauss.h"
+#include "cedar/auxiliaries/stringFunctions.h"
+#include "cedar/auxiliaries/exceptions.h"
+#include "cedar/configuration.h"
+
+// SYSTEM INCLUDES
+#include <opencv2/opencv.hpp>
+#ifndef Q_MOC_RUN
+  #include <boost/date_time/posix_time/posix_time.hpp>
+#endif
+#include <limits>
+#include <vector>
+#include <iostream>
+
+struct TestSet
+{
+  TestSet(unsigned int dimensionality, int size, double sigma, unsigned int reps)
+  :
+  mDimensionality(dimensionality),
+  mSize(size),
+  mSigma(sigma),
+  mReps(reps),
+  mPlanned(cedar::aux::conv::Strategy::Direct),
+  mFastest(cedar::aux::conv::Strategy::Direct)
+  {
+    mDurations.assign(cedar::aux::conv::Strategy::type().list().size(), -1.0);
+  }
+
+  std::string id() const
+  {
+    return "conv" + cedar::aux::toString(this->mDimensionality) + "d"
+           + " - size = " + cedar::aux::toString(this->mSize)
+           + ", sigma = " + cedar::aux::toString(this->mSigma)
+           + ", reps = " + cedar::aux::toString(this->mReps);
+  }
+
+  unsigned int mDimensionality;
+  int mSize;
+  double mSigma;
+  unsigned int mReps;
+  cedar::aux::conv::Strategy::Id mPlanned;
+  cedar::aux::conv::Strategy::Id mFastest;
+  //! Time per convolution, indexed by strategy; negative for strategies that could not be applied.
+  std::vector<double> mDurations;
+};
+
+// returns the number of strategies whose results differ from the direct convolution
+int measure_strategies(TestSet& test)
+{
+  using boost::posix_time::ptime;
+  using boost::posix_time::microsec_clock;
+
+  int errors = 0;
+
+  cedar::aux::conv::OpenCV engine;
+  cedar::aux::kernel::GaussPtr kernel
+  (
+    new cedar::aux::kernel::Gauss(test.mDimensionality, 1.0, test.mSigma, 0.0, 3.0)
+  );
+
+  std::vector<int> sizes(test.mDimensionality, test.mSize);
+  if (test.mDimensionality == 1)
+  {
+    sizes.push_back(1);
+  }
+  cv::Mat matrix(static_cast<int>(sizes.size()), &sizes.front(), CV_32F);
+  cv::randu(matrix, cv::Scalar(0), cv::Scalar(1));
+
+  test.mPlanned = engine.getStrategy(matrix, kernel);
+
+  cv::Mat reference;
+  double fastest_duration = std::numeric_limits<double>::max();
+  for (size_t i = 0; i < cedar::aux::conv::Strategy::type().list().size(); ++i)
+  {
+    const cedar::aux::Enum& strategy = cedar::aux::conv::Strategy::type().list().at(i);
+
+    cv::Mat result;
+    try
+    {
+      result = engine.convolveUsing(matrix, kernel, cedar::aux::conv::BorderType::Zero, strategy);
+    }
+    catch (const cedar::aux::UnhandledValueException&)
+    {
+      // strategy is not applicable to this case
+      continue;
+    }
+
+    if (reference.empty())
+    {
+      reference = result;
+    }
+    else
+    {
+      double difference = cv::norm(reference, result, cv::NORM_INF);
+      if (difference > 1e-3)
+      {
+        std::cout << "ERROR: " << test.id() << ": result of strategy " << strategy.name()
+                  << " differs by " << difference << " from that of the direct convolution." << std::endl;
+        ++errors;
+      }
+    }
+
+    ptime start = microsec_clock::local_time();
+    for (unsigned int rep = 0; rep < test.mReps; ++rep)
+    {
+      // volatile so this doesn't get optimized away
+      volatile cv::Mat convolved
+        = engine.convolveUsing(matrix, kernel, cedar::aux::conv::BorderType::Zero, strategy);
+    }
+    ptime end = microsec_clock::local_time();
+
+    double duration = static_cast<double>((end - start).total_microseconds()) / 1000000.0;
+    cedar::test::write_measurement(test.id() + ", strategy = " + strategy.name(), duration);
+
+    test.mDurations.at(strategy.id()) = duration / static_cast<double>(test.mReps);
+    if (test.mDurations.at(strategy.id()) < fastest_duration)
+    {
+      fastest_duration = test.mDurations.at(strategy.id());
+      test.mFastest = strategy;
+    }
+  }
+
+  return errors;
+}
+
+int main(int, char**)
+{
+  int errors = 0;
+
+  // each row sweeps the kernel size for a fixed matrix size, so the crossover points show up in the summary
+  std::vector<TestSet> tests;
+  for (double sigma : {1.0, 4.0, 16.0, 64.0})
+  {
+    tests.push_back(TestSet(1, 4096, sigma, 200));
+  }
+  for (double sigma : {1.0, 3.0, 6.0, 12.0})
+  {
+    tests.push_back(TestSet(2, 256, sigma, 20));
+  }
+  for (double sigma : {0.5, 1.0, 2.0, 4.0})
+  {
+    tests.push_back(TestSet(3, 48, sigma, 3));
+  }
+
+  // measure
+  for (size_t i = 0; i < tests.size(); ++i)
+  {
+    errors += measure_strategies(tests[i]);
+  }
+
+  // summarize results; the planner is considered to have missed a crossover point if its choice is much slower
+  unsigned int misses = 0;
+  for (size_t i = 0; i < tests.size(); ++i)
+  {
+    const TestSet& test = tests[i];
+    double planned_duration = test.mDurations.at(test.mPlanned);
+    double fastest_duration = test.mDurations.at(test.mFastest);
+    bool miss = planned_duration > 1.5 * fastest_duration;
+    if (miss)
+    {
+      ++misses;
+    }
+
+    std::cout << test.id()
+              << " \t|\tplanned: " << cedar::aux::conv::Strategy::type().get(test.mPlanned).name()
+              << " (" << planned_duration << " s)"
+              << " \t|\tfastest: " << cedar::aux::conv::Strategy::type().get(test.mFastest).name()
+              << " (" << fastest_duration << " s)"
+              << (miss ? " \t<- planner missed the crossover" : "")
+              << std::endl;
+  }
+  std::cout << "The planner picked a strategy more than 1.5 times slower than the fastest one in "
+            << misses << " of " << tests.size() << " cases." << std::endl;
+
+  return errors;
+}
@@ -0,0 +1,165 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        main.cpp
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 18
+
+    Description: Compares accuracy and cost of the integrators of cedar::dyn::Dynamics.
+
+    Credits:
+
+======================================================================================================================*/
+
+
+// CEDAR INCLUDES
+#include "cedar/configuration.h"
+#include "cedar/dynamics/fields/NeuralField.h"
+#include "cedar/dynamics/integrator/AdaptiveHeun.h"
+#include "cedar/dynamics/integrator/Euler.h"
+#include "cedar/dynamics/integrator/ExponentialEuler.h"
+#include "cedar/dynamics/integrator/Heun.h"
+#include "cedar/dynamics/integrator/RungeKutta4.h"
+#include "cedar/processing/StepTime.h"
+#include "cedar/auxiliaries/BoolParameter.h"
+#include "cedar/auxiliaries/DoubleParameter.h"
+#include "cedar/auxiliaries/MatData.h"
+#include "cedar/auxiliaries/casts.h"
+#include "cedar/units/Time.h"
+#include "cedar/units/prefixes.h"
+
+// SYSTEM INCLUDES
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+#include <algorithm>
+
+//! Simulated time for each run, in seconds.
+const double SIMULATED_TIME = 0.5;
+
+//! Step size of the reference solution, in seconds.
+const double REFERENCE_STEP_SIZE = 0.0001;
+
+/* Creates a one-dimensional field with its default lateral kernel and without noise. The activation starts as a
+ * localized bump that is strong enough to form a self-stabilized peak, which makes the dynamics nonlinear.
+ */
+cedar::dyn::NeuralFieldPtr createField(cedar::dyn::integrator::IntegratorPtr integrator)
+{
+  cedar::dyn::NeuralFieldPtr field(new cedar::dyn::NeuralField());
+  field->setDimensionality(1);
+  field->setSize(0, 100);
+  cedar::aux::asserted_pointer_cast<cedar::aux::BoolParameter>
+  (
+    field->getParameter("update stepIcon according to output")
+  )->setValue(false);
+  cedar::aux::asserted_pointer_cast<cedar::aux::DoubleParameter>
+  (
+    field->getParameter("input noise gain")
+  )->setValue(0.0);
+  field->setIntegrator(integrator);
+
+  cv::Mat& activation
+    = cedar::aux::asserted_pointer_cast<cedar::aux::MatData>(field->getBufferSlot("activation")->getData())->getData();
+  for (int i = 0; i < activation.rows; ++i)
+  {
+    activation.at<float>(i, 0) = static_cast<float>(-5.0 + 10.0 * std::exp(-0.5 * std::pow((i - 50) / 5.0, 2)));
+  }
+  return field;
+}
+
+/* Simulates the field and returns its final activation. The wall-clock time and the number of derivative evaluations
+ * are written to the given references.
+ */
+cv::Mat simulate
+(
+  cedar::dyn::integrator::IntegratorPtr integrator,
+  double stepSize,
+  double& seconds,
+  unsigned int& evaluations
+)
+{
+  cedar::dyn::NeuralFieldPtr field = createField(integrator);
+  cedar::proc::ArgumentsPtr arguments(new cedar::proc::StepTime(cedar::unit::Time(stepSize * cedar::unit::seconds)));
+  unsigned int steps = static_cast<unsigned int>(SIMULATED_TIME / stepSize + 0.5);
+
+  evaluations = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (unsigned int i = 0; i < steps; ++i)
+  {
+    field->onTrigger(arguments);
+    // the Euler integrator uses the fused Euler step of the field, which evaluates the dynamics once
+    evaluations += std::max(1u, integrator->getNumberOfEvaluations());
+  }
+  seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  return field->getBuffer("activation")->getData<cv::Mat>().clone();
+}
+
+int main(int, char**)
+{
+  double seconds;
+  unsigned int evaluations;
+  cv::Mat reference = simulate
+                      (
+                        cedar::dyn::integrator::IntegratorPtr(new cedar::dyn::integrator::RungeKutta4()),
+                        REFERENCE_STEP_SIZE,
+                        seconds,
+                        evaluations
+                      );
+
+  using cedar::dyn::integrator::IntegratorPtr;
+  std::vector<std::pair<std::string, IntegratorPtr> > integrators;
+  integrators.push_back(std::make_pair("Euler", IntegratorPtr(new cedar::dyn::integrator::Euler())));
+  integrators.push_back
+  (
+    std::make_pair("exponential Euler", IntegratorPtr(new cedar::dyn::integrator::ExponentialEuler()))
+  );
+  integrators.push_back(std::make_pair("Heun", IntegratorPtr(new cedar::dyn::integrator::Heun())));
+  integrators.push_back(std::make_pair("Runge-Kutta 4", IntegratorPtr(new cedar::dyn::integrator::RungeKutta4())));
+  integrators.push_back(std::make_pair("adaptive Heun", IntegratorPtr(new cedar::dyn::integrator::AdaptiveHeun())));
+
+  std::cout << std::setw(20) << "integrator" << std::setw(10) << "dt [ms]" << std::setw(14) << "max. error"
+            << std::setw(16) << "evaluations/s" << std::setw(22) << "ms per simulated s" << std::endl;
+  const double step_sizes[] = {0.001, 0.005, 0.01};
+  for (const auto& integrator : integrators)
+  {
+    for (double step_size : step_sizes)
+    {
+      cv::Mat result = simulate(integrator.second, step_size, seconds, evaluations);
+      std::cout << std::setw(20) << integrator.first
+                << std::setw(10) << 1000.0 * step_size
+                << std::setw(14) << cv::norm(result, reference, cv::NORM_INF)
+                << std::setw(16) << evaluations / SIMULATED_TIME
+                << std::setw(22) << 1000.0 * seconds / SIMULATED_TIME << std::endl;
+    }
+  }
+
+  return 0; // no errors -- this is a performance test.
+}
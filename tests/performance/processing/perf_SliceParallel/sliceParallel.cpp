@@ -0,0 +1,133 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        sliceParallel.cpp
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 18
+
+    Description: Measures the slice-parallel 3D code paths with one and with all threads.
+
+    Credits:
+
+======================================================================================================================*/
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CEDAR INCLUDES
+#include "cedar/processing/steps/CoordinateTransformation.h"
+#include "cedar/processing/steps/Resize.h"
+#include "cedar/auxiliaries/convolution/Convolution.h"
+#include "cedar/auxiliaries/convolution/OpenCV.h"
+#include "cedar/auxiliaries/convolution/BorderType.h"
+#include "cedar/auxiliaries/kernel/Gauss.h"
+#include "cedar/auxiliaries/math/tools.h"
+#include "cedar/auxiliaries/MatData.h"
+#include "cedar/auxiliaries/UIntParameter.h"
+#include "cedar/auxiliaries/stringFunctions.h"
+#include "cedar/testingUtilities/measurementFunctions.h"
+
+// SYSTEM INCLUDES
+#include <opencv2/opencv.hpp>
+#include <string>
+#include <vector>
+
+namespace
+{
+  void measure(const std::vector<int>& sizes, int threads, unsigned int repetitions)
+  {
+    cv::setNumThreads(threads);
+
+    std::string id = cedar::aux::toString(sizes.at(0)) + "x" + cedar::aux::toString(sizes.at(1)) + "x"
+                     + cedar::aux::toString(sizes.at(2)) + ", " + cedar::aux::toString(threads) + " thread(s)";
+
+    cv::Mat matrix(3, &sizes.front(), CV_32F);
+    cv::randu(matrix, cv::Scalar(0), cv::Scalar(1));
+    cedar::aux::MatDataPtr input(new cedar::aux::MatData(matrix));
+
+    // feature fields are sliced along their last dimension
+    cedar::proc::steps::CoordinateTransformationPtr transformation(new cedar::proc::steps::CoordinateTransformation());
+    transformation->getParameter<cedar::aux::UIntParameter>("sliced dimension")->setValue(2);
+    transformation->setInput("input", input);
+    cedar::test::test_time
+    (
+      "CoordinateTransformation " + id,
+      [&]() { transformation->onTrigger(); },
+      repetitions
+    );
+
+    cedar::proc::steps::ResizePtr resize(new cedar::proc::steps::Resize());
+    resize->setInput("input", input);
+    for (unsigned int d = 0; d < 3; ++d)
+    {
+      resize->setOutputSize(d, sizes.at(d) / 2);
+    }
+    cedar::test::test_time("Resize " + id, [&]() { resize->onTrigger(); }, repetitions);
+
+    cedar::aux::conv::ConvolutionPtr convolution(new cedar::aux::conv::Convolution());
+    convolution->setBorderType(cedar::aux::conv::BorderType::Zero);
+    convolution->setEngine(cedar::aux::conv::OpenCVPtr(new cedar::aux::conv::OpenCV()));
+    convolution->getKernelList()->append
+    (
+      cedar::aux::kernel::GaussPtr(new cedar::aux::kernel::Gauss(3, 1.0, 3.0, 0.0, 5.0))
+    );
+    cedar::test::test_time
+    (
+      "OpenCV convolution " + id,
+      [&]() { volatile cv::Mat result = convolution->convolve(matrix); },
+      repetitions
+    );
+
+    // this is what Projection uses for compressing 3D to 2D
+    cv::Mat reduced(sizes.at(0), sizes.at(1), CV_32F);
+    cedar::test::test_time
+    (
+      "3D to 2D reduction " + id,
+      [&]() { cedar::aux::math::reduceCvMat3D<float>(matrix, reduced, 2, CEDAR_OPENCV_CONSTANT(REDUCE_MAX)); },
+      repetitions
+    );
+  }
+}
+
+int main(int, char**)
+{
+  const int default_threads = cv::getNumThreads();
+
+  std::vector<std::vector<int> > sizes;
+  sizes.push_back({50, 50, 10});
+  sizes.push_back({100, 100, 30});
+  sizes.push_back({200, 200, 30});
+
+  for (const auto& size : sizes)
+  {
+    // one thread makes parallelForSlices run serially, i.e., it gives the time before the slices were parallelized
+    measure(size, 1, 20);
+    measure(size, default_threads, 20);
+  }
+
+  cv::setNumThreads(default_threads);
+  return 0; // no errors -- this is a performance test.
+}
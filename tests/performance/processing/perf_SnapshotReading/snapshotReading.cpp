@@ -0,0 +1,122 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        snapshotReading.cpp
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 18
+
+    Description: Compares lock wait times of a sum reading locked and published terms.
+
+    Credits:
+
+======================================================================================================================*/
+
+// CEDAR INCLUDES
+#include "cedar/configuration.h"
+#include "cedar/processing/steps/Sum.h"
+#include "cedar/auxiliaries/MatData.h"
+#include "cedar/units/Time.h"
+#include "cedar/units/prefixes.h"
+
+// SYSTEM INCLUDES
+#include <QWriteLocker>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <vector>
+#include <iostream>
+
+/* Measures how long a sum waits for the locks of its terms while other threads keep writing them. Each writer holds
+ * the write lock of its term for a while, as a step would during its compute call, and then publishes the term.
+ */
+double measure_lock_wait(bool publishing, unsigned int terms, unsigned int repetitions)
+{
+  cedar::proc::steps::SumPtr sum(new cedar::proc::steps::Sum());
+
+  std::vector<cedar::aux::MatDataPtr> data;
+  for (unsigned int i = 0; i < terms; ++i)
+  {
+    cedar::aux::MatDataPtr term(new cedar::aux::MatData(cv::Mat::ones(100, 100, CV_32F)));
+    term->setPublishing(publishing);
+    sum->setInput("terms", term);
+    data.push_back(term);
+  }
+
+  std::atomic<bool> stop(false);
+  std::vector<std::thread> writers;
+  for (auto term : data)
+  {
+    writers.push_back
+    (
+      std::thread
+      (
+        [term, &stop]()
+        {
+          while (!stop)
+          {
+            {
+              QWriteLocker locker(&term->getLock());
+              term->prepareWrite();
+              term->getData() += 1.0;
+              std::this_thread::sleep_for(std::chrono::microseconds(500));
+              term->publish();
+            }
+            std::this_thread::yield();
+          }
+        }
+      )
+    );
+  }
+
+  double lock_wait = 0.0;
+  for (unsigned int r = 0; r < repetitions; ++r)
+  {
+    sum->onTrigger();
+    lock_wait += sum->getLockTimeMeasurement() / cedar::unit::Time(1.0 * cedar::unit::micro * cedar::unit::seconds);
+  }
+
+  stop = true;
+  for (auto& writer : writers)
+  {
+    writer.join();
+  }
+
+  return lock_wait / static_cast<double>(repetitions);
+}
+
+int main(int, char**)
+{
+  unsigned int terms = 4;
+  unsigned int repetitions = 500;
+
+  double locked = measure_lock_wait(false, terms, repetitions);
+  std::cout << "Average lock wait with locked terms: " << locked << " us" << std::endl;
+
+  double published = measure_lock_wait(true, terms, repetitions);
+  std::cout << "Average lock wait with published terms: " << published << " us" << std::endl;
+
+  return 0; // no errors -- this is a performance test.
+}
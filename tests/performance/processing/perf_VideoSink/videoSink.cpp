@@ -0,0 +1,128 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        videoSink.cpp
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 18
+
+    Description: Measures how long recording a frame blocks the trigger thread of a video sink.
+
+    Credits:
+
+======================================================================================================================*/
+
+
+// CEDAR INCLUDES
+#include "cedar/configuration.h"
+#include "cedar/processing/sinks/VideoSink.h"
+#include "cedar/processing/StepTime.h"
+#include "cedar/auxiliaries/BoolParameter.h"
+#include "cedar/auxiliaries/FileParameter.h"
+#include "cedar/auxiliaries/MatData.h"
+#include "cedar/auxiliaries/casts.h"
+#include "cedar/units/Time.h"
+#include "cedar/units/prefixes.h"
+
+// SYSTEM INCLUDES
+#include <QCoreApplication>
+#include <QDir>
+#include <QFile>
+#include <chrono>
+#include <thread>
+#include <iostream>
+#include <string>
+
+//! Number of frames recorded per measurement.
+const unsigned int FRAMES = 90;
+
+/* Records noise frames, which are expensive to encode, and returns the average time the trigger thread spends per frame
+ * in microseconds. If paced, frames arrive at 30 fps, as they would from a camera; otherwise, as fast as possible.
+ */
+double measure_trigger_time(bool asynchronous, bool paced, unsigned int width, unsigned int height)
+{
+  std::string file_name = QDir::temp().filePath("cedar_perf_video_sink.avi").toStdString();
+
+  cedar::proc::sinks::VideoSinkPtr sink(new cedar::proc::sinks::VideoSink());
+  cedar::aux::asserted_pointer_cast<cedar::aux::FileParameter>
+  (
+    sink->getParameter("output file name")
+  )->setValue(file_name);
+  cedar::aux::asserted_pointer_cast<cedar::aux::BoolParameter>
+  (
+    sink->getParameter("asynchronous encoding")
+  )->setValue(asynchronous);
+
+  cedar::aux::MatDataPtr frame(new cedar::aux::MatData(cv::Mat(height, width, CV_8UC3)));
+  cv::randu(frame->getData(), cv::Scalar::all(0), cv::Scalar::all(255));
+  sink->setInput("input", frame);
+
+  // slightly longer than one frame at 30 fps, so that every trigger records a frame
+  cedar::proc::ArgumentsPtr step_time
+  (
+    new cedar::proc::StepTime(cedar::unit::Time(40.0 * cedar::unit::milli * cedar::unit::seconds))
+  );
+
+  sink->callOnStart();
+  double trigger_time = 0.0;
+  for (unsigned int i = 0; i < FRAMES; ++i)
+  {
+    auto start = std::chrono::steady_clock::now();
+    sink->onTrigger(step_time);
+    auto end = std::chrono::steady_clock::now();
+    trigger_time += std::chrono::duration<double, std::micro>(end - start).count();
+
+    if (paced)
+    {
+      std::this_thread::sleep_until(start + std::chrono::microseconds(33333));
+    }
+  }
+  sink->callOnStop();
+
+  std::cout << "  " << (asynchronous ? "asynchronous" : "synchronous ") << ", " << (paced ? "30 fps" : "unpaced")
+            << ": " << trigger_time / FRAMES << " us per frame on the trigger thread, "
+            << sink->getNumberOfEncodedFrames() << " frames encoded, " << sink->getNumberOfDroppedFrames()
+            << " dropped" << std::endl;
+
+  QFile::remove(QString::fromStdString(file_name));
+  return trigger_time / FRAMES;
+}
+
+int main(int argc, char** argv)
+{
+  // the encoder runs in a cedar thread, which needs an application object
+  QCoreApplication app(argc, argv);
+
+  const unsigned int sizes[][2] = {{320, 240}, {640, 480}, {1280, 720}};
+  for (const auto& size : sizes)
+  {
+    std::cout << size[0] << "x" << size[1] << ":" << std::endl;
+    measure_trigger_time(false, true, size[0], size[1]);
+    measure_trigger_time(true, true, size[0], size[1]);
+    measure_trigger_time(true, false, size[0], size[1]);
+  }
+
+  return 0; // no errors -- this is a performance test.
+}
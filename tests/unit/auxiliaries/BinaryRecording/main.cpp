@@ -0,0 +1,142 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        main.cpp
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 18
+
+    Description: Tests reading binary recordings, including damaged ones.
+
+    Credits:
+
+======================================================================================================================*/
+
+// CEDAR INCLUDES
+#include "cedar/auxiliaries/BinaryRecording.h"
+#include "cedar/auxiliaries/exceptions.h"
+#include "cedar/units/Time.h"
+
+// SYSTEM INCLUDES
+#include <boost/filesystem.hpp>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+unsigned int errors = 0;
+
+//! Writes the first bytes of the given recording to a file.
+void writeFile(const std::string& path, const std::string& contents, size_t length)
+{
+  std::ofstream stream(path.c_str(), std::ios::binary | std::ios::trunc);
+  stream.write(contents.data(), length);
+}
+
+void test_complete_recording(const std::string& path, const std::string& contents)
+{
+  std::cout << "Reading a complete recording." << std::endl;
+  writeFile(path, contents, contents.size());
+
+  cedar::aux::BinaryRecording recording(path);
+  if (recording.getNumberOfFrames() != 3)
+  {
+    ++errors;
+    std::cout << "ERROR: Read " << recording.getNumberOfFrames() << " frames instead of 3." << std::endl;
+    return;
+  }
+
+  for (size_t i = 0; i < recording.getNumberOfFrames(); ++i)
+  {
+    if (recording.getFrame(i).at<float>(1, 2) != static_cast<float>(i))
+    {
+      ++errors;
+      std::cout << "ERROR: Frame " << i << " has the wrong contents." << std::endl;
+    }
+  }
+}
+
+void test_truncated_time_stamps(const std::string& path, const std::string& contents, size_t completeSize)
+{
+  std::cout << "Reading a recording that ends inside the time stamps of its last chunk." << std::endl;
+  // the complete first chunk, then the chunk marker, frame count and one of the three time stamps of the second
+  writeFile(path, contents, completeSize + 4 + 4 + sizeof(double));
+
+  cedar::aux::BinaryRecording recording(path);
+  if (recording.getNumberOfFrames() != 3)
+  {
+    ++errors;
+    std::cout << "ERROR: Read " << recording.getNumberOfFrames() << " frames instead of the 3 of the first chunk."
+              << std::endl;
+    return;
+  }
+
+  for (size_t i = 0; i < recording.getNumberOfFrames(); ++i)
+  {
+    if (recording.getFrame(i).at<float>(1, 2) != static_cast<float>(i))
+    {
+      ++errors;
+      std::cout << "ERROR: Frame " << i << " has the wrong contents." << std::endl;
+    }
+  }
+}
+
+int main(int, char**)
+{
+  cv::Mat frame = cv::Mat::zeros(4, 5, CV_32F);
+  std::vector<cedar::unit::Time> time_stamps;
+  std::vector<cv::Mat> frames;
+  for (int i = 0; i < 3; ++i)
+  {
+    frame.at<float>(1, 2) = static_cast<float>(i);
+    frames.push_back(frame.clone());
+    time_stamps.push_back(cedar::unit::Time(0.1 * i * cedar::unit::seconds));
+  }
+
+  std::ostringstream header;
+  cedar::aux::BinaryRecording::writeHeader(header, frame);
+  std::ostringstream stream;
+  stream << header.str();
+  cedar::aux::BinaryRecording::writeChunk(stream, time_stamps, frames);
+  std::string complete = stream.str();
+  cedar::aux::BinaryRecording::writeChunk(stream, time_stamps, frames);
+
+  boost::filesystem::path path = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+  try
+  {
+    test_complete_recording(path.string(), complete);
+    test_truncated_time_stamps(path.string(), stream.str(), complete.size());
+  }
+  catch (const cedar::aux::ExceptionBase& e)
+  {
+    ++errors;
+    std::cout << "ERROR: Unexpected exception: " << e.exceptionInfo() << std::endl;
+  }
+  boost::filesystem::remove(path);
+
+  std::cout << "Test finished with " << errors << " error(s)." << std::endl;
+  return errors;
+}
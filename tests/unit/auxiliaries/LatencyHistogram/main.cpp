@@ -0,0 +1,200 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        main.cpp
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 18
+
+    Description: Tests the cedar::aux::LatencyHistogram class.
+
+    Credits:
+
+======================================================================================================================*/
+
+// CEDAR INCLUDES
+#include "cedar/auxiliaries/LatencyHistogram.h"
+#include "cedar/units/prefixes.h"
+
+// SYSTEM INCLUDES
+#include <iostream>
+#include <thread>
+
+cedar::unit::Time microseconds(double value)
+{
+  return cedar::unit::Time(value * cedar::unit::micro * cedar::unit::seconds);
+}
+
+int testPercentiles()
+{
+  std::cout << "Testing percentiles." << std::endl;
+  int errors = 0;
+  cedar::aux::LatencyHistogram histogram;
+
+  if (histogram.getPercentile(0.5) != microseconds(0.0))
+  {
+    std::cout << "ERROR: an empty histogram has a non-zero median." << std::endl;
+    ++errors;
+  }
+
+  // 98 latencies of 10 us, one of 500 us and one of 20 ms
+  for (unsigned int i = 0; i < 98; ++i)
+  {
+    histogram.record(10LL);
+  }
+  histogram.record(microseconds(500.0));
+  histogram.record(20000LL);
+
+  if (histogram.getCount() != 100)
+  {
+    std::cout << "ERROR: expected 100 latencies, got " << histogram.getCount() << "." << std::endl;
+    ++errors;
+  }
+
+  // percentiles are reported as the upper end of their bin
+  if (histogram.getPercentile(0.5) != microseconds(11.0))
+  {
+    std::cout << "ERROR: wrong median: " << histogram.getPercentile(0.5) << std::endl;
+    ++errors;
+  }
+
+  if (histogram.getPercentile(0.99) != microseconds(501.0))
+  {
+    std::cout << "ERROR: wrong 99th percentile: " << histogram.getPercentile(0.99) << std::endl;
+    ++errors;
+  }
+
+  // coarse bins are capped by the exact maximum
+  if (histogram.getPercentile(1.0) != microseconds(20000.0) || histogram.getMaximum() != microseconds(20000.0))
+  {
+    std::cout << "ERROR: wrong maximum: " << histogram.getMaximum() << std::endl;
+    ++errors;
+  }
+
+  cedar::aux::LatencyHistogram other;
+  other.record(30000LL);
+  histogram.merge(other);
+  if (histogram.getCount() != 101 || histogram.getMaximum() != microseconds(30000.0))
+  {
+    std::cout << "ERROR: merging did not add the other histogram." << std::endl;
+    ++errors;
+  }
+
+  histogram.reset();
+  if (histogram.getCount() != 0 || histogram.getMaximum() != microseconds(0.0))
+  {
+    std::cout << "ERROR: reset did not clear the histogram." << std::endl;
+    ++errors;
+  }
+
+  return errors;
+}
+
+int testBins()
+{
+  std::cout << "Testing bins." << std::endl;
+  int errors = 0;
+  cedar::aux::LatencyHistogram histogram;
+
+  histogram.record(-5LL);
+  histogram.record(999LL);
+  histogram.record(1050LL);
+  histogram.record(1000000LL);
+
+  unsigned int last = histogram.getNumberOfBins() - 1;
+  if (histogram.getBinCount(0) != 1 || histogram.getBinCount(999) != 1 || histogram.getBinCount(last) != 1)
+  {
+    std::cout << "ERROR: negative, fine or overflowing latencies ended up in the wrong bin." << std::endl;
+    ++errors;
+  }
+
+  if (histogram.getBinCount(1000) != 1 || histogram.getBinUpperBound(1000) != microseconds(1100.0))
+  {
+    std::cout << "ERROR: coarse latencies ended up in the wrong bin." << std::endl;
+    ++errors;
+  }
+
+  if (histogram.getBinUpperBound(last) != histogram.getMaximum())
+  {
+    std::cout << "ERROR: the last bin should end at the maximum." << std::endl;
+    ++errors;
+  }
+
+  return errors;
+}
+
+int testConcurrentReading()
+{
+  std::cout << "Testing reading while another thread records." << std::endl;
+  int errors = 0;
+  cedar::aux::LatencyHistogram histogram;
+  const unsigned long number_of_latencies = 100000;
+
+  std::thread recorder
+  (
+    [&]()
+    {
+      for (unsigned long i = 0; i < number_of_latencies; ++i)
+      {
+        histogram.record(static_cast<long long>(i % 2000));
+      }
+    }
+  );
+
+  unsigned long previous_count = 0;
+  while (previous_count < number_of_latencies)
+  {
+    cedar::aux::LatencyHistogram copy = histogram;
+    if (copy.getCount() < previous_count)
+    {
+      std::cout << "ERROR: a copy lost recorded latencies." << std::endl;
+      ++errors;
+      break;
+    }
+    previous_count = copy.getCount();
+  }
+  recorder.join();
+
+  if (histogram.getCount() != number_of_latencies || histogram.getMaximum() != microseconds(1999.0))
+  {
+    std::cout << "ERROR: recorded " << histogram.getCount() << " latencies with a maximum of "
+              << histogram.getMaximum() << " while being read." << std::endl;
+    ++errors;
+  }
+
+  return errors;
+}
+
+int main(int, char**)
+{
+  int errors = 0;
+
+  errors += testPercentiles();
+  errors += testBins();
+  errors += testConcurrentReading();
+
+  std::cout << "Done. There were " << errors << " error(s)." << std::endl;
+  return errors;
+}
@@ -47,6 +47,7 @@
 #ifndef Q_MOC_RUN
   #include <boost/shared_ptr.hpp>
 #endif
+#include <QCoreApplication>
 #include <string>
 
 class CustomLogger : public cedar::aux::LogInterface
@@ -68,8 +69,11 @@ class CustomLogger : public cedar::aux::LogInterface
 
 CEDAR_GENERATE_POINTER_TYPES(CustomLogger);
 
-int main()
+int main(int argc, char** argv)
 {
+  // the asynchronous mode runs a cedar thread, which needs an application object
+  QCoreApplication app(argc, argv);
+
   int errors = 0;
   
   // test general logging capabilities
@@ -142,6 +146,82 @@ int main()
     ++errors;
   }
   
+  // test asynchronous logging
+  cedar::aux::LogSingleton::getInstance()->clearLoggers();
+  CustomLoggerPtr async_logger (new CustomLogger());
+  cedar::aux::LogSingleton::getInstance()->addLogger(async_logger);
+  cedar::aux::LogSingleton::getInstance()->setAsynchronous(true);
+
+  cedar::aux::LogSingleton::getInstance()->message("first", "SystemTest::async");
+  cedar::aux::LogSingleton::getInstance()->message("second", "SystemTest::async");
+  cedar::aux::LogSingleton::getInstance()->flush();
+
+  if (async_logger->mMessages.size() != 2 || async_logger->mMessages.back() != "second")
+  {
+    std::cout << "Asynchronous messages were not passed on after flushing; logger has "
+              << async_logger->mMessages.size() << " messages." << std::endl;
+    ++errors;
+  }
+
+  // repetitions of the same message should be collapsed into one summary
+  async_logger->mMessages.clear();
+  for (unsigned int i = 0; i < 10; ++i)
+  {
+    cedar::aux::LogSingleton::getInstance()->warning("repeated", "SystemTest::dedup");
+  }
+  cedar::aux::LogSingleton::getInstance()->warning("different", "SystemTest::dedup");
+  cedar::aux::LogSingleton::getInstance()->flush();
+
+  if
+  (
+    async_logger->mMessages.size() != 3
+    || async_logger->mMessages.at(0) != "repeated"
+    || async_logger->mMessages.at(1) != "Last message repeated 9 times."
+    || async_logger->mMessages.at(2) != "different"
+  )
+  {
+    std::cout << "Repeated messages were not deduplicated; logger has "
+              << async_logger->mMessages.size() << " messages." << std::endl;
+    ++errors;
+  }
+
+  // messages beyond the rate limit should be suppressed and summarized
+  async_logger->mMessages.clear();
+  cedar::aux::LogSingleton::getInstance()->setRateLimit(5);
+  for (unsigned int i = 0; i < 20; ++i)
+  {
+    cedar::aux::LogSingleton::getInstance()->message("message " + cedar::aux::toString(i), "SystemTest::rate");
+  }
+  cedar::aux::LogSingleton::getInstance()->flush();
+  cedar::aux::LogSingleton::getInstance()->setRateLimit(0);
+
+  if
+  (
+    async_logger->mMessages.size() != 6
+    || async_logger->mMessages.back() != "15 messages from this source were suppressed by the rate limit."
+  )
+  {
+    std::cout << "Rate limit was not applied; logger has " << async_logger->mMessages.size() << " messages."
+              << std::endl;
+    ++errors;
+  }
+
+  if (cedar::aux::LogSingleton::getInstance()->getNumberOfDroppedMessages() != 0)
+  {
+    std::cout << "Messages were dropped although the queue was not full." << std::endl;
+    ++errors;
+  }
+
+  // switching back should process everything that is still queued
+  async_logger->mMessages.clear();
+  cedar::aux::LogSingleton::getInstance()->message("last", "SystemTest::async");
+  cedar::aux::LogSingleton::getInstance()->setAsynchronous(false);
+
+  if (async_logger->mMessages.size() != 1)
+  {
+    std::cout << "Queued messages were lost when switching to synchronous logging." << std::endl;
+    ++errors;
+  }
   
   return errors;
 }
@@ -0,0 +1,168 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        main.cpp
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 18
+
+    Description: Tests publishing and snapshots of cedar::aux::MatData.
+
+    Credits:
+
+======================================================================================================================*/
+
+// CEDAR INCLUDES
+#include "cedar/auxiliaries/MatData.h"
+
+// SYSTEM INCLUDES
+#include <iostream>
+#include <vector>
+
+int main()
+{
+  // the number of errors encountered in this test
+  int errors = 0;
+
+  cedar::aux::MatDataPtr data(new cedar::aux::MatData(cv::Mat::zeros(10, 10, CV_32F)));
+
+  std::cout << "Checking snapshots of non-publishing data." << std::endl;
+  auto copy = data->getSnapshot();
+  data->getData().setTo(1.0);
+  if (copy->mData.at<float>(0, 0) != 0.0f)
+  {
+    std::cout << "ERROR: snapshot of non-publishing data changed with the data." << std::endl;
+    ++errors;
+  }
+  if (data->getRevision() != 0 || copy->mRevision != 0)
+  {
+    std::cout << "ERROR: unchanged data has revision " << data->getRevision() << ", expected 0." << std::endl;
+    ++errors;
+  }
+
+  std::cout << "Checking publishing." << std::endl;
+  data->setPublishing(true);
+  auto first = data->getSnapshot();
+  if (first->mData.at<float>(0, 0) != 1.0f || first->mRevision != 1)
+  {
+    std::cout << "ERROR: enabling publishing did not publish the current value." << std::endl;
+    ++errors;
+  }
+
+  data->prepareWrite();
+  data->getData().setTo(2.0);
+  if (data->getSnapshot()->mData.at<float>(0, 0) != 1.0f)
+  {
+    std::cout << "ERROR: unpublished changes are visible in snapshots." << std::endl;
+    ++errors;
+  }
+
+  data->publish();
+  auto second = data->getSnapshot();
+  if (second->mData.at<float>(0, 0) != 2.0f || second->mRevision != 2 || data->getRevision() != 2)
+  {
+    std::cout << "ERROR: published value or revision is wrong." << std::endl;
+    ++errors;
+  }
+  if (first->mData.at<float>(0, 0) != 1.0f)
+  {
+    std::cout << "ERROR: publishing overwrote a buffer that is still held by a reader." << std::endl;
+    ++errors;
+  }
+
+  std::cout << "Checking that buffers are reused once released." << std::endl;
+  const float* first_memory = first->mData.ptr<float>();
+  first.reset();
+  second.reset();
+  copy.reset();
+  data->prepareWrite();
+  data->getData().setTo(3.0);
+  data->publish();
+  auto third = data->getSnapshot();
+  if (third->mData.ptr<float>() != first_memory)
+  {
+    std::cout << "ERROR: released buffer was not reused." << std::endl;
+    ++errors;
+  }
+  if (third->mData.at<float>(0, 0) != 3.0f)
+  {
+    std::cout << "ERROR: reused buffer holds the wrong value." << std::endl;
+    ++errors;
+  }
+
+  std::cout << "Checking that publishing hands over the matrix without copying it." << std::endl;
+  if (third->mData.ptr<float>() != data->getData().ptr<float>())
+  {
+    std::cout << "ERROR: the published snapshot does not share the memory of the matrix." << std::endl;
+    ++errors;
+  }
+
+  std::cout << "Checking writing from the previous value." << std::endl;
+  cv::Mat previous = data->prepareWrite(false);
+  if (previous.at<float>(0, 0) != 3.0f || previous.ptr<float>() == data->getData().ptr<float>())
+  {
+    std::cout << "ERROR: prepareWrite did not return the previous matrix or did not move to a new buffer." << std::endl;
+    ++errors;
+  }
+  cv::add(previous, 1.0, data->getData());
+  data->publish();
+  if (data->getSnapshot()->mData.at<float>(0, 0) != 4.0f || third->mData.at<float>(0, 0) != 3.0f)
+  {
+    std::cout << "ERROR: the value written from the previous value was not published correctly." << std::endl;
+    ++errors;
+  }
+
+  std::cout << "Checking that readers holding many snapshots never block publishing." << std::endl;
+  std::vector<cedar::aux::MatData::ConstSnapshotPtr> held;
+  for (int i = 0; i < 10; ++i)
+  {
+    data->prepareWrite(false);
+    data->getData().setTo(static_cast<float>(i));
+    data->publish();
+    held.push_back(data->getSnapshot());
+  }
+  for (int i = 0; i < 10; ++i)
+  {
+    if (held.at(i)->mData.at<float>(0, 0) != static_cast<float>(i))
+    {
+      std::cout << "ERROR: snapshot " << i << " was overwritten while it was held." << std::endl;
+      ++errors;
+    }
+  }
+  held.clear();
+  third.reset();
+
+  std::cout << "Checking that setData publishes." << std::endl;
+  data->setData(cv::Mat::ones(5, 3, CV_32F));
+  auto resized = data->getSnapshot();
+  if (resized->mData.rows != 5 || resized->mData.cols != 3)
+  {
+    std::cout << "ERROR: setData did not publish the new matrix." << std::endl;
+    ++errors;
+  }
+
+  std::cout << "Done. There were " << errors << " error(s)." << std::endl;
+  return errors;
+}
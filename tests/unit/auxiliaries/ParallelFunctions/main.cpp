@@ -0,0 +1,126 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        main.cpp
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 18
+
+    Description: Unit test for running slices of N-D work in parallel.
+
+    Credits:
+
+======================================================================================================================*/
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CEDAR INCLUDES
+#include "cedar/auxiliaries/parallelFunctions.h"
+
+// SYSTEM INCLUDES
+#include <opencv2/opencv.hpp>
+#include <atomic>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+int main(int, char**)
+{
+  // the number of errors encountered in this test
+  int errors = 0;
+
+  std::cout << "Checking that every slice is processed exactly once." << std::endl;
+  {
+    int sizes[3] = {37, 40, 40};
+    cv::Mat matrix = cv::Mat::zeros(3, sizes, CV_32F);
+    std::atomic<int> calls(0);
+    cedar::aux::parallelForSlices
+    (
+      matrix,
+      [&](int begin, int end)
+      {
+        ++calls;
+        for (int i = begin; i < end; ++i)
+        {
+          cv::Mat plane(sizes[1], sizes[2], CV_32F, matrix.ptr(i));
+          plane += 1.0;
+        }
+      }
+    );
+
+    double min, max;
+    cv::minMaxIdx(matrix, &min, &max);
+    if (min != 1.0 || max != 1.0)
+    {
+      std::cout << "ERROR: slices were processed between " << min << " and " << max << " times." << std::endl;
+      ++errors;
+    }
+    if (calls < 1 || calls > sizes[0])
+    {
+      std::cout << "ERROR: the body was called " << calls << " times for " << sizes[0] << " slices." << std::endl;
+      ++errors;
+    }
+  }
+
+  std::cout << "Checking that small work runs in the calling thread." << std::endl;
+  {
+    std::vector<std::thread::id> threads;
+    cedar::aux::parallelForSlices
+    (
+      10,
+      100,
+      [&](int begin, int end)
+      {
+        threads.push_back(std::this_thread::get_id());
+        if (begin != 0 || end != 10)
+        {
+          std::cout << "ERROR: got the range " << begin << " to " << end << " instead of all slices." << std::endl;
+          ++errors;
+        }
+      }
+    );
+    if (threads.size() != 1 || threads.front() != std::this_thread::get_id())
+    {
+      std::cout << "ERROR: small work wasn't run once in the calling thread." << std::endl;
+      ++errors;
+    }
+  }
+
+  std::cout << "Checking that empty matrices don't call the body." << std::endl;
+  {
+    bool called = false;
+    cedar::aux::parallelForSlices(cv::Mat(), [&](int, int) { called = true; });
+    cedar::aux::parallelForSlices(0, 1000000, [&](int, int) { called = true; });
+    if (called)
+    {
+      std::cout << "ERROR: the body was called without any slices." << std::endl;
+      ++errors;
+    }
+  }
+
+  std::cout << "Test finished with " << errors << " error(s)." << std::endl;
+  return errors;
+}
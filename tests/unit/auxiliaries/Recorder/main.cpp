@@ -40,6 +40,7 @@
 #include "cedar/auxiliaries/CallFunctionInThread.h"
 #include "cedar/auxiliaries/sleepFunctions.h"
 #include "cedar/auxiliaries/Settings.h"
+#include "cedar/auxiliaries/exceptions.h"
 #include "cedar/units/Time.h"
 #include "cedar/units/prefixes.h"
 
@@ -95,6 +96,25 @@ void run_test()
   cedar::aux::RecorderSingleton::getInstance()->start();
   cedar::aux::sleep(cedar::unit::Time(5.0 * cedar::unit::seconds));
   cedar::aux::RecorderSingleton::getInstance()->stop();
+
+  // with the default (blocking) overflow policy, no snapshots may be lost
+  if (cedar::aux::RecorderSingleton::getInstance()->getNumberOfDroppedFrames() != 0)
+  {
+    errors++;
+    std::cout << "Recorder dropped frames although its overflow policy is to block." << std::endl;
+  }
+
+  try
+  {
+    cedar::aux::RecorderSingleton::getInstance()->setBufferCapacity(0);
+    errors++;
+    std::cout << "Recorder accepted a buffer capacity of zero." << std::endl;
+  }
+  catch (const cedar::aux::RangeException&)
+  {
+    // expected
+  }
+
   cedar::aux::RecorderSingleton::getInstance()->clear();
 
   std::string filename = cedar::aux::RecorderSingleton::getInstance()->getOutputDirectory()+"/Mat1.csv";
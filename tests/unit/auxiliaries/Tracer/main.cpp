@@ -0,0 +1,161 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        main.cpp
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 18
+
+    Description: Unit test for cedar::aux::Tracer.
+
+    Credits:
+
+======================================================================================================================*/
+
+// CEDAR INCLUDES
+#include "cedar/auxiliaries/Tracer.h"
+#include "cedar/auxiliaries/sleepFunctions.h"
+#include "cedar/units/Time.h"
+#include "cedar/units/prefixes.h"
+
+// SYSTEM INCLUDES
+#include <QThread>
+#include <boost/date_time/posix_time/posix_time.hpp>
+#include <iostream>
+#include <sstream>
+
+//! Records an event that lasts for the given number of milliseconds.
+void record(const std::string& name, const std::string& detail = std::string(), double milliseconds = 0.0)
+{
+  boost::posix_time::ptime begin = boost::posix_time::microsec_clock::universal_time();
+  if (milliseconds > 0.0)
+  {
+    cedar::aux::sleep(cedar::unit::Time(milliseconds * cedar::unit::milli * cedar::unit::seconds));
+  }
+  cedar::aux::Tracer::record("test", name, detail, begin, boost::posix_time::microsec_clock::universal_time());
+}
+
+//! Records a few events in a separate thread.
+class TracingThread : public QThread
+{
+protected:
+  void run()
+  {
+    record("thread", "second thread", 2.0);
+  }
+};
+
+int main()
+{
+  // the number of errors encountered in this test
+  int errors = 0;
+
+  // nothing may be recorded while tracing is disabled
+  record("disabled");
+  if (!cedar::aux::Tracer::getEvents().empty())
+  {
+    std::cout << "ERROR: events were recorded while tracing was disabled." << std::endl;
+    ++errors;
+  }
+
+  // a full buffer takes roughly a hundred bytes per event and thread
+  if (cedar::aux::Tracer::getBufferCapacity() > 10000)
+  {
+    std::cout << "ERROR: the default buffer capacity is " << cedar::aux::Tracer::getBufferCapacity() << "."
+              << std::endl;
+    ++errors;
+  }
+
+  cedar::aux::Tracer::setBufferCapacity(4);
+  cedar::aux::Tracer::setEnabled(true);
+  record("outer", "with \"quotes\"", 1.0);
+
+  TracingThread thread;
+  thread.start();
+  thread.wait();
+
+  auto events = cedar::aux::Tracer::getEvents();
+  if (events.size() != 2)
+  {
+    std::cout << "ERROR: expected two events, got " << events.size() << "." << std::endl;
+    ++errors;
+  }
+  else
+  {
+    if (events.at(0).mName != "outer" || events.at(1).mName != "thread")
+    {
+      std::cout << "ERROR: events are not ordered by their beginning." << std::endl;
+      ++errors;
+    }
+    if (events.at(0).mThread == events.at(1).mThread)
+    {
+      std::cout << "ERROR: events of different threads have the same thread number." << std::endl;
+      ++errors;
+    }
+    if (events.at(0).mEnd < events.at(0).mBegin)
+    {
+      std::cout << "ERROR: event ends before it begins." << std::endl;
+      ++errors;
+    }
+  }
+
+  // the ring buffer only keeps the newest events
+  for (int i = 0; i < 10; ++i)
+  {
+    record("repeated");
+  }
+  unsigned int repeated = 0;
+  for (const auto& event : cedar::aux::Tracer::getEvents())
+  {
+    if (event.mName == "repeated")
+    {
+      ++repeated;
+    }
+  }
+  if (repeated != 4)
+  {
+    std::cout << "ERROR: expected the buffer to hold four repeated events, got " << repeated << "." << std::endl;
+    ++errors;
+  }
+
+  std::stringstream trace;
+  cedar::aux::Tracer::writeChromeTrace(trace);
+  std::cout << trace.str();
+  if (trace.str().find("\"ph\":\"X\"") == std::string::npos || trace.str().find("with \\\"quotes\\\"") == std::string::npos)
+  {
+    std::cout << "ERROR: the exported trace does not contain the expected events." << std::endl;
+    ++errors;
+  }
+
+  cedar::aux::Tracer::setEnabled(false);
+  cedar::aux::Tracer::clear();
+  if (!cedar::aux::Tracer::getEvents().empty())
+  {
+    std::cout << "ERROR: clear did not remove the events." << std::endl;
+    ++errors;
+  }
+
+  return errors;
+}
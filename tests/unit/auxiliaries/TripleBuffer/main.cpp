@@ -0,0 +1,144 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        main.cpp
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 18
+
+    Description: Tests the cedar::aux::TripleBuffer class.
+
+    Credits:
+
+======================================================================================================================*/
+
+// CEDAR INCLUDES
+#include "cedar/auxiliaries/TripleBuffer.h"
+
+// SYSTEM INCLUDES
+#include <atomic>
+#include <iostream>
+#include <thread>
+
+//! Two copies of the same counter; a reader that sees them differ read a buffer the writer was still filling.
+struct Sample
+{
+  Sample() : mFirst(0), mSecond(0) {}
+  unsigned long mFirst;
+  unsigned long mSecond;
+};
+
+int testSingleThreaded()
+{
+  std::cout << "Testing publish and update." << std::endl;
+  int errors = 0;
+  cedar::aux::TripleBuffer<int> buffer;
+  buffer.initialize([](int& value) { value = -1; });
+
+  if (buffer.update())
+  {
+    ++errors;
+    std::cout << "ERROR: update succeeded before anything was published." << std::endl;
+  }
+
+  buffer.getWriteBuffer() = 1;
+  buffer.publish();
+  buffer.getWriteBuffer() = 2;
+  buffer.publish();
+
+  if (!buffer.update() || buffer.getReadBuffer() != 2)
+  {
+    ++errors;
+    std::cout << "ERROR: the reader did not get the latest value, but " << buffer.getReadBuffer() << "." << std::endl;
+  }
+
+  if (buffer.update() || buffer.getReadBuffer() != 2)
+  {
+    ++errors;
+    std::cout << "ERROR: a second update changed the read buffer." << std::endl;
+  }
+
+  return errors;
+}
+
+int testConcurrent()
+{
+  std::cout << "Testing concurrent writing and reading." << std::endl;
+  const unsigned long count = 1000000;
+  cedar::aux::TripleBuffer<Sample> buffer;
+  std::atomic<bool> done(false);
+
+  std::thread writer([&]()
+  {
+    for (unsigned long i = 1; i <= count; ++i)
+    {
+      Sample& sample = buffer.getWriteBuffer();
+      sample.mFirst = i;
+      sample.mSecond = i;
+      buffer.publish();
+    }
+    done = true;
+  });
+
+  int errors = 0;
+  unsigned long last = 0;
+  while (last < count)
+  {
+    bool finished = done;
+    if (!buffer.update())
+    {
+      if (finished)
+      {
+        ++errors;
+        std::cout << "ERROR: the last value was never handed over." << std::endl;
+        break;
+      }
+      continue;
+    }
+
+    const Sample& sample = buffer.getReadBuffer();
+    if (sample.mFirst != sample.mSecond || sample.mFirst <= last)
+    {
+      ++errors;
+      std::cout << "ERROR: read " << sample.mFirst << "/" << sample.mSecond << " after " << last << "." << std::endl;
+      break;
+    }
+    last = sample.mFirst;
+  }
+
+  writer.join();
+  return errors;
+}
+
+int main(int, char**)
+{
+  int errors = 0;
+
+  errors += testSingleThreaded();
+  errors += testConcurrent();
+
+  std::cout << "Test finished with " << errors << " error(s)." << std::endl;
+  return errors;
+}
@@ -37,14 +37,17 @@
 
 // LOCAL INCLUDES
 #include "cedar/auxiliaries/convolution/Engine.h"
+#include "cedar/auxiliaries/convolution/KernelList.h"
 #include "cedar/auxiliaries/convolution/OpenCV.h"
 #include "cedar/auxiliaries/convolution/FFTW.h"
+#include "cedar/auxiliaries/convolution/Strategy.h"
 #include "cedar/auxiliaries/kernel/Kernel.h"
 #include "cedar/auxiliaries/kernel/Separable.h"
 #include "cedar/auxiliaries/math/tools.h"
 #include "cedar/auxiliaries/MatData.h"
 #include "cedar/auxiliaries/utilities.h"
 #include "cedar/auxiliaries/kernel/Gauss.h"
+#include "cedar/auxiliaries/kernel/RotatedGauss.h"
 #include "cedar/configuration.h"
 
 // SYSTEM INCLUDES
@@ -1123,6 +1126,139 @@ void testMatrixMatrixOperations(cedar::aux::conv::EnginePtr engine, int& ok, int
   }
 }
 
+int testStrategies(cedar::aux::conv::OpenCVPtr engine)
+{
+  std::cout << "=============================================================================" << std::endl;
+  std::cout << "Testing strategies of the OpenCV engine" << std::endl;
+  std::cout << "=============================================================================" << std::endl;
+
+  int errors = 0;
+
+  // all strategies that can be applied must produce the same results
+  for (unsigned int dim = 1; dim <= 3; ++dim)
+  {
+    cedar::aux::kernel::GaussPtr gauss(new cedar::aux::kernel::Gauss(dim, 1.0, 1.5, 0.0, 3.0));
+    std::vector<int> sizes(dim, 13);
+    if (dim == 1)
+    {
+      sizes.push_back(1);
+    }
+    cv::Mat matrix(static_cast<int>(sizes.size()), &sizes.front(), CV_32F);
+    cv::randu(matrix, cv::Scalar(0), cv::Scalar(1));
+
+    for (const auto& border_type : cedar::aux::conv::BorderType::type().list())
+    {
+      cv::Mat direct = engine->convolveUsing(matrix, gauss, border_type, cedar::aux::conv::Strategy::Direct);
+      cv::Mat separable = engine->convolveUsing(matrix, gauss, border_type, cedar::aux::conv::Strategy::Separable);
+      if (cv::norm(direct, separable, cv::NORM_INF) > 1e-4)
+      {
+        std::cout << "ERROR: separable and direct convolution differ in " << dim << "D with border "
+                  << border_type.name() << std::endl;
+        ++errors;
+      }
+
+      if (dim <= 2)
+      {
+        cv::Mat fft = engine->convolveUsing(matrix, gauss, border_type, cedar::aux::conv::Strategy::FFT);
+        if (cv::norm(direct, fft, cv::NORM_INF) > 1e-4)
+        {
+          std::cout << "ERROR: fft and direct convolution differ in " << dim << "D with border "
+                    << border_type.name() << std::endl;
+          ++errors;
+        }
+      }
+    }
+  }
+
+  // the planner should pick the obvious choices
+  if (cedar::aux::conv::OpenCV::planStrategy({64}, {3}, false) != cedar::aux::conv::Strategy::Direct)
+  {
+    std::cout << "ERROR: small 1D kernels should be applied directly." << std::endl;
+    ++errors;
+  }
+  if (cedar::aux::conv::OpenCV::planStrategy({64, 64, 64}, {19, 19, 19}, true) != cedar::aux::conv::Strategy::Separable)
+  {
+    std::cout << "ERROR: large separable 3D kernels should be applied in passes." << std::endl;
+    ++errors;
+  }
+  if (cedar::aux::conv::OpenCV::planStrategy({256, 256}, {101, 101}, false) != cedar::aux::conv::Strategy::FFT)
+  {
+    std::cout << "ERROR: large non-separable 2D kernels should be applied via fft." << std::endl;
+    ++errors;
+  }
+
+  std::cout << "Strategy errors: " << errors << std::endl;
+  return errors;
+}
+
+int testConvolveInto(cedar::aux::conv::OpenCVPtr engine, const cv::Mat& matrix)
+{
+  int errors = 0;
+  for (const auto& border_type : cedar::aux::conv::BorderType::type().list())
+  {
+    for (bool alternate : {false, true})
+    {
+      cv::Mat expected = engine->convolve(matrix, border_type, cedar::aux::conv::Mode::Same, alternate);
+
+      cv::Mat output(matrix.rows, matrix.cols, matrix.type());
+      const uchar* data = output.data;
+      engine->convolveInto(matrix, output, border_type, cedar::aux::conv::Mode::Same, alternate);
+      if (output.data != data)
+      {
+        std::cout << "ERROR: convolveInto reallocated the output with border " << border_type.name() << std::endl;
+        ++errors;
+      }
+      if (cv::norm(expected, output, cv::NORM_INF) > 1e-4)
+      {
+        std::cout << "ERROR: convolveInto and convolve differ for a " << matrix.rows << "x" << matrix.cols
+                  << " matrix with border " << border_type.name() << std::endl;
+        ++errors;
+      }
+
+      cv::Mat in_place = matrix.clone();
+      engine->convolveInto(in_place, in_place, border_type, cedar::aux::conv::Mode::Same, alternate);
+      if (cv::norm(expected, in_place, cv::NORM_INF) > 1e-4)
+      {
+        std::cout << "ERROR: convolveInto in place and convolve differ for a " << matrix.rows << "x" << matrix.cols
+                  << " matrix with border " << border_type.name() << std::endl;
+        ++errors;
+      }
+    }
+  }
+  return errors;
+}
+
+int testConvolveInto()
+{
+  std::cout << "=============================================================================" << std::endl;
+  std::cout << "Testing convolveInto of the OpenCV engine" << std::endl;
+  std::cout << "=============================================================================" << std::endl;
+
+  int errors = 0;
+
+  // two kernels, one of them not separable
+  cedar::aux::conv::KernelListPtr kernels_2d(new cedar::aux::conv::KernelList());
+  kernels_2d->append(cedar::aux::kernel::KernelPtr(new cedar::aux::kernel::Gauss(2, 1.0, 1.5, 0.0, 3.0)));
+  kernels_2d->append(cedar::aux::kernel::KernelPtr(new cedar::aux::kernel::RotatedGauss()));
+  cedar::aux::conv::OpenCVPtr engine_2d(new cedar::aux::conv::OpenCV());
+  engine_2d->setKernelList(kernels_2d);
+  cv::Mat matrix_2d(40, 40, CV_32F);
+  cv::randu(matrix_2d, cv::Scalar(0), cv::Scalar(1));
+  errors += testConvolveInto(engine_2d, matrix_2d);
+
+  // the kernel has to be oriented like the vector
+  cedar::aux::conv::KernelListPtr kernels_1d(new cedar::aux::conv::KernelList());
+  kernels_1d->append(cedar::aux::kernel::KernelPtr(new cedar::aux::kernel::Gauss(1, 1.0, 1.5, 0.0, 3.0)));
+  cedar::aux::conv::OpenCVPtr engine_1d(new cedar::aux::conv::OpenCV());
+  engine_1d->setKernelList(kernels_1d);
+  cv::Mat column(40, 1, CV_32F);
+  cv::randu(column, cv::Scalar(0), cv::Scalar(1));
+  errors += testConvolveInto(engine_1d, column);
+  errors += testConvolveInto(engine_1d, column.t());
+
+  std::cout << "convolveInto errors: " << errors << std::endl;
+  return errors;
+}
 
 int testEngine(cedar::aux::conv::EnginePtr engine)
 {
@@ -1239,6 +1375,8 @@ int main()
 
   cedar::aux::conv::OpenCVPtr open_cv (new cedar::aux::conv::OpenCV());
   errors += testEngine(open_cv);
+  errors += testStrategies(open_cv);
+  errors += testConvolveInto();
 
 #ifdef CEDAR_USE_FFTW
   cedar::aux::conv::FFTWPtr fftw (new cedar::aux::conv::FFTW());
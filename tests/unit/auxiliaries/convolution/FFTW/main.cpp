@@ -41,12 +41,15 @@
 // CEDAR INCLUDES
 #include "cedar/auxiliaries/convolution/Convolution.h"
 #include "cedar/auxiliaries/convolution/FFTW.h"
+#include "cedar/auxiliaries/convolution/KernelList.h"
+#include "cedar/auxiliaries/kernel/Gauss.h"
 #include "cedar/auxiliaries/LoopedThread.h"
 #include "cedar/auxiliaries/CallFunctionInThread.h"
 #include "cedar/auxiliaries/sleepFunctions.h"
 
 // SYSTEM INCLUDES
 #include <opencv2/opencv.hpp>
+#include <atomic>
 
 class FFTW : public cedar::aux::conv::FFTW
 {
@@ -107,6 +110,100 @@ void multi_thread_test()
   }
 }
 
+//! Convolves with one engine from several threads at once; each convolution has to produce the same result.
+class SharedEngineTestThread : public cedar::aux::LoopedThread
+{
+  public:
+    SharedEngineTestThread(FFTWPtr fftw, cv::Mat matrix, cv::Mat expected, std::atomic<int>& errors)
+    :
+    mFftw(fftw),
+    mMatrix(matrix),
+    mExpected(expected),
+    mErrors(errors)
+    {
+    }
+
+    void step(cedar::unit::Time)
+    {
+      cv::Mat result;
+      this->mFftw->convolveInto(this->mMatrix, result, cedar::aux::conv::BorderType::Cyclic);
+      if (cv::norm(result - this->mExpected, cv::NORM_INF) > 1e-6)
+      {
+        ++this->mErrors;
+      }
+    }
+
+    FFTWPtr mFftw;
+    cv::Mat mMatrix;
+    cv::Mat mExpected;
+    std::atomic<int>& mErrors;
+};
+CEDAR_GENERATE_POINTER_TYPES(SharedEngineTestThread);
+
+int shared_engine_test()
+{
+  FFTWPtr fftw(new FFTW());
+  fftw->getKernelList()->append(cedar::aux::kernel::KernelPtr(new cedar::aux::kernel::Gauss(2, 1.0, 3.0, 0.0, 3.0)));
+  cv::Mat matrix(40, 30, CV_32F);
+  cv::randu(matrix, 0.0, 1.0);
+  cv::Mat expected;
+  fftw->convolveInto(matrix, expected, cedar::aux::conv::BorderType::Cyclic);
+
+  std::atomic<int> errors(0);
+  std::vector<SharedEngineTestThreadPtr> threads;
+  for (size_t i = 0; i < 4; ++i)
+  {
+    threads.push_back(SharedEngineTestThreadPtr(new SharedEngineTestThread(fftw, matrix, expected, errors)));
+    threads.back()->start();
+  }
+
+  cedar::aux::sleep(0.5 * cedar::unit::seconds);
+
+  for (auto thread : threads)
+  {
+    thread->stop();
+    thread->wait();
+  }
+
+  if (errors > 0)
+  {
+    std::cout << "error: " << errors << " convolutions on a shared engine gave wrong results" << std::endl;
+    return 1;
+  }
+  return 0;
+}
+
+//! Convolves matrices that start one element into their buffer, i.e., don't have the alignment FFTW planned for.
+int unaligned_test(int type)
+{
+  int errors = 0;
+  FFTWPtr fftw(new FFTW());
+  fftw->getKernelList()->append(cedar::aux::kernel::KernelPtr(new cedar::aux::kernel::Gauss(2, 1.0, 3.0, 0.0, 3.0)));
+  cv::Mat matrix(40, 30, type);
+  cv::randu(matrix, 0.0, 1.0);
+  cv::Mat expected;
+  fftw->convolveInto(matrix, expected, cedar::aux::conv::BorderType::Cyclic);
+
+  cv::Mat input_buffer(1, static_cast<int>(matrix.total()) + 1, type);
+  cv::Mat unaligned_input(matrix.rows, matrix.cols, type, input_buffer.ptr(0, 1));
+  matrix.copyTo(unaligned_input);
+  cv::Mat output_buffer(1, static_cast<int>(matrix.total()) + 1, type);
+  cv::Mat unaligned_output(matrix.rows, matrix.cols, type, output_buffer.ptr(0, 1));
+
+  fftw->convolveInto(unaligned_input, unaligned_output, cedar::aux::conv::BorderType::Cyclic);
+  if (unaligned_output.data != output_buffer.ptr(0, 1))
+  {
+    ++errors;
+    std::cout << "error: the output was reallocated instead of written in place" << std::endl;
+  }
+  if (cv::norm(unaligned_output - expected, cv::NORM_INF) > 1e-5)
+  {
+    ++errors;
+    std::cout << "error: convolving unaligned matrices of type " << type << " gives a different result" << std::endl;
+  }
+  return errors;
+}
+
 // global variable
 unsigned int errors;
 
@@ -239,6 +336,13 @@ void run_test()
   kernel_pad = cv::Mat(3, sizes_kernel, CV_32F);
   padded = fftw->padTheKernel(matrix_pad, kernel_pad);
 
+  std::cout << "test no " << test_number++ << ": unaligned matrices" << std::endl;
+  errors += unaligned_test(CV_32F);
+  errors += unaligned_test(CV_64F);
+
+  std::cout << "test no " << test_number++ << ": one engine used by several threads" << std::endl;
+  errors += shared_engine_test();
+
   multi_thread_test();
 
   std::cout << "test finished, there were " << errors << " errors" << std::endl;
@@ -246,6 +350,7 @@ void run_test()
   {
     errors = 255;
   }
+  ::errors = errors;
 }
 
 int main(int argc, char* argv[])
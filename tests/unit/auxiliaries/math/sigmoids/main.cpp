@@ -40,11 +40,67 @@
 #include "cedar/auxiliaries/math/transferFunctions/AbsSigmoid.h"
 #include "cedar/auxiliaries/math/transferFunctions/ExpSigmoid.h"
 #include "cedar/auxiliaries/math/transferFunctions/HeavisideSigmoid.h"
+#include "cedar/auxiliaries/math/transferFunctions/LinearTransferFunction.h"
+#include "cedar/auxiliaries/math/transferFunctions/Logarithm.h"
+#include "cedar/auxiliaries/math/transferFunctions/SemiLinearTransferFunction.h"
 #include "cedar/auxiliaries/math/tools.h"
 #include "cedar/auxiliaries/math/TransferFunctionDeclaration.h"
 #include "cedar/auxiliaries/utilities.h"
 
 // SYSTEM INCLUDES
+#include <vector>
+#include <string>
+#include <utility>
+#include <algorithm>
+#include <cmath>
+
+// compares the batch path of the transfer function with the scalar one; returns the number of errors
+template <typename T>
+int test_batch_compute(const std::string& name, cedar::aux::math::TransferFunctionPtr function)
+{
+  int errors = 0;
+  std::vector<int> sizes(3, 17);
+  cv::Mat values(3, &sizes.front(), cv::DataType<T>::type);
+  cv::randu(values, cv::Scalar(-2.0), cv::Scalar(2.0));
+  // make sure the threshold and zero are hit exactly
+  values.ptr<T>()[0] = T(0);
+  values.ptr<T>()[1] = T(0.5);
+
+  cv::Mat expected = function->compute<T>(values);
+
+  cv::Mat result;
+  function->compute(values, result);
+  cv::Mat in_place = values.clone();
+  function->compute(in_place, in_place);
+
+  cv::MatConstIterator_<T> iter_expected = expected.begin<T>();
+  cv::MatConstIterator_<T> iter_result = result.begin<T>();
+  cv::MatConstIterator_<T> iter_in_place = in_place.begin<T>();
+  for ( ; iter_expected != expected.end<T>(); ++iter_expected, ++iter_result, ++iter_in_place)
+  {
+    const double expected_value = static_cast<double>(*iter_expected);
+    const double tolerance = 1e-5 * std::max(1.0, std::abs(expected_value));
+    for (int path = 0; path < 2; ++path)
+    {
+      const double value = static_cast<double>(path == 0 ? *iter_result : *iter_in_place);
+      bool equal = (std::isnan(expected_value) && std::isnan(value))
+                   || (std::isinf(expected_value) && value == expected_value)
+                   || std::abs(value - expected_value) <= tolerance;
+      if (!equal)
+      {
+        std::cout << "error in batch compute of " << name << " (" << (path == 0 ? "result" : "in place") << "): "
+                  << value << " instead of " << expected_value << std::endl;
+        ++errors;
+        break;
+      }
+    }
+    if (errors > 0)
+    {
+      break;
+    }
+  }
+  return errors;
+}
 
 int main()
 {
@@ -120,6 +176,35 @@ int main()
   cedar::aux::write(sigmoid_my_values);
   cedar::aux::write(sigmoid_my_values_double);
 
+  // test batch computation of all transfer functions
+  std::cout << "test no " << test_number++ << std::endl;
+  using cedar::aux::math::TransferFunctionPtr;
+  std::vector<std::pair<std::string, TransferFunctionPtr> > functions;
+  functions.push_back(std::make_pair("AbsSigmoid", TransferFunctionPtr(new cedar::aux::math::AbsSigmoid(0.5, 10.0))));
+  functions.push_back(std::make_pair("ExpSigmoid", TransferFunctionPtr(new cedar::aux::math::ExpSigmoid(0.5, 10.0))));
+  functions.push_back
+  (
+    std::make_pair("HeavisideSigmoid", TransferFunctionPtr(new cedar::aux::math::HeavisideSigmoid(0.5)))
+  );
+  functions.push_back
+  (
+    std::make_pair("LinearTransferFunction", TransferFunctionPtr(new cedar::aux::math::LinearTransferFunction()))
+  );
+  functions.push_back
+  (
+    std::make_pair
+    (
+      "SemiLinearTransferFunction",
+      TransferFunctionPtr(new cedar::aux::math::SemiLinearTransferFunction(0.5, 2.0))
+    )
+  );
+  functions.push_back(std::make_pair("Logarithm", TransferFunctionPtr(new cedar::aux::math::Logarithm())));
+  for (size_t i = 0; i < functions.size(); ++i)
+  {
+    errors += test_batch_compute<float>(functions.at(i).first, functions.at(i).second);
+    errors += test_batch_compute<double>(functions.at(i).first, functions.at(i).second);
+  }
+
   std::cout << "test finished, there were " << errors << " errors" << std::endl;
   if (errors > 255)
   {
@@ -0,0 +1,167 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        main.cpp
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 18
+
+    Description: Tests that cedar::dev::kteam::DriveSerial requests the encoders only when they are measured.
+
+    Credits:
+
+======================================================================================================================*/
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CEDAR INCLUDES
+#include "cedar/testingUtilities/devices/FakeSerialRobot.h"
+#include "cedar/testingUtilities/helpers.h"
+#include "cedar/devices/kteam/DriveSerial.h"
+#include "cedar/devices/kteam/SerialChannel.h"
+#include "cedar/auxiliaries/StringParameter.h"
+#include "cedar/auxiliaries/sleepFunctions.h"
+#include "cedar/units/Time.h"
+#include "cedar/units/Velocity.h"
+
+// SYSTEM INCLUDES
+#include <iostream>
+#include <vector>
+
+#ifndef CEDAR_OS_WINDOWS
+
+//! Makes the movement command callable without a running communication loop.
+class TestDrive : public cedar::dev::kteam::DriveSerial
+{
+public:
+  TestDrive(cedar::dev::kteam::SerialChannelPtr channel)
+  :
+  cedar::dev::kteam::DriveSerial(channel)
+  {
+  }
+
+  using cedar::dev::kteam::DriveSerial::sendMovementCommand;
+};
+
+int testMovementWithoutMeasurement(TestDrive& drive, cedar::test::dev::FakeSerialRobot& robot)
+{
+  std::cout << "Testing movement commands while no measurement is due." << std::endl;
+  int errors = 0;
+
+  unsigned int speed_commands = robot.getNumberOfCommandsReceived("D");
+  for (unsigned int i = 0; i < 5; ++i)
+  {
+    drive.sendMovementCommand();
+  }
+
+  CEDAR_UNIT_TEST_CONDITION(errors, robot.getNumberOfCommandsReceived("D") == speed_commands + 5);
+  CEDAR_UNIT_TEST_CONDITION(errors, robot.getNumberOfCommandsReceived("Q") == 0);
+
+  return errors;
+}
+
+int testRetrieveEncoders(TestDrive& drive, cedar::test::dev::FakeSerialRobot& robot)
+{
+  std::cout << "Testing encoder retrieval." << std::endl;
+  int errors = 0;
+
+  cv::Mat encoders = drive.retrieveEncoders();
+
+  CEDAR_UNIT_TEST_CONDITION(errors, robot.getNumberOfCommandsReceived("Q") == 1);
+  CEDAR_UNIT_TEST_CONDITION(errors, encoders.rows == 2 && encoders.cols == 1);
+  CEDAR_UNIT_TEST_CONDITION(errors, encoders.at<float>(0, 0) == 100.0f);
+  CEDAR_UNIT_TEST_CONDITION(errors, encoders.at<float>(1, 0) == 200.0f);
+
+  return errors;
+}
+
+int testCommunication(TestDrive& drive, cedar::test::dev::FakeSerialRobot& robot)
+{
+  std::cout << "Testing movement commands while communicating." << std::endl;
+  int errors = 0;
+
+  unsigned int encoder_requests = robot.getNumberOfCommandsReceived("Q");
+
+  std::vector<cedar::unit::Velocity> speeds(2, 0.01 * cedar::unit::DEFAULT_VELOCITY_UNIT);
+  drive.startCommunication();
+  drive.setWheelSpeed(speeds);
+  cedar::aux::sleep(0.5 * cedar::unit::seconds);
+  drive.stopCommunication();
+
+  // the encoders are measured now, and requested in the same write as the speed command
+  CEDAR_UNIT_TEST_CONDITION(errors, robot.getNumberOfCommandsReceived("Q") > encoder_requests);
+  CEDAR_UNIT_TEST_CONDITION(errors, robot.getLargestBatch() >= 2);
+
+  return errors;
+}
+
+int main(int, char**)
+{
+  int errors = 0;
+
+  cedar::test::dev::FakeSerialRobot robot;
+  if (!robot.isValid())
+  {
+    std::cout << "Could not create a pseudo terminal, skipping the test." << std::endl;
+    return 0;
+  }
+  robot.setAnswer("Q", "q,100,200");
+  robot.start();
+
+  cedar::dev::kteam::SerialChannelPtr channel(new cedar::dev::kteam::SerialChannel());
+  boost::dynamic_pointer_cast<cedar::aux::StringParameter>(channel->getParameter("device path"))
+    ->setValue(robot.getSlavePath());
+  channel->open();
+
+  if (!channel->isOpen())
+  {
+    ++errors;
+    std::cout << "ERROR: could not open " << robot.getSlavePath() << "." << std::endl;
+  }
+  else
+  {
+    TestDrive drive(channel);
+    errors += testMovementWithoutMeasurement(drive, robot);
+    errors += testRetrieveEncoders(drive, robot);
+    errors += testCommunication(drive, robot);
+  }
+
+  channel->close();
+  robot.stop();
+
+  std::cout << "Test finished with " << errors << " error(s)." << std::endl;
+  return errors;
+}
+
+#else // CEDAR_OS_WINDOWS
+
+int main(int, char**)
+{
+  std::cout << "Pseudo terminals are not available on this platform, skipping the test." << std::endl;
+  return 0;
+}
+
+#endif // CEDAR_OS_WINDOWS
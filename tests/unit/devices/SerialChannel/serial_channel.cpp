@@ -0,0 +1,202 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        serial_channel.cpp
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 18
+
+    Description: Tests the command pipeline of cedar::dev::SerialChannel against a pseudo terminal.
+
+    Credits:
+
+======================================================================================================================*/
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CEDAR INCLUDES
+#include "cedar/testingUtilities/devices/FakeSerialRobot.h"
+#include "cedar/devices/SerialChannel.h"
+#include "cedar/auxiliaries/StringParameter.h"
+#include "cedar/auxiliaries/stringFunctions.h"
+
+// SYSTEM INCLUDES
+#include <atomic>
+#include <cctype>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifndef CEDAR_OS_WINDOWS
+
+int testBatch(cedar::dev::SerialChannelPtr channel, cedar::test::dev::FakeSerialRobot& robot)
+{
+  std::cout << "Testing batched commands." << std::endl;
+  int errors = 0;
+
+  std::vector<std::string> commands;
+  commands.push_back("D,10,10");
+  commands.push_back("Q");
+  commands.push_back("N");
+  commands.push_back("L,0,1");
+
+  std::vector<std::string> answers = channel->writeAndReadBatch(commands);
+  for (size_t i = 0; i < commands.size(); ++i)
+  {
+    std::string expected = commands.at(i);
+    expected[0] = static_cast<char>(std::tolower(expected[0]));
+    if (answers.at(i) != expected)
+    {
+      ++errors;
+      std::cout << "ERROR: the answer to \"" << commands.at(i) << "\" was \"" << answers.at(i) << "\"." << std::endl;
+    }
+  }
+
+  if (robot.getLargestBatch() < commands.size())
+  {
+    ++errors;
+    std::cout << "ERROR: the commands were not sent in a single write; the largest batch held "
+              << robot.getLargestBatch() << " commands." << std::endl;
+  }
+
+  return errors;
+}
+
+int testConcurrentCommands(cedar::dev::SerialChannelPtr channel)
+{
+  std::cout << "Testing commands from several threads." << std::endl;
+  const unsigned int threads = 4;
+  const unsigned int commands_per_thread = 50;
+  std::atomic<int> errors(0);
+
+  std::vector<std::thread> senders;
+  for (unsigned int t = 0; t < threads; ++t)
+  {
+    senders.push_back(std::thread([&, t]()
+    {
+      for (unsigned int i = 0; i < commands_per_thread; ++i)
+      {
+        std::string command = "T," + cedar::aux::toString(t) + "," + cedar::aux::toString(i);
+        std::string expected = "t," + cedar::aux::toString(t) + "," + cedar::aux::toString(i);
+        try
+        {
+          std::string answer = channel->writeAndReadLocked(command);
+          if (answer != expected)
+          {
+            ++errors;
+            std::cout << "ERROR: the answer to \"" << command << "\" was \"" << answer << "\"." << std::endl;
+          }
+        }
+        catch (const cedar::aux::ExceptionBase& e)
+        {
+          ++errors;
+          std::cout << "ERROR: exception for command \"" << command << "\": " << e.exceptionInfo() << std::endl;
+        }
+      }
+    }));
+  }
+
+  for (auto& sender : senders)
+  {
+    sender.join();
+  }
+
+  return errors;
+}
+
+int testQueuedCommands(cedar::dev::SerialChannelPtr channel)
+{
+  std::cout << "Testing queued commands." << std::endl;
+  int errors = 0;
+
+  // more commands than may be in flight at once
+  std::vector<cedar::dev::SerialChannel::PendingCommandPtr> pending;
+  for (unsigned int i = 0; i < 3 * channel->getMaximumNumberOfCommandsInFlight(); ++i)
+  {
+    pending.push_back(channel->queueCommand("Q," + cedar::aux::toString(i)));
+  }
+
+  // waiting for the last one reads all the others, too
+  for (auto iter = pending.rbegin(); iter != pending.rend(); ++iter)
+  {
+    std::string command = (*iter)->getCommand();
+    std::string answer = channel->waitForAnswer(*iter);
+    if (answer != "q" + command.substr(1))
+    {
+      ++errors;
+      std::cout << "ERROR: the answer to \"" << command << "\" was \"" << answer << "\"." << std::endl;
+    }
+  }
+
+  return errors;
+}
+
+int main(int, char**)
+{
+  int errors = 0;
+
+  cedar::test::dev::FakeSerialRobot robot;
+  if (!robot.isValid())
+  {
+    std::cout << "Could not create a pseudo terminal, skipping the test." << std::endl;
+    return 0;
+  }
+  robot.start();
+
+  cedar::dev::SerialChannelPtr channel(new cedar::dev::SerialChannel());
+  boost::dynamic_pointer_cast<cedar::aux::StringParameter>(channel->getParameter("device path"))
+    ->setValue(robot.getSlavePath());
+  channel->open();
+
+  if (!channel->isOpen())
+  {
+    ++errors;
+    std::cout << "ERROR: could not open " << robot.getSlavePath() << "." << std::endl;
+  }
+  else
+  {
+    errors += testBatch(channel, robot);
+    errors += testConcurrentCommands(channel);
+    errors += testQueuedCommands(channel);
+  }
+
+  channel->close();
+  robot.stop();
+
+  std::cout << "Test finished with " << errors << " error(s)." << std::endl;
+  return errors;
+}
+
+#else // CEDAR_OS_WINDOWS
+
+int main(int, char**)
+{
+  std::cout << "Pseudo terminals are not available on this platform, skipping the test." << std::endl;
+  return 0;
+}
+
+#endif // CEDAR_OS_WINDOWS
@@ -0,0 +1,201 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        main.cpp
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 18
+
+    Description: Unit test for decoding ahead and replaying videos as fast as possible in the VideoGrabber.
+
+    Credits:
+
+======================================================================================================================*/
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CEDAR INCLUDES
+#include "cedar/devices/sensors/visual/VideoGrabber.h"
+
+// SYSTEM INCLUDES
+#include <QCoreApplication>
+#include <opencv2/opencv.hpp>
+#include <iostream>
+#include <string>
+#include <cmath>
+#include <chrono>
+
+namespace
+{
+  const unsigned int FRAME_COUNT = 20;
+
+  // every frame is filled with a value that identifies its number; channel 1 is offset to tell the channels apart
+  double frameValue(unsigned int channel, unsigned int frame)
+  {
+    return 10.0 * frame + 5.0 * channel;
+  }
+
+  bool writeVideo(const std::string& fileName, unsigned int channel)
+  {
+#if CEDAR_OPENCV_MAJOR_VERSION >= 3
+    int fourcc = cv::VideoWriter::fourcc('M', 'J', 'P', 'G');
+#else
+    int fourcc = static_cast<int>(CV_FOURCC('M', 'J', 'P', 'G'));
+#endif
+    cv::VideoWriter writer(fileName, fourcc, 25.0, cv::Size(32, 32));
+    if (!writer.isOpened())
+    {
+      return false;
+    }
+    for (unsigned int frame = 0; frame < FRAME_COUNT; ++frame)
+    {
+      writer << cv::Mat(32, 32, CV_8UC3, cv::Scalar::all(frameValue(channel, frame)));
+    }
+    return true;
+  }
+
+  // checks that both channels show the given frame
+  int checkFrame(cedar::dev::sensors::visual::VideoGrabberPtr grabber, unsigned int frame, const std::string& what)
+  {
+    int errors = 0;
+    for (unsigned int channel = 0; channel < 2; ++channel)
+    {
+      cv::Mat image = grabber->getImage(channel);
+      // the codec is lossy, so the values are compared with some tolerance
+      if (image.empty() || std::abs(cv::mean(image)[0] - frameValue(channel, frame)) > 3.0)
+      {
+        std::cout << "ERROR: " << what << ": channel " << channel << " doesn't show frame " << frame << "."
+                  << std::endl;
+        ++errors;
+      }
+    }
+    return errors;
+  }
+}
+
+int main(int argc, char** argv)
+{
+  // the decoders run in cedar threads, which need an application object
+  QCoreApplication app(argc, argv);
+
+  // the number of errors encountered in this test
+  int errors = 0;
+
+  const std::string file_name_0 = "prefetch_channel0.avi";
+  const std::string file_name_1 = "prefetch_channel1.avi";
+  if (!writeVideo(file_name_0, 0) || !writeVideo(file_name_1, 1))
+  {
+    std::cout << "Could not write the test videos; skipping test." << std::endl;
+    std::cout << "Test finished with " << errors << " error(s)." << std::endl;
+    return errors;
+  }
+
+  cedar::dev::sensors::visual::VideoGrabberPtr grabber
+  (
+    new cedar::dev::sensors::visual::VideoGrabber(file_name_0, file_name_1, false)
+  );
+  grabber->setPrefetchFrames(4);
+  grabber->setReplayAsFastAsPossible(true);
+
+  std::cout << "Creating the grabber." << std::endl;
+  if (!grabber->applyParameter())
+  {
+    std::cout << "ERROR: could not open the test videos." << std::endl;
+    ++errors;
+    std::cout << "Test finished with " << errors << " error(s)." << std::endl;
+    return errors;
+  }
+  errors += checkFrame(grabber, 0, "after creation");
+
+  if (grabber->getFramerate() <= 1000.0)
+  {
+    std::cout << "ERROR: replaying as fast as possible didn't set a step size of zero." << std::endl;
+    ++errors;
+  }
+
+  std::cout << "Replaying every frame in order." << std::endl;
+  for (unsigned int frame = 1; frame < FRAME_COUNT; ++frame)
+  {
+    grabber->grab();
+    errors += checkFrame(grabber, frame, "replay");
+  }
+
+  std::cout << "Grabbing past the end of a file that isn't looped." << std::endl;
+  grabber->grab();
+  errors += checkFrame(grabber, FRAME_COUNT - 1, "end of file");
+  if (grabber->getPositionAbsolute() != FRAME_COUNT)
+  {
+    std::cout << "ERROR: position is " << grabber->getPositionAbsolute() << " at the end of the file." << std::endl;
+    ++errors;
+  }
+
+  // at the end of a file that isn't looped, replaying as fast as possible must pause instead of spinning
+  auto before_grab = std::chrono::steady_clock::now();
+  grabber->grab();
+  if (std::chrono::steady_clock::now() - before_grab < std::chrono::milliseconds(50))
+  {
+    std::cout << "ERROR: grabbing at the end of the file didn't pause." << std::endl;
+    ++errors;
+  }
+  errors += checkFrame(grabber, FRAME_COUNT - 1, "end of file");
+
+  std::cout << "Seeking while decoding ahead." << std::endl;
+  grabber->setPositionAbsolute(5);
+  grabber->grab();
+  errors += checkFrame(grabber, 5, "seek");
+  if (grabber->getPositionAbsolute() != 6)
+  {
+    std::cout << "ERROR: position is " << grabber->getPositionAbsolute() << " after seeking to 5." << std::endl;
+    ++errors;
+  }
+
+  std::cout << "Looping while decoding ahead." << std::endl;
+  grabber->setLooped(true);
+  grabber->setPositionAbsolute(FRAME_COUNT - 2);
+  grabber->grab();
+  errors += checkFrame(grabber, FRAME_COUNT - 2, "loop");
+  grabber->grab();
+  errors += checkFrame(grabber, FRAME_COUNT - 1, "loop");
+  grabber->grab();
+  errors += checkFrame(grabber, 0, "loop");
+
+  std::cout << "Switching back to decoding in the grabbing thread." << std::endl;
+  grabber->setPrefetchFrames(0);
+  grabber->grab();
+  errors += checkFrame(grabber, 1, "no prefetching");
+  grabber->grab();
+  errors += checkFrame(grabber, 2, "no prefetching");
+
+  if (grabber->getLateFrames() != 0)
+  {
+    std::cout << "ERROR: replaying as fast as possible found " << grabber->getLateFrames() << " late frames."
+              << std::endl;
+    ++errors;
+  }
+
+  std::cout << "Test finished with " << errors << " error(s)." << std::endl;
+  return errors;
+}
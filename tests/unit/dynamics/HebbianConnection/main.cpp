@@ -0,0 +1,166 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        main.cpp
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 18
+
+    Description: Tests the learning rule of cedar::dyn::steps::HebbianConnection.
+
+    Credits:
+
+======================================================================================================================*/
+
+
+// CEDAR INCLUDES
+#include "cedar/dynamics/steps/HebbianConnection.h"
+#include "cedar/processing/StepTime.h"
+#include "cedar/auxiliaries/BoolParameter.h"
+#include "cedar/auxiliaries/DoubleParameter.h"
+#include "cedar/auxiliaries/MatData.h"
+#include "cedar/auxiliaries/casts.h"
+#include "cedar/units/Time.h"
+#include "cedar/units/prefixes.h"
+
+// SYSTEM INCLUDES
+#include <iostream>
+
+//! Number of learning steps in each test.
+const unsigned int LEARNING_STEPS = 200;
+
+/* Creates a connection with three-dimensional weights along with an association input that is one in the lower half
+ * of the first dimension and zero elsewhere.
+ */
+cedar::dyn::steps::HebbianConnectionPtr createConnection(cedar::aux::MatDataPtr association)
+{
+  cedar::dyn::steps::HebbianConnectionPtr connection(new cedar::dyn::steps::HebbianConnection());
+  connection->setDimensionality(3);
+  connection->setSize(0, 4);
+  connection->setSize(1, 5);
+  connection->setSize(2, 6);
+  cedar::aux::asserted_pointer_cast<cedar::aux::DoubleParameter>
+  (
+    connection->getParameter("learning rate")
+  )->setValue(0.1);
+
+  int sizes[] = {4, 5, 6};
+  association->setData(cv::Mat(3, sizes, CV_32F, cv::Scalar(0)));
+  cv::Range ranges[] = {cv::Range(0, 2), cv::Range::all(), cv::Range::all()};
+  association->getData()(ranges) = cv::Scalar(1);
+  connection->setInput(connection->getAssoInputName(), association);
+  return connection;
+}
+
+//! Triggers the connection repeatedly while reward and source node have the given value.
+void learn(cedar::dyn::steps::HebbianConnectionPtr connection, float node)
+{
+  cedar::aux::MatDataPtr signal(new cedar::aux::MatData(cv::Mat(1, 1, CV_32F, cv::Scalar(node))));
+  connection->setInput(connection->getRewardInputName(), signal);
+  connection->setInput(connection->getReadOutInputName(), signal);
+
+  cedar::proc::ArgumentsPtr step_time
+  (
+    new cedar::proc::StepTime(cedar::unit::Time(1.0 * cedar::unit::milli * cedar::unit::seconds))
+  );
+  for (unsigned int i = 0; i < LEARNING_STEPS; ++i)
+  {
+    connection->onTrigger(step_time);
+  }
+}
+
+const cv::Mat& getWeights(cedar::dyn::steps::HebbianConnectionPtr connection)
+{
+  return connection->getBuffer(connection->getOutputName())->getData<cv::Mat>();
+}
+
+int main(int, char**)
+{
+  int errors = 0;
+
+  {
+    std::cout << "Testing that three-dimensional weights converge to the association input." << std::endl;
+    cedar::aux::MatDataPtr association(new cedar::aux::MatData());
+    cedar::dyn::steps::HebbianConnectionPtr connection = createConnection(association);
+    learn(connection, 1.0f);
+
+    const cv::Mat& weights = getWeights(connection);
+    if (weights.dims != 3 || cv::norm(weights, association->getData(), cv::NORM_INF) > 1e-3)
+    {
+      ++errors;
+      std::cout << "ERROR: the weights did not converge to the association input." << std::endl;
+    }
+
+    const cv::Mat& output = connection->getOutput(connection->getTriggerOutputName())->getData<cv::Mat>();
+    if (cv::norm(output, weights, cv::NORM_INF) != 0.0)
+    {
+      ++errors;
+      std::cout << "ERROR: the learned output does not show the weights while the source node is active." << std::endl;
+    }
+  }
+
+  {
+    std::cout << "Testing that sparse updates only change weights at active locations." << std::endl;
+    cedar::aux::MatDataPtr association(new cedar::aux::MatData());
+    cedar::dyn::steps::HebbianConnectionPtr connection = createConnection(association);
+    cedar::aux::asserted_pointer_cast<cedar::aux::BoolParameter>
+    (
+      connection->getParameter("sparse update")
+    )->setValue(true);
+    cv::Mat initial_weights = getWeights(connection).clone();
+    learn(connection, 1.0f);
+
+    const cv::Mat& weights = getWeights(connection);
+    cv::Range active[] = {cv::Range(0, 2), cv::Range::all(), cv::Range::all()};
+    cv::Range inactive[] = {cv::Range(2, 4), cv::Range::all(), cv::Range::all()};
+    if (cv::norm(weights(active), association->getData()(active), cv::NORM_INF) > 1e-3)
+    {
+      ++errors;
+      std::cout << "ERROR: the weights at active locations did not converge." << std::endl;
+    }
+    if (cv::norm(weights(inactive), initial_weights(inactive), cv::NORM_INF) != 0.0)
+    {
+      ++errors;
+      std::cout << "ERROR: the weights at inactive locations were changed." << std::endl;
+    }
+  }
+
+  {
+    std::cout << "Testing that the learned output is zero while the source node is inactive." << std::endl;
+    cedar::aux::MatDataPtr association(new cedar::aux::MatData());
+    cedar::dyn::steps::HebbianConnectionPtr connection = createConnection(association);
+    learn(connection, 0.0f);
+
+    const cv::Mat& output = connection->getOutput(connection->getTriggerOutputName())->getData<cv::Mat>();
+    if (output.dims != 3 || cv::norm(output, cv::NORM_INF) != 0.0)
+    {
+      ++errors;
+      std::cout << "ERROR: the learned output is not zero." << std::endl;
+    }
+  }
+
+  std::cout << "Test finished with " << errors << " error(s)." << std::endl;
+  return errors;
+}
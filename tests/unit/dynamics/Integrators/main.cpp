@@ -0,0 +1,173 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        main.cpp
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 18
+
+    Description: Tests the integrators of cedar::dyn::Dynamics.
+
+    Credits:
+
+======================================================================================================================*/
+
+
+// CEDAR INCLUDES
+#include "cedar/dynamics/fields/NeuralField.h"
+#include "cedar/dynamics/integrator/AdaptiveHeun.h"
+#include "cedar/dynamics/integrator/Euler.h"
+#include "cedar/dynamics/integrator/ExponentialEuler.h"
+#include "cedar/dynamics/integrator/Heun.h"
+#include "cedar/dynamics/integrator/RungeKutta4.h"
+#include "cedar/processing/StepTime.h"
+#include "cedar/auxiliaries/BoolParameter.h"
+#include "cedar/auxiliaries/DoubleParameter.h"
+#include "cedar/auxiliaries/ObjectListParameter.h"
+#include "cedar/auxiliaries/MatData.h"
+#include "cedar/auxiliaries/casts.h"
+#include "cedar/units/Time.h"
+#include "cedar/units/prefixes.h"
+
+// SYSTEM INCLUDES
+#include <iostream>
+#include <string>
+#include <cmath>
+
+//! Simulated time for each run, in seconds.
+const double SIMULATED_TIME = 0.5;
+
+cedar::aux::DoubleParameterPtr getDoubleParameter(cedar::dyn::NeuralFieldPtr field, const std::string& name)
+{
+  return cedar::aux::asserted_pointer_cast<cedar::aux::DoubleParameter>(field->getParameter(name));
+}
+
+/* Creates a one-dimensional field without lateral interaction, global inhibition or noise. Starting at zero, its
+ * activation relaxes to the resting level h with time scale tau, i.e., u(t) = h * (1 - exp(-t/tau)).
+ */
+cedar::dyn::NeuralFieldPtr createRelaxingField()
+{
+  cedar::dyn::NeuralFieldPtr field(new cedar::dyn::NeuralField());
+  field->setDimensionality(1);
+  field->setSize(0, 10);
+  cedar::aux::asserted_pointer_cast<cedar::aux::BoolParameter>
+  (
+    field->getParameter("update stepIcon according to output")
+  )->setValue(false);
+  cedar::aux::asserted_pointer_cast<cedar::aux::ObjectListParameter>(field->getParameter("lateral kernels"))->clear();
+  getDoubleParameter(field, "global inhibition")->setValue(0.0);
+  getDoubleParameter(field, "input noise gain")->setValue(0.0);
+
+  cv::Mat& activation
+    = cedar::aux::asserted_pointer_cast<cedar::aux::MatData>(field->getBufferSlot("activation")->getData())->getData();
+  activation = cv::Scalar(0);
+  return field;
+}
+
+//! Integrates the relaxing field with the given integrator and returns the maximal deviation from the exact solution.
+double simulate(cedar::dyn::integrator::IntegratorPtr integrator, double stepSize)
+{
+  cedar::dyn::NeuralFieldPtr field = createRelaxingField();
+  field->setIntegrator(integrator);
+
+  cedar::proc::ArgumentsPtr arguments
+  (
+    new cedar::proc::StepTime(cedar::unit::Time(stepSize * cedar::unit::seconds))
+  );
+  unsigned int steps = static_cast<unsigned int>(SIMULATED_TIME / stepSize + 0.5);
+  for (unsigned int i = 0; i < steps; ++i)
+  {
+    field->onTrigger(arguments);
+  }
+
+  double h = getDoubleParameter(field, "resting level")->getValue();
+  double tau = 0.001 * getDoubleParameter(field, "time scale")->getValue();
+  double expected = h * (1.0 - std::exp(-SIMULATED_TIME / tau));
+
+  double minimum, maximum;
+  cv::minMaxLoc(field->getBuffer("activation")->getData<cv::Mat>(), &minimum, &maximum);
+  return std::max(std::abs(minimum - expected), std::abs(maximum - expected));
+}
+
+int main(int, char**)
+{
+  int errors = 0;
+  const double coarse = 0.01;
+  const double fine = 0.005;
+
+  std::cout << "Testing that Euler is the default integrator." << std::endl;
+  if (!boost::dynamic_pointer_cast<cedar::dyn::integrator::Euler>(createRelaxingField()->getIntegrator()))
+  {
+    ++errors;
+    std::cout << "ERROR: the default integrator is not Euler." << std::endl;
+  }
+
+  double euler_error = simulate(cedar::dyn::integrator::IntegratorPtr(new cedar::dyn::integrator::Euler()), coarse);
+  double exponential_error
+    = simulate(cedar::dyn::integrator::IntegratorPtr(new cedar::dyn::integrator::ExponentialEuler()), coarse);
+  double heun_error = simulate(cedar::dyn::integrator::IntegratorPtr(new cedar::dyn::integrator::Heun()), coarse);
+  double heun_fine_error = simulate(cedar::dyn::integrator::IntegratorPtr(new cedar::dyn::integrator::Heun()), fine);
+  double rk4_error
+    = simulate(cedar::dyn::integrator::IntegratorPtr(new cedar::dyn::integrator::RungeKutta4()), coarse);
+  cedar::dyn::integrator::AdaptiveHeunPtr adaptive(new cedar::dyn::integrator::AdaptiveHeun());
+  double adaptive_error = simulate(adaptive, coarse);
+
+  std::cout << "Errors: Euler " << euler_error << ", exponential Euler " << exponential_error
+            << ", Heun " << heun_error << " (" << heun_fine_error << " at half the step size)"
+            << ", Runge-Kutta " << rk4_error << ", adaptive Heun " << adaptive_error << std::endl;
+
+  std::cout << "Testing that exponential Euler is exact for linear relaxation." << std::endl;
+  if (exponential_error > 1e-4)
+  {
+    ++errors;
+    std::cout << "ERROR: exponential Euler deviates by " << exponential_error << "." << std::endl;
+  }
+
+  std::cout << "Testing that higher-order integrators are more accurate." << std::endl;
+  if (!(rk4_error < heun_error && heun_error < euler_error))
+  {
+    ++errors;
+    std::cout << "ERROR: errors are not ordered by the order of the integrators." << std::endl;
+  }
+
+  std::cout << "Testing that Heun's method converges with second order." << std::endl;
+  if (heun_fine_error > 0.35 * heun_error)
+  {
+    ++errors;
+    std::cout << "ERROR: halving the step size only reduced the error by a factor of "
+              << heun_error / heun_fine_error << "." << std::endl;
+  }
+
+  std::cout << "Testing that the adaptive integrator refines the step." << std::endl;
+  if (adaptive->getNumberOfSubsteps() < 2 || adaptive_error > 1e-3)
+  {
+    ++errors;
+    std::cout << "ERROR: adaptive Heun took " << adaptive->getNumberOfSubsteps() << " substep(s) and deviates by "
+              << adaptive_error << "." << std::endl;
+  }
+
+  std::cout << "Test finished with " << errors << " error(s)." << std::endl;
+  return errors;
+}
@@ -0,0 +1,309 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        main.cpp
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 18
+
+    Description: Tests that the built-in steps do not allocate memory in their compute calls once warmed up.
+
+    Credits:
+
+======================================================================================================================*/
+
+// CEDAR INCLUDES
+#include "cedar/processing/steps/AbsoluteValue.h"
+#include "cedar/processing/steps/ComponentMultiply.h"
+#include "cedar/processing/steps/Convolution.h"
+#include "cedar/processing/steps/Delay.h"
+#include "cedar/processing/steps/ExponentialSmoothing.h"
+#include "cedar/processing/steps/Mask.h"
+#include "cedar/processing/steps/MatrixSlice.h"
+#include "cedar/processing/steps/Maximum.h"
+#include "cedar/processing/steps/Minimum.h"
+#include "cedar/processing/steps/NumericalIntegration.h"
+#include "cedar/processing/steps/ScalarDivision.h"
+#include "cedar/processing/steps/StaticGain.h"
+#include "cedar/processing/steps/Sum.h"
+#include "cedar/processing/steps/TransferFunction.h"
+#include "cedar/processing/steps/Transpose.h"
+#include "cedar/processing/steps/VariableGauss.h"
+#include "cedar/processing/StepTime.h"
+#include "cedar/dynamics/fields/NeuralField.h"
+#include "cedar/dynamics/fields/Preshape.h"
+#include "cedar/dynamics/steps/HarmonicOscillator.h"
+#include "cedar/dynamics/steps/HebbianConnection.h"
+#include "cedar/dynamics/steps/RateToSpaceCode.h"
+#include "cedar/dynamics/steps/SerialOrder.h"
+#include "cedar/dynamics/steps/SpaceCodeToRateMatrix.h"
+#include "cedar/dynamics/steps/SpaceToRateCode.h"
+#include "cedar/dynamics/steps/TwoStepInput.h"
+#include "cedar/auxiliaries/kernel/Gauss.h"
+#include "cedar/auxiliaries/AllocationCounter.h"
+#include "cedar/auxiliaries/BoolParameter.h"
+#include "cedar/auxiliaries/ObjectListParameter.h"
+#include "cedar/auxiliaries/MatData.h"
+#include "cedar/auxiliaries/casts.h"
+
+// SYSTEM INCLUDES
+#include <iostream>
+#include <vector>
+
+//! Number of compute calls a step may use to set up its buffers.
+const unsigned int WARM_UP_ITERATIONS = 10;
+
+//! Number of compute calls during which a step must not allocate.
+const unsigned int MEASURED_ITERATIONS = 100;
+
+//! Returns the number of allocations OpenCV itself makes when filtering into an already allocated matrix.
+unsigned long filterAllocations(const cv::Mat& matrix, const cedar::aux::kernel::Separable& kernel)
+{
+  cv::Mat filtered = cv::Mat::zeros(matrix.rows, matrix.cols, CV_32F);
+  const cv::Mat& kernel_x = kernel.getKernelPart(1);
+  const cv::Mat& kernel_y = kernel.getKernelPart(0);
+  // the first call may set up OpenCV's internal state
+  cv::sepFilter2D(matrix, filtered, -1, kernel_x, kernel_y, cv::Point(-1, -1), 0, cv::BORDER_CONSTANT);
+
+  cedar::aux::AllocationCounter counter;
+  cv::sepFilter2D(matrix, filtered, -1, kernel_x, kernel_y, cv::Point(-1, -1), 0, cv::BORDER_CONSTANT);
+  return counter.getCount();
+}
+
+int checkSteadyState
+    (
+      const std::string& name,
+      cedar::proc::StepPtr step,
+      const std::vector<cedar::aux::MatDataPtr>& inputs,
+      cedar::proc::ArgumentsPtr arguments = cedar::proc::ArgumentsPtr(),
+      unsigned long allowedAllocations = 0
+    )
+{
+  std::cout << "Testing that " << name << " does not allocate in steady state." << std::endl;
+  int errors = 0;
+  for (unsigned int i = 0; i < WARM_UP_ITERATIONS + MEASURED_ITERATIONS; ++i)
+  {
+    // mark the inputs as changed so that pure steps don't skip their compute calls
+    for (auto input : inputs)
+    {
+      input->markChanged();
+    }
+    step->onTrigger(arguments);
+
+    if (i >= WARM_UP_ITERATIONS && step->getLastComputeAllocations() > allowedAllocations)
+    {
+      ++errors;
+      std::cout << "ERROR: " << name << " made " << step->getLastComputeAllocations()
+                << " allocation(s) in compute call " << i << "." << std::endl;
+    }
+  }
+  return errors;
+}
+
+int main(int, char**)
+{
+  if (!cedar::aux::AllocationCounter::isEnabled())
+  {
+    std::cout << "Allocation counting is disabled (see CEDAR_COUNT_ALLOCATIONS); skipping test." << std::endl;
+    return 0;
+  }
+
+  int errors = 0;
+
+  cedar::aux::MatDataPtr matrix(new cedar::aux::MatData(cv::Mat::ones(50, 50, CV_32F)));
+  cedar::aux::MatDataPtr scalar(new cedar::aux::MatData(cv::Mat::ones(1, 1, CV_32F) * 2.0));
+  std::vector<cedar::aux::MatDataPtr> matrix_only(1, matrix);
+  std::vector<cedar::aux::MatDataPtr> scalar_only(1, scalar);
+  std::vector<cedar::aux::MatDataPtr> no_inputs;
+  cedar::proc::ArgumentsPtr step_time
+  (
+    new cedar::proc::StepTime(cedar::unit::Time(1.0 * cedar::unit::milli * cedar::unit::seconds))
+  );
+
+  // cv::filter2D and cv::sepFilter2D always allocate some internal bookkeeping; steps that convolve may make as many
+  // allocations as filtering with the (default) Gauss kernel takes
+  unsigned long filter_allocations = filterAllocations(matrix->getData(), cedar::aux::kernel::Gauss(2));
+  std::cout << "Filtering with OpenCV takes " << filter_allocations << " allocation(s)." << std::endl;
+
+  {
+    cedar::proc::steps::StaticGainPtr step(new cedar::proc::steps::StaticGain());
+    step->setInput("input", matrix);
+    errors += checkSteadyState("StaticGain", step, matrix_only);
+  }
+  {
+    cedar::proc::steps::AbsoluteValuePtr step(new cedar::proc::steps::AbsoluteValue());
+    step->setInput("input", matrix);
+    errors += checkSteadyState("AbsoluteValue", step, matrix_only);
+  }
+  {
+    cedar::proc::steps::ScalarDivisionPtr step(new cedar::proc::steps::ScalarDivision());
+    step->setInput("matrix", matrix);
+    step->setInput("divisor", scalar);
+    std::vector<cedar::aux::MatDataPtr> inputs;
+    inputs.push_back(matrix);
+    inputs.push_back(scalar);
+    errors += checkSteadyState("ScalarDivision", step, inputs);
+  }
+  {
+    cedar::proc::steps::TransposePtr step(new cedar::proc::steps::Transpose());
+    step->setInput("matrix", matrix);
+    errors += checkSteadyState("Transpose", step, matrix_only);
+  }
+  {
+    cedar::proc::steps::SumPtr step(new cedar::proc::steps::Sum());
+    step->setInput("terms", matrix);
+    errors += checkSteadyState("Sum", step, matrix_only);
+  }
+  {
+    cedar::proc::steps::MaximumPtr step(new cedar::proc::steps::Maximum());
+    step->setInput("terms", matrix);
+    errors += checkSteadyState("Maximum", step, matrix_only);
+  }
+  {
+    cedar::proc::steps::MinimumPtr step(new cedar::proc::steps::Minimum());
+    step->setInput("terms", matrix);
+    errors += checkSteadyState("Minimum", step, matrix_only);
+  }
+  {
+    cedar::proc::steps::ComponentMultiplyPtr step(new cedar::proc::steps::ComponentMultiply());
+    step->setInput("operands", matrix);
+    errors += checkSteadyState("ComponentMultiply", step, matrix_only);
+  }
+  {
+    cedar::proc::steps::DelayPtr step(new cedar::proc::steps::Delay());
+    step->setInput("input", matrix);
+    errors += checkSteadyState("Delay", step, matrix_only);
+  }
+  {
+    cedar::proc::steps::TransferFunctionPtr step(new cedar::proc::steps::TransferFunction());
+    step->setInput("input", matrix);
+    errors += checkSteadyState("TransferFunction", step, matrix_only);
+  }
+  {
+    cedar::proc::steps::ExponentialSmoothingPtr step(new cedar::proc::steps::ExponentialSmoothing());
+    step->setInput("input", matrix);
+    errors += checkSteadyState("ExponentialSmoothing", step, matrix_only);
+  }
+  {
+    cedar::proc::steps::NumericalIntegrationPtr step(new cedar::proc::steps::NumericalIntegration());
+    step->setInput("input", matrix);
+    errors += checkSteadyState("NumericalIntegration", step, matrix_only);
+  }
+  {
+    cedar::dyn::PreshapePtr step(new cedar::dyn::Preshape());
+    step->setInput("input", matrix);
+    errors += checkSteadyState("Preshape", step, matrix_only, step_time);
+  }
+  {
+    cedar::dyn::NeuralFieldPtr step(new cedar::dyn::NeuralField());
+    // updating the step icon is not part of the allocation-free path
+    cedar::aux::asserted_pointer_cast<cedar::aux::BoolParameter>
+    (
+      step->getParameter("update stepIcon according to output")
+    )->setValue(false);
+    step->setInput("input", matrix);
+    errors += checkSteadyState("NeuralField", step, matrix_only, step_time, filter_allocations);
+  }
+  {
+    cedar::proc::steps::ConvolutionPtr step(new cedar::proc::steps::Convolution());
+    cedar::aux::asserted_pointer_cast<cedar::aux::ObjectListParameter>
+    (
+      step->getParameter("kernels")
+    )->pushBack("cedar.aux.kernel.Gauss");
+    step->setInput("matrix", matrix);
+    errors += checkSteadyState("Convolution", step, matrix_only, cedar::proc::ArgumentsPtr(), filter_allocations);
+  }
+  {
+    cedar::aux::MatDataPtr mask(new cedar::aux::MatData(cv::Mat::eye(50, 50, CV_8U)));
+    cedar::proc::steps::MaskPtr step(new cedar::proc::steps::Mask());
+    step->setInput("mask", mask);
+    step->setInput("input", matrix);
+    std::vector<cedar::aux::MatDataPtr> inputs;
+    inputs.push_back(matrix);
+    inputs.push_back(mask);
+    errors += checkSteadyState("Mask", step, inputs);
+  }
+  {
+    cedar::proc::steps::MatrixSlicePtr step(new cedar::proc::steps::MatrixSlice());
+    step->setInput("matrix", matrix);
+    errors += checkSteadyState("MatrixSlice", step, matrix_only);
+  }
+  {
+    cv::Mat center_values(2, 1, CV_32F);
+    center_values.at<float>(0, 0) = 10.0f;
+    center_values.at<float>(1, 0) = 20.0f;
+    cedar::aux::MatDataPtr centers(new cedar::aux::MatData(center_values));
+    cedar::proc::steps::VariableGaussPtr step(new cedar::proc::steps::VariableGauss());
+    step->setInput("centers", centers);
+    errors += checkSteadyState("VariableGauss", step, std::vector<cedar::aux::MatDataPtr>(1, centers));
+  }
+  {
+    cedar::dyn::SerialOrderPtr step(new cedar::dyn::SerialOrder());
+    errors += checkSteadyState("SerialOrder", step, no_inputs, step_time);
+  }
+  {
+    cedar::aux::MatDataPtr lambda(new cedar::aux::MatData(cv::Mat::ones(2, 1, CV_32F)));
+    boost::shared_ptr<cedar::dyn::steps::HarmonicOscillator> step(new cedar::dyn::steps::HarmonicOscillator());
+    step->setInput("lambda", lambda);
+    errors += checkSteadyState("HarmonicOscillator", step, std::vector<cedar::aux::MatDataPtr>(1, lambda), step_time);
+  }
+  {
+    cedar::dyn::steps::TwoStepInputPtr step(new cedar::dyn::steps::TwoStepInput());
+    errors += checkSteadyState("TwoStepInput", step, no_inputs, step_time);
+  }
+  {
+    cedar::dyn::RateToSpaceCodePtr step(new cedar::dyn::RateToSpaceCode());
+    step->setInput("input", scalar);
+    errors += checkSteadyState("RateToSpaceCode", step, scalar_only);
+  }
+  {
+    cedar::aux::MatDataPtr vector(new cedar::aux::MatData(cv::Mat::ones(50, 1, CV_32F)));
+    cedar::dyn::SpaceToRateCodePtr step(new cedar::dyn::SpaceToRateCode());
+    step->setInput("input", vector);
+    errors += checkSteadyState("SpaceToRateCode", step, std::vector<cedar::aux::MatDataPtr>(1, vector), step_time);
+  }
+  {
+    int sizes[] = {10, 10, 5};
+    cedar::aux::MatDataPtr space_code(new cedar::aux::MatData(cv::Mat(3, sizes, CV_32F, cv::Scalar(0.5))));
+    cedar::dyn::SpaceCodeToRateMatrixPtr step(new cedar::dyn::SpaceCodeToRateMatrix());
+    step->setInput("input", space_code);
+    std::vector<cedar::aux::MatDataPtr> inputs(1, space_code);
+    errors += checkSteadyState("SpaceCodeToRateMatrix", step, inputs);
+  }
+
+  {
+    cedar::dyn::steps::HebbianConnectionPtr step(new cedar::dyn::steps::HebbianConnection());
+    step->setInput(step->getAssoInputName(), matrix);
+    step->setInput(step->getRewardInputName(), scalar);
+    step->setInput(step->getReadOutInputName(), scalar);
+    std::vector<cedar::aux::MatDataPtr> inputs;
+    inputs.push_back(matrix);
+    inputs.push_back(scalar);
+    errors += checkSteadyState("HebbianConnection", step, inputs, step_time);
+  }
+
+  std::cout << "Test finished with " << errors << " error(s)." << std::endl;
+  return errors;
+}
@@ -0,0 +1,163 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        main.cpp
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 18
+
+    Description: Tests skipping the compute calls of pure steps whose inputs did not change.
+
+    Credits:
+
+======================================================================================================================*/
+
+// CEDAR INCLUDES
+#include "cedar/processing/steps/StaticGain.h"
+#include "cedar/processing/Step.h"
+#include "cedar/auxiliaries/DoubleParameter.h"
+#include "cedar/auxiliaries/MatData.h"
+#include "cedar/auxiliaries/exceptions.h"
+
+// SYSTEM INCLUDES
+#include <iostream>
+
+//! A pure step whose first compute call fails.
+class FailingStep : public cedar::proc::Step
+{
+public:
+  FailingStep()
+  :
+  mComputeCalls(0)
+  {
+    this->declareInput("input");
+    this->setPure(true);
+  }
+
+  void compute(const cedar::proc::Arguments&)
+  {
+    if (++mComputeCalls == 1)
+    {
+      CEDAR_THROW(cedar::aux::UnknownTypeException, "The first compute call fails.");
+    }
+  }
+
+  unsigned int mComputeCalls;
+};
+
+CEDAR_GENERATE_POINTER_TYPES(FailingStep);
+
+int checkOutput(cedar::proc::steps::StaticGainPtr gain, float expected)
+{
+  auto output = boost::dynamic_pointer_cast<cedar::aux::ConstMatData>(gain->getOutput("output"));
+  float value = output->getData().at<float>(0, 0);
+  if (value != expected)
+  {
+    std::cout << "ERROR: output is " << value << ", expected " << expected << "." << std::endl;
+    return 1;
+  }
+  return 0;
+}
+
+int checkSkipped(cedar::proc::steps::StaticGainPtr gain, unsigned long expected)
+{
+  if (gain->getNumberOfSkippedComputeCalls() != expected)
+  {
+    std::cout << "ERROR: " << gain->getNumberOfSkippedComputeCalls() << " compute calls were skipped, expected "
+              << expected << "." << std::endl;
+    return 1;
+  }
+  return 0;
+}
+
+int main(int, char**)
+{
+  int errors = 0;
+
+  cedar::aux::MatDataPtr input(new cedar::aux::MatData(cv::Mat::ones(3, 3, CV_32F)));
+  cedar::proc::steps::StaticGainPtr gain(new cedar::proc::steps::StaticGain());
+  auto gain_factor = boost::dynamic_pointer_cast<cedar::aux::DoubleParameter>(gain->getParameter("gain factor"));
+  gain_factor->setValue(2.0);
+  gain->setInput("input", input);
+
+  if (!gain->isPure())
+  {
+    ++errors;
+    std::cout << "ERROR: static gain is not pure." << std::endl;
+  }
+
+  std::cout << "Testing that unchanged inputs skip compute." << std::endl;
+  gain->onTrigger();
+  errors += checkOutput(gain, 2.0);
+  errors += checkSkipped(gain, 0);
+
+  unsigned long revision = gain->getOutput("output")->getRevision();
+  gain->onTrigger();
+  errors += checkOutput(gain, 2.0);
+  errors += checkSkipped(gain, 1);
+  if (gain->getOutput("output")->getRevision() != revision)
+  {
+    ++errors;
+    std::cout << "ERROR: the revision of the output changed even though compute was skipped." << std::endl;
+  }
+
+  std::cout << "Testing that changed inputs are recomputed." << std::endl;
+  input->setData(cv::Mat::ones(3, 3, CV_32F) * 3.0);
+  gain->onTrigger();
+  errors += checkOutput(gain, 6.0);
+  errors += checkSkipped(gain, 1);
+
+  std::cout << "Testing that parameter changes are recomputed." << std::endl;
+  // the step recomputes on its own when the gain changes
+  gain_factor->setValue(4.0);
+  errors += checkOutput(gain, 12.0);
+  errors += checkSkipped(gain, 1);
+
+  std::cout << "Testing that unchanged outputs let subsequent pure steps skip." << std::endl;
+  cedar::proc::steps::StaticGainPtr second_gain(new cedar::proc::steps::StaticGain());
+  second_gain->setInput("input", boost::const_pointer_cast<cedar::aux::Data>(gain->getOutput("output")));
+  second_gain->onTrigger();
+  errors += checkOutput(second_gain, 12.0);
+
+  gain->onTrigger();
+  second_gain->onTrigger();
+  errors += checkSkipped(gain, 2);
+  errors += checkSkipped(second_gain, 1);
+  errors += checkOutput(second_gain, 12.0);
+
+  std::cout << "Testing that a failed compute call is retried." << std::endl;
+  FailingStepPtr failing(new FailingStep());
+  failing->setInput("input", input);
+  failing->onTrigger();
+  failing->onTrigger();
+  if (failing->mComputeCalls != 2 || failing->getNumberOfSkippedComputeCalls() != 0)
+  {
+    ++errors;
+    std::cout << "ERROR: the failed compute call was skipped on the next trigger." << std::endl;
+  }
+
+  std::cout << "Test finished with " << errors << " error(s)." << std::endl;
+  return errors;
+}
@@ -0,0 +1,181 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        main.cpp
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 18
+
+    Description: Compares the results of the parallelized slice loops with their serial results.
+
+    Credits:
+
+======================================================================================================================*/
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CEDAR INCLUDES
+#include "cedar/processing/steps/CoordinateTransformation.h"
+#include "cedar/processing/steps/Resize.h"
+#include "cedar/auxiliaries/convolution/KernelList.h"
+#include "cedar/auxiliaries/convolution/OpenCV.h"
+#include "cedar/auxiliaries/kernel/Gauss.h"
+#include "cedar/auxiliaries/math/tools.h"
+#include "cedar/auxiliaries/parallelFunctions.h"
+#include "cedar/auxiliaries/stringFunctions.h"
+#include "cedar/auxiliaries/MatData.h"
+#include "cedar/auxiliaries/UIntParameter.h"
+
+// SYSTEM INCLUDES
+#include <opencv2/opencv.hpp>
+#include <boost/function.hpp>
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+//! Maximal difference between the serial and the parallel result of a computation.
+const double TOLERANCE = 1e-5;
+
+//! Computes a result once serially and once in parallel and compares the two.
+int compareWithSerial(const std::string& name, const boost::function<cv::Mat ()>& compute)
+{
+  std::cout << "Comparing the parallel and the serial result of " << name << "." << std::endl;
+
+  cedar::aux::setParallelForSlicesMinimumWork(SIZE_MAX);
+  cv::Mat serial = compute().clone();
+  cedar::aux::setParallelForSlicesMinimumWork(cedar::aux::PARALLEL_FOR_SLICES_MINIMUM_WORK);
+  cv::Mat parallel = compute();
+
+  if (serial.dims != parallel.dims || serial.size != parallel.size || serial.type() != parallel.type())
+  {
+    std::cout << "ERROR: the parallel result has a different size or type than the serial one." << std::endl;
+    return 1;
+  }
+
+  if (serial.total() < cedar::aux::PARALLEL_FOR_SLICES_MINIMUM_WORK)
+  {
+    std::cout << "ERROR: the result is too small to be computed in parallel." << std::endl;
+    return 1;
+  }
+
+  double difference = cv::norm(serial, parallel, cv::NORM_INF);
+  if (difference > TOLERANCE)
+  {
+    std::cout << "ERROR: the results differ by " << difference << "." << std::endl;
+    return 1;
+  }
+  return 0;
+}
+
+int main(int, char**)
+{
+  // the number of errors encountered in this test
+  int errors = 0;
+
+  std::cout << "OpenCV uses " << cv::getNumThreads() << " thread(s)." << std::endl;
+
+  // well above the work below which slices are processed serially
+  int sizes[3] = {40, 40, 30};
+  cv::Mat matrix(3, sizes, CV_32F);
+  cv::randu(matrix, cv::Scalar(0), cv::Scalar(1));
+  cedar::aux::MatDataPtr input(new cedar::aux::MatData(matrix));
+
+  {
+    cedar::aux::conv::OpenCVPtr engine(new cedar::aux::conv::OpenCV());
+    cedar::aux::conv::KernelListPtr kernels(new cedar::aux::conv::KernelList());
+    kernels->append(cedar::aux::kernel::GaussPtr(new cedar::aux::kernel::Gauss(3, 1.0, 2.0, 0.0, 3.0)));
+    engine->setKernelList(kernels);
+    errors += compareWithSerial
+              (
+                "the separable 3D convolution",
+                [&]() { return engine->convolve(matrix, cedar::aux::conv::BorderType::Zero); }
+              );
+
+    int kernel_sizes[3] = {5, 5, 5};
+    cv::Mat kernel(3, kernel_sizes, CV_32F);
+    cv::randu(kernel, cv::Scalar(-1), cv::Scalar(1));
+    errors += compareWithSerial
+              (
+                "the 3D convolution",
+                [&]() { return engine->convolve(matrix, kernel, cedar::aux::conv::BorderType::Reflect); }
+              );
+  }
+
+  for (int dimension = 0; dimension < 3; ++dimension)
+  {
+    for (int reduction : {CEDAR_OPENCV_CONSTANT(REDUCE_SUM), CEDAR_OPENCV_CONSTANT(REDUCE_MAX)})
+    {
+      errors += compareWithSerial
+                (
+                  "the 3D reduction along dimension " + cedar::aux::toString(dimension),
+                  [&]()
+                  {
+                    cv::Mat reduced;
+                    cedar::aux::math::reduceCvMat3D<float>(matrix, reduced, dimension, reduction);
+                    return reduced;
+                  }
+                );
+    }
+  }
+
+  for (unsigned int dimension = 0; dimension < 3; ++dimension)
+  {
+    errors += compareWithSerial
+              (
+                "the coordinate transformation sliced along dimension " + cedar::aux::toString(dimension),
+                [&]()
+                {
+                  // a new step for every run, so that the computation is never skipped
+                  cedar::proc::steps::CoordinateTransformationPtr step
+                  (
+                    new cedar::proc::steps::CoordinateTransformation()
+                  );
+                  step->getParameter<cedar::aux::UIntParameter>("sliced dimension")->setValue(dimension);
+                  step->setInput("input", input);
+                  step->onTrigger();
+                  return step->getOutput("result")->getData<cv::Mat>().clone();
+                }
+              );
+  }
+
+  errors += compareWithSerial
+            (
+              "the 3D resizing",
+              [&]()
+              {
+                cedar::proc::steps::ResizePtr step(new cedar::proc::steps::Resize());
+                step->setInput("input", input);
+                step->setOutputSize(0, 50);
+                step->setOutputSize(1, 45);
+                step->setOutputSize(2, 40);
+                step->onTrigger();
+                return step->getOutput("output")->getData<cv::Mat>().clone();
+              }
+            );
+
+  std::cout << "Test finished with " << errors << " error(s)." << std::endl;
+  return errors;
+}
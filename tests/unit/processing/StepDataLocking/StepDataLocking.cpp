@@ -36,6 +36,7 @@
 
 // CEDAR INCLUDES
 #include "cedar/processing/Step.h"
+#include "cedar/processing/ExternalData.h"
 #include "cedar/auxiliaries/MatData.h"
 #include "cedar/auxiliaries/CallFunctionInThread.h"
 
@@ -50,6 +51,7 @@ class TestStep : public cedar::proc::Step
     :
     mErrors(0),
     mInput(new cedar::aux::MatData()),
+    mPublishedInput(new cedar::aux::MatData()),
     mBuffer(new cedar::aux::MatData()),
     mOutput(new cedar::aux::MatData())
     {
@@ -57,6 +59,12 @@ class TestStep : public cedar::proc::Step
       // because we don't use a network here, we manually set some input data
       this->setInput("input", this->mInput);
 
+      // publishing data connected to a slot that reads snapshots must not be locked
+      auto snapshot_slot = this->declareInput("snapshot input");
+      boost::static_pointer_cast<cedar::proc::ExternalData>(snapshot_slot)->setReadsSnapshots(true);
+      this->mPublishedInput->setPublishing(true);
+      this->setInput("snapshot input", this->mPublishedInput);
+
       this->declareBuffer("buffer", this->mBuffer);
 
       this->declareOutput("output", this->mOutput);
@@ -79,6 +87,18 @@ class TestStep : public cedar::proc::Step
         std::cout << "Passed: input write lock could not be acquired." << std::endl;
       }
 
+      auto& published_lock = this->mPublishedInput->getLock();
+      if (published_lock.tryLockForWrite())
+      {
+        std::cout << "Passed: write lock of published input acquired successfully." << std::endl;
+        published_lock.unlock();
+      }
+      else
+      {
+        std::cout << "ERROR: write lock of published input could not be acquired." << std::endl;
+        ++mErrors;
+      }
+
       auto& buf_lock = this->mBuffer->getLock();
       if (buf_lock.tryLockForWrite())
       {
@@ -103,6 +123,7 @@ class TestStep : public cedar::proc::Step
     }
 
     cedar::aux::MatDataPtr mInput;
+    cedar::aux::MatDataPtr mPublishedInput;
     cedar::aux::MatDataPtr mBuffer;
     cedar::aux::MatDataPtr mOutput;
 };
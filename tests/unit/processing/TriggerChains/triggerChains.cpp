@@ -40,6 +40,7 @@
 #include "cedar/processing/Group.h"
 #include "cedar/processing/Step.h"
 #include "cedar/processing/Trigger.h"
+#include "cedar/processing/LoopedTrigger.h"
 #include "cedar/auxiliaries/DataTemplate.h"
 #include "cedar/auxiliaries/CallFunctionInThread.h"
 #include "cedar/auxiliaries/stringFunctions.h"
@@ -51,6 +52,7 @@
 #include <QCoreApplication>
 #include <boost/make_shared.hpp>
 #include <limits.h>
+#include <atomic>
 
 
 // ---------------------------------------------------------------------------------------------------------------------
@@ -144,6 +146,42 @@ public:
 
 CEDAR_GENERATE_POINTER_TYPES(TriggerTest);
 
+//! A looped step that takes a fixed time to compute.
+class SlowLoopedStep : public cedar::proc::Step
+{
+public:
+  SlowLoopedStep()
+  :
+  cedar::proc::Step(true),
+  mTriggerCount(0)
+  {
+  }
+
+  void compute(const cedar::proc::Arguments&)
+  {
+    unsigned int running = ++mRunning;
+    unsigned int maximum = mMaximumRunning;
+    while (running > maximum && !mMaximumRunning.compare_exchange_weak(maximum, running))
+    {
+    }
+
+    cedar::aux::sleep(cedar::unit::Time(0.1 * cedar::unit::seconds));
+    ++mTriggerCount;
+    --mRunning;
+  }
+
+  unsigned int mTriggerCount;
+
+  //! Number of SlowLoopedSteps currently computing, and the largest number seen so far.
+  static std::atomic<unsigned int> mRunning;
+  static std::atomic<unsigned int> mMaximumRunning;
+};
+
+std::atomic<unsigned int> SlowLoopedStep::mRunning(0);
+std::atomic<unsigned int> SlowLoopedStep::mMaximumRunning(0);
+
+CEDAR_GENERATE_POINTER_TYPES(SlowLoopedStep);
+
 int global_errors = 0;
 int num_superfluous_triggers = 0;
 
@@ -326,6 +364,48 @@ void test_disconnecting()
 }
 
 
+void test_parallel_looped_trigger()
+{
+  std::cout << "=================================================" << std::endl;
+  std::cout << " Checking parallel listeners of a looped trigger" << std::endl;
+  std::cout << "=================================================" << std::endl << std::endl;
+
+  cedar::proc::GroupPtr group(new cedar::proc::Group());
+  auto step1 = boost::make_shared<SlowLoopedStep>();
+  auto step2 = boost::make_shared<SlowLoopedStep>();
+  auto trigger = boost::make_shared<cedar::proc::LoopedTrigger>();
+  group->add(step1, "slow1");
+  group->add(step2, "slow2");
+  group->add(trigger, "trigger");
+  group->connectTrigger(trigger, step1);
+  group->connectTrigger(trigger, step2);
+
+  trigger->step(cedar::unit::Time(0.01 * cedar::unit::seconds));
+  if (SlowLoopedStep::mMaximumRunning != 1)
+  {
+    ++global_errors;
+    std::cout << "Without parallel execution, " << SlowLoopedStep::mMaximumRunning
+              << " listeners of the looped trigger computed at the same time." << std::endl;
+  }
+
+  trigger->setParallelExecution(true);
+  trigger->step(cedar::unit::Time(0.01 * cedar::unit::seconds));
+
+  if (step1->mTriggerCount != 2 || step2->mTriggerCount != 2)
+  {
+    ++global_errors;
+    std::cout << "The looped steps were triggered " << step1->mTriggerCount << " and " << step2->mTriggerCount
+              << " times instead of twice." << std::endl;
+  }
+
+  // the trigger waits for all listeners, so the steps overlap however long the machine takes for each of them
+  if (SlowLoopedStep::mMaximumRunning < 2)
+  {
+    ++global_errors;
+    std::cout << "The listeners of the looped trigger were not executed in parallel." << std::endl;
+  }
+}
+
 void run_test()
 {
   using cedar::proc::Group;
@@ -354,6 +434,36 @@ void run_test()
     test_group(group);
   }
 
+  {
+    std::cout << "=================================================" << std::endl;
+    std::cout << " Checking network configuration 1 (in parallel)" << std::endl;
+    std::cout << "=================================================" << std::endl << std::endl;
+
+    GroupPtr group(new Group());
+    group->add(boost::make_shared<TriggerTest>(), "step1");
+    group->add(boost::make_shared<TriggerTest>(), "step2");
+    group->add(boost::make_shared<TriggerTest>(), "step3");
+    group->add(boost::make_shared<TriggerTest>(), "step4");
+
+    group->connectSlots("step1.out", "step2.in1");
+    group->connectSlots("step1.out", "step3.in1");
+    group->connectSlots("step2.out", "step4.in1");
+    group->connectSlots("step3.out", "step4.in2");
+
+    // step2 and step3 have the same depth and are thus executed in parallel; step4 must still come after both
+    for (const auto& name_element_pair : group->getElements())
+    {
+      if (auto step = boost::dynamic_pointer_cast<TriggerTest>(name_element_pair.second))
+      {
+        step->getFinishedTrigger()->setParallelExecution(true);
+      }
+    }
+
+    test_group(group);
+  }
+
+  test_parallel_looped_trigger();
+
   test_disconnecting();
 }
 
@@ -0,0 +1,138 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        step_GaussInput.cpp
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 18
+
+    Description: Unit test for the cedar::proc::sources::GaussInput class.
+
+    Credits:
+
+======================================================================================================================*/
+
+// CEDAR INCLUDES
+#include "cedar/processing/sources/GaussInput.h"
+#include "cedar/auxiliaries/DoubleVectorParameter.h"
+#include "cedar/auxiliaries/MatData.h"
+#include "cedar/auxiliaries/math/functions.h"
+
+// SYSTEM INCLUDES
+#include <iostream>
+#include <cmath>
+
+int testSeparableGaussMatrix()
+{
+  int errors = 0;
+  std::cout << "Testing the values of a 3D Gauss matrix." << std::endl;
+
+  std::vector<unsigned int> sizes = {7, 5, 4};
+  std::vector<double> sigmas = {1.5, 2.0, 0.75};
+  std::vector<double> centers = {3.0, 1.0, 2.5};
+  double amplitude = 2.0;
+  cv::Mat gauss = cedar::aux::math::gaussMatrix(3, sizes, amplitude, sigmas, centers, false);
+
+  if (gauss.dims != 3 || gauss.size[0] != 7 || gauss.size[1] != 5 || gauss.size[2] != 4)
+  {
+    ++errors;
+    std::cout << "ERROR: Gauss matrix has the wrong size." << std::endl;
+    return errors;
+  }
+
+  for (int i = 0; i < 7; ++i)
+  {
+    for (int j = 0; j < 5; ++j)
+    {
+      for (int k = 0; k < 4; ++k)
+      {
+        double expected = amplitude
+                          * cedar::aux::math::gauss(i - centers.at(0), sigmas.at(0))
+                          * cedar::aux::math::gauss(j - centers.at(1), sigmas.at(1))
+                          * cedar::aux::math::gauss(k - centers.at(2), sigmas.at(2));
+        int position[] = {i, j, k};
+        double value = gauss.at<float>(position);
+        if (std::abs(value - expected) > 1e-5)
+        {
+          ++errors;
+          std::cout << "ERROR: entry (" << i << ", " << j << ", " << k << "): "
+                    << value << " != " << expected << std::endl;
+        }
+      }
+    }
+  }
+
+  return errors;
+}
+
+int testCaching()
+{
+  int errors = 0;
+  std::cout << "Testing that the Gauss input is only recomputed when parameters change." << std::endl;
+
+  cedar::proc::sources::GaussInputPtr gauss(new cedar::proc::sources::GaussInput());
+  auto output = boost::dynamic_pointer_cast<cedar::aux::ConstMatData>(gauss->getOutput("Gauss input"));
+
+  gauss->onTrigger();
+  unsigned long revision = output->getRevision();
+  gauss->onTrigger();
+  gauss->onTrigger();
+
+  if (output->getRevision() != revision)
+  {
+    ++errors;
+    std::cout << "ERROR: The output was republished although no parameter changed." << std::endl;
+  }
+
+  double max_before = output->getSnapshot()->mData.at<float>(24, 24);
+  gauss->setAmplitude(3.0);
+  gauss->onTrigger();
+
+  if (output->getRevision() == revision)
+  {
+    ++errors;
+    std::cout << "ERROR: Changing the amplitude did not publish a new output." << std::endl;
+  }
+
+  double max_after = output->getSnapshot()->mData.at<float>(24, 24);
+  if (std::abs(max_after - 3.0 * max_before) > 1e-5)
+  {
+    ++errors;
+    std::cout << "ERROR: The output was not recomputed: " << max_after << " != " << 3.0 * max_before << std::endl;
+  }
+
+  return errors;
+}
+
+int main(int, char**)
+{
+  int errors = 0;
+
+  errors += testSeparableGaussMatrix();
+  errors += testCaching();
+
+  std::cout << "Test finished with " << errors << " error(s)." << std::endl;
+  return errors;
+}
@@ -0,0 +1,162 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        step_Delay.cpp
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 18
+
+    Description: Tests for the Delay step.
+
+    Credits:
+
+======================================================================================================================*/
+
+// CEDAR INCLUDES
+#include "cedar/processing/steps/Delay.h"
+#include "cedar/auxiliaries/GlobalClock.h"
+#include "cedar/auxiliaries/EnumParameter.h"
+#include "cedar/auxiliaries/UIntParameter.h"
+#include "cedar/auxiliaries/TimeParameter.h"
+#include "cedar/auxiliaries/MatData.h"
+
+// SYSTEM INCLUDES
+#include <iostream>
+#include <cmath>
+
+int checkOutput(cedar::proc::steps::DelayPtr delay, float expected, const std::string& context)
+{
+  auto output = boost::dynamic_pointer_cast<cedar::aux::ConstMatData>(delay->getOutput("output"));
+  float value = output->getData().at<float>(1, 1);
+  if (std::abs(value - expected) > 1e-5)
+  {
+    std::cout << "ERROR: " << context << ": output is " << value << ", expected " << expected << "." << std::endl;
+    return 1;
+  }
+  return 0;
+}
+
+void step(cedar::proc::steps::DelayPtr delay, cedar::aux::MatDataPtr input, float value, double milliseconds)
+{
+  cedar::aux::GlobalClockSingleton::getInstance()->addTime
+  (
+    cedar::unit::Time(milliseconds * cedar::unit::milli * cedar::unit::seconds)
+  );
+  input->getData().setTo(value);
+  delay->onTrigger();
+}
+
+int testStepDelay()
+{
+  std::cout << "Testing delays in steps." << std::endl;
+  int errors = 0;
+
+  cedar::aux::MatDataPtr input(new cedar::aux::MatData(cv::Mat::zeros(3, 3, CV_32F)));
+  cedar::proc::steps::DelayPtr delay(new cedar::proc::steps::Delay());
+  delay->setInput("input", input);
+  boost::dynamic_pointer_cast<cedar::aux::UIntParameter>(delay->getParameter("delay steps"))->setValue(3);
+
+  if (delay->getBufferCapacity() != 4)
+  {
+    ++errors;
+    std::cout << "ERROR: buffer capacity is " << delay->getBufferCapacity() << ", expected 4." << std::endl;
+  }
+
+  for (unsigned int i = 1; i <= 10; ++i)
+  {
+    step(delay, input, static_cast<float>(i), 1.0);
+    // until three inputs are buffered, the oldest input is used
+    errors += checkOutput(delay, static_cast<float>(i > 3 ? i - 3 : 1), "delay of 3 steps");
+  }
+
+  return errors;
+}
+
+int testTimeDelay(cedar::aux::EnumId interpolation)
+{
+  std::cout << "Testing delays in time with "
+            << cedar::proc::steps::Delay::Interpolation::type().get(interpolation).prettyString()
+            << " interpolation." << std::endl;
+  int errors = 0;
+
+  cedar::aux::MatDataPtr input(new cedar::aux::MatData(cv::Mat::zeros(3, 3, CV_32F)));
+  cedar::proc::steps::DelayPtr delay(new cedar::proc::steps::Delay());
+  delay->setInput("input", input);
+  boost::dynamic_pointer_cast<cedar::aux::EnumParameter>(delay->getParameter("delay unit"))->setValue
+  (
+    cedar::proc::steps::Delay::DelayUnit::TIME
+  );
+  boost::dynamic_pointer_cast<cedar::aux::EnumParameter>(delay->getParameter("interpolation"))->setValue
+  (
+    interpolation
+  );
+  boost::dynamic_pointer_cast<cedar::aux::TimeParameter>(delay->getParameter("delay time"))->setValue
+  (
+    cedar::unit::Time(24.0 * cedar::unit::milli * cedar::unit::seconds)
+  );
+  boost::dynamic_pointer_cast<cedar::aux::UIntParameter>(delay->getParameter("buffer size"))->setValue(10);
+
+  // the input equals the time (in ms) since the first step, which is taken in steps of 10 ms
+  for (unsigned int i = 0; i <= 6; ++i)
+  {
+    step(delay, input, static_cast<float>(10 * i), 10.0);
+  }
+  // now at 60 ms: 36 ms lies between the inputs stored at 30 ms and 40 ms
+  bool linear = interpolation == cedar::proc::steps::Delay::Interpolation::LINEAR;
+  errors += checkOutput(delay, linear ? 36.0 : 40.0, "24 ms delay with steps of 10 ms");
+
+  // a shorter step; now at 64 ms: 40 ms is an input that was stored
+  step(delay, input, 64.0, 4.0);
+  errors += checkOutput(delay, 40.0, "24 ms delay after a step of 4 ms");
+
+  // a longer step; now at 85 ms: 61 ms lies between the inputs stored at 60 ms and 64 ms
+  step(delay, input, 85.0, 21.0);
+  errors += checkOutput(delay, linear ? 61.0 : 60.0, "24 ms delay after a step of 21 ms");
+
+  // now at 95 ms: 71 ms lies between the inputs stored at 64 ms and 85 ms
+  step(delay, input, 95.0, 10.0);
+  errors += checkOutput(delay, linear ? 71.0 : 64.0, "24 ms delay after a step of 10 ms");
+
+  // a buffer that is too short for the delay provides its oldest frame
+  boost::dynamic_pointer_cast<cedar::aux::UIntParameter>(delay->getParameter("buffer size"))->setValue(2);
+  step(delay, input, 105.0, 10.0);
+  step(delay, input, 115.0, 10.0);
+  step(delay, input, 125.0, 10.0);
+  errors += checkOutput(delay, 115.0, "24 ms delay with a buffer of two frames");
+
+  return errors;
+}
+
+int main(int, char**)
+{
+  int errors = 0;
+
+  errors += testStepDelay();
+  errors += testTimeDelay(cedar::proc::steps::Delay::Interpolation::NEAREST);
+  errors += testTimeDelay(cedar::proc::steps::Delay::Interpolation::LINEAR);
+
+  std::cout << "Test finished with " << errors << " error(s)." << std::endl;
+  return errors;
+}
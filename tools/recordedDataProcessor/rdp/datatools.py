@@ -41,6 +41,7 @@
 import csv
 import numpy as np
 import re
+import struct
 import wx
 import rdp
 import recorded_data_processor
@@ -68,8 +69,89 @@ def prepare_plot_configuration(directory, x_label, y_label, z_label, marked, ste
     return save_object
 
 
+# Mapping from OpenCV depths to numpy types; the depth is stored in the lowest three bits of the type
+OPENCV_DEPTHS = {0: ('CV_8U', np.uint8), 1: ('CV_8S', np.int8), 2: ('CV_16U', np.uint16), 3: ('CV_16S', np.int16),
+                 4: ('CV_32S', np.int32), 5: ('CV_32F', np.float32), 6: ('CV_64F', np.float64)}
+
+
+def read_binary_recording(bin_f):
+    '''Reads the header and chunk layout of a binary recording (see cedar::aux::BinaryRecording).
+
+    Returns the matrix type, the sizes, the time stamps and a memory-mapped array holding all frames.'''
+
+    raw = np.memmap(bin_f, dtype=np.uint8, mode='r')
+
+    if raw[:8].tostring() != b'CEDARREC':
+        raise IOError(bin_f + ' is not a binary recording.')
+
+    version, header_size, mat_type, ndims = struct.unpack('<IIii', raw[8:24].tostring())
+    sizes = list(struct.unpack('<' + 'i' * ndims, raw[24:24 + 4 * ndims].tostring()))
+    frame_size = struct.unpack('<Q', raw[24 + 4 * ndims:32 + 4 * ndims].tostring())[0]
+
+    depth, dtype = OPENCV_DEPTHS[mat_type & 7]
+    channels = (mat_type >> 3) + 1
+    shape = sizes + ([channels] if channels > 1 else [])
+
+    time_stamps = []
+    frames = []
+    position = header_size
+
+    while position + 8 <= len(raw) and raw[position:position + 4].tostring() == b'CHNK':
+        count = struct.unpack('<I', raw[position + 4:position + 8].tostring())[0]
+        stamps_start = position + 8
+        frames_start = stamps_start + 8 * count
+        frames_end = frames_start + count * frame_size
+
+        # incomplete chunks (e.g., after a crash) end the recording
+        if frames_end > len(raw):
+            break
+
+        time_stamps.extend(np.frombuffer(raw[stamps_start:frames_start], dtype=np.float64))
+        frames.append(np.ndarray(shape=[count] + shape, dtype=dtype, buffer=raw, offset=frames_start))
+        position = frames_start + ((count * frame_size + 7) // 8) * 8
+
+    return mat_type, sizes, time_stamps, frames
+
+
+def get_binary_header(bin_f):
+    '''Gets a header in the same format as for csv files from the given binary recording.'''
+
+    raw = np.memmap(bin_f, dtype=np.uint8, mode='r')
+    mat_type, ndims = struct.unpack('<ii', raw[16:24].tostring())
+    sizes = struct.unpack('<' + 'i' * ndims, raw[24:24 + 4 * ndims].tostring())
+    depth = OPENCV_DEPTHS[mat_type & 7][0]
+    channels = (mat_type >> 3) + 1
+
+    if channels > 1:
+        depth += 'C' + str(channels)
+
+    return ['Mat', depth] + [str(size) for size in sizes]
+
+
+def get_binary_data(bin_f):
+    '''Gets data and time codes from given binary recording, arranged like the data read from csv files.'''
+
+    mat_type, sizes, time_stamps, chunks = read_binary_recording(bin_f)
+
+    # csv files list the entries with the first index running fastest (i.e., in Fortran order), channels innermost
+    if (mat_type >> 3) > 0:
+        rows = [np.rollaxis(frame, -1).ravel(order='F') for chunk in chunks for frame in chunk]
+    else:
+        rows = [frame.ravel(order='F') for chunk in chunks for frame in chunk]
+
+    if len(rows) > 0:
+        data = np.vstack(rows).astype(np.float64)
+    else:
+        data = np.zeros((0, int(np.prod(sizes))))
+
+    return data, [str(time_stamp) + ' s' for time_stamp in time_stamps]
+
+
 def get_csv_header(csv_f):
     '''Gets header from given csv file.'''
+
+    if csv_f.endswith('.bin'):
+        return get_binary_header(csv_f)
     
     csv_file = open(csv_f, 'rb')   
     reader = csv.reader(csv_file)
@@ -84,6 +166,10 @@ def get_csv_header(csv_f):
 
 def get_csv_data(csv_f, header):
     '''Gets data and time codes from given csv file.'''
+
+    if csv_f.endswith('.bin'):
+        return get_binary_data(csv_f)
+
     time_stamps = []
     data = None
     count = 0